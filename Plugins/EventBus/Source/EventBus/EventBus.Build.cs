@@ -13,8 +13,18 @@ public class EventBus : ModuleRules
 			{
 				"Core",
 				"CoreUObject",
+				"DeveloperSettings",
 				"Engine",
-				"GameplayTags"
+				"GameplayTags",
+				"TraceLog"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Json",
+				"Projects"
 			}
 		);
 	}
@@ -0,0 +1,149 @@
+#include "EventBus/BP/EventBusBlueprintDiagnostics.h"
+
+#include "Containers/StaticArray.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+
+namespace Nfrrlib::EventBus
+{
+	namespace
+	{
+		TAutoConsoleVariable<int32> CVarBlueprintLogMode(
+			TEXT("EventBus.BP.LogMode"),
+			1,
+			TEXT("Blueprint facade request/result logging: 0 = counters only, 1 = sampled, 2 = every call. Compiled out in Shipping."));
+
+		TAutoConsoleVariable<int32> CVarBlueprintLogSampleInterval(
+			TEXT("EventBus.BP.LogSampleInterval"),
+			256,
+			TEXT("In sampled mode, log the first call and then one call in this many per Blueprint facade entry point."));
+
+		/** @brief Per-entry-point counters indexed by EEventBusBlueprintApi. */
+		TStaticArray<FEventBusBlueprintApiCounters, static_cast<int32>(EEventBusBlueprintApi::Count)> GApiCounters;
+
+		FEventBusBlueprintApiCounters& GetMutableCounters(const EEventBusBlueprintApi Api)
+		{
+			return GApiCounters[static_cast<int32>(Api)];
+		}
+	} // namespace
+
+	/**
+	 * @brief Converts facade entry points into stable diagnostic strings.
+	 */
+	const TCHAR* LexToString(const EEventBusBlueprintApi Api)
+	{
+		switch (Api)
+		{
+		case EEventBusBlueprintApi::RegisterChannel:
+			return TEXT("RegisterChannel");
+		case EEventBusBlueprintApi::UnregisterChannel:
+			return TEXT("UnregisterChannel");
+		case EEventBusBlueprintApi::AddPublisher:
+			return TEXT("AddPublisher");
+		case EEventBusBlueprintApi::RemovePublisher:
+			return TEXT("RemovePublisher");
+		case EEventBusBlueprintApi::AddListener:
+			return TEXT("AddListener");
+		case EEventBusBlueprintApi::RemoveListener:
+			return TEXT("RemoveListener");
+		case EEventBusBlueprintApi::GetKnownListenerFunctions:
+			return TEXT("GetKnownListenerFunctions");
+		case EEventBusBlueprintApi::RecordPublisherBinding:
+			return TEXT("RecordPublisherBinding");
+		case EEventBusBlueprintApi::RecordListenerBinding:
+			return TEXT("RecordListenerBinding");
+		case EEventBusBlueprintApi::AddPublisherBindings:
+			return TEXT("AddPublisherBindings");
+		case EEventBusBlueprintApi::AddListenerBindings:
+			return TEXT("AddListenerBindings");
+		case EEventBusBlueprintApi::RemoveListenerBindings:
+			return TEXT("RemoveListenerBindings");
+		default:
+			return TEXT("Unknown");
+		}
+	}
+
+	/**
+	 * @brief Counts the call and applies the active logging tier to it.
+	 */
+	bool FEventBusBlueprintDiagnostics::BeginCall(const EEventBusBlueprintApi Api)
+	{
+		FEventBusBlueprintApiCounters& Counters = GetMutableCounters(Api);
+		++Counters.Calls;
+
+		const bool bLogCall = ShouldLogCall(Counters.Calls, GetLogMode(), CVarBlueprintLogSampleInterval.GetValueOnGameThread());
+		Counters.LoggedCalls += bLogCall ? 1 : 0;
+		return bLogCall;
+	}
+
+	void FEventBusBlueprintDiagnostics::EndCall(const EEventBusBlueprintApi Api, const bool bSucceeded)
+	{
+		GetMutableCounters(Api).Failures += bSucceeded ? 0 : 1;
+	}
+
+	FEventBusBlueprintApiCounters FEventBusBlueprintDiagnostics::GetCounters(const EEventBusBlueprintApi Api)
+	{
+		return GetMutableCounters(Api);
+	}
+
+	void FEventBusBlueprintDiagnostics::ResetCounters()
+	{
+		for (FEventBusBlueprintApiCounters& Counters : GApiCounters)
+		{
+			Counters = FEventBusBlueprintApiCounters();
+		}
+	}
+
+	/**
+	 * @brief Prints calls, failures and logged calls per entry point.
+	 */
+	void FEventBusBlueprintDiagnostics::DumpCounters(FOutputDevice& Ar)
+	{
+		Ar.Logf(TEXT("%-28s %12s %12s %12s"), TEXT("Api"), TEXT("Calls"), TEXT("Failures"), TEXT("Logged"));
+		for (int32 Index = 0; Index < static_cast<int32>(EEventBusBlueprintApi::Count); ++Index)
+		{
+			const FEventBusBlueprintApiCounters& Counters = GApiCounters[Index];
+			Ar.Logf(TEXT("%-28s %12llu %12llu %12llu"),
+				LexToString(static_cast<EEventBusBlueprintApi>(Index)),
+				Counters.Calls,
+				Counters.Failures,
+				Counters.LoggedCalls);
+		}
+		Ar.Logf(TEXT("LogMode=%d SampleInterval=%d Compiled=%d"),
+			static_cast<int32>(GetLogMode()),
+			CVarBlueprintLogSampleInterval.GetValueOnGameThread(),
+			NFL_EVENTBUS_FACADE_LOGGING);
+	}
+
+	/**
+	 * @brief Clamps the cvar into the known tiers.
+	 */
+	EEventBusBlueprintLogMode FEventBusBlueprintDiagnostics::GetLogMode()
+	{
+#if NFL_EVENTBUS_FACADE_LOGGING
+		const int32 Mode = FMath::Clamp(
+			CVarBlueprintLogMode.GetValueOnGameThread(),
+			static_cast<int32>(EEventBusBlueprintLogMode::Off),
+			static_cast<int32>(EEventBusBlueprintLogMode::Verbose));
+		return static_cast<EEventBusBlueprintLogMode>(Mode);
+#else
+		return EEventBusBlueprintLogMode::Off;
+#endif
+	}
+
+	/**
+	 * @brief Sampled mode logs call 1, 1 + Interval, 1 + 2 * Interval, ...
+	 */
+	bool FEventBusBlueprintDiagnostics::ShouldLogCall(const uint64 CallIndex, const EEventBusBlueprintLogMode Mode, const int32 SampleInterval)
+	{
+		switch (Mode)
+		{
+		case EEventBusBlueprintLogMode::Verbose:
+			return true;
+		case EEventBusBlueprintLogMode::Sampled:
+			return CallIndex > 0 && (CallIndex - 1) % static_cast<uint64>(FMath::Max(SampleInterval, 1)) == 0;
+		default:
+			return false;
+		}
+	}
+} // namespace Nfrrlib::EventBus
@@ -3,6 +3,7 @@
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
 
+#include "EventBus/BP/EventBusBlueprintDiagnostics.h"
 #include "EventBus/BP/EventBusRegistryAsset.h"
 #include "EventBus/BP/EventBusSubsystem.h"
 #include "EventBus/Core/EventBus.h"
@@ -11,6 +12,9 @@ namespace
 {
 	/**
 	 * @brief Shared subsystem lookup helper used by all Blueprint runtime entry points.
+	 *
+	 * Repeated calls from the same world hit the subsystem's per-world cache; the engine, game-instance and
+	 * subsystem lookups only run on the first call per world.
 	 */
 	FORCEINLINE UEventBusSubsystem* ResolveEventBusSubsystem(UObject* WorldContextObject)
 	{
@@ -21,6 +25,11 @@ namespace
 			return nullptr;
 		}
 
+		if (UEventBusSubsystem* const CachedSubsystem = UEventBusSubsystem::FindCachedForWorld(WorldContextObject->GetWorld()))
+		{
+			return CachedSubsystem;
+		}
+
 		if (!GEngine)
 		{
 			UE_LOG(LogNFLEventBus, Warning,
@@ -55,6 +64,7 @@ namespace
 			return nullptr;
 		}
 
+		UEventBusSubsystem::CacheForWorld(World, Subsystem);
 		return Subsystem;
 	}
 
@@ -67,7 +77,7 @@ namespace
 		UObject* PublisherObj,
 		const FName DelegatePropertyName)
 	{
-		if (!::IsValid(Subsystem) || !::IsValid(PublisherObj))
+		if (!UEventBusRegistryAsset::IsRecordingEnabled() || !::IsValid(Subsystem) || !::IsValid(PublisherObj))
 		{
 			return;
 		}
@@ -88,7 +98,7 @@ namespace
 		UObject* ListenerObj,
 		const FName FunctionName)
 	{
-		if (!::IsValid(Subsystem) || !::IsValid(ListenerObj))
+		if (!UEventBusRegistryAsset::IsRecordingEnabled() || !::IsValid(Subsystem) || !::IsValid(ListenerObj))
 		{
 			return;
 		}
@@ -137,9 +147,12 @@ namespace
 		const FGameplayTag& ChannelTag,
 		UObject* PublisherObj,
 		const FName DelegatePropertyName,
-		const TCHAR* ApiName)
+		const TCHAR* ApiName,
+		FEventBusBindingHandle* OutHandle = nullptr,
+		const FEventBusBindingToken* Token = nullptr)
 	{
-		UE_LOG(LogNFLEventBus, Log,
+		Nfrrlib::EventBus::FScopedBlueprintCall Call(Nfrrlib::EventBus::EEventBusBlueprintApi::AddPublisher);
+		NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
 			TEXT("BP %s request. Channel=%s Publisher=%s Delegate=%s"),
 			ApiName,
 			*ChannelTag.ToString(),
@@ -162,14 +175,26 @@ namespace
 
 		Nfrrlib::EventBus::FPublisherBinding Binding;
 		Binding.DelegatePropertyName = DelegatePropertyName;
+		if (Token)
+		{
+			Binding.ResolvedDelegateProperty = Token->DelegateProperty.Get();
+		}
 
-		const bool bResult = Subsystem->GetEventBus().AddPublisher(ChannelTag, PublisherObj, Binding);
+		const bool bResult = Call.SetSucceeded(Subsystem->GetEventBus().AddPublisher(ChannelTag, PublisherObj, Binding));
 		if (bResult)
 		{
 			RecordPublisherHistory(Subsystem, ChannelTag, PublisherObj, DelegatePropertyName);
+			if (OutHandle)
+			{
+				OutHandle->Subsystem = Subsystem;
+				OutHandle->ChannelTag = ChannelTag;
+				OutHandle->BoundObject = PublisherObj;
+				OutHandle->MemberName = DelegatePropertyName;
+				OutHandle->bIsListener = false;
+			}
 		}
 
-		UE_LOG(LogNFLEventBus, Log,
+		NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
 			TEXT("BP %s result. Channel=%s Publisher=%s Delegate=%s Success=%s"),
 			ApiName,
 			*ChannelTag.ToString(),
@@ -187,9 +212,12 @@ namespace
 		const FGameplayTag& ChannelTag,
 		UObject* ListenerObj,
 		const FName FunctionName,
-		const TCHAR* ApiName)
+		const TCHAR* ApiName,
+		FEventBusBindingHandle* OutHandle = nullptr,
+		const FEventBusBindingToken* Token = nullptr)
 	{
-		UE_LOG(LogNFLEventBus, Log,
+		Nfrrlib::EventBus::FScopedBlueprintCall Call(Nfrrlib::EventBus::EEventBusBlueprintApi::AddListener);
+		NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
 			TEXT("BP %s request. Channel=%s Listener=%s Function=%s"),
 			ApiName,
 			*ChannelTag.ToString(),
@@ -212,14 +240,27 @@ namespace
 
 		Nfrrlib::EventBus::FListenerBinding Binding;
 		Binding.FunctionName = FunctionName;
+		if (Token)
+		{
+			Binding.ResolvedFunction = Token->ListenerFunction;
+			Binding.ProvenSignature = Token->ProvenSignature;
+		}
 
-		const bool bResult = Subsystem->GetEventBus().AddListener(ChannelTag, ListenerObj, Binding);
+		const bool bResult = Call.SetSucceeded(Subsystem->GetEventBus().AddListener(ChannelTag, ListenerObj, Binding));
 		if (bResult)
 		{
 			RecordListenerHistory(Subsystem, ChannelTag, ListenerObj, FunctionName);
+			if (OutHandle)
+			{
+				OutHandle->Subsystem = Subsystem;
+				OutHandle->ChannelTag = ChannelTag;
+				OutHandle->BoundObject = ListenerObj;
+				OutHandle->MemberName = FunctionName;
+				OutHandle->bIsListener = true;
+			}
 		}
 
-		UE_LOG(LogNFLEventBus, Log,
+		NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
 			TEXT("BP %s result. Channel=%s Listener=%s Function=%s Success=%s"),
 			ApiName,
 			*ChannelTag.ToString(),
@@ -228,6 +269,88 @@ namespace
 			bResult ? TEXT("true") : TEXT("false"));
 		return bResult;
 	}
+
+	/**
+	 * @brief Inline capacity for bulk bind conversions; covers the channel count of typical large actors.
+	 */
+	constexpr int32 BulkBindingInlineCount = 32;
+
+	/**
+	 * @brief Resolves the subsystem and validates the bound object once for a bulk entry point.
+	 * Fills OutResults with failures and returns nullptr when the batch cannot run.
+	 */
+	UEventBusSubsystem* BeginBulkBinding(
+		UObject* WorldContextObject,
+		const TCHAR* ApiName,
+		const TCHAR* ObjectLabel,
+		UObject* BoundObject,
+		const int32 EntryCount,
+		TArray<bool>& OutResults)
+	{
+		UEventBusSubsystem* const Subsystem = ResolveEventBusSubsystem(WorldContextObject);
+		if (!::IsValid(Subsystem))
+		{
+			UE_LOG(LogNFLEventBus, Warning,
+				TEXT("BP %s denied: subsystem resolution failed."),
+				ApiName);
+			OutResults.Init(false, EntryCount);
+			return nullptr;
+		}
+
+		if (!::IsValid(BoundObject))
+		{
+			UE_LOG(LogNFLEventBus, Warning,
+				TEXT("BP %s denied: %s is invalid."),
+				ApiName,
+				ObjectLabel);
+			OutResults.Init(false, EntryCount);
+			return nullptr;
+		}
+
+		return Subsystem;
+	}
+
+	/**
+	 * @brief Shared implementation for bulk listener-add APIs; records history for each successful entry.
+	 */
+	int32 AddListenersInternal(
+		UObject* WorldContextObject,
+		UObject* ListenerObj,
+		const TConstArrayView<Nfrrlib::EventBus::FChannelListenerBinding> Bindings,
+		TArray<bool>& OutResults,
+		const TCHAR* ApiName)
+	{
+		Nfrrlib::EventBus::FScopedBlueprintCall Call(Nfrrlib::EventBus::EEventBusBlueprintApi::AddListenerBindings);
+		NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
+			TEXT("BP %s request. Listener=%s Count=%d"),
+			ApiName,
+			*GetNameSafe(ListenerObj),
+			Bindings.Num());
+
+		UEventBusSubsystem* const Subsystem = BeginBulkBinding(WorldContextObject, ApiName, TEXT("ListenerObj"), ListenerObj, Bindings.Num(), OutResults);
+		if (!Subsystem)
+		{
+			return 0;
+		}
+
+		const int32 SucceededCount = Subsystem->GetEventBus().AddListeners(ListenerObj, Bindings, OutResults);
+		Call.SetSucceeded(SucceededCount == Bindings.Num());
+		for (int32 Index = 0; Index < Bindings.Num(); ++Index)
+		{
+			if (OutResults[Index])
+			{
+				RecordListenerHistory(Subsystem, Bindings[Index].ChannelTag, ListenerObj, Bindings[Index].Binding.FunctionName);
+			}
+		}
+
+		NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
+			TEXT("BP %s result. Listener=%s Succeeded=%d Count=%d"),
+			ApiName,
+			*GetNameSafe(ListenerObj),
+			SucceededCount,
+			Bindings.Num());
+		return SucceededCount;
+	}
 }
 
 /**
@@ -238,7 +361,8 @@ bool UEventBusBlueprintLibrary::RegisterChannel(
 	const FGameplayTag ChannelTag,
 	const bool bOwnsPublisherDelegates)
 {
-	UE_LOG(LogNFLEventBus, Log,
+	Nfrrlib::EventBus::FScopedBlueprintCall Call(Nfrrlib::EventBus::EEventBusBlueprintApi::RegisterChannel);
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
 		TEXT("BP RegisterChannel request. Channel=%s bOwnsPublisherDelegates=%s"),
 		*ChannelTag.ToString(),
 		bOwnsPublisherDelegates ? TEXT("true") : TEXT("false"));
@@ -254,8 +378,8 @@ bool UEventBusBlueprintLibrary::RegisterChannel(
 	Nfrrlib::EventBus::FChannelRegistration Registration;
 	Registration.ChannelTag = ChannelTag;
 	Registration.bOwnsPublisherDelegates = bOwnsPublisherDelegates;
-	const bool bResult = Subsystem->GetEventBus().RegisterChannel(Registration);
-	UE_LOG(LogNFLEventBus, Log,
+	const bool bResult = Call.SetSucceeded(Subsystem->GetEventBus().RegisterChannel(Registration));
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
 		TEXT("BP RegisterChannel result. Channel=%s Success=%s"),
 		*ChannelTag.ToString(),
 		bResult ? TEXT("true") : TEXT("false"));
@@ -267,7 +391,8 @@ bool UEventBusBlueprintLibrary::RegisterChannel(
  */
 bool UEventBusBlueprintLibrary::UnregisterChannel(UObject* WorldContextObject, const FGameplayTag ChannelTag)
 {
-	UE_LOG(LogNFLEventBus, Log,
+	Nfrrlib::EventBus::FScopedBlueprintCall Call(Nfrrlib::EventBus::EEventBusBlueprintApi::UnregisterChannel);
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
 		TEXT("BP UnregisterChannel request. Channel=%s"),
 		*ChannelTag.ToString());
 
@@ -279,8 +404,8 @@ bool UEventBusBlueprintLibrary::UnregisterChannel(UObject* WorldContextObject, c
 		return false;
 	}
 
-	const bool bResult = Subsystem->GetEventBus().UnregisterChannel(ChannelTag);
-	UE_LOG(LogNFLEventBus, Log,
+	const bool bResult = Call.SetSucceeded(Subsystem->GetEventBus().UnregisterChannel(ChannelTag));
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
 		TEXT("BP UnregisterChannel result. Channel=%s Success=%s"),
 		*ChannelTag.ToString(),
 		bResult ? TEXT("true") : TEXT("false"));
@@ -304,6 +429,26 @@ bool UEventBusBlueprintLibrary::AddPublisherValidated(
 		TEXT("AddPublisherValidated"));
 }
 
+/**
+ * @brief Compiled filtered-node entry point; the token lets the core skip the delegate property lookup.
+ */
+bool UEventBusBlueprintLibrary::AddPublisherTrusted(
+	UObject* WorldContextObject,
+	const FGameplayTag ChannelTag,
+	UObject* PublisherObj,
+	const FName DelegatePropertyName,
+	const FEventBusBindingToken& Token)
+{
+	return AddPublisherInternal(
+		WorldContextObject,
+		ChannelTag,
+		PublisherObj,
+		DelegatePropertyName,
+		TEXT("AddPublisherTrusted"),
+		nullptr,
+		&Token);
+}
+
 /**
  * @brief Blueprint facade wrapper for publisher registration.
  */
@@ -326,7 +471,8 @@ bool UEventBusBlueprintLibrary::AddPublisher(
  */
 bool UEventBusBlueprintLibrary::RemovePublisher(UObject* WorldContextObject, const FGameplayTag ChannelTag, UObject* PublisherObj)
 {
-	UE_LOG(LogNFLEventBus, Log,
+	Nfrrlib::EventBus::FScopedBlueprintCall Call(Nfrrlib::EventBus::EEventBusBlueprintApi::RemovePublisher);
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
 		TEXT("BP RemovePublisher request. Channel=%s Publisher=%s"),
 		*ChannelTag.ToString(),
 		*GetNameSafe(PublisherObj));
@@ -343,8 +489,8 @@ bool UEventBusBlueprintLibrary::RemovePublisher(UObject* WorldContextObject, con
 		return false;
 	}
 
-	const bool bResult = Subsystem->GetEventBus().RemovePublisher(ChannelTag, PublisherObj);
-	UE_LOG(LogNFLEventBus, Log,
+	const bool bResult = Call.SetSucceeded(Subsystem->GetEventBus().RemovePublisher(ChannelTag, PublisherObj));
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
 		TEXT("BP RemovePublisher result. Channel=%s Publisher=%s Success=%s"),
 		*ChannelTag.ToString(),
 		*GetNameSafe(PublisherObj),
@@ -369,6 +515,26 @@ bool UEventBusBlueprintLibrary::AddListenerValidated(
 		TEXT("AddListenerValidated"));
 }
 
+/**
+ * @brief Compiled filtered-node entry point; the token lets the core skip the function lookup and signature check.
+ */
+bool UEventBusBlueprintLibrary::AddListenerTrusted(
+	UObject* WorldContextObject,
+	const FGameplayTag ChannelTag,
+	UObject* ListenerObj,
+	const FName FunctionName,
+	const FEventBusBindingToken& Token)
+{
+	return AddListenerInternal(
+		WorldContextObject,
+		ChannelTag,
+		ListenerObj,
+		FunctionName,
+		TEXT("AddListenerTrusted"),
+		nullptr,
+		&Token);
+}
+
 /**
  * @brief Blueprint facade wrapper for listener registration.
  */
@@ -395,7 +561,8 @@ bool UEventBusBlueprintLibrary::RemoveListener(
 	UObject* ListenerObj,
 	const FName FunctionName)
 {
-	UE_LOG(LogNFLEventBus, Log,
+	Nfrrlib::EventBus::FScopedBlueprintCall Call(Nfrrlib::EventBus::EEventBusBlueprintApi::RemoveListener);
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
 		TEXT("BP RemoveListener request. Channel=%s Listener=%s Function=%s"),
 		*ChannelTag.ToString(),
 		*GetNameSafe(ListenerObj),
@@ -415,8 +582,8 @@ bool UEventBusBlueprintLibrary::RemoveListener(
 
 	Nfrrlib::EventBus::FListenerBinding Binding;
 	Binding.FunctionName = FunctionName;
-	const bool bResult = Subsystem->GetEventBus().RemoveListener(ChannelTag, ListenerObj, Binding);
-	UE_LOG(LogNFLEventBus, Log,
+	const bool bResult = Call.SetSucceeded(Subsystem->GetEventBus().RemoveListener(ChannelTag, ListenerObj, Binding));
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
 		TEXT("BP RemoveListener result. Channel=%s Listener=%s Function=%s Success=%s"),
 		*ChannelTag.ToString(),
 		*GetNameSafe(ListenerObj),
@@ -425,6 +592,230 @@ bool UEventBusBlueprintLibrary::RemoveListener(
 	return bResult;
 }
 
+/**
+ * @brief Blueprint facade wrapper for publisher registration that returns a removal handle.
+ */
+FEventBusBindingHandle UEventBusBlueprintLibrary::AddPublisherWithHandle(
+	UObject* WorldContextObject,
+	const FGameplayTag ChannelTag,
+	UObject* PublisherObj,
+	const FName DelegatePropertyName)
+{
+	FEventBusBindingHandle Handle;
+	AddPublisherInternal(
+		WorldContextObject,
+		ChannelTag,
+		PublisherObj,
+		DelegatePropertyName,
+		TEXT("AddPublisherWithHandle"),
+		&Handle);
+	return Handle;
+}
+
+/**
+ * @brief Blueprint facade wrapper for listener registration that returns a removal handle.
+ */
+FEventBusBindingHandle UEventBusBlueprintLibrary::AddListenerWithHandle(
+	UObject* WorldContextObject,
+	const FGameplayTag ChannelTag,
+	UObject* ListenerObj,
+	const FName FunctionName)
+{
+	FEventBusBindingHandle Handle;
+	AddListenerInternal(
+		WorldContextObject,
+		ChannelTag,
+		ListenerObj,
+		FunctionName,
+		TEXT("AddListenerWithHandle"),
+		&Handle);
+	return Handle;
+}
+
+/**
+ * @brief Blueprint facade wrapper for handle-based removal; uses the handle's subsystem directly.
+ */
+bool UEventBusBlueprintLibrary::RemoveBindingByHandle(FEventBusBindingHandle& Handle)
+{
+	Nfrrlib::EventBus::FScopedBlueprintCall Call(Handle.bIsListener
+		? Nfrrlib::EventBus::EEventBusBlueprintApi::RemoveListener
+		: Nfrrlib::EventBus::EEventBusBlueprintApi::RemovePublisher);
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
+		TEXT("BP RemoveBindingByHandle request. Channel=%s Object=%s Member=%s Listener=%s"),
+		*Handle.ChannelTag.ToString(),
+		*GetNameSafe(Handle.BoundObject.Get()),
+		*Handle.MemberName.ToString(),
+		Handle.bIsListener ? TEXT("true") : TEXT("false"));
+
+	if (!Handle.IsValid())
+	{
+		UE_LOG(LogNFLEventBus, Warning,
+			TEXT("BP RemoveBindingByHandle denied: handle is empty or stale. Channel=%s Member=%s"),
+			*Handle.ChannelTag.ToString(),
+			*Handle.MemberName.ToString());
+		return false;
+	}
+
+	Nfrrlib::EventBus::FEventBus& Bus = Handle.Subsystem->GetEventBus();
+	bool bResult = false;
+	if (Handle.bIsListener)
+	{
+		Nfrrlib::EventBus::FListenerBinding Binding;
+		Binding.FunctionName = Handle.MemberName;
+		bResult = Bus.RemoveListener(Handle.ChannelTag, Handle.BoundObject.Get(), Binding);
+	}
+	else
+	{
+		bResult = Bus.RemovePublisher(Handle.ChannelTag, Handle.BoundObject.Get());
+	}
+	Call.SetSucceeded(bResult);
+
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
+		TEXT("BP RemoveBindingByHandle result. Channel=%s Object=%s Member=%s Success=%s"),
+		*Handle.ChannelTag.ToString(),
+		*GetNameSafe(Handle.BoundObject.Get()),
+		*Handle.MemberName.ToString(),
+		bResult ? TEXT("true") : TEXT("false"));
+	if (bResult)
+	{
+		Handle = FEventBusBindingHandle();
+	}
+	return bResult;
+}
+
+/**
+ * @brief Reports whether a binding handle can still be removed.
+ */
+bool UEventBusBlueprintLibrary::IsBindingHandleValid(const FEventBusBindingHandle& Handle)
+{
+	return Handle.IsValid();
+}
+
+/**
+ * @brief Blueprint facade wrapper for bulk publisher registration with runtime history tracking.
+ */
+int32 UEventBusBlueprintLibrary::AddPublisherBindings(
+	UObject* WorldContextObject,
+	UObject* PublisherObj,
+	const TArray<FEventBusPublisherBindingEntry>& Bindings,
+	TArray<bool>& OutResults)
+{
+	Nfrrlib::EventBus::FScopedBlueprintCall Call(Nfrrlib::EventBus::EEventBusBlueprintApi::AddPublisherBindings);
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
+		TEXT("BP AddPublisherBindings request. Publisher=%s Count=%d"),
+		*GetNameSafe(PublisherObj),
+		Bindings.Num());
+
+	UEventBusSubsystem* const Subsystem = BeginBulkBinding(
+		WorldContextObject, TEXT("AddPublisherBindings"), TEXT("PublisherObj"), PublisherObj, Bindings.Num(), OutResults);
+	if (!Subsystem)
+	{
+		return 0;
+	}
+
+	TArray<Nfrrlib::EventBus::FChannelPublisherBinding, TInlineAllocator<BulkBindingInlineCount>> CoreBindings;
+	CoreBindings.Reserve(Bindings.Num());
+	for (const FEventBusPublisherBindingEntry& Entry : Bindings)
+	{
+		CoreBindings.Add({Entry.ChannelTag, {Entry.DelegatePropertyName}});
+	}
+
+	const int32 SucceededCount = Subsystem->GetEventBus().AddPublishers(PublisherObj, CoreBindings, OutResults);
+	Call.SetSucceeded(SucceededCount == Bindings.Num());
+	for (int32 Index = 0; Index < Bindings.Num(); ++Index)
+	{
+		if (OutResults[Index])
+		{
+			RecordPublisherHistory(Subsystem, Bindings[Index].ChannelTag, PublisherObj, Bindings[Index].DelegatePropertyName);
+		}
+	}
+
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
+		TEXT("BP AddPublisherBindings result. Publisher=%s Succeeded=%d Count=%d"),
+		*GetNameSafe(PublisherObj),
+		SucceededCount,
+		Bindings.Num());
+	return SucceededCount;
+}
+
+/**
+ * @brief Blueprint facade wrapper for bulk listener registration with runtime history tracking.
+ */
+int32 UEventBusBlueprintLibrary::AddListenerBindings(
+	UObject* WorldContextObject,
+	UObject* ListenerObj,
+	const TArray<FEventBusListenerBindingEntry>& Bindings,
+	TArray<bool>& OutResults)
+{
+	TArray<Nfrrlib::EventBus::FChannelListenerBinding, TInlineAllocator<BulkBindingInlineCount>> CoreBindings;
+	CoreBindings.Reserve(Bindings.Num());
+	for (const FEventBusListenerBindingEntry& Entry : Bindings)
+	{
+		CoreBindings.Add({Entry.ChannelTag, {Entry.FunctionName}});
+	}
+
+	return AddListenersInternal(WorldContextObject, ListenerObj, CoreBindings, OutResults, TEXT("AddListenerBindings"));
+}
+
+/**
+ * @brief Blueprint facade wrapper binding one listener function to every tag of a container.
+ */
+int32 UEventBusBlueprintLibrary::AddListenerToChannels(
+	UObject* WorldContextObject,
+	const FGameplayTagContainer& ChannelTags,
+	UObject* ListenerObj,
+	const FName FunctionName,
+	TArray<bool>& OutResults)
+{
+	TArray<Nfrrlib::EventBus::FChannelListenerBinding, TInlineAllocator<BulkBindingInlineCount>> CoreBindings;
+	CoreBindings.Reserve(ChannelTags.Num());
+	for (const FGameplayTag& ChannelTag : ChannelTags)
+	{
+		CoreBindings.Add({ChannelTag, {FunctionName}});
+	}
+
+	return AddListenersInternal(WorldContextObject, ListenerObj, CoreBindings, OutResults, TEXT("AddListenerToChannels"));
+}
+
+/**
+ * @brief Blueprint facade wrapper for bulk listener removal.
+ */
+int32 UEventBusBlueprintLibrary::RemoveListenerBindings(
+	UObject* WorldContextObject,
+	UObject* ListenerObj,
+	const TArray<FEventBusListenerBindingEntry>& Bindings,
+	TArray<bool>& OutResults)
+{
+	Nfrrlib::EventBus::FScopedBlueprintCall Call(Nfrrlib::EventBus::EEventBusBlueprintApi::RemoveListenerBindings);
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
+		TEXT("BP RemoveListenerBindings request. Listener=%s Count=%d"),
+		*GetNameSafe(ListenerObj),
+		Bindings.Num());
+
+	UEventBusSubsystem* const Subsystem = BeginBulkBinding(
+		WorldContextObject, TEXT("RemoveListenerBindings"), TEXT("ListenerObj"), ListenerObj, Bindings.Num(), OutResults);
+	if (!Subsystem)
+	{
+		return 0;
+	}
+
+	TArray<Nfrrlib::EventBus::FChannelListenerBinding, TInlineAllocator<BulkBindingInlineCount>> CoreBindings;
+	CoreBindings.Reserve(Bindings.Num());
+	for (const FEventBusListenerBindingEntry& Entry : Bindings)
+	{
+		CoreBindings.Add({Entry.ChannelTag, {Entry.FunctionName}});
+	}
+
+	const int32 RemovedCount = Subsystem->GetEventBus().RemoveListeners(ListenerObj, CoreBindings, OutResults);
+	Call.SetSucceeded(RemovedCount == Bindings.Num());
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
+		TEXT("BP RemoveListenerBindings result. Listener=%s Removed=%d Count=%d"),
+		*GetNameSafe(ListenerObj),
+		RemovedCount,
+		Bindings.Num());
+	return RemovedCount;
+}
+
 /**
  * @brief Returns sorted, deduplicated listener functions recorded in runtime history.
  */
@@ -433,7 +824,8 @@ TArray<FName> UEventBusBlueprintLibrary::GetKnownListenerFunctions(
 	const FGameplayTag ChannelTag,
 	const TSubclassOf<UObject> ListenerClass)
 {
-	UE_LOG(LogNFLEventBus, Log,
+	Nfrrlib::EventBus::FScopedBlueprintCall Call(Nfrrlib::EventBus::EEventBusBlueprintApi::GetKnownListenerFunctions);
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
 		TEXT("BP GetKnownListenerFunctions request. Channel=%s ListenerClass=%s"),
 		*ChannelTag.ToString(),
 		*GetNameSafe(ListenerClass.Get()));
@@ -451,6 +843,7 @@ TArray<FName> UEventBusBlueprintLibrary::GetKnownListenerFunctions(
 	if (::IsValid(Registry))
 	{
 		KnownFunctions = Registry->GetKnownListenerFunctions(ChannelTag, ListenerClass.Get());
+		Call.SetSucceeded(true);
 	}
 	else
 	{
@@ -458,7 +851,7 @@ TArray<FName> UEventBusBlueprintLibrary::GetKnownListenerFunctions(
 			TEXT("BP GetKnownListenerFunctions warning: runtime registry is null, returning empty list."));
 	}
 
-	UE_LOG(LogNFLEventBus, Log,
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
 		TEXT("BP GetKnownListenerFunctions result. Channel=%s ListenerClass=%s Count=%d"),
 		*ChannelTag.ToString(),
 		*GetNameSafe(ListenerClass.Get()),
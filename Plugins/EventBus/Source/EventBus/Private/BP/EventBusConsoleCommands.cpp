@@ -0,0 +1,348 @@
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+
+#include "EventBus/BP/EventBusBlueprintDiagnostics.h"
+#include "EventBus/BP/EventBusRegistryAsset.h"
+#include "EventBus/BP/EventBusSubsystem.h"
+#include "EventBus/Core/EventBusDiagnostics.h"
+#include "EventBus/Core/EventBusRecorder.h"
+
+namespace
+{
+	using Nfrrlib::EventBus::EEventBusTopSort;
+	using Nfrrlib::EventBus::FEventBus;
+	using Nfrrlib::EventBus::FEventBusTopRow;
+	using Nfrrlib::EventBus::FEventBusTopSampler;
+	using Nfrrlib::EventBus::FEventChannelStats;
+
+	TAutoConsoleVariable<float> CVarEventBusTopSampleInterval(
+		TEXT("EventBus.Top.SampleInterval"),
+		1.0f,
+		TEXT("Seconds between EventBus.Top counter samples while sampling is active."));
+
+	TAutoConsoleVariable<float> CVarEventBusTopIdleTimeout(
+		TEXT("EventBus.Top.IdleTimeout"),
+		60.0f,
+		TEXT("Seconds without an EventBus.Top query before sampling stops and history is dropped."));
+
+	/** @brief Calls Visitor for every live subsystem, skipping the class default object. */
+	void ForEachSubsystem(const TFunctionRef<void(const UEventBusSubsystem& Subsystem)> Visitor)
+	{
+		for (TObjectIterator<UEventBusSubsystem> It; It; ++It)
+		{
+			if (!It->HasAnyFlags(RF_ClassDefaultObject))
+			{
+				Visitor(**It);
+			}
+		}
+	}
+
+	/**
+	 * @brief Sampler and ticker backing EventBus.Top.
+	 *
+	 * The ticker exists only between the first query and the idle timeout, so an unobserved
+	 * server pays nothing beyond the per-channel counters it already keeps.
+	 */
+	struct FEventBusTopState final
+	{
+		FEventBusTopSampler Sampler;
+		FTSTicker::FDelegateHandle TickerHandle;
+		double LastQuerySeconds = 0.0;
+
+		static FEventBusTopState& Get()
+		{
+			static FEventBusTopState State;
+			return State;
+		}
+
+		bool IsSampling() const
+		{
+			return TickerHandle.IsValid();
+		}
+
+		/** @brief Pushes "<Bus>/<Channel>" counters for every bus of every live subsystem. */
+		void TakeSample()
+		{
+			TMap<FString, FEventChannelStats> Counters;
+			ForEachSubsystem([&Counters](const UEventBusSubsystem& Subsystem)
+			{
+				Subsystem.ForEachBus([&Counters](const FString& BusName, const FEventBus& Bus)
+				{
+					TMap<FGameplayTag, FEventChannelStats> ChannelStats;
+					Bus.GetAllChannelStats(ChannelStats);
+					for (const TPair<FGameplayTag, FEventChannelStats>& Pair : ChannelStats)
+					{
+						Counters.Add(BusName / Pair.Key.ToString(), Pair.Value);
+					}
+				});
+			});
+			Sampler.AddSample(FPlatformTime::Seconds(), MoveTemp(Counters));
+		}
+
+		void Start()
+		{
+			if (IsSampling())
+			{
+				return;
+			}
+
+			TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+				FTickerDelegate::CreateStatic(&FEventBusTopState::Tick),
+				FMath::Max(CVarEventBusTopSampleInterval.GetValueOnGameThread(), 0.05f));
+		}
+
+		void Stop()
+		{
+			if (IsSampling())
+			{
+				FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+				TickerHandle.Reset();
+			}
+			Sampler.Reset();
+		}
+
+		static bool Tick(const float NFL_EVENTBUS_MAYBE_UNUSED DeltaTime)
+		{
+			FEventBusTopState& State = Get();
+			if (FPlatformTime::Seconds() - State.LastQuerySeconds > CVarEventBusTopIdleTimeout.GetValueOnGameThread())
+			{
+				State.TickerHandle.Reset();
+				State.Sampler.Reset();
+				return false;
+			}
+
+			State.TakeSample();
+			return true;
+		}
+	};
+
+	/** @brief `EventBus.Dump [Filter]`: channels, bound classes, memory and counters for every bus. */
+	FAutoConsoleCommandWithArgsAndOutputDevice GEventBusDumpCommand(
+		TEXT("EventBus.Dump"),
+		TEXT("Dumps every EventBus channel with publisher/listener counts, bound classes, memory and counters. Optional argument filters by channel tag substring."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic([](const TArray<FString>& Args, FOutputDevice& Ar)
+		{
+			const FString Filter = Args.Num() > 0 ? Args[0] : FString();
+			ForEachSubsystem([&Ar, &Filter](const UEventBusSubsystem& Subsystem)
+			{
+				Subsystem.ForEachBus([&Ar, &Filter](const FString& BusName, const FEventBus& Bus)
+				{
+					Ar.Logf(TEXT("EventBus dump. Bus=%s"), *BusName);
+					Bus.DumpChannels(Ar, Filter);
+				});
+			});
+		}));
+
+	/** @brief `EventBus.Stats`: cumulative per-channel counters for every bus. */
+	FAutoConsoleCommandWithOutputDevice GEventBusStatsCommand(
+		TEXT("EventBus.Stats"),
+		TEXT("Dumps cumulative per-channel EventBus counters (broadcasts, invocations, binds, cleanup and dispatch time) for every bus."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic([](FOutputDevice& Ar)
+		{
+			ForEachSubsystem([&Ar](const UEventBusSubsystem& Subsystem)
+			{
+				Subsystem.ForEachBus([&Ar](const FString& BusName, const FEventBus& Bus)
+				{
+					Ar.Logf(TEXT("EventBus stats. Bus=%s"), *BusName);
+					Bus.DumpStats(Ar);
+				});
+			});
+		}));
+
+	/** @brief `EventBus.SlowListeners [PerChannel] [reset]`: worst listener timings per channel for every bus. */
+	FAutoConsoleCommandWithArgsAndOutputDevice GEventBusSlowListenersCommand(
+		TEXT("EventBus.SlowListeners"),
+		TEXT("Lists the slowest listeners per channel (default 5) recorded while EventBus.ListenerTiming.Enabled is on. 'reset' clears recorded timings."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic([](const TArray<FString>& Args, FOutputDevice& Ar)
+		{
+			const bool bReset = Args.ContainsByPredicate([](const FString& Arg)
+			{
+				return Arg.Equals(TEXT("reset"), ESearchCase::IgnoreCase);
+			});
+			const FString* const RowArg = Args.FindByPredicate([](const FString& Arg)
+			{
+				return Arg.IsNumeric();
+			});
+			const int32 MaxPerChannel = RowArg != nullptr ? FMath::Max(FCString::Atoi(**RowArg), 1) : 5;
+
+			if (!Nfrrlib::EventBus::FEventListenerTiming::IsEnabled())
+			{
+				Ar.Logf(TEXT("Listener timing is off; set EventBus.ListenerTiming.Enabled 1 to record new timings."));
+			}
+
+			for (TObjectIterator<UEventBusSubsystem> It; It; ++It)
+			{
+				if (It->HasAnyFlags(RF_ClassDefaultObject))
+				{
+					continue;
+				}
+
+				if (bReset)
+				{
+					It->ResetListenerTimings();
+					continue;
+				}
+
+				It->ForEachBus([&Ar, MaxPerChannel](const FString& BusName, const FEventBus& Bus)
+				{
+					Ar.Logf(TEXT("EventBus slow listeners. Bus=%s"), *BusName);
+					Bus.DumpSlowListeners(Ar, MaxPerChannel);
+				});
+			}
+		}));
+
+	/** @brief `EventBus.BP.Counters [reset]`: Blueprint facade call, failure and logged-call counters. */
+	FAutoConsoleCommandWithArgsAndOutputDevice GEventBusBlueprintCountersCommand(
+		TEXT("EventBus.BP.Counters"),
+		TEXT("Dumps Blueprint facade call, failure and logged-call counters per entry point, plus subsystem cache and runtime history stats. 'reset' clears them."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic([](const TArray<FString>& Args, FOutputDevice& Ar)
+		{
+			Nfrrlib::EventBus::FEventBusBlueprintDiagnostics::DumpCounters(Ar);
+			const Nfrrlib::EventBus::FEventBusSubsystemCacheStats CacheStats = UEventBusSubsystem::GetCacheStats();
+			Ar.Logf(TEXT("SubsystemCache Hits=%llu Misses=%llu Worlds=%d"), CacheStats.Hits, CacheStats.Misses, CacheStats.NumWorlds);
+
+			const bool bReset = Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase);
+			for (TObjectIterator<UEventBusRegistryAsset> It; It; ++It)
+			{
+				if (It->HasAnyFlags(RF_ClassDefaultObject))
+				{
+					continue;
+				}
+
+				const Nfrrlib::EventBus::FRegistryHistoryStats& RegistryStats = It->GetStats();
+				Ar.Logf(TEXT("Registry %s Publishers=%d Listeners=%d BakedPublishers=%d BakedListeners=%d LookupHits=%llu LookupMisses=%llu Evictions=%llu"),
+					*It->GetPathName(),
+					It->PublisherHistory.Num(),
+					It->ListenerHistory.Num(),
+					It->BakedPublishers.Num(),
+					It->BakedListeners.Num(),
+					RegistryStats.LookupHits,
+					RegistryStats.LookupMisses,
+					RegistryStats.Evictions);
+				if (bReset)
+				{
+					It->ResetStats();
+				}
+			}
+
+			if (bReset)
+			{
+				Nfrrlib::EventBus::FEventBusBlueprintDiagnostics::ResetCounters();
+				UEventBusSubsystem::ResetCache();
+				Ar.Logf(TEXT("Blueprint facade counters reset."));
+			}
+		}));
+
+	/** @brief `EventBus.Record.Start [File]`: starts appending bus operations to an event-stream file. */
+	FAutoConsoleCommandWithArgsAndOutputDevice GEventBusRecordStartCommand(
+		TEXT("EventBus.Record.Start"),
+		TEXT("Records every EventBus operation and typed publish to a binary event stream. Defaults to Saved/EventBus/Recordings."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic([](const TArray<FString>& Args, FOutputDevice& Ar)
+		{
+			using Nfrrlib::EventBus::FEventBusRecorder;
+			if (FEventBusRecorder::Start(Args.Num() > 0 ? Args[0] : FString()))
+			{
+				Ar.Logf(TEXT("EventBus recording to %s"), *FEventBusRecorder::GetFilePath());
+			}
+			else
+			{
+				Ar.Logf(TEXT("EventBus recording not started; see LogNFLEventBus."));
+			}
+		}));
+
+	/** @brief `EventBus.Record.Stop`: flushes and closes the active event-stream file. */
+	FAutoConsoleCommandWithOutputDevice GEventBusRecordStopCommand(
+		TEXT("EventBus.Record.Stop"),
+		TEXT("Stops EventBus recording, flushes pending blocks and closes the file."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic([](FOutputDevice& Ar)
+		{
+			using Nfrrlib::EventBus::FEventBusRecorder;
+			if (!FEventBusRecorder::IsRecording())
+			{
+				Ar.Logf(TEXT("EventBus is not recording."));
+				return;
+			}
+
+			FEventBusRecorder::Stop();
+			const Nfrrlib::EventBus::FEventBusRecorderStats Stats = FEventBusRecorder::GetStats();
+			Ar.Logf(TEXT("EventBus recording saved to %s: %llu records, %llu bytes."),
+				*FEventBusRecorder::GetFilePath(),
+				Stats.RecordCount,
+				Stats.WrittenBytes);
+		}));
+
+	/** @brief `EventBus.Memory`: per-channel memory breakdown for every live EventBus subsystem. */
+	FAutoConsoleCommandWithOutputDevice GEventBusMemoryCommand(
+		TEXT("EventBus.Memory"),
+		TEXT("Dumps per-channel EventBus memory (owned bytes, publisher/listener storage, publisher delegate lists) for every game instance and scope."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic([](FOutputDevice& Ar)
+		{
+			ForEachSubsystem([&Ar](const UEventBusSubsystem& Subsystem)
+			{
+				Subsystem.DumpMemory(Ar);
+			});
+		}));
+
+	/** @brief `EventBus.Top [Rows] [WindowSeconds] [cost] [stop]`: hottest channels over a sliding window. */
+	FAutoConsoleCommandWithArgsAndOutputDevice GEventBusTopCommand(
+		TEXT("EventBus.Top"),
+		TEXT("Lists channels with the highest listener invocation rate (or dispatch cost with 'cost') over a sliding window. ")
+		TEXT("Usage: EventBus.Top [Rows=10] [WindowSeconds=10] [cost] [stop]. The first call starts sampling; sampling stops after EventBus.Top.IdleTimeout seconds without a query."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic([](const TArray<FString>& Args, FOutputDevice& Ar)
+		{
+			FEventBusTopState& State = FEventBusTopState::Get();
+
+			int32 MaxRows = 10;
+			double WindowSeconds = 10.0;
+			EEventBusTopSort Sort = EEventBusTopSort::Invocations;
+			int32 NumericArgCount = 0;
+			for (const FString& Arg : Args)
+			{
+				if (Arg.Equals(TEXT("stop"), ESearchCase::IgnoreCase))
+				{
+					State.Stop();
+					Ar.Logf(TEXT("EventBus.Top sampling stopped."));
+					return;
+				}
+
+				if (Arg.Equals(TEXT("cost"), ESearchCase::IgnoreCase))
+				{
+					Sort = EEventBusTopSort::Cost;
+				}
+				else if (Arg.IsNumeric())
+				{
+					if (NumericArgCount++ == 0)
+					{
+						MaxRows = FMath::Max(FCString::Atoi(*Arg), 1);
+					}
+					else
+					{
+						WindowSeconds = FMath::Max(FCString::Atod(*Arg), 0.0);
+					}
+				}
+			}
+
+			State.LastQuerySeconds = FPlatformTime::Seconds();
+			State.Sampler.SetMaxAgeSeconds(FMath::Max(WindowSeconds, static_cast<double>(CVarEventBusTopIdleTimeout.GetValueOnGameThread())));
+			const bool bWasSampling = State.IsSampling();
+			State.Start();
+			State.TakeSample();
+
+			TArray<FEventBusTopRow> Rows;
+			double CoveredSeconds = 0.0;
+			if (!bWasSampling || !State.Sampler.GetTop(WindowSeconds, Sort, MaxRows, Rows, CoveredSeconds))
+			{
+				Ar.Logf(TEXT("EventBus.Top sampling started every %.2fs. Run again to see rates."),
+					CVarEventBusTopSampleInterval.GetValueOnGameThread());
+				return;
+			}
+
+			Ar.Logf(TEXT("EventBus.Top over %.1fs, sorted by %s"), CoveredSeconds, Sort == EEventBusTopSort::Cost ? TEXT("dispatch cost") : TEXT("invocations"));
+			Ar.Logf(TEXT("%-64s %12s %12s %12s"), TEXT("Bus/Channel"), TEXT("Bcast/s"), TEXT("Invoke/s"), TEXT("DispMs/s"));
+			for (const FEventBusTopRow& Row : Rows)
+			{
+				Ar.Logf(TEXT("%-64s %12.1f %12.1f %12.3f"), *Row.Channel, Row.BroadcastsPerSecond, Row.InvocationsPerSecond, Row.DispatchMsPerSecond);
+			}
+		}));
+} // namespace
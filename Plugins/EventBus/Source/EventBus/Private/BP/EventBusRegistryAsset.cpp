@@ -1,44 +1,301 @@
 #include "EventBus/BP/EventBusRegistryAsset.h"
 
-#include "Containers/Set.h"
+#include "Algo/BinarySearch.h"
+#include "UObject/UObjectGlobals.h"
 
+#include "EventBus/BP/EventBusBlueprintDiagnostics.h"
+#include "EventBus/BP/EventBusSettings.h"
 #include "EventBus/Core/EventBus.h"
 
 namespace
 {
-	constexpr int32 MaxPublisherHistoryEntries = 512;
-	constexpr int32 MaxListenerHistoryEntries = 512;
+	bool LexicalNameLess(const FName A, const FName B)
+	{
+		return A.Compare(B) < 0;
+	}
 
 	void SortAndUniqueNames(TArray<FName>& Names)
 	{
-		TSet<FName> UniqueNames;
-		for (const FName Name : Names)
+		Names.RemoveAll([](const FName Name)
+		{
+			return Name.IsNone();
+		});
+		Names.Sort(&LexicalNameLess);
+		for (int32 Index = Names.Num() - 1; Index > 0; --Index)
 		{
-			if (!Name.IsNone())
+			if (Names[Index] == Names[Index - 1])
 			{
-				UniqueNames.Add(Name);
+				Names.RemoveAt(Index, 1, EAllowShrinking::No);
 			}
 		}
+	}
+
+	/**
+	 * @brief Inserts Name at its sorted position. Returns false when Names already holds it.
+	 */
+	bool InsertSortedName(TArray<FName>& Names, const FName Name)
+	{
+		const int32 InsertIndex = Algo::LowerBound(Names, Name, &LexicalNameLess);
+		if (Names.IsValidIndex(InsertIndex) && Names[InsertIndex] == Name)
+		{
+			return false;
+		}
 
-		Names = UniqueNames.Array();
-		Names.Sort([](const FName& A, const FName& B)
+		Names.Insert(Name, InsertIndex);
+		return true;
+	}
+
+	Nfrrlib::EventBus::FRegistryHistoryKey MakePublisherKey(const FGameplayTag& ChannelTag, const UClass* PublisherClass, const FName DelegatePropertyName)
+	{
+		return Nfrrlib::EventBus::FRegistryHistoryKey{ChannelTag, FObjectKey(PublisherClass), DelegatePropertyName};
+	}
+
+	Nfrrlib::EventBus::FRegistryHistoryKey MakeListenerKey(const FGameplayTag& ChannelTag, const UClass* ListenerClass)
+	{
+		return Nfrrlib::EventBus::FRegistryHistoryKey{ChannelTag, FObjectKey(ListenerClass), NAME_None};
+	}
+
+	/**
+	 * @brief Removes history slot Slot in O(1) by swapping in the last entry, keeping Index and Lru in step.
+	 * Index entries only follow slots they point at, so duplicates left by direct edits stay unindexed.
+	 */
+	template <typename TEntryType, typename TMakeKey>
+	void RemoveHistorySlot(
+		TArray<TEntryType>& Entries,
+		TMap<Nfrrlib::EventBus::FRegistryHistoryKey, int32>& Index,
+		Nfrrlib::EventBus::FRegistryHistoryLru& Lru,
+		const int32 Slot,
+		TMakeKey&& MakeKey)
+	{
+		const Nfrrlib::EventBus::FRegistryHistoryKey RemovedKey = MakeKey(Entries[Slot]);
+		if (const int32* IndexedSlot = Index.Find(RemovedKey); IndexedSlot && *IndexedSlot == Slot)
 		{
-			return A.Compare(B) < 0;
+			Index.Remove(RemovedKey);
+		}
+
+		const int32 LastSlot = Entries.Num() - 1;
+		if (Slot != LastSlot)
+		{
+			int32* const MovedSlot = Index.Find(MakeKey(Entries[LastSlot]));
+			if (MovedSlot && *MovedSlot == LastSlot)
+			{
+				*MovedSlot = Slot;
+			}
+		}
+
+		Entries.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+		Lru.RemoveSwap(Slot);
+	}
+
+	/**
+	 * @brief Removes every slot whose class is no longer valid through RemoveHistorySlot. Returns the removed count.
+	 * GC nulls the class reference, so index entries of dead slots are dropped by slot before any swap moves them.
+	 */
+	template <typename TEntryType, typename TGetClass, typename TMakeKey>
+	int32 RemoveCollectedSlots(
+		TArray<TEntryType>& Entries,
+		TMap<Nfrrlib::EventBus::FRegistryHistoryKey, int32>& Index,
+		Nfrrlib::EventBus::FRegistryHistoryLru& Lru,
+		TGetClass&& GetClass,
+		TMakeKey&& MakeKey)
+	{
+		const bool bAnyCollected = Entries.ContainsByPredicate([&GetClass](const TEntryType& Entry)
+		{
+			return !::IsValid(GetClass(Entry));
 		});
+		if (!bAnyCollected)
+		{
+			return 0;
+		}
+
+		for (auto It = Index.CreateIterator(); It; ++It)
+		{
+			if (!::IsValid(GetClass(Entries[It.Value()])))
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		// Walking down means the last slot swapped into a removed one was already checked.
+		int32 RemovedCount = 0;
+		for (int32 Slot = Entries.Num() - 1; Slot >= 0; --Slot)
+		{
+			if (!::IsValid(GetClass(Entries[Slot])))
+			{
+				RemoveHistorySlot(Entries, Index, Lru, Slot, MakeKey);
+				++RemovedCount;
+			}
+		}
+		return RemovedCount;
+	}
+}
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Links slots oldest-first so the last array element ends up most recent.
+	 */
+	void FRegistryHistoryLru::Reset(const int32 Num)
+	{
+		Prev.SetNumUninitialized(Num);
+		Next.SetNumUninitialized(Num);
+		for (int32 Slot = 0; Slot < Num; ++Slot)
+		{
+			Prev[Slot] = Slot + 1 < Num ? Slot + 1 : INDEX_NONE;
+			Next[Slot] = Slot - 1;
+		}
+		Head = Num > 0 ? Num - 1 : INDEX_NONE;
+		Tail = Num > 0 ? 0 : INDEX_NONE;
+	}
+
+	/**
+	 * @brief Tracks a slot just appended to the history array.
+	 */
+	void FRegistryHistoryLru::Add()
+	{
+		const int32 Slot = Prev.Add(INDEX_NONE);
+		Next.Add(INDEX_NONE);
+		LinkFront(Slot);
+	}
+
+	/**
+	 * @brief Moves Slot to the front of the recency list.
+	 */
+	void FRegistryHistoryLru::Touch(const int32 Slot)
+	{
+		if (Slot != Head)
+		{
+			Unlink(Slot);
+			LinkFront(Slot);
+		}
+	}
+
+	/**
+	 * @brief Unlinks Slot, then relinks the last slot under Slot's number to mirror a swap removal.
+	 */
+	void FRegistryHistoryLru::RemoveSwap(const int32 Slot)
+	{
+		Unlink(Slot);
+
+		const int32 LastSlot = Prev.Num() - 1;
+		if (Slot != LastSlot)
+		{
+			Prev[Slot] = Prev[LastSlot];
+			Next[Slot] = Next[LastSlot];
+			if (Prev[Slot] != INDEX_NONE)
+			{
+				Next[Prev[Slot]] = Slot;
+			}
+			else
+			{
+				Head = Slot;
+			}
+
+			if (Next[Slot] != INDEX_NONE)
+			{
+				Prev[Next[Slot]] = Slot;
+			}
+			else
+			{
+				Tail = Slot;
+			}
+		}
+
+		Prev.Pop(EAllowShrinking::No);
+		Next.Pop(EAllowShrinking::No);
 	}
 
-	template <typename TEntryType>
-	void TrimOldestEntries(TArray<TEntryType>& Entries, const int32 MaxEntries)
+	/**
+	 * @brief Detaches Slot from its neighbours; Prev points toward the head, Next toward the tail.
+	 */
+	void FRegistryHistoryLru::Unlink(const int32 Slot)
 	{
-		if (MaxEntries <= 0 || Entries.Num() <= MaxEntries)
+		const int32 PrevSlot = Prev[Slot];
+		const int32 NextSlot = Next[Slot];
+		if (PrevSlot != INDEX_NONE)
 		{
-			return;
+			Next[PrevSlot] = NextSlot;
+		}
+		else
+		{
+			Head = NextSlot;
+		}
+
+		if (NextSlot != INDEX_NONE)
+		{
+			Prev[NextSlot] = PrevSlot;
+		}
+		else
+		{
+			Tail = PrevSlot;
 		}
 
-		const int32 OverflowCount = Entries.Num() - MaxEntries;
-		Entries.RemoveAt(0, OverflowCount, EAllowShrinking::No);
+		Prev[Slot] = INDEX_NONE;
+		Next[Slot] = INDEX_NONE;
+	}
+
+	/**
+	 * @brief Makes Slot the head.
+	 */
+	void FRegistryHistoryLru::LinkFront(const int32 Slot)
+	{
+		Prev[Slot] = INDEX_NONE;
+		Next[Slot] = Head;
+		if (Head != INDEX_NONE)
+		{
+			Prev[Head] = Slot;
+		}
+		Head = Slot;
+		if (Tail == INDEX_NONE)
+		{
+			Tail = Slot;
+		}
+	}
+} // namespace Nfrrlib::EventBus
+
+/**
+ * @brief Idempotent; the hook is removed in BeginDestroy.
+ */
+void UEventBusRegistryAsset::EnableGarbageCollectPruning()
+{
+	if (!PostGarbageCollectHandle.IsValid())
+	{
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UEventBusRegistryAsset::HandlePostGarbageCollect);
+	}
+}
+
+/**
+ * @brief Removes the post-GC hook before the registry goes away.
+ */
+void UEventBusRegistryAsset::BeginDestroy()
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	PostGarbageCollectHandle.Reset();
+	Super::BeginDestroy();
+}
+
+#if WITH_EDITOR
+/**
+ * @brief Edits that keep the array sizes would otherwise leave the indexes pointing at the wrong entries.
+ * Undo and redo arrive without a property, so they count as edits too.
+ */
+void UEventBusRegistryAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	const FName PropertyName = PropertyChangedEvent.GetMemberPropertyName();
+	if (PropertyName.IsNone() ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(UEventBusRegistryAsset, PublisherHistory) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(UEventBusRegistryAsset, ListenerHistory))
+	{
+		MarkHistoryEdited();
 	}
 }
+#endif
+
+void UEventBusRegistryAsset::MarkHistoryEdited()
+{
+	++HistoryEditSerial;
+}
 
 /**
  * @brief Records one publisher binding in history if valid and not already present.
@@ -48,6 +305,7 @@ void UEventBusRegistryAsset::RecordPublisherBinding(
 	UClass* PublisherClass,
 	const FName DelegatePropertyName)
 {
+	Nfrrlib::EventBus::FScopedBlueprintCall Call(Nfrrlib::EventBus::EEventBusBlueprintApi::RecordPublisherBinding);
 	if (!ChannelTag.IsValid() || !::IsValid(PublisherClass) || DelegatePropertyName.IsNone())
 	{
 		UE_LOG(LogNFLEventBus, Warning,
@@ -59,31 +317,26 @@ void UEventBusRegistryAsset::RecordPublisherBinding(
 		return;
 	}
 
-	PublisherHistory.RemoveAll([](const FEventBusPublisherHistoryEntry& Entry)
-	{
-		return !Entry.ChannelTag.IsValid() ||
-			!::IsValid(Entry.PublisherClass.Get()) ||
-			Entry.DelegatePropertyName.IsNone();
-	});
+	Call.SetSucceeded(true);
+	EnsureHistoryIndexes();
 
-	for (const FEventBusPublisherHistoryEntry& Entry : PublisherHistory)
+	const Nfrrlib::EventBus::FRegistryHistoryKey Key = MakePublisherKey(ChannelTag, PublisherClass, DelegatePropertyName);
+	if (const int32* FoundIndex = PublisherIndex.Find(Key))
 	{
-		if (Entry.ChannelTag == ChannelTag &&
-			Entry.PublisherClass.Get() == PublisherClass &&
-			Entry.DelegatePropertyName == DelegatePropertyName)
-		{
-			return;
-		}
+		PublisherLru.Touch(*FoundIndex);
+		return;
 	}
 
 	FEventBusPublisherHistoryEntry NewEntry;
 	NewEntry.ChannelTag = ChannelTag;
 	NewEntry.PublisherClass = PublisherClass;
 	NewEntry.DelegatePropertyName = DelegatePropertyName;
-	PublisherHistory.Add(MoveTemp(NewEntry));
-	TrimOldestEntries(PublisherHistory, MaxPublisherHistoryEntries);
+	PublisherIndex.Add(Key, PublisherHistory.Add(MoveTemp(NewEntry)));
+	PublisherLru.Add();
+	EnforcePublisherCapacity();
+	IndexedPublisherCount = PublisherHistory.Num();
 
-	UE_LOG(LogNFLEventBus, Log,
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
 		TEXT("Registry RecordPublisherBinding added. Registry=%s Channel=%s PublisherClass=%s Delegate=%s Total=%d"),
 		*GetNameSafe(this),
 		*ChannelTag.ToString(),
@@ -100,6 +353,7 @@ void UEventBusRegistryAsset::RecordListenerBinding(
 	UClass* ListenerClass,
 	const FName FunctionName)
 {
+	Nfrrlib::EventBus::FScopedBlueprintCall Call(Nfrrlib::EventBus::EEventBusBlueprintApi::RecordListenerBinding);
 	if (!ChannelTag.IsValid() || !::IsValid(ListenerClass) || FunctionName.IsNone())
 	{
 		UE_LOG(LogNFLEventBus, Warning,
@@ -111,44 +365,39 @@ void UEventBusRegistryAsset::RecordListenerBinding(
 		return;
 	}
 
-	ListenerHistory.RemoveAll([](const FEventBusListenerHistoryEntry& Entry)
-	{
-		return !Entry.ChannelTag.IsValid() ||
-			!::IsValid(Entry.ListenerClass.Get());
-	});
+	Call.SetSucceeded(true);
+	EnsureHistoryIndexes();
 
-	for (FEventBusListenerHistoryEntry& Entry : ListenerHistory)
+	const Nfrrlib::EventBus::FRegistryHistoryKey Key = MakeListenerKey(ChannelTag, ListenerClass);
+	int32 EntryIndex = INDEX_NONE;
+	if (const int32* FoundIndex = ListenerIndex.Find(Key))
 	{
-		SortAndUniqueNames(Entry.KnownFunctions);
+		EntryIndex = *FoundIndex;
+		ListenerLru.Touch(EntryIndex);
 	}
-
-	ListenerHistory.RemoveAll([](const FEventBusListenerHistoryEntry& Entry)
-	{
-		return Entry.KnownFunctions.IsEmpty();
-	});
-
-	FEventBusListenerHistoryEntry* FoundEntry = ListenerHistory.FindByPredicate(
-		[&ChannelTag, ListenerClass](const FEventBusListenerHistoryEntry& Entry)
-		{
-			return Entry.ChannelTag == ChannelTag && Entry.ListenerClass.Get() == ListenerClass;
-		});
-
-	if (!FoundEntry)
+	else
 	{
 		FEventBusListenerHistoryEntry NewEntry;
 		NewEntry.ChannelTag = ChannelTag;
 		NewEntry.ListenerClass = ListenerClass;
-		ListenerHistory.Add(MoveTemp(NewEntry));
-		FoundEntry = &ListenerHistory.Last();
+		if (const FEventBusBakedListenerEntry* const BakedEntry = FindBakedListener(ChannelTag, ListenerClass))
+		{
+			NewEntry.KnownFunctions = BakedEntry->KnownFunctions;
+		}
+		EntryIndex = ListenerHistory.Add(MoveTemp(NewEntry));
+		ListenerIndex.Add(Key, EntryIndex);
+		ListenerLru.Add();
 	}
 
-	FoundEntry->KnownFunctions.Add(FunctionName);
-	SortAndUniqueNames(FoundEntry->KnownFunctions);
-	const int32 KnownFunctionsCount = FoundEntry->KnownFunctions.Num();
+	TArray<FName>& KnownFunctions = ListenerHistory[EntryIndex].KnownFunctions;
+	InsertSortedName(KnownFunctions, FunctionName);
+	const int32 KnownFunctionsCount = KnownFunctions.Num();
 
-	TrimOldestEntries(ListenerHistory, MaxListenerHistoryEntries);
+	// The new entry is most recent, so eviction never hits EntryIndex.
+	EnforceListenerCapacity();
+	IndexedListenerCount = ListenerHistory.Num();
 
-	UE_LOG(LogNFLEventBus, Log,
+	NFL_EVENTBUS_FACADE_LOG(Call.ShouldLog(),
 		TEXT("Registry RecordListenerBinding updated. Registry=%s Channel=%s ListenerClass=%s Function=%s KnownCount=%d"),
 		*GetNameSafe(this),
 		*ChannelTag.ToString(),
@@ -173,40 +422,52 @@ TArray<FName> UEventBusRegistryAsset::GetKnownListenerFunctions(const FGameplayT
 		return Result;
 	}
 
-	for (const FEventBusListenerHistoryEntry& Entry : ListenerHistory)
+	if (AreHistoryIndexesCurrent() && !bHasDuplicateListenerKeys)
 	{
-		UClass* const EntryClass = Entry.ListenerClass.Get();
-		if (!::IsValid(EntryClass))
+		if (const int32* FoundIndex = ListenerIndex.Find(MakeListenerKey(ChannelTag, ListenerClass)))
 		{
-			continue;
+			Result = ListenerHistory[*FoundIndex].KnownFunctions;
+			ListenerLru.Touch(*FoundIndex);
 		}
-
-		// Keep lookup strict to class-local history so picker results do not include inherited members.
-		if (Entry.ChannelTag == ChannelTag && ListenerClass == EntryClass)
+	}
+	else
+	{
+		// History was edited directly since the last reindex; merge every matching entry.
+		for (const FEventBusListenerHistoryEntry& Entry : ListenerHistory)
 		{
-			for (const FName FunctionName : Entry.KnownFunctions)
+			UClass* const EntryClass = Entry.ListenerClass.Get();
+			if (!::IsValid(EntryClass))
+			{
+				continue;
+			}
+
+			// Keep lookup strict to class-local history so picker results do not include inherited members.
+			if (Entry.ChannelTag == ChannelTag && ListenerClass == EntryClass)
 			{
-				if (!FunctionName.IsNone())
-				{
-					Result.Add(FunctionName);
-				}
+				Result.Append(Entry.KnownFunctions);
 			}
 		}
+		SortAndUniqueNames(Result);
 	}
 
-	TSet<FName> UniqueNames;
-	for (const FName Name : Result)
+	if (Result.IsEmpty())
 	{
-		UniqueNames.Add(Name);
+		if (const FEventBusBakedListenerEntry* const BakedEntry = FindBakedListener(ChannelTag, ListenerClass))
+		{
+			Result = BakedEntry->KnownFunctions;
+		}
 	}
 
-	Result = UniqueNames.Array();
-	Result.Sort([](const FName& A, const FName& B)
+	if (Result.IsEmpty())
 	{
-		return A.Compare(B) < 0;
-	});
+		++Stats.LookupMisses;
+	}
+	else
+	{
+		++Stats.LookupHits;
+	}
 
-	UE_LOG(LogNFLEventBus, Log,
+	NFL_EVENTBUS_FACADE_LOG(Nfrrlib::EventBus::FEventBusBlueprintDiagnostics::GetLogMode() == Nfrrlib::EventBus::EEventBusBlueprintLogMode::Verbose,
 		TEXT("Registry GetKnownListenerFunctions result. Registry=%s Channel=%s ListenerClass=%s Count=%d"),
 		*GetNameSafe(this),
 		*ChannelTag.ToString(),
@@ -225,6 +486,14 @@ void UEventBusRegistryAsset::ResetHistory()
 
 	PublisherHistory.Reset();
 	ListenerHistory.Reset();
+	PublisherIndex.Reset();
+	ListenerIndex.Reset();
+	IndexedPublisherCount = 0;
+	IndexedListenerCount = 0;
+	IndexedEditSerial = HistoryEditSerial;
+	bHasDuplicateListenerKeys = false;
+	PublisherLru.Reset(0);
+	ListenerLru.Reset(0);
 
 	UE_LOG(LogNFLEventBus, Log,
 		TEXT("Registry ResetHistory completed. Registry=%s RemovedPublishers=%d RemovedListeners=%d"),
@@ -232,3 +501,276 @@ void UEventBusRegistryAsset::ResetHistory()
 		PublisherCount,
 		ListenerCount);
 }
+
+/**
+ * @brief Record and reset keep the indexed sizes and serial in sync; direct edits change one or the other.
+ */
+bool UEventBusRegistryAsset::AreHistoryIndexesCurrent() const
+{
+	return IndexedEditSerial == HistoryEditSerial &&
+		IndexedPublisherCount == PublisherHistory.Num() &&
+		IndexedListenerCount == ListenerHistory.Num();
+}
+
+void UEventBusRegistryAsset::EnsureHistoryIndexes()
+{
+	if (!AreHistoryIndexesCurrent())
+	{
+		RebuildHistoryIndexes();
+	}
+}
+
+/**
+ * @brief Full O(n) pass; runs after direct edits only. Recency restarts from array order.
+ */
+void UEventBusRegistryAsset::RebuildHistoryIndexes()
+{
+	PublisherHistory.RemoveAll([](const FEventBusPublisherHistoryEntry& Entry)
+	{
+		return !Entry.ChannelTag.IsValid() ||
+			!::IsValid(Entry.PublisherClass.Get()) ||
+			Entry.DelegatePropertyName.IsNone();
+	});
+
+	for (FEventBusListenerHistoryEntry& Entry : ListenerHistory)
+	{
+		SortAndUniqueNames(Entry.KnownFunctions);
+	}
+	ListenerHistory.RemoveAll([](const FEventBusListenerHistoryEntry& Entry)
+	{
+		return !Entry.ChannelTag.IsValid() ||
+			!::IsValid(Entry.ListenerClass.Get()) ||
+			Entry.KnownFunctions.IsEmpty();
+	});
+
+	PublisherIndex.Reset();
+	PublisherIndex.Reserve(PublisherHistory.Num());
+	for (int32 Index = 0; Index < PublisherHistory.Num(); ++Index)
+	{
+		const FEventBusPublisherHistoryEntry& Entry = PublisherHistory[Index];
+		PublisherIndex.FindOrAdd(MakePublisherKey(Entry.ChannelTag, Entry.PublisherClass.Get(), Entry.DelegatePropertyName), Index);
+	}
+
+	ListenerIndex.Reset();
+	ListenerIndex.Reserve(ListenerHistory.Num());
+	bHasDuplicateListenerKeys = false;
+	for (int32 Index = 0; Index < ListenerHistory.Num(); ++Index)
+	{
+		const FEventBusListenerHistoryEntry& Entry = ListenerHistory[Index];
+		const Nfrrlib::EventBus::FRegistryHistoryKey Key = MakeListenerKey(Entry.ChannelTag, Entry.ListenerClass.Get());
+		if (ListenerIndex.Contains(Key))
+		{
+			bHasDuplicateListenerKeys = true;
+			continue;
+		}
+		ListenerIndex.Add(Key, Index);
+	}
+
+	PublisherLru.Reset(PublisherHistory.Num());
+	ListenerLru.Reset(ListenerHistory.Num());
+	EnforcePublisherCapacity();
+	EnforceListenerCapacity();
+
+	IndexedPublisherCount = PublisherHistory.Num();
+	IndexedListenerCount = ListenerHistory.Num();
+	IndexedEditSerial = HistoryEditSerial;
+}
+
+/**
+ * @brief Prunes collected classes once per GC instead of once per record. Surviving entries keep their slots and
+ * recency; only history edited directly since the last reindex gets the full rebuild.
+ */
+void UEventBusRegistryAsset::HandlePostGarbageCollect()
+{
+	const int32 PublisherCount = PublisherHistory.Num();
+	const int32 ListenerCount = ListenerHistory.Num();
+	if (!AreHistoryIndexesCurrent())
+	{
+		RebuildHistoryIndexes();
+	}
+	else
+	{
+		RemoveCollectedSlots(PublisherHistory, PublisherIndex, PublisherLru,
+			[](const FEventBusPublisherHistoryEntry& Entry)
+			{
+				return Entry.PublisherClass.Get();
+			},
+			[](const FEventBusPublisherHistoryEntry& Entry)
+			{
+				return MakePublisherKey(Entry.ChannelTag, Entry.PublisherClass.Get(), Entry.DelegatePropertyName);
+			});
+		RemoveCollectedSlots(ListenerHistory, ListenerIndex, ListenerLru,
+			[](const FEventBusListenerHistoryEntry& Entry)
+			{
+				return Entry.ListenerClass.Get();
+			},
+			[](const FEventBusListenerHistoryEntry& Entry)
+			{
+				return MakeListenerKey(Entry.ChannelTag, Entry.ListenerClass.Get());
+			});
+		IndexedPublisherCount = PublisherHistory.Num();
+		IndexedListenerCount = ListenerHistory.Num();
+	}
+
+	UE_CLOG(PublisherHistory.Num() != PublisherCount || ListenerHistory.Num() != ListenerCount, LogNFLEventBus, Verbose,
+		TEXT("Registry pruned after GC. Registry=%s RemovedPublishers=%d RemovedListeners=%d"),
+		*GetNameSafe(this),
+		PublisherCount - PublisherHistory.Num(),
+		ListenerCount - ListenerHistory.Num());
+}
+
+/**
+ * @brief Evicts from the recency tail; each eviction is a swap removal.
+ */
+void UEventBusRegistryAsset::EnforcePublisherCapacity()
+{
+	const int32 MaxEntries = GetDefault<UEventBusSettings>()->MaxPublisherHistoryEntries;
+	while (MaxEntries > 0 && PublisherHistory.Num() > MaxEntries)
+	{
+		RemoveHistorySlot(PublisherHistory, PublisherIndex, PublisherLru, PublisherLru.GetLeastRecent(),
+			[](const FEventBusPublisherHistoryEntry& Entry)
+			{
+				return MakePublisherKey(Entry.ChannelTag, Entry.PublisherClass.Get(), Entry.DelegatePropertyName);
+			});
+		++Stats.Evictions;
+	}
+}
+
+/**
+ * @brief Evicts from the recency tail; each eviction is a swap removal.
+ */
+void UEventBusRegistryAsset::EnforceListenerCapacity()
+{
+	const int32 MaxEntries = GetDefault<UEventBusSettings>()->MaxListenerHistoryEntries;
+	while (MaxEntries > 0 && ListenerHistory.Num() > MaxEntries)
+	{
+		RemoveHistorySlot(ListenerHistory, ListenerIndex, ListenerLru, ListenerLru.GetLeastRecent(),
+			[](const FEventBusListenerHistoryEntry& Entry)
+			{
+				return MakeListenerKey(Entry.ChannelTag, Entry.ListenerClass.Get());
+			});
+		++Stats.Evictions;
+	}
+}
+
+/**
+ * @brief Copies both history arrays, then reindexes so recency restarts from Source's array order.
+ */
+void UEventBusRegistryAsset::CopyHistoryFrom(const UEventBusRegistryAsset& Source)
+{
+	PublisherHistory = Source.PublisherHistory;
+	ListenerHistory = Source.ListenerHistory;
+	RebuildHistoryIndexes();
+}
+
+/**
+ * @brief Stores class paths rather than class references, so the saved asset pulls in no Blueprint class.
+ */
+void UEventBusRegistryAsset::BakeFrom(const UEventBusRegistryAsset& Source)
+{
+	BakedPublishers.Reset(Source.PublisherHistory.Num());
+	for (const FEventBusPublisherHistoryEntry& Entry : Source.PublisherHistory)
+	{
+		if (!Entry.ChannelTag.IsValid() || !::IsValid(Entry.PublisherClass.Get()) || Entry.DelegatePropertyName.IsNone())
+		{
+			continue;
+		}
+
+		FEventBusBakedPublisherEntry& BakedEntry = BakedPublishers.AddDefaulted_GetRef();
+		BakedEntry.ChannelTag = Entry.ChannelTag;
+		BakedEntry.PublisherClassPath = FSoftClassPath(Entry.PublisherClass.Get());
+		BakedEntry.DelegatePropertyName = Entry.DelegatePropertyName;
+	}
+
+	BakedListeners.Reset(Source.ListenerHistory.Num());
+	for (const FEventBusListenerHistoryEntry& Entry : Source.ListenerHistory)
+	{
+		if (!Entry.ChannelTag.IsValid() || !::IsValid(Entry.ListenerClass.Get()) || Entry.KnownFunctions.IsEmpty())
+		{
+			continue;
+		}
+
+		FEventBusBakedListenerEntry& BakedEntry = BakedListeners.AddDefaulted_GetRef();
+		BakedEntry.ChannelTag = Entry.ChannelTag;
+		BakedEntry.ListenerClassPath = FSoftClassPath(Entry.ListenerClass.Get());
+		BakedEntry.KnownFunctions = Entry.KnownFunctions;
+		SortAndUniqueNames(BakedEntry.KnownFunctions);
+	}
+}
+
+/**
+ * @brief Listener entries recorded before the baked source arrived take its functions now, in place, so their
+ * slots and recency are untouched.
+ */
+void UEventBusRegistryAsset::SetBakedSource(UEventBusRegistryAsset* Baked)
+{
+	BakedSource = Baked;
+	BakedListenerIndex.Reset();
+	if (!Baked)
+	{
+		return;
+	}
+
+	BakedListenerIndex.Reserve(Baked->BakedListeners.Num());
+	for (int32 Index = 0; Index < Baked->BakedListeners.Num(); ++Index)
+	{
+		const FEventBusBakedListenerEntry& Entry = Baked->BakedListeners[Index];
+		if (Entry.ChannelTag.IsValid() && Entry.ListenerClassPath.IsValid())
+		{
+			BakedListenerIndex.FindOrAdd(Nfrrlib::EventBus::FRegistryBakedKey{Entry.ChannelTag, Entry.ListenerClassPath.GetAssetPath()}, Index);
+		}
+	}
+
+	for (FEventBusListenerHistoryEntry& Entry : ListenerHistory)
+	{
+		if (const FEventBusBakedListenerEntry* const BakedEntry = FindBakedListener(Entry.ChannelTag, Entry.ListenerClass.Get()))
+		{
+			for (const FName FunctionName : BakedEntry->KnownFunctions)
+			{
+				InsertSortedName(Entry.KnownFunctions, FunctionName);
+			}
+		}
+	}
+}
+
+/**
+ * @brief One hash lookup keyed by the class path; unloaded baked classes stay unloaded.
+ */
+const FEventBusBakedListenerEntry* UEventBusRegistryAsset::FindBakedListener(const FGameplayTag& ChannelTag, const UClass* ListenerClass) const
+{
+	if (BakedListenerIndex.IsEmpty() || !BakedSource || !ListenerClass)
+	{
+		return nullptr;
+	}
+
+	const int32* const FoundIndex = BakedListenerIndex.Find(Nfrrlib::EventBus::FRegistryBakedKey{ChannelTag, ListenerClass->GetClassPathName()});
+	return FoundIndex && BakedSource->BakedListeners.IsValidIndex(*FoundIndex) ? &BakedSource->BakedListeners[*FoundIndex] : nullptr;
+}
+
+/**
+ * @brief Compile-time gate first, then the project setting.
+ */
+bool UEventBusRegistryAsset::IsRecordingEnabled()
+{
+#if NFL_EVENTBUS_RUNTIME_HISTORY
+	return GetDefault<UEventBusSettings>()->bRecordRuntimeHistory;
+#else
+	return false;
+#endif
+}
+
+/**
+ * @brief Returns lookup and eviction counters.
+ */
+const Nfrrlib::EventBus::FRegistryHistoryStats& UEventBusRegistryAsset::GetStats() const
+{
+	return Stats;
+}
+
+/**
+ * @brief Zeroes lookup and eviction counters without touching history.
+ */
+void UEventBusRegistryAsset::ResetStats()
+{
+	Stats = Nfrrlib::EventBus::FRegistryHistoryStats();
+}
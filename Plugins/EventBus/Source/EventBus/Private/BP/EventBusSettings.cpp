@@ -0,0 +1,10 @@
+#include "EventBus/BP/EventBusSettings.h"
+
+/**
+ * @brief Places the settings page under the Plugins category.
+ */
+UEventBusSettings::UEventBusSettings()
+{
+	CategoryName = TEXT("Plugins");
+	SectionName = TEXT("EventBus");
+}
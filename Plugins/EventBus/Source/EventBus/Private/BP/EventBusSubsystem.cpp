@@ -1,8 +1,57 @@
 #include "EventBus/BP/EventBusSubsystem.h"
 
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Misc/CoreDelegates.h"
 #include "Subsystems/SubsystemCollection.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
 
 #include "EventBus/BP/EventBusRegistryAsset.h"
+#include "EventBus/BP/EventBusSettings.h"
+
+namespace
+{
+	/**
+	 * @brief World to subsystem cache behind FindCachedForWorld; the last hit is kept outside the map so
+	 * single-world games never hash.
+	 */
+	struct FSubsystemWorldCache final
+	{
+		TObjectKey<UWorld> LastWorld;
+		TWeakObjectPtr<UEventBusSubsystem> LastSubsystem;
+		TMap<TObjectKey<UWorld>, TWeakObjectPtr<UEventBusSubsystem>> Entries;
+		Nfrrlib::EventBus::FEventBusSubsystemCacheStats Stats;
+	};
+
+	FSubsystemWorldCache& GetSubsystemWorldCache()
+	{
+		static FSubsystemWorldCache Cache;
+		return Cache;
+	}
+
+	/**
+	 * @brief Drops cached entries matching Predicate and clears the last-hit slot when it was one of them.
+	 */
+	template <typename PredicateType>
+	void RemoveCachedWorlds(PredicateType&& Predicate)
+	{
+		FSubsystemWorldCache& Cache = GetSubsystemWorldCache();
+		for (auto It = Cache.Entries.CreateIterator(); It; ++It)
+		{
+			if (Predicate(It.Key(), It.Value()))
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		if (Predicate(Cache.LastWorld, Cache.LastSubsystem))
+		{
+			Cache.LastWorld = TObjectKey<UWorld>();
+			Cache.LastSubsystem.Reset();
+		}
+	}
+}
 
 /**
  * @brief Emits subsystem startup diagnostics for runtime tracing.
@@ -18,7 +67,28 @@ void UEventBusSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 			UEventBusRegistryAsset::StaticClass(),
 			NAME_None,
 			RF_Transient);
+		RuntimeRegistry->EnableGarbageCollectPruning();
+	}
+
+	const TSoftObjectPtr<UEventBusRegistryAsset>& BakedRegistry = GetDefault<UEventBusSettings>()->BakedRegistry;
+	if (UEventBusRegistryAsset* const LoadedBakedRegistry = BakedRegistry.Get())
+	{
+		UseBakedRegistry(LoadedBakedRegistry);
 	}
+	else if (!BakedRegistry.IsNull())
+	{
+		// Startup never blocks on the baked registry.
+		LoadPackageAsync(
+			BakedRegistry.GetLongPackageName(),
+			FLoadPackageAsyncDelegate::CreateUObject(this, &UEventBusSubsystem::HandleBakedRegistryLoaded));
+	}
+
+	Scopes = MakeUnique<Nfrrlib::EventBus::FEventBusScopeRegistry>(EventBus);
+
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UEventBusSubsystem::FlushBatchChannelsAtEndOfFrame);
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UEventBusSubsystem::HandlePostGarbageCollect);
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &UEventBusSubsystem::HandleWorldCleanup);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UEventBusSubsystem::HandleLevelRemovedFromWorld);
 
 	UE_LOG(LogNFLEventBus, Log,
 		TEXT("EventBusSubsystem::Initialize. GameInstance=%s RuntimeRegistry=%s"),
@@ -36,11 +106,147 @@ void UEventBusSubsystem::Deinitialize()
 		*GetNameSafe(GetGameInstance()),
 		*GetNameSafe(RuntimeRegistry.Get()));
 
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	PostGarbageCollectHandle.Reset();
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	WorldCleanupHandle.Reset();
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	LevelRemovedHandle.Reset();
+	RemoveCachedWorlds([this](const TObjectKey<UWorld>&, const TWeakObjectPtr<UEventBusSubsystem>& Cached)
+	{
+		// Compared by object key: during teardown the weak pointer may no longer resolve to this.
+		return Cached.HasSameIndexAndSerialNumber(TWeakObjectPtr<UEventBusSubsystem>(this));
+	});
+
+	// Scopes retract forwarded publishers from EventBus, so they go first.
+	Scopes.Reset();
 	EventBus.Reset();
 	RuntimeRegistry = nullptr;
 	Super::Deinitialize();
 }
 
+/**
+ * @brief Resolves the asset through the settings path; the subsystem may have deinitialized since the request.
+ */
+void UEventBusSubsystem::HandleBakedRegistryLoaded(
+	const FName& PackageName,
+	UPackage* NFL_EVENTBUS_MAYBE_UNUSED Package,
+	const EAsyncLoadingResult::Type Result)
+{
+	UEventBusRegistryAsset* const Baked = GetDefault<UEventBusSettings>()->BakedRegistry.Get();
+	if (Result != EAsyncLoadingResult::Succeeded || !Baked)
+	{
+		UE_LOG(LogNFLEventBus, Warning,
+			TEXT("EventBusSubsystem baked registry load failed. Package=%s Result=%d"),
+			*PackageName.ToString(),
+			static_cast<int32>(Result));
+		return;
+	}
+
+	UseBakedRegistry(Baked);
+}
+
+/**
+ * @brief Only indexes the baked entries by class path; no Blueprint class is loaded.
+ */
+void UEventBusSubsystem::UseBakedRegistry(UEventBusRegistryAsset* Baked)
+{
+	if (!::IsValid(RuntimeRegistry.Get()))
+	{
+		return;
+	}
+
+	RuntimeRegistry->SetBakedSource(Baked);
+	UE_LOG(LogNFLEventBus, Log,
+		TEXT("EventBusSubsystem loaded baked registry. Registry=%s BakedPublishers=%d BakedListeners=%d"),
+		*GetPathNameSafe(Baked),
+		Baked->BakedPublishers.Num(),
+		Baked->BakedListeners.Num());
+}
+
+/**
+ * @brief Delivers batched channel payloads accumulated during the frame and samples per-channel CSV stats.
+ */
+void UEventBusSubsystem::FlushBatchChannelsAtEndOfFrame()
+{
+	if (Scopes)
+	{
+		Scopes->FlushBatchChannels();
+	}
+	EventBus.FlushBatchChannels();
+	EventBus.RecordCsvChannelStats();
+}
+
+/**
+ * @brief Sweeps once per GC rather than per mutation, so presence drops even on channels nobody touches.
+ */
+void UEventBusSubsystem::HandlePostGarbageCollect()
+{
+	int32 DroppedCount = Scopes ? Scopes->SweepStaleBindings() : 0;
+	DroppedCount += EventBus.SweepStaleBindings();
+	UE_CLOG(DroppedCount > 0, LogNFLEventBus, Verbose,
+		TEXT("EventBusSubsystem swept after GC. GameInstance=%s DroppedBindings=%d"),
+		*GetNameSafe(GetGameInstance()),
+		DroppedCount);
+}
+
+/**
+ * @brief Releases world scopes and every level or actor scope nested inside the world.
+ */
+void UEventBusSubsystem::HandleWorldCleanup(
+	UWorld* World,
+	const bool NFL_EVENTBUS_MAYBE_UNUSED bSessionEnded,
+	const bool NFL_EVENTBUS_MAYBE_UNUSED bCleanupResources)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	const TObjectKey<UWorld> WorldKey(World);
+	RemoveCachedWorlds([&WorldKey](const TObjectKey<UWorld>& CachedWorld, const TWeakObjectPtr<UEventBusSubsystem>&)
+	{
+		return CachedWorld == WorldKey;
+	});
+
+	if (!Scopes)
+	{
+		return;
+	}
+
+	const int32 ReleasedCount = Scopes->ReleaseScopesWithin(World);
+	UE_CLOG(ReleasedCount > 0, LogNFLEventBus, Verbose,
+		TEXT("EventBusSubsystem::HandleWorldCleanup. World=%s ReleasedScopes=%d"),
+		*GetNameSafe(World),
+		ReleasedCount);
+}
+
+/**
+ * @brief Releases scopes of a streamed-out level; a null level means every level left the world.
+ */
+void UEventBusSubsystem::HandleLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	if (!Scopes)
+	{
+		return;
+	}
+
+	const UObject* const Outer = Level ? static_cast<const UObject*>(Level) : static_cast<const UObject*>(World);
+	if (!Outer)
+	{
+		return;
+	}
+
+	const int32 ReleasedCount = Scopes->ReleaseScopesWithin(Outer);
+	UE_CLOG(ReleasedCount > 0, LogNFLEventBus, Verbose,
+		TEXT("EventBusSubsystem::HandleLevelRemovedFromWorld. Level=%s World=%s ReleasedScopes=%d"),
+		*GetNameSafe(Level),
+		*GetNameSafe(World),
+		ReleasedCount);
+}
+
 /**
  * @brief Returns mutable EventBus runtime owned by this subsystem.
  */
@@ -49,6 +255,23 @@ Nfrrlib::EventBus::FEventBus& UEventBusSubsystem::GetEventBus()
 	return EventBus;
 }
 
+/**
+ * @brief Returns scoped sub-bus tree rooted at the game-instance bus.
+ */
+Nfrrlib::EventBus::FEventBusScopeRegistry& UEventBusSubsystem::GetScopes()
+{
+	check(Scopes);
+	return *Scopes;
+}
+
+/**
+ * @brief Resolves the nearest scope bus for a context object.
+ */
+Nfrrlib::EventBus::FEventBus& UEventBusSubsystem::GetEventBusForContext(const UObject* ContextObject)
+{
+	return Scopes ? Scopes->ResolveBus(ContextObject) : EventBus;
+}
+
 /**
  * @brief Returns active runtime registry used for blueprint bind history.
  */
@@ -56,3 +279,131 @@ const UEventBusRegistryAsset* UEventBusSubsystem::GetRuntimeRegistry() const
 {
 	return RuntimeRegistry.Get();
 }
+
+/**
+ * @brief Visits the game-instance bus first so scope output reads top-down.
+ */
+void UEventBusSubsystem::ForEachBus(const TFunctionRef<void(const FString& BusName, const Nfrrlib::EventBus::FEventBus& Bus)> Visitor) const
+{
+	Visitor(GetNameSafe(GetGameInstance()), EventBus);
+	if (!Scopes)
+	{
+		return;
+	}
+
+	Scopes->ForEachScope([&Visitor](const UObject* ScopeOwner, const Nfrrlib::EventBus::FEventBus& ScopeBus)
+	{
+		Visitor(GetPathNameSafe(ScopeOwner), ScopeBus);
+	});
+}
+
+/**
+ * @brief Clears timings on the game-instance bus and each scope bus.
+ */
+void UEventBusSubsystem::ResetListenerTimings()
+{
+	EventBus.ResetListenerTimings();
+	if (Scopes)
+	{
+		Scopes->ResetListenerTimings();
+	}
+}
+
+/**
+ * @brief Dumps the game-instance bus first, then each scope bus with its owner.
+ */
+void UEventBusSubsystem::DumpMemory(FOutputDevice& Ar) const
+{
+	ForEachBus([&Ar](const FString& BusName, const Nfrrlib::EventBus::FEventBus& Bus)
+	{
+		Ar.Logf(TEXT("EventBus memory. Bus=%s"), *BusName);
+		Bus.DumpMemory(Ar);
+	});
+
+	if (Scopes)
+	{
+		Ar.Logf(TEXT("Scopes=%d ScopeOwnedBytes=%llu"), Scopes->GetNumScopes(), static_cast<uint64>(Scopes->GetAllocatedSize()));
+	}
+}
+
+/**
+ * @brief Answers from the last-hit slot first, then the map; dead subsystems count as misses and are evicted.
+ */
+UEventBusSubsystem* UEventBusSubsystem::FindCachedForWorld(const UWorld* World)
+{
+	FSubsystemWorldCache& Cache = GetSubsystemWorldCache();
+	if (!World)
+	{
+		++Cache.Stats.Misses;
+		return nullptr;
+	}
+
+	const TObjectKey<UWorld> WorldKey(World);
+	if (Cache.LastWorld == WorldKey)
+	{
+		if (UEventBusSubsystem* const Subsystem = Cache.LastSubsystem.Get())
+		{
+			++Cache.Stats.Hits;
+			return Subsystem;
+		}
+	}
+	else if (const TWeakObjectPtr<UEventBusSubsystem>* const Cached = Cache.Entries.Find(WorldKey))
+	{
+		if (UEventBusSubsystem* const Subsystem = Cached->Get())
+		{
+			Cache.LastWorld = WorldKey;
+			Cache.LastSubsystem = *Cached;
+			++Cache.Stats.Hits;
+			return Subsystem;
+		}
+	}
+
+	Cache.Entries.Remove(WorldKey);
+	if (Cache.LastWorld == WorldKey)
+	{
+		Cache.LastWorld = TObjectKey<UWorld>();
+		Cache.LastSubsystem.Reset();
+	}
+	++Cache.Stats.Misses;
+	return nullptr;
+}
+
+/**
+ * @brief Stores the resolution result and makes it the last hit.
+ */
+void UEventBusSubsystem::CacheForWorld(const UWorld* World, UEventBusSubsystem* Subsystem)
+{
+	if (!World || !::IsValid(Subsystem))
+	{
+		return;
+	}
+
+	FSubsystemWorldCache& Cache = GetSubsystemWorldCache();
+	const TObjectKey<UWorld> WorldKey(World);
+	Cache.Entries.Add(WorldKey, Subsystem);
+	Cache.LastWorld = WorldKey;
+	Cache.LastSubsystem = Subsystem;
+}
+
+/**
+ * @brief Returns cache counters with the current world count.
+ */
+Nfrrlib::EventBus::FEventBusSubsystemCacheStats UEventBusSubsystem::GetCacheStats()
+{
+	const FSubsystemWorldCache& Cache = GetSubsystemWorldCache();
+	Nfrrlib::EventBus::FEventBusSubsystemCacheStats Stats = Cache.Stats;
+	Stats.NumWorlds = Cache.Entries.Num();
+	return Stats;
+}
+
+/**
+ * @brief Empties the cache; the next facade call per world resolves from scratch.
+ */
+void UEventBusSubsystem::ResetCache()
+{
+	FSubsystemWorldCache& Cache = GetSubsystemWorldCache();
+	Cache.Entries.Reset();
+	Cache.LastWorld = TObjectKey<UWorld>();
+	Cache.LastSubsystem.Reset();
+	Cache.Stats = Nfrrlib::EventBus::FEventBusSubsystemCacheStats();
+}
@@ -0,0 +1,319 @@
+#include "EventBus/Core/ConcurrentEventBus.h"
+
+#include "Async/Mutex.h"
+#include "Async/UniqueLock.h"
+
+#include "EventBus/Core/EventBus.h"
+#include "EventBus/Core/EventBusSnapshots.h"
+
+namespace Nfrrlib::EventBus
+{
+	namespace
+	{
+		/**
+		 * @brief One listener; shared by every channel view that lists it and retired when removed.
+		 */
+		struct FConcurrentListener final
+		{
+			uint64 ListenerId = 0;
+			TFunction<void(const void*)> Callback;
+		};
+
+		/**
+		 * @brief Immutable listener list of one channel.
+		 */
+		struct FConcurrentChannelView final
+		{
+			FEventPayloadTypeId PayloadTypeId;
+			/** @brief Display name given at registration; used in logs only. */
+			FName PayloadTypeName = NAME_None;
+			TArray<const FConcurrentListener*> Listeners;
+		};
+
+		/**
+		 * @brief Immutable channel map of one shard. Channel views are shared between consecutive shard views,
+		 * so retiring a shard view never deletes them.
+		 */
+		struct FConcurrentShardView final
+		{
+			TMap<FGameplayTag, const FConcurrentChannelView*> Channels;
+		};
+	}
+
+	/**
+	 * @brief Lock, snapshot and grace-period domain of one shard, on its own cache line.
+	 */
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FConcurrentEventBus::FShard final
+	{
+		/** @brief Serializes writers of this shard; readers never take it. */
+		UE::FMutex Mutex;
+		TEventBusSnapshotCell<FConcurrentShardView> View;
+		FEventBusEpochDomain Domain;
+
+		/** @brief Returns the channel view in the current snapshot, or nullptr. Caller holds Mutex or a read scope. */
+		const FConcurrentChannelView* FindChannel(const FGameplayTag& ChannelTag) const
+		{
+			const FConcurrentShardView* const ShardView = View.Load();
+			const FConcurrentChannelView* const* const ChannelView = ShardView ? ShardView->Channels.Find(ChannelTag) : nullptr;
+			return ChannelView ? *ChannelView : nullptr;
+		}
+
+		/** @brief Publishes a shard view with ChannelTag mapped to NewChannel, or removed when NewChannel is null. */
+		void PublishChannel(const FGameplayTag& ChannelTag, const FConcurrentChannelView* NewChannel)
+		{
+			FConcurrentShardView* const NewView = View.Load() ? new FConcurrentShardView(*View.Load()) : new FConcurrentShardView();
+			if (NewChannel)
+			{
+				NewView->Channels.Add(ChannelTag, NewChannel);
+			}
+			else
+			{
+				NewView->Channels.Remove(ChannelTag);
+			}
+			View.Publish(NewView, Domain);
+		}
+	};
+
+	FConcurrentEventBus::FConcurrentEventBus(const int32 InShardCount)
+	{
+		const int32 ShardCount = FMath::Max(InShardCount, 1);
+		Shards.Reserve(ShardCount);
+		for (int32 Index = 0; Index < ShardCount; ++Index)
+		{
+			Shards.Add(MakeUnique<FShard>());
+		}
+	}
+
+	/**
+	 * @brief Current views own their channels and listeners; retired views are freed by each shard's domain.
+	 */
+	FConcurrentEventBus::~FConcurrentEventBus()
+	{
+		for (const TUniquePtr<FShard>& Shard : Shards)
+		{
+			if (const FConcurrentShardView* const ShardView = Shard->View.Load())
+			{
+				for (const TPair<FGameplayTag, const FConcurrentChannelView*>& Pair : ShardView->Channels)
+				{
+					for (const FConcurrentListener* const Listener : Pair.Value->Listeners)
+					{
+						delete Listener;
+					}
+					delete Pair.Value;
+				}
+			}
+		}
+	}
+
+	bool FConcurrentEventBus::RegisterChannelErased(
+		const FGameplayTag& ChannelTag,
+		const FEventPayloadTypeId PayloadTypeId,
+		const FName PayloadTypeName)
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("RegisterConcurrentChannel"), ChannelTag, Error) ||
+			!FPolicies::FValidation::ValidateName(PayloadTypeName, Error))
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("RegisterConcurrentChannel failed. Error=%s Channel=%s Payload=%s"),
+				LexToString(Error),
+				*ChannelTag.ToString(),
+				*PayloadTypeName.ToString());
+			return false;
+		}
+
+		FShard& Shard = GetShard(ChannelTag);
+		UE::TUniqueLock Lock(Shard.Mutex);
+		if (const FConcurrentChannelView* const Existing = Shard.FindChannel(ChannelTag))
+		{
+			if (Existing->PayloadTypeId != PayloadTypeId)
+			{
+				UE_LOG(LogNFLEventBus, Warning, TEXT("RegisterConcurrentChannel failed. Error=%s Channel=%s Existing=%s Requested=%s"),
+					LexToString(EEventBusError::PayloadTypeMismatch),
+					*ChannelTag.ToString(),
+					*Existing->PayloadTypeName.ToString(),
+					*PayloadTypeName.ToString());
+				return false;
+			}
+			return true;
+		}
+
+		FConcurrentChannelView* const NewChannel = new FConcurrentChannelView();
+		NewChannel->PayloadTypeId = PayloadTypeId;
+		NewChannel->PayloadTypeName = PayloadTypeName;
+		Shard.PublishChannel(ChannelTag, NewChannel);
+		return true;
+	}
+
+	bool FConcurrentEventBus::UnregisterChannel(const FGameplayTag& ChannelTag)
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("UnregisterConcurrentChannel"), ChannelTag, Error))
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("UnregisterConcurrentChannel failed. Error=%s Channel=%s"),
+				LexToString(Error),
+				*ChannelTag.ToString());
+			return false;
+		}
+
+		FShard& Shard = GetShard(ChannelTag);
+		UE::TUniqueLock Lock(Shard.Mutex);
+		const FConcurrentChannelView* const Existing = Shard.FindChannel(ChannelTag);
+		if (!Existing)
+		{
+			return false;
+		}
+
+		Shard.PublishChannel(ChannelTag, nullptr);
+		for (const FConcurrentListener* const Listener : Existing->Listeners)
+		{
+			Shard.Domain.Retire(Listener);
+		}
+		Shard.Domain.Retire(Existing);
+		return true;
+	}
+
+	bool FConcurrentEventBus::IsChannelRegistered(const FGameplayTag& ChannelTag) const
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("IsConcurrentChannelRegistered"), ChannelTag, Error))
+		{
+			return false;
+		}
+
+		const FShard& Shard = GetShard(ChannelTag);
+		const FEventBusEpochDomain::FReadScope ReadScope(Shard.Domain);
+		return Shard.FindChannel(ChannelTag) != nullptr;
+	}
+
+	int32 FConcurrentEventBus::GetListenerCount(const FGameplayTag& ChannelTag) const
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("GetConcurrentListenerCount"), ChannelTag, Error))
+		{
+			return 0;
+		}
+
+		const FShard& Shard = GetShard(ChannelTag);
+		const FEventBusEpochDomain::FReadScope ReadScope(Shard.Domain);
+		const FConcurrentChannelView* const ChannelView = Shard.FindChannel(ChannelTag);
+		return ChannelView ? ChannelView->Listeners.Num() : 0;
+	}
+
+	/**
+	 * @brief Copies the channel's listener list with the new entry appended; existing listeners are shared.
+	 */
+	FConcurrentListenerHandle FConcurrentEventBus::AddListenerErased(
+		const FGameplayTag& ChannelTag,
+		const FEventPayloadTypeId PayloadTypeId,
+		FErasedCallback&& Callback)
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("AddConcurrentListener"), ChannelTag, Error))
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("AddConcurrentListener failed. Error=%s Channel=%s"),
+				LexToString(Error),
+				*ChannelTag.ToString());
+			return {};
+		}
+
+		FShard& Shard = GetShard(ChannelTag);
+		UE::TUniqueLock Lock(Shard.Mutex);
+		const FConcurrentChannelView* const Existing = Shard.FindChannel(ChannelTag);
+		if (!Existing || Existing->PayloadTypeId != PayloadTypeId)
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("AddConcurrentListener failed. Error=%s Channel=%s Registered=%s"),
+				LexToString(Existing ? EEventBusError::PayloadTypeMismatch : EEventBusError::ChannelNotRegistered),
+				*ChannelTag.ToString(),
+				Existing ? *Existing->PayloadTypeName.ToString() : TEXT("None"));
+			return {};
+		}
+
+		FConcurrentListener* const Listener = new FConcurrentListener();
+		Listener->ListenerId = NextListenerId.fetch_add(1, std::memory_order_relaxed);
+		Listener->Callback = MoveTemp(Callback);
+
+		FConcurrentChannelView* const NewChannel = new FConcurrentChannelView();
+		NewChannel->PayloadTypeId = PayloadTypeId;
+		NewChannel->PayloadTypeName = Existing->PayloadTypeName;
+		NewChannel->Listeners.Reserve(Existing->Listeners.Num() + 1);
+		NewChannel->Listeners.Append(Existing->Listeners);
+		NewChannel->Listeners.Add(Listener);
+		Shard.PublishChannel(ChannelTag, NewChannel);
+		Shard.Domain.Retire(Existing);
+		return {ChannelTag, Listener->ListenerId};
+	}
+
+	bool FConcurrentEventBus::RemoveListener(const FConcurrentListenerHandle& Handle)
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!Handle.IsValid() || !FPolicies::EnterChannelCall(TEXT("RemoveConcurrentListener"), Handle.ChannelTag, Error))
+		{
+			return false;
+		}
+
+		FShard& Shard = GetShard(Handle.ChannelTag);
+		UE::TUniqueLock Lock(Shard.Mutex);
+		const FConcurrentChannelView* const Existing = Shard.FindChannel(Handle.ChannelTag);
+		const int32 ListenerIndex = Existing
+			? Existing->Listeners.IndexOfByPredicate([&Handle](const FConcurrentListener* const Listener)
+			{
+				return Listener->ListenerId == Handle.ListenerId;
+			})
+			: INDEX_NONE;
+		if (ListenerIndex == INDEX_NONE)
+		{
+			return false;
+		}
+
+		const FConcurrentListener* const Removed = Existing->Listeners[ListenerIndex];
+		FConcurrentChannelView* const NewChannel = new FConcurrentChannelView(*Existing);
+		NewChannel->Listeners.RemoveAt(ListenerIndex, EAllowShrinking::No);
+		Shard.PublishChannel(Handle.ChannelTag, NewChannel);
+		Shard.Domain.Retire(Existing);
+		Shard.Domain.Retire(Removed);
+		return true;
+	}
+
+	/**
+	 * @brief Invokes listeners inside one read scope, so every listener the snapshot lists stays alive until it returns.
+	 */
+	int32 FConcurrentEventBus::PublishErased(
+		const FGameplayTag& ChannelTag,
+		const FEventPayloadTypeId PayloadTypeId,
+		const void* const Payload) const
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("ConcurrentPublish"), ChannelTag, Error))
+		{
+			return 0;
+		}
+
+		const FShard& Shard = GetShard(ChannelTag);
+		const FEventBusEpochDomain::FReadScope ReadScope(Shard.Domain);
+		const FConcurrentChannelView* const ChannelView = Shard.FindChannel(ChannelTag);
+		if (!ChannelView || ChannelView->PayloadTypeId != PayloadTypeId)
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("ConcurrentPublish failed. Error=%s Channel=%s Registered=%s"),
+				LexToString(ChannelView ? EEventBusError::PayloadTypeMismatch : EEventBusError::ChannelNotRegistered),
+				*ChannelTag.ToString(),
+				ChannelView ? *ChannelView->PayloadTypeName.ToString() : TEXT("None"));
+			return 0;
+		}
+
+		for (const FConcurrentListener* const Listener : ChannelView->Listeners)
+		{
+			Listener->Callback(Payload);
+		}
+		return ChannelView->Listeners.Num();
+	}
+
+	int32 FConcurrentEventBus::GetShardCount() const
+	{
+		return Shards.Num();
+	}
+
+	FConcurrentEventBus::FShard& FConcurrentEventBus::GetShard(const FGameplayTag& ChannelTag) const
+	{
+		return *Shards[GetTypeHash(ChannelTag) % static_cast<uint32>(Shards.Num())];
+	}
+} // namespace Nfrrlib::EventBus
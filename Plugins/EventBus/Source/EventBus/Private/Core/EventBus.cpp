@@ -1,5 +1,6 @@
 #include "EventBus/Core/EventBus.h"
 
+#include "EventBus/Core/EventBusTrace.h"
 #include "EventBus/Core/EventBusValidation.h"
 #include "Core/EventChannelState.h"
 
@@ -28,9 +29,15 @@ namespace Nfrrlib::EventBus
 	 */
 	bool FEventBus::RegisterChannel(const FChannelRegistration& Registration)
 	{
+		NFL_EVENTBUS_TRACE_SCOPE(EventBus_RegisterChannel);
+		LLM_SCOPE_BYTAG(EventBus);
+		if (FEventBusRecorder::IsRecording())
+		{
+			FEventBusRecorder::RecordChannel(*this, EEventBusRecordOp::RegisterChannel, Registration.ChannelTag, Registration.bOwnsPublisherDelegates ? 1 : 0, NAME_None);
+		}
+
 		EEventBusError Error = EEventBusError::None;
-		if (!FEventBusValidation::EnsureGameThread(TEXT("RegisterChannel"), Error) ||
-			!FEventBusValidation::ValidateChannelTag(Registration.ChannelTag, Error))
+		if (!FPolicies::EnterChannelCall(TEXT("RegisterChannel"), Registration.ChannelTag, Error))
 		{
 			UE_LOG(LogNFLEventBus, Warning, TEXT("RegisterChannel failed. Error=%s Channel=%s"),
 				LexToString(Error),
@@ -38,6 +45,14 @@ namespace Nfrrlib::EventBus
 			return false;
 		}
 
+		if (NativeChannels.Contains(Registration.ChannelTag))
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("RegisterChannel failed. Error=%s Channel=%s"),
+				LexToString(EEventBusError::ChannelKindConflict),
+				*Registration.ChannelTag.ToString());
+			return false;
+		}
+
 		if (const Private::FEventChannelState* Existing = FindChannelState(Registration.ChannelTag))
 		{
 			if (!Existing->MatchesOwnershipPolicy(Registration.bOwnsPublisherDelegates))
@@ -53,18 +68,45 @@ namespace Nfrrlib::EventBus
 			return true;
 		}
 
-		Channels.Add(Registration.ChannelTag, FChannelStatePtr(new Private::FEventChannelState(Registration.bOwnsPublisherDelegates)));
+		const FChannelStatePtr& NewState = Channels.Add(Registration.ChannelTag, FChannelStatePtr(new Private::FEventChannelState(Registration.bOwnsPublisherDelegates)));
+		PublishTopology(Registration.ChannelTag, *NewState);
 		return true;
 	}
 
+	/**
+	 * @brief Registers a set of channels in bulk; each entry follows RegisterChannel semantics.
+	 */
+	bool FEventBus::RegisterChannels(const TConstArrayView<FChannelRegistration> Registrations)
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterCall(TEXT("RegisterChannels"), Error))
+		{
+			return false;
+		}
+
+		Channels.Reserve(Channels.Num() + Registrations.Num());
+
+		bool bAllRegistered = true;
+		for (const FChannelRegistration& Registration : Registrations)
+		{
+			bAllRegistered &= RegisterChannel(Registration);
+		}
+		return bAllRegistered;
+	}
+
 	/**
 	 * @brief Unregisters one channel and unbinds all publisher/listener callbacks.
 	 */
 	bool FEventBus::UnregisterChannel(const FGameplayTag& ChannelTag)
 	{
+		NFL_EVENTBUS_TRACE_SCOPE(EventBus_UnregisterChannel);
+		if (FEventBusRecorder::IsRecording())
+		{
+			FEventBusRecorder::RecordChannel(*this, EEventBusRecordOp::UnregisterChannel, ChannelTag, 0, NAME_None);
+		}
+
 		EEventBusError Error = EEventBusError::None;
-		if (!FEventBusValidation::EnsureGameThread(TEXT("UnregisterChannel"), Error) ||
-			!FEventBusValidation::ValidateChannelTag(ChannelTag, Error))
+		if (!FPolicies::EnterChannelCall(TEXT("UnregisterChannel"), ChannelTag, Error))
 		{
 			UE_LOG(LogNFLEventBus, Warning, TEXT("UnregisterChannel failed. Error=%s Channel=%s"),
 				LexToString(Error),
@@ -78,8 +120,12 @@ namespace Nfrrlib::EventBus
 			return false;
 		}
 
+		RetractChannel(ChannelTag);
 		State->ClearAndUnbind();
+		UnbindStaticSlots(State);
 		Channels.Remove(ChannelTag);
+		PublisherHolds.Remove(ChannelTag);
+		Topology.Remove(ChannelTag);
 		return true;
 	}
 
@@ -87,15 +133,116 @@ namespace Nfrrlib::EventBus
 	 * @brief Returns true when a channel exists in runtime state map.
 	 */
 	bool FEventBus::IsChannelRegistered(const FGameplayTag& ChannelTag) const
+	{
+		return IsChannelRegistered(FStaticChannelId{INDEX_NONE, ChannelTag});
+	}
+
+	/**
+	 * @brief Returns true when a typed channel exists, resolving through its static slot first.
+	 * Other threads are answered from the topology snapshot.
+	 */
+	bool FEventBus::IsChannelRegistered(const FStaticChannelId& Channel) const
+	{
+		if (!IsInGameThread())
+		{
+			FEventChannelTopology ChannelTopology;
+			return GetChannelTopology(Channel.ChannelTag, ChannelTopology) && !ChannelTopology.IsNative();
+		}
+
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("IsChannelRegistered"), Channel.ChannelTag, Error))
+		{
+			return false;
+		}
+
+		return FindChannelState(Channel) != nullptr;
+	}
+
+	/**
+	 * @brief Reads the snapshot on every thread, so callers see the same answer wherever they run.
+	 */
+	bool FEventBus::GetChannelTopology(const FGameplayTag& ChannelTag, FEventChannelTopology& OutTopology) const
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::FValidation::ValidateChannelTag(ChannelTag, Error))
+		{
+			return false;
+		}
+
+		return Topology.Find(ChannelTag, OutTopology);
+	}
+
+	/**
+	 * @brief Returns true when the channel currently has listeners.
+	 */
+	bool FEventBus::HasListeners(const FGameplayTag& ChannelTag) const
+	{
+		return HasListeners(FStaticChannelId{INDEX_NONE, ChannelTag});
+	}
+
+	/**
+	 * @brief Game-thread callers read channel state directly; other threads read the topology snapshot.
+	 */
+	bool FEventBus::HasListeners(const FStaticChannelId& Channel) const
+	{
+		if (!IsInGameThread())
+		{
+			FEventChannelTopology ChannelTopology;
+			return GetChannelTopology(Channel.ChannelTag, ChannelTopology) && ChannelTopology.ListenerCount > 0;
+		}
+
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("HasListeners"), Channel.ChannelTag, Error))
+		{
+			return false;
+		}
+
+		if (const Private::FEventChannelState* State = FindChannelState(Channel))
+		{
+			return State->HasListeners();
+		}
+
+		const FNativeChannelStatePtr* NativeChannel = NativeChannels.Find(Channel.ChannelTag);
+		return NativeChannel && (*NativeChannel)->GetListenerCount() > 0;
+	}
+
+	/**
+	 * @brief Subscribes a presence callback through the topology table, which sees every listener count change.
+	 */
+	FDelegateHandle FEventBus::AddPresenceCallback(const FGameplayTag& ChannelTag, FOnChannelPresenceChanged::FDelegate&& Callback)
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (FPolicies::EnterChannelCall(TEXT("AddPresenceCallback"), ChannelTag, Error) && !Callback.IsBound())
+		{
+			Error = EEventBusError::ListenerFunctionNotBindable;
+		}
+
+		if (Error != EEventBusError::None)
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("AddPresenceCallback failed. Error=%s Channel=%s"),
+				LexToString(Error),
+				*ChannelTag.ToString());
+			return FDelegateHandle();
+		}
+
+		return Topology.AddPresenceCallback(ChannelTag, MoveTemp(Callback));
+	}
+
+	/**
+	 * @brief Unsubscribes one presence callback.
+	 */
+	bool FEventBus::RemovePresenceCallback(const FGameplayTag& ChannelTag, const FDelegateHandle Handle)
 	{
 		EEventBusError Error = EEventBusError::None;
-		if (!FEventBusValidation::EnsureGameThread(TEXT("IsChannelRegistered"), Error) ||
-			!FEventBusValidation::ValidateChannelTag(ChannelTag, Error))
+		if (!FPolicies::EnterChannelCall(TEXT("RemovePresenceCallback"), ChannelTag, Error))
 		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("RemovePresenceCallback failed. Error=%s Channel=%s"),
+				LexToString(Error),
+				*ChannelTag.ToString());
 			return false;
 		}
 
-		return FindChannelState(ChannelTag) != nullptr;
+		return Topology.RemovePresenceCallback(ChannelTag, Handle);
 	}
 
 	/**
@@ -103,27 +250,95 @@ namespace Nfrrlib::EventBus
 	 */
 	bool FEventBus::AddPublisher(const FGameplayTag& ChannelTag, UObject* PublisherObj, const FPublisherBinding& Binding)
 	{
+		return AddPublisher(FStaticChannelId{INDEX_NONE, ChannelTag}, PublisherObj, Binding);
+	}
+
+	/**
+	 * @brief Adds or updates a publisher binding for one typed channel resolved through its static slot.
+	 */
+	bool FEventBus::AddPublisher(const FStaticChannelId& Channel, UObject* PublisherObj, const FPublisherBinding& Binding)
+	{
+		return AddPublisherFrom(Channel, PublisherObj, Binding, EPublisherSource::Direct);
+	}
+
+	/**
+	 * @brief Shared by direct and forwarded registrations; only the hold bookkeeping differs.
+	 */
+	bool FEventBus::AddPublisherFrom(
+		const FStaticChannelId& Channel,
+		UObject* PublisherObj,
+		const FPublisherBinding& Binding,
+		const EPublisherSource Source)
+	{
+		NFL_EVENTBUS_TRACE_SCOPE(EventBus_AddPublisher);
+		LLM_SCOPE_BYTAG(EventBus);
+		if (FEventBusRecorder::IsRecording())
+		{
+			FEventBusRecorder::RecordBinding(*this, EEventBusRecordOp::AddPublisher, Channel.ChannelTag, PublisherObj, Binding.DelegatePropertyName);
+		}
+
 		EEventBusError Error = EEventBusError::None;
-		if (!FEventBusValidation::EnsureGameThread(TEXT("AddPublisher"), Error) ||
-			!FEventBusValidation::ValidateChannelTag(ChannelTag, Error))
+		if (!FPolicies::EnterChannelCall(TEXT("AddPublisher"), Channel.ChannelTag, Error))
 		{
 			UE_LOG(LogNFLEventBus, Warning, TEXT("AddPublisher failed. Error=%s Channel=%s Publisher=%s"),
 				LexToString(Error),
-				*ChannelTag.ToString(),
+				*Channel.ChannelTag.ToString(),
 				*GetNameSafe(PublisherObj));
 			return false;
 		}
 
-		Private::FEventChannelState* State = FindChannelState(ChannelTag);
+		Private::FEventChannelState* State = FindChannelState(Channel);
 		if (!State)
 		{
 			UE_LOG(LogNFLEventBus, Warning, TEXT("AddPublisher failed. Error=%s Channel=%s"),
 				LexToString(EEventBusError::ChannelNotRegistered),
-				*ChannelTag.ToString());
+				*Channel.ChannelTag.ToString());
+			return false;
+		}
+
+		const bool bHeldBefore = Source != EPublisherSource::Direct && State->HasPublisher(PublisherObj);
+		const bool bAdded = State->AddPublisher(PublisherObj, Binding);
+		PublishTopology(Channel.ChannelTag, *State);
+		if (!bAdded)
+		{
 			return false;
 		}
 
-		return State->AddPublisher(PublisherObj, Binding);
+		if (Source == EPublisherSource::Direct)
+		{
+			MarkDirectPublisher(Channel.ChannelTag, PublisherObj);
+		}
+		else
+		{
+			// A publisher registered here before its first forward belongs to this bus's caller too.
+			FPublisherHold& Hold = PublisherHolds.FindOrAdd(Channel.ChannelTag).FindOrAdd(FObjectKey(PublisherObj));
+			if (Hold.ForwardCount == 0)
+			{
+				Hold.bDirect = bHeldBefore;
+				Hold.ForwardCount = 1;
+			}
+			else if (Source == EPublisherSource::Forwarded)
+			{
+				++Hold.ForwardCount;
+			}
+		}
+
+		ForwardPublisher(Channel.ChannelTag, PublisherObj, Binding);
+		return true;
+	}
+
+	/**
+	 * @brief A direct registration keeps the publisher bound after every descendant releases its forward.
+	 */
+	void FEventBus::MarkDirectPublisher(const FGameplayTag& ChannelTag, const UObject* PublisherObj)
+	{
+		if (TMap<FObjectKey, FPublisherHold>* Holds = PublisherHolds.Find(ChannelTag))
+		{
+			if (FPublisherHold* Hold = Holds->Find(FObjectKey(PublisherObj)))
+			{
+				Hold->bDirect = true;
+			}
+		}
 	}
 
 	/**
@@ -131,24 +346,95 @@ namespace Nfrrlib::EventBus
 	 */
 	bool FEventBus::RemovePublisher(const FGameplayTag& ChannelTag, UObject* PublisherObj)
 	{
+		return RemovePublisher(FStaticChannelId{INDEX_NONE, ChannelTag}, PublisherObj);
+	}
+
+	/**
+	 * @brief Removes a publisher binding from one typed channel resolved through its static slot.
+	 */
+	bool FEventBus::RemovePublisher(const FStaticChannelId& Channel, UObject* PublisherObj)
+	{
+		NFL_EVENTBUS_TRACE_SCOPE(EventBus_RemovePublisher);
+		if (FEventBusRecorder::IsRecording())
+		{
+			FEventBusRecorder::RecordBinding(*this, EEventBusRecordOp::RemovePublisher, Channel.ChannelTag, PublisherObj, NAME_None);
+		}
+
 		EEventBusError Error = EEventBusError::None;
-		if (!FEventBusValidation::EnsureGameThread(TEXT("RemovePublisher"), Error) ||
-			!FEventBusValidation::ValidateChannelTag(ChannelTag, Error))
+		if (!FPolicies::EnterChannelCall(TEXT("RemovePublisher"), Channel.ChannelTag, Error))
 		{
 			UE_LOG(LogNFLEventBus, Warning, TEXT("RemovePublisher failed. Error=%s Channel=%s Publisher=%s"),
 				LexToString(Error),
-				*ChannelTag.ToString(),
+				*Channel.ChannelTag.ToString(),
 				*GetNameSafe(PublisherObj));
 			return false;
 		}
 
-		Private::FEventChannelState* State = FindChannelState(ChannelTag);
+		Private::FEventChannelState* State = FindChannelState(Channel);
 		if (!State)
 		{
 			return false;
 		}
 
-		return State->RemovePublisher(PublisherObj);
+		if (TMap<FObjectKey, FPublisherHold>* Holds = PublisherHolds.Find(Channel.ChannelTag))
+		{
+			if (FPublisherHold* Hold = Holds->Find(FObjectKey(PublisherObj)))
+			{
+				// Descendant buses still forward this publisher; only the direct registration is released.
+				const bool bWasDirect = Hold->bDirect;
+				Hold->bDirect = false;
+				return bWasDirect;
+			}
+		}
+
+		return DetachPublisher(Channel.ChannelTag, *State, PublisherObj);
+	}
+
+	/**
+	 * @brief Removes the binding itself; callers have already settled any forwarded references.
+	 */
+	bool FEventBus::DetachPublisher(const FGameplayTag& ChannelTag, Private::FEventChannelState& ChannelState, UObject* PublisherObj)
+	{
+		RetractPublisher(ChannelTag, PublisherObj);
+		const bool bRemoved = ChannelState.RemovePublisher(PublisherObj);
+		PublishTopology(ChannelTag, ChannelState);
+		return bRemoved;
+	}
+
+	/**
+	 * @brief Holds vanish with the channel, so a release after unregistration or Reset is a no-op.
+	 */
+	void FEventBus::ReleaseForwardedPublisher(const FGameplayTag& ChannelTag, const FObjectKey& PublisherKey, UObject* PublisherObj)
+	{
+		TMap<FObjectKey, FPublisherHold>* Holds = PublisherHolds.Find(ChannelTag);
+		FPublisherHold* Hold = Holds ? Holds->Find(PublisherKey) : nullptr;
+		if (!Hold || --Hold->ForwardCount > 0)
+		{
+			return;
+		}
+
+		const bool bDirect = Hold->bDirect;
+		Holds->Remove(PublisherKey);
+		if (Holds->IsEmpty())
+		{
+			PublisherHolds.Remove(ChannelTag);
+		}
+
+		// Destroyed publishers are dropped by this bus's own stale-entry cleanup.
+		if (bDirect || !PublisherObj)
+		{
+			return;
+		}
+
+		if (FEventBusRecorder::IsRecording())
+		{
+			FEventBusRecorder::RecordBinding(*this, EEventBusRecordOp::RemovePublisher, ChannelTag, PublisherObj, NAME_None);
+		}
+
+		if (Private::FEventChannelState* State = FindChannelState(ChannelTag))
+		{
+			NFL_EVENTBUS_UNUSED(DetachPublisher(ChannelTag, *State, PublisherObj));
+		}
 	}
 
 	/**
@@ -156,28 +442,44 @@ namespace Nfrrlib::EventBus
 	 */
 	bool FEventBus::AddListener(const FGameplayTag& ChannelTag, UObject* ListenerObj, const FListenerBinding& Binding)
 	{
+		return AddListener(FStaticChannelId{INDEX_NONE, ChannelTag}, ListenerObj, Binding);
+	}
+
+	/**
+	 * @brief Adds or updates a listener callback binding for one typed channel resolved through its static slot.
+	 */
+	bool FEventBus::AddListener(const FStaticChannelId& Channel, UObject* ListenerObj, const FListenerBinding& Binding)
+	{
+		NFL_EVENTBUS_TRACE_SCOPE(EventBus_AddListener);
+		LLM_SCOPE_BYTAG(EventBus);
+		if (FEventBusRecorder::IsRecording())
+		{
+			FEventBusRecorder::RecordBinding(*this, EEventBusRecordOp::AddListener, Channel.ChannelTag, ListenerObj, Binding.FunctionName);
+		}
+
 		EEventBusError Error = EEventBusError::None;
-		if (!FEventBusValidation::EnsureGameThread(TEXT("AddListener"), Error) ||
-			!FEventBusValidation::ValidateChannelTag(ChannelTag, Error))
+		if (!FPolicies::EnterChannelCall(TEXT("AddListener"), Channel.ChannelTag, Error))
 		{
 			UE_LOG(LogNFLEventBus, Warning, TEXT("AddListener failed. Error=%s Channel=%s Listener=%s Func=%s"),
 				LexToString(Error),
-				*ChannelTag.ToString(),
+				*Channel.ChannelTag.ToString(),
 				*GetNameSafe(ListenerObj),
 				*Binding.FunctionName.ToString());
 			return false;
 		}
 
-		Private::FEventChannelState* State = FindChannelState(ChannelTag);
+		Private::FEventChannelState* State = FindChannelState(Channel);
 		if (!State)
 		{
 			UE_LOG(LogNFLEventBus, Warning, TEXT("AddListener failed. Error=%s Channel=%s"),
 				LexToString(EEventBusError::ChannelNotRegistered),
-				*ChannelTag.ToString());
+				*Channel.ChannelTag.ToString());
 			return false;
 		}
 
-		return State->AddListener(ListenerObj, Binding);
+		const bool bAdded = State->AddListener(ListenerObj, Binding);
+		PublishTopology(Channel.ChannelTag, *State);
+		return bAdded;
 	}
 
 	/**
@@ -185,64 +487,1304 @@ namespace Nfrrlib::EventBus
 	 */
 	bool FEventBus::RemoveListener(const FGameplayTag& ChannelTag, UObject* ListenerObj, const FListenerBinding& Binding)
 	{
+		return RemoveListener(FStaticChannelId{INDEX_NONE, ChannelTag}, ListenerObj, Binding);
+	}
+
+	/**
+	 * @brief Removes a listener callback binding from one typed channel resolved through its static slot.
+	 */
+	bool FEventBus::RemoveListener(const FStaticChannelId& Channel, UObject* ListenerObj, const FListenerBinding& Binding)
+	{
+		NFL_EVENTBUS_TRACE_SCOPE(EventBus_RemoveListener);
+		if (FEventBusRecorder::IsRecording())
+		{
+			FEventBusRecorder::RecordBinding(*this, EEventBusRecordOp::RemoveListener, Channel.ChannelTag, ListenerObj, Binding.FunctionName);
+		}
+
 		EEventBusError Error = EEventBusError::None;
-		if (!FEventBusValidation::EnsureGameThread(TEXT("RemoveListener"), Error) ||
-			!FEventBusValidation::ValidateChannelTag(ChannelTag, Error))
+		if (!FPolicies::EnterChannelCall(TEXT("RemoveListener"), Channel.ChannelTag, Error))
 		{
 			UE_LOG(LogNFLEventBus, Warning, TEXT("RemoveListener failed. Error=%s Channel=%s Listener=%s Func=%s"),
 				LexToString(Error),
-				*ChannelTag.ToString(),
+				*Channel.ChannelTag.ToString(),
 				*GetNameSafe(ListenerObj),
 				*Binding.FunctionName.ToString());
 			return false;
 		}
 
-		Private::FEventChannelState* State = FindChannelState(ChannelTag);
+		Private::FEventChannelState* State = FindChannelState(Channel);
 		if (!State)
 		{
 			return false;
 		}
 
-		return State->RemoveListener(ListenerObj, Binding);
+		const bool bRemoved = State->RemoveListener(ListenerObj, Binding);
+		PublishTopology(Channel.ChannelTag, *State);
+		return bRemoved;
 	}
 
 	/**
-	 * @brief Fully unbinds and clears every registered channel state.
+	 * @brief Adds one publisher per entry; an invalid publisher fails the whole batch with one warning.
 	 */
-	void FEventBus::Reset()
+	int32 FEventBus::AddPublishers(
+		UObject* PublisherObj,
+		const TConstArrayView<FChannelPublisherBinding> Bindings,
+		TArray<bool>& OutResults)
 	{
+		OutResults.Reset(Bindings.Num());
 		EEventBusError Error = EEventBusError::None;
-		if (!FEventBusValidation::EnsureGameThread(TEXT("Reset"), Error))
+		if (!FPolicies::EnterCall(TEXT("AddPublishers"), Error) ||
+			!FPolicies::FValidation::ValidateObject(PublisherObj, Error))
 		{
-			return;
+			UE_LOG(LogNFLEventBus, Warning, TEXT("AddPublishers failed. Error=%s Publisher=%s Count=%d"),
+				LexToString(Error),
+				*GetNameSafe(PublisherObj),
+				Bindings.Num());
+			OutResults.Init(false, Bindings.Num());
+			return 0;
 		}
 
-		for (TPair<FGameplayTag, FChannelStatePtr>& Pair : Channels)
+		NFL_EVENTBUS_TRACE_SCOPE(EventBus_AddPublishers);
+		LLM_SCOPE_BYTAG(EventBus);
+		FBulkChannelStates Touched;
+		int32 SucceededCount = 0;
+		for (const FChannelPublisherBinding& Entry : Bindings)
 		{
-			if (Pair.Value)
+			if (FEventBusRecorder::IsRecording())
 			{
-				Pair.Value->ClearAndUnbind();
+				FEventBusRecorder::RecordBinding(*this, EEventBusRecordOp::AddPublisher, Entry.ChannelTag, PublisherObj, Entry.Binding.DelegatePropertyName);
+			}
+
+			bool bAdded = false;
+			if (!FPolicies::FValidation::ValidateChannelTag(Entry.ChannelTag, Error))
+			{
+				UE_LOG(LogNFLEventBus, Warning, TEXT("AddPublisher failed. Error=%s Channel=%s Publisher=%s"),
+					LexToString(Error),
+					*Entry.ChannelTag.ToString(),
+					*GetNameSafe(PublisherObj));
+			}
+			else if (Private::FEventChannelState* State = FindBulkChannelState(Entry.ChannelTag, Touched))
+			{
+				bAdded = State->AddPublisher(PublisherObj, Entry.Binding);
+				if (bAdded)
+				{
+					MarkDirectPublisher(Entry.ChannelTag, PublisherObj);
+				}
+			}
+			else
+			{
+				UE_LOG(LogNFLEventBus, Warning, TEXT("AddPublisher failed. Error=%s Channel=%s"),
+					LexToString(EEventBusError::ChannelNotRegistered),
+					*Entry.ChannelTag.ToString());
 			}
+			OutResults.Add(bAdded);
+			SucceededCount += bAdded ? 1 : 0;
 		}
 
-		Channels.Reset();
+		PublishBulkTopology(Touched);
+
+		// Presence callbacks above may have unregistered a channel; only still-registered ones forward.
+		for (int32 Index = 0; Index < Bindings.Num(); ++Index)
+		{
+			if (OutResults[Index] && FindChannelState(Bindings[Index].ChannelTag))
+			{
+				ForwardPublisher(Bindings[Index].ChannelTag, PublisherObj, Bindings[Index].Binding);
+			}
+		}
+		return SucceededCount;
 	}
 
 	/**
-	 * @brief Finds mutable channel state entry.
+	 * @brief Adds one listener per entry; an invalid listener fails the whole batch with one warning.
 	 */
-	Private::FEventChannelState* FEventBus::FindChannelState(const FGameplayTag& ChannelTag)
+	int32 FEventBus::AddListeners(
+		UObject* ListenerObj,
+		const TConstArrayView<FChannelListenerBinding> Bindings,
+		TArray<bool>& OutResults)
 	{
-		FChannelStatePtr* Found = Channels.Find(ChannelTag);
-		return Found ? Found->Get() : nullptr;
+		OutResults.Reset(Bindings.Num());
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterCall(TEXT("AddListeners"), Error) ||
+			!FPolicies::FValidation::ValidateObject(ListenerObj, Error))
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("AddListeners failed. Error=%s Listener=%s Count=%d"),
+				LexToString(Error),
+				*GetNameSafe(ListenerObj),
+				Bindings.Num());
+			OutResults.Init(false, Bindings.Num());
+			return 0;
+		}
+
+		NFL_EVENTBUS_TRACE_SCOPE(EventBus_AddListeners);
+		LLM_SCOPE_BYTAG(EventBus);
+		FBulkChannelStates Touched;
+		int32 SucceededCount = 0;
+		for (const FChannelListenerBinding& Entry : Bindings)
+		{
+			if (FEventBusRecorder::IsRecording())
+			{
+				FEventBusRecorder::RecordBinding(*this, EEventBusRecordOp::AddListener, Entry.ChannelTag, ListenerObj, Entry.Binding.FunctionName);
+			}
+
+			bool bAdded = false;
+			if (!FPolicies::FValidation::ValidateChannelTag(Entry.ChannelTag, Error))
+			{
+				UE_LOG(LogNFLEventBus, Warning, TEXT("AddListener failed. Error=%s Channel=%s Listener=%s Func=%s"),
+					LexToString(Error),
+					*Entry.ChannelTag.ToString(),
+					*GetNameSafe(ListenerObj),
+					*Entry.Binding.FunctionName.ToString());
+			}
+			else if (Private::FEventChannelState* State = FindBulkChannelState(Entry.ChannelTag, Touched))
+			{
+				bAdded = State->AddListener(ListenerObj, Entry.Binding);
+			}
+			else
+			{
+				UE_LOG(LogNFLEventBus, Warning, TEXT("AddListener failed. Error=%s Channel=%s"),
+					LexToString(EEventBusError::ChannelNotRegistered),
+					*Entry.ChannelTag.ToString());
+			}
+			OutResults.Add(bAdded);
+			SucceededCount += bAdded ? 1 : 0;
+		}
+
+		PublishBulkTopology(Touched);
+		return SucceededCount;
 	}
 
 	/**
-	 * @brief Finds immutable channel state entry.
+	 * @brief Removes one listener binding per entry.
 	 */
-	const Private::FEventChannelState* FEventBus::FindChannelState(const FGameplayTag& ChannelTag) const
+	int32 FEventBus::RemoveListeners(
+		UObject* ListenerObj,
+		const TConstArrayView<FChannelListenerBinding> Bindings,
+		TArray<bool>& OutResults)
 	{
-		const FChannelStatePtr* Found = Channels.Find(ChannelTag);
-		return Found ? Found->Get() : nullptr;
+		OutResults.Reset(Bindings.Num());
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterCall(TEXT("RemoveListeners"), Error) ||
+			!FPolicies::FValidation::ValidateObject(ListenerObj, Error))
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("RemoveListeners failed. Error=%s Listener=%s Count=%d"),
+				LexToString(Error),
+				*GetNameSafe(ListenerObj),
+				Bindings.Num());
+			OutResults.Init(false, Bindings.Num());
+			return 0;
+		}
+
+		NFL_EVENTBUS_TRACE_SCOPE(EventBus_RemoveListeners);
+		FBulkChannelStates Touched;
+		int32 RemovedCount = 0;
+		for (const FChannelListenerBinding& Entry : Bindings)
+		{
+			if (FEventBusRecorder::IsRecording())
+			{
+				FEventBusRecorder::RecordBinding(*this, EEventBusRecordOp::RemoveListener, Entry.ChannelTag, ListenerObj, Entry.Binding.FunctionName);
+			}
+
+			bool bRemoved = false;
+			if (!FPolicies::FValidation::ValidateChannelTag(Entry.ChannelTag, Error))
+			{
+				UE_LOG(LogNFLEventBus, Warning, TEXT("RemoveListener failed. Error=%s Channel=%s Listener=%s Func=%s"),
+					LexToString(Error),
+					*Entry.ChannelTag.ToString(),
+					*GetNameSafe(ListenerObj),
+					*Entry.Binding.FunctionName.ToString());
+			}
+			else if (Private::FEventChannelState* State = FindBulkChannelState(Entry.ChannelTag, Touched))
+			{
+				bRemoved = State->RemoveListener(ListenerObj, Entry.Binding);
+			}
+			OutResults.Add(bRemoved);
+			RemovedCount += bRemoved ? 1 : 0;
+		}
+
+		PublishBulkTopology(Touched);
+		return RemovedCount;
+	}
+
+	/**
+	 * @brief Registers native channel state; idempotent for the same kind and payload type.
+	 */
+	bool FEventBus::RegisterNativeChannelState(
+		const FGameplayTag& ChannelTag,
+		const EEventNativeChannelKind Kind,
+		const FEventPayloadTypeId PayloadTypeId,
+		const FName PayloadTypeName,
+		const TFunctionRef<FNativeChannelStatePtr()> Factory)
+	{
+		NFL_EVENTBUS_TRACE_SCOPE(EventBus_RegisterNativeChannel);
+		LLM_SCOPE_BYTAG(EventBus);
+		if (FEventBusRecorder::IsRecording())
+		{
+			FEventBusRecorder::RecordChannel(*this, EEventBusRecordOp::RegisterNativeChannel, ChannelTag, static_cast<uint32>(Kind), PayloadTypeName);
+		}
+
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("RegisterNativeChannel"), ChannelTag, Error) ||
+			!FPolicies::FValidation::ValidateName(PayloadTypeName, Error))
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("RegisterNativeChannel failed. Error=%s Kind=%s Channel=%s Payload=%s"),
+				LexToString(Error),
+				LexToString(Kind),
+				*ChannelTag.ToString(),
+				*PayloadTypeName.ToString());
+			return false;
+		}
+
+		if (Channels.Contains(ChannelTag))
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("RegisterNativeChannel failed. Error=%s Kind=%s Channel=%s"),
+				LexToString(EEventBusError::ChannelKindConflict),
+				LexToString(Kind),
+				*ChannelTag.ToString());
+			return false;
+		}
+
+		if (const FNativeChannelStatePtr* Existing = NativeChannels.Find(ChannelTag))
+		{
+			if ((*Existing)->GetKind() != Kind)
+			{
+				UE_LOG(LogNFLEventBus, Warning,
+					TEXT("RegisterNativeChannel failed. Error=%s Channel=%s ExistingKind=%s RequestedKind=%s"),
+					LexToString(EEventBusError::ChannelKindConflict),
+					*ChannelTag.ToString(),
+					LexToString((*Existing)->GetKind()),
+					LexToString(Kind));
+				return false;
+			}
+
+			if ((*Existing)->GetPayloadTypeId() != PayloadTypeId)
+			{
+				UE_LOG(LogNFLEventBus, Warning,
+					TEXT("RegisterNativeChannel failed. Error=%s Kind=%s Channel=%s ExistingPayload=%s RequestedPayload=%s"),
+					LexToString(EEventBusError::PayloadTypeMismatch),
+					LexToString(Kind),
+					*ChannelTag.ToString(),
+					*(*Existing)->GetPayloadTypeName().ToString(),
+					*PayloadTypeName.ToString());
+				return false;
+			}
+			return true;
+		}
+
+		FNativeChannelStatePtr& NativeChannel = NativeChannels.Add(ChannelTag, Factory());
+		NativeChannel->SetChannelTag(ChannelTag);
+		NativeChannel->SetTopology(&Topology);
+		return true;
+	}
+
+	/**
+	 * @brief Unregisters one native channel of the requested kind and drops its pending payloads and listeners.
+	 */
+	bool FEventBus::UnregisterNativeChannel(const FGameplayTag& ChannelTag, const EEventNativeChannelKind Kind)
+	{
+		if (FEventBusRecorder::IsRecording())
+		{
+			FEventBusRecorder::RecordChannel(*this, EEventBusRecordOp::UnregisterNativeChannel, ChannelTag, static_cast<uint32>(Kind), NAME_None);
+		}
+
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("UnregisterNativeChannel"), ChannelTag, Error))
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("UnregisterNativeChannel failed. Error=%s Kind=%s Channel=%s"),
+				LexToString(Error),
+				LexToString(Kind),
+				*ChannelTag.ToString());
+			return false;
+		}
+
+		const FNativeChannelStatePtr* Found = NativeChannels.Find(ChannelTag);
+		if (!Found || (*Found)->GetKind() != Kind)
+		{
+			return false;
+		}
+
+		FNativeChannelStatePtr State;
+		NativeChannels.RemoveAndCopyValue(ChannelTag, State);
+		State->SetTopology(nullptr);
+		Topology.Remove(ChannelTag);
+		State->Reset();
+		return true;
+	}
+
+	/**
+	 * @brief Returns true when a native channel of the requested kind exists in runtime state map.
+	 */
+	bool FEventBus::IsNativeChannelRegistered(const FGameplayTag& ChannelTag, const EEventNativeChannelKind Kind) const
+	{
+		if (!IsInGameThread())
+		{
+			FEventChannelTopology ChannelTopology;
+			return GetChannelTopology(ChannelTag, ChannelTopology) && EnumHasAnyFlags(ChannelTopology.Flags,
+				Kind == EEventNativeChannelKind::Batch ? EEventChannelTopologyFlags::Batch : EEventChannelTopologyFlags::Spatial);
+		}
+
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("IsNativeChannelRegistered"), ChannelTag, Error))
+		{
+			return false;
+		}
+
+		const FNativeChannelStatePtr* Found = NativeChannels.Find(ChannelTag);
+		return Found && (*Found)->GetKind() == Kind;
+	}
+
+	/**
+	 * @brief Unregisters one batched channel.
+	 */
+	bool FEventBus::UnregisterBatchChannel(const FGameplayTag& ChannelTag)
+	{
+		return UnregisterNativeChannel(ChannelTag, EEventNativeChannelKind::Batch);
+	}
+
+	/**
+	 * @brief Returns true when a batched channel is registered.
+	 */
+	bool FEventBus::IsBatchChannelRegistered(const FGameplayTag& ChannelTag) const
+	{
+		return IsNativeChannelRegistered(ChannelTag, EEventNativeChannelKind::Batch);
+	}
+
+	/**
+	 * @brief Unregisters one spatial channel.
+	 */
+	bool FEventBus::UnregisterSpatialChannel(const FGameplayTag& ChannelTag)
+	{
+		return UnregisterNativeChannel(ChannelTag, EEventNativeChannelKind::Spatial);
+	}
+
+	/**
+	 * @brief Returns true when a spatial channel is registered.
+	 */
+	bool FEventBus::IsSpatialChannelRegistered(const FGameplayTag& ChannelTag) const
+	{
+		return IsNativeChannelRegistered(ChannelTag, EEventNativeChannelKind::Spatial);
+	}
+
+	/**
+	 * @brief Flushes one batched channel while holding a reference that outlives callback-driven unregistration.
+	 */
+	int32 FEventBus::FlushBatchChannel(const FGameplayTag& ChannelTag)
+	{
+		if (FEventBusRecorder::IsRecording())
+		{
+			FEventBusRecorder::RecordFlush(*this, ChannelTag);
+		}
+
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("FlushBatchChannel"), ChannelTag, Error))
+		{
+			return 0;
+		}
+
+		const FNativeChannelStatePtr* Found = NativeChannels.Find(ChannelTag);
+		if (!Found || (*Found)->GetKind() != EEventNativeChannelKind::Batch)
+		{
+			return 0;
+		}
+
+		const FNativeChannelStatePtr PinnedState = *Found;
+		return PinnedState->Flush();
+	}
+
+	/**
+	 * @brief Flushes every batched channel from a snapshot so callbacks may register or unregister channels.
+	 */
+	int32 FEventBus::FlushBatchChannels()
+	{
+		NFL_EVENTBUS_TRACE_SCOPE(EventBus_FlushBatchChannels);
+		if (FEventBusRecorder::IsRecording())
+		{
+			FEventBusRecorder::RecordFlush(*this, FGameplayTag());
+		}
+
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterCall(TEXT("FlushBatchChannels"), Error) || NativeChannels.IsEmpty())
+		{
+			return 0;
+		}
+
+		TArray<FNativeChannelStatePtr, TInlineAllocator<16>> PinnedStates;
+		for (const TPair<FGameplayTag, FNativeChannelStatePtr>& Pair : NativeChannels)
+		{
+			if (Pair.Value->GetPendingCount() > 0)
+			{
+				PinnedStates.Add(Pair.Value);
+			}
+		}
+
+		int32 DeliveredCount = 0;
+		for (const FNativeChannelStatePtr& State : PinnedStates)
+		{
+			DeliveredCount += State->Flush();
+		}
+		return DeliveredCount;
+	}
+
+	/**
+	 * @brief Sweeps from a snapshot of tags, since presence callbacks may register or unregister channels.
+	 */
+	int32 FEventBus::SweepStaleBindings()
+	{
+		NFL_EVENTBUS_TRACE_SCOPE(EventBus_SweepStaleBindings);
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterCall(TEXT("SweepStaleBindings"), Error))
+		{
+			return 0;
+		}
+
+		TArray<FGameplayTag, TInlineAllocator<16>> ChannelTags;
+		Channels.GetKeys(ChannelTags);
+		int32 DroppedCount = 0;
+		for (const FGameplayTag& ChannelTag : ChannelTags)
+		{
+			if (Private::FEventChannelState* State = FindChannelState(ChannelTag))
+			{
+				DroppedCount += State->SweepStaleEntries();
+				PublishTopology(ChannelTag, *State);
+			}
+		}
+
+		TArray<FNativeChannelStatePtr, TInlineAllocator<16>> PinnedStates;
+		NativeChannels.GenerateValueArray(PinnedStates);
+		for (const FNativeChannelStatePtr& State : PinnedStates)
+		{
+			DroppedCount += State->SweepStaleListeners();
+		}
+		return DroppedCount;
+	}
+
+	/**
+	 * @brief Returns native channel state only when the registered kind and payload type match.
+	 */
+	FEventNativeChannelBase* FEventBus::FindNativeChannelState(
+		const FGameplayTag& ChannelTag,
+		const EEventNativeChannelKind Kind,
+		const FEventPayloadTypeId PayloadTypeId)
+	{
+		return PinNativeChannelState(ChannelTag, Kind, PayloadTypeId).Get();
+	}
+
+	/**
+	 * @brief Checks kind and payload type, then copies the shared pointer so callers may outlive unregistration.
+	 */
+	FEventBus::FNativeChannelStatePtr FEventBus::PinNativeChannelState(
+		const FGameplayTag& ChannelTag,
+		const EEventNativeChannelKind Kind,
+		const FEventPayloadTypeId PayloadTypeId)
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("FindNativeChannel"), ChannelTag, Error))
+		{
+			return nullptr;
+		}
+
+		const FNativeChannelStatePtr* Found = NativeChannels.Find(ChannelTag);
+		if (!Found)
+		{
+			return nullptr;
+		}
+
+		if ((*Found)->GetKind() != Kind)
+		{
+			UE_LOG(LogNFLEventBus, Warning,
+				TEXT("FindNativeChannel failed. Error=%s Channel=%s ExistingKind=%s RequestedKind=%s"),
+				LexToString(EEventBusError::ChannelKindConflict),
+				*ChannelTag.ToString(),
+				LexToString((*Found)->GetKind()),
+				LexToString(Kind));
+			return nullptr;
+		}
+
+		if ((*Found)->GetPayloadTypeId() != PayloadTypeId)
+		{
+			UE_LOG(LogNFLEventBus, Warning,
+				TEXT("FindNativeChannel failed. Error=%s Kind=%s Channel=%s ExistingPayload=%s"),
+				LexToString(EEventBusError::PayloadTypeMismatch),
+				LexToString(Kind),
+				*ChannelTag.ToString(),
+				*(*Found)->GetPayloadTypeName().ToString());
+			return nullptr;
+		}
+
+		return *Found;
+	}
+
+	/**
+	 * @brief Copies counters for one channel of either kind.
+	 */
+	bool FEventBus::GetChannelStats(const FGameplayTag& ChannelTag, FEventChannelStats& OutStats) const
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("GetChannelStats"), ChannelTag, Error))
+		{
+			return false;
+		}
+
+		if (const Private::FEventChannelState* State = FindChannelState(ChannelTag))
+		{
+			OutStats = State->GetStats();
+			return true;
+		}
+
+		if (const FNativeChannelStatePtr* NativeState = NativeChannels.Find(ChannelTag))
+		{
+			OutStats = (*NativeState)->GetStats();
+			return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * @brief Collects counters for every registered channel.
+	 */
+	void FEventBus::GetAllChannelStats(TMap<FGameplayTag, FEventChannelStats>& OutStats) const
+	{
+		OutStats.Reset();
+
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterCall(TEXT("GetAllChannelStats"), Error))
+		{
+			return;
+		}
+
+		OutStats.Reserve(Channels.Num() + NativeChannels.Num());
+		for (const TPair<FGameplayTag, FChannelStatePtr>& Pair : Channels)
+		{
+			OutStats.Add(Pair.Key, Pair.Value->GetStats());
+		}
+
+		for (const TPair<FGameplayTag, FNativeChannelStatePtr>& Pair : NativeChannels)
+		{
+			OutStats.Add(Pair.Key, Pair.Value->GetStats());
+		}
+	}
+
+	/**
+	 * @brief Clears cumulative counters on every channel.
+	 */
+	void FEventBus::ResetChannelStats()
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterCall(TEXT("ResetChannelStats"), Error))
+		{
+			return;
+		}
+
+		for (TPair<FGameplayTag, FChannelStatePtr>& Pair : Channels)
+		{
+			Pair.Value->ResetStats();
+		}
+
+		for (TPair<FGameplayTag, FNativeChannelStatePtr>& Pair : NativeChannels)
+		{
+			Pair.Value->ResetStats();
+		}
+	}
+
+	/**
+	 * @brief Records one broadcast on a delegate channel and feeds the stats and CSV counters.
+	 */
+	void FEventBus::RecordDispatch(const FStaticChannelId& Channel, const uint64 StartCycles, const uint64 EndCycles)
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("RecordDispatch"), Channel.ChannelTag, Error))
+		{
+			return;
+		}
+
+		Private::FEventChannelState* State = FindChannelState(Channel);
+		if (!State)
+		{
+			return;
+		}
+
+		const int32 InvocationCount = State->RecordDispatch(EndCycles - StartCycles);
+		// Timed broadcasts already traced each listener with its own window.
+		if (FEventBusTrace::IsEnabled() && !FEventListenerTiming::IsEnabled())
+		{
+			State->TraceListenerInvocations(Channel.ChannelTag, StartCycles, EndCycles);
+		}
+		INC_DWORD_STAT(STAT_EventBus_Broadcasts);
+		INC_DWORD_STAT_BY(STAT_EventBus_ListenerInvocations, InvocationCount);
+		CSV_CUSTOM_STAT(EventBus, Broadcasts, 1, ECsvCustomStatOp::Accumulate);
+		CSV_CUSTOM_STAT(EventBus, ListenerInvocations, InvocationCount, ECsvCustomStatOp::Accumulate);
+	}
+
+	/**
+	 * @brief Snapshots listener callbacks of one typed delegate channel.
+	 */
+	void FEventBus::CollectTimedListeners(const FStaticChannelId& Channel, TArray<FEventTimedListener>& OutListeners) const
+	{
+		OutListeners.Reset();
+
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("CollectTimedListeners"), Channel.ChannelTag, Error))
+		{
+			return;
+		}
+
+		if (const Private::FEventChannelState* State = FindChannelState(Channel))
+		{
+			State->CollectTimedListeners(OutListeners);
+		}
+	}
+
+	/**
+	 * @brief Forwards one timed listener invocation to its channel.
+	 */
+	void FEventBus::RecordListenerTiming(const FStaticChannelId& Channel, const FListenerKey& ListenerKey, const uint64 Cycles)
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("RecordListenerTiming"), Channel.ChannelTag, Error))
+		{
+			return;
+		}
+
+		if (Private::FEventChannelState* State = FindChannelState(Channel))
+		{
+			State->RecordListenerTiming(Channel.ChannelTag, ListenerKey, Cycles);
+		}
+	}
+
+	/**
+	 * @brief Returns listener timings for one delegate channel, falling back to native channels.
+	 */
+	bool FEventBus::GetListenerTimings(const FGameplayTag& ChannelTag, const int32 MaxRows, TArray<FEventListenerTimingStats>& OutTimings) const
+	{
+		OutTimings.Reset();
+
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("GetListenerTimings"), ChannelTag, Error))
+		{
+			return false;
+		}
+
+		if (const Private::FEventChannelState* State = FindChannelState(ChannelTag))
+		{
+			State->GetListenerTimings(MaxRows, OutTimings);
+			return true;
+		}
+
+		if (const FNativeChannelStatePtr* NativeChannel = NativeChannels.Find(ChannelTag))
+		{
+			(*NativeChannel)->GetListenerTimings(MaxRows, OutTimings);
+			return true;
+		}
+		return false;
+	}
+
+	/**
+	 * @brief Drops listener timings on every delegate and native channel.
+	 */
+	void FEventBus::ResetListenerTimings()
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterCall(TEXT("ResetListenerTimings"), Error))
+		{
+			return;
+		}
+
+		for (TPair<FGameplayTag, FChannelStatePtr>& Pair : Channels)
+		{
+			Pair.Value->ResetListenerTimings();
+		}
+
+		for (TPair<FGameplayTag, FNativeChannelStatePtr>& Pair : NativeChannels)
+		{
+			Pair.Value->ResetListenerTimings();
+		}
+	}
+
+	/**
+	 * @brief Prints the worst listeners per channel, skipping channels without timings.
+	 */
+	void FEventBus::DumpSlowListeners(FOutputDevice& Ar, const int32 MaxPerChannel) const
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterCall(TEXT("DumpSlowListeners"), Error))
+		{
+			return;
+		}
+
+		TArray<FGameplayTag> ChannelTags;
+		Channels.GetKeys(ChannelTags);
+		for (const TPair<FGameplayTag, FNativeChannelStatePtr>& Pair : NativeChannels)
+		{
+			ChannelTags.Add(Pair.Key);
+		}
+		ChannelTags.Sort([](const FGameplayTag& Left, const FGameplayTag& Right)
+		{
+			return Left.GetTagName().LexicalLess(Right.GetTagName());
+		});
+
+		TArray<FEventListenerTimingStats> Timings;
+		for (const FGameplayTag& ChannelTag : ChannelTags)
+		{
+			if (!GetListenerTimings(ChannelTag, MaxPerChannel, Timings) || Timings.IsEmpty())
+			{
+				continue;
+			}
+
+			Ar.Logf(TEXT("%s"), *ChannelTag.ToString());
+			for (const FEventListenerTimingStats& Timing : Timings)
+			{
+				Ar.Logf(TEXT("    %s::%s Calls=%llu AvgMs=%.3f MaxMs=%.3f LastMs=%.3f OverBudget=%llu"),
+					*Timing.ClassName.ToString(),
+					*Timing.FunctionName.ToString(),
+					Timing.CallCount,
+					Timing.AverageMs,
+					Timing.MaxMs,
+					Timing.LastMs,
+					Timing.OverBudgetCount);
+			}
+		}
+	}
+
+	/**
+	 * @brief Samples every delegate channel into the CSV profiler while a capture is running.
+	 */
+	void FEventBus::RecordCsvChannelStats()
+	{
+#if CSV_PROFILER
+		if (!FCsvProfiler::Get()->IsCapturing())
+		{
+			return;
+		}
+
+		for (TPair<FGameplayTag, FChannelStatePtr>& Pair : Channels)
+		{
+			Pair.Value->RecordCsvStats(Pair.Key);
+		}
+#endif
+	}
+
+	/**
+	 * @brief Sums channel maps, heap-allocated channel states and forwarding records.
+	 */
+	SIZE_T FEventBus::GetAllocatedSize() const
+	{
+		SIZE_T Bytes = Channels.GetAllocatedSize() + StaticSlots.GetAllocatedSize() + NativeChannels.GetAllocatedSize() + ForwardedPublishers.GetAllocatedSize();
+		for (const TPair<FGameplayTag, FChannelStatePtr>& Pair : Channels)
+		{
+			Bytes += sizeof(Private::FEventChannelState) + Pair.Value->GetAllocatedSize();
+		}
+
+		for (const TPair<FGameplayTag, FNativeChannelStatePtr>& Pair : NativeChannels)
+		{
+			FEventChannelMemory Memory;
+			Pair.Value->GetMemory(Memory);
+			Bytes += Memory.OwnedBytes;
+		}
+
+		for (const TPair<FGameplayTag, TArray<FForwardedPublisher>>& Pair : ForwardedPublishers)
+		{
+			Bytes += Pair.Value.GetAllocatedSize();
+		}
+
+		Bytes += PublisherHolds.GetAllocatedSize();
+		for (const TPair<FGameplayTag, TMap<FObjectKey, FPublisherHold>>& Pair : PublisherHolds)
+		{
+			Bytes += Pair.Value.GetAllocatedSize();
+		}
+		return Bytes;
+	}
+
+	/**
+	 * @brief Returns footprint for one delegate channel, falling back to native channels.
+	 */
+	bool FEventBus::GetChannelMemory(const FGameplayTag& ChannelTag, FEventChannelMemory& OutMemory) const
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterChannelCall(TEXT("GetChannelMemory"), ChannelTag, Error))
+		{
+			return false;
+		}
+
+		if (const Private::FEventChannelState* State = FindChannelState(ChannelTag))
+		{
+			OutMemory = State->GetMemory();
+			return true;
+		}
+
+		if (const FNativeChannelStatePtr* NativeChannel = NativeChannels.Find(ChannelTag))
+		{
+			(*NativeChannel)->GetMemory(OutMemory);
+			return true;
+		}
+		return false;
+	}
+
+	/**
+	 * @brief Collects footprint for every delegate and native channel.
+	 */
+	void FEventBus::GetAllChannelMemory(TMap<FGameplayTag, FEventChannelMemory>& OutMemory) const
+	{
+		OutMemory.Reset();
+
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterCall(TEXT("GetAllChannelMemory"), Error))
+		{
+			return;
+		}
+
+		OutMemory.Reserve(Channels.Num() + NativeChannels.Num());
+		for (const TPair<FGameplayTag, FChannelStatePtr>& Pair : Channels)
+		{
+			OutMemory.Add(Pair.Key, Pair.Value->GetMemory());
+		}
+
+		for (const TPair<FGameplayTag, FNativeChannelStatePtr>& Pair : NativeChannels)
+		{
+			Pair.Value->GetMemory(OutMemory.Add(Pair.Key));
+		}
+	}
+
+	/**
+	 * @brief Prints one row per channel sorted by owned bytes, then bus totals.
+	 */
+	void FEventBus::DumpMemory(FOutputDevice& Ar) const
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterCall(TEXT("DumpMemory"), Error))
+		{
+			return;
+		}
+
+		TMap<FGameplayTag, FEventChannelMemory> ChannelMemory;
+		GetAllChannelMemory(ChannelMemory);
+		ChannelMemory.ValueSort([](const FEventChannelMemory& Left, const FEventChannelMemory& Right)
+		{
+			return Left.OwnedBytes > Right.OwnedBytes;
+		});
+
+		Ar.Logf(TEXT("%-48s %10s %10s %10s %10s %12s %6s %6s"),
+			TEXT("Channel"), TEXT("Owned"), TEXT("Publishers"), TEXT("Listeners"), TEXT("Dispatch"), TEXT("PubDelegates"), TEXT("#Pub"), TEXT("#Lis"));
+
+		SIZE_T PublisherDelegateBytes = 0;
+		for (const TPair<FGameplayTag, FEventChannelMemory>& Pair : ChannelMemory)
+		{
+			const FEventChannelMemory& Memory = Pair.Value;
+			PublisherDelegateBytes += Memory.PublisherDelegateBytes;
+			Ar.Logf(TEXT("%-48s %10llu %10llu %10llu %10llu %12llu %6d %6d"),
+				*Pair.Key.ToString(),
+				static_cast<uint64>(Memory.OwnedBytes),
+				static_cast<uint64>(Memory.PublisherBytes),
+				static_cast<uint64>(Memory.ListenerBytes),
+				static_cast<uint64>(Memory.DispatchBytes),
+				static_cast<uint64>(Memory.PublisherDelegateBytes),
+				Memory.PublisherCount,
+				Memory.ListenerCount);
+		}
+
+		Ar.Logf(TEXT("Channels=%d BusOwnedBytes=%llu PublisherDelegateBytes=%llu"),
+			ChannelMemory.Num(),
+			static_cast<uint64>(sizeof(FEventBus) + GetAllocatedSize()),
+			static_cast<uint64>(PublisherDelegateBytes));
+	}
+
+	/**
+	 * @brief Combines counters, memory and binding summaries for delegate and native channels.
+	 */
+	void FEventBus::GetChannelSnapshots(TArray<FEventChannelSnapshot>& OutSnapshots) const
+	{
+		OutSnapshots.Reset();
+
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterCall(TEXT("GetChannelSnapshots"), Error))
+		{
+			return;
+		}
+
+		OutSnapshots.Reserve(Channels.Num() + NativeChannels.Num());
+		for (const TPair<FGameplayTag, FChannelStatePtr>& Pair : Channels)
+		{
+			FEventChannelSnapshot& Snapshot = OutSnapshots.AddDefaulted_GetRef();
+			Snapshot.ChannelTag = Pair.Key;
+			Snapshot.Stats = Pair.Value->GetStats();
+			Snapshot.Memory = Pair.Value->GetMemory();
+			Pair.Value->GetBindingSummaries(Snapshot.Publishers, Snapshot.Listeners);
+		}
+
+		for (const TPair<FGameplayTag, FNativeChannelStatePtr>& Pair : NativeChannels)
+		{
+			FEventChannelSnapshot& Snapshot = OutSnapshots.AddDefaulted_GetRef();
+			Snapshot.ChannelTag = Pair.Key;
+			Snapshot.Kind = LexToString(Pair.Value->GetKind());
+			Snapshot.Stats = Pair.Value->GetStats();
+			Pair.Value->GetMemory(Snapshot.Memory);
+			Pair.Value->GetListenerSummaries(Snapshot.Listeners);
+		}
+
+		OutSnapshots.Sort([](const FEventChannelSnapshot& Left, const FEventChannelSnapshot& Right)
+		{
+			return Left.ChannelTag.GetTagName().LexicalLess(Right.ChannelTag.GetTagName());
+		});
+	}
+
+	/**
+	 * @brief Prints one header line per matching channel followed by its publisher and listener bindings.
+	 */
+	void FEventBus::DumpChannels(FOutputDevice& Ar, const FString& ChannelFilter) const
+	{
+		TArray<FEventChannelSnapshot> Snapshots;
+		GetChannelSnapshots(Snapshots);
+
+		int32 DumpedCount = 0;
+		for (const FEventChannelSnapshot& Snapshot : Snapshots)
+		{
+			const FString TagString = Snapshot.ChannelTag.ToString();
+			if (!ChannelFilter.IsEmpty() && !TagString.Contains(ChannelFilter))
+			{
+				continue;
+			}
+
+			++DumpedCount;
+			Ar.Logf(TEXT("%s [%s] Publishers=%d Listeners=%d OwnedBytes=%llu Broadcasts=%llu Invocations=%llu DispatchMs=%.3f"),
+				*TagString,
+				Snapshot.Kind,
+				Snapshot.Stats.PublisherCount,
+				Snapshot.Stats.ListenerCount,
+				static_cast<uint64>(Snapshot.Memory.OwnedBytes),
+				Snapshot.Stats.BroadcastCount,
+				Snapshot.Stats.ListenerInvocationCount,
+				Snapshot.Stats.GetDispatchSeconds() * 1000.0);
+
+			for (const FEventBindingSummary& Summary : Snapshot.Publishers)
+			{
+				Ar.Logf(TEXT("    Publisher %s.%s x%d"), *Summary.ClassName.ToString(), *Summary.MemberName.ToString(), Summary.ObjectCount);
+			}
+
+			for (const FEventBindingSummary& Summary : Snapshot.Listeners)
+			{
+				Ar.Logf(TEXT("    Listener  %s::%s x%d"), *Summary.ClassName.ToString(), *Summary.MemberName.ToString(), Summary.ObjectCount);
+			}
+		}
+
+		Ar.Logf(TEXT("Channels=%d Shown=%d Parent=%s"), Snapshots.Num(), DumpedCount, Parent != nullptr ? TEXT("yes") : TEXT("no"));
+	}
+
+	/**
+	 * @brief Prints cumulative counters sorted by listener invocations.
+	 */
+	void FEventBus::DumpStats(FOutputDevice& Ar) const
+	{
+		TMap<FGameplayTag, FEventChannelStats> ChannelStats;
+		GetAllChannelStats(ChannelStats);
+		ChannelStats.ValueSort([](const FEventChannelStats& Left, const FEventChannelStats& Right)
+		{
+			return Left.ListenerInvocationCount > Right.ListenerInvocationCount;
+		});
+
+		Ar.Logf(TEXT("%-48s %6s %6s %12s %12s %8s %8s %10s %10s"),
+			TEXT("Channel"), TEXT("#Pub"), TEXT("#Lis"), TEXT("Broadcasts"), TEXT("Invocations"), TEXT("Binds"), TEXT("Unbinds"), TEXT("CleanupMs"), TEXT("DispatchMs"));
+
+		for (const TPair<FGameplayTag, FEventChannelStats>& Pair : ChannelStats)
+		{
+			const FEventChannelStats& Stats = Pair.Value;
+			Ar.Logf(TEXT("%-48s %6d %6d %12llu %12llu %8llu %8llu %10.3f %10.3f"),
+				*Pair.Key.ToString(),
+				Stats.PublisherCount,
+				Stats.ListenerCount,
+				Stats.BroadcastCount,
+				Stats.ListenerInvocationCount,
+				Stats.BindCount,
+				Stats.UnbindCount,
+				Stats.GetCleanupSeconds() * 1000.0,
+				Stats.GetDispatchSeconds() * 1000.0);
+		}
+	}
+
+	/**
+	 * @brief Replaces the forwarding parent after rejecting cycles and retracting old forwards.
+	 */
+	bool FEventBus::SetParent(FEventBus* InParent)
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterCall(TEXT("SetParent"), Error))
+		{
+			return false;
+		}
+
+		for (const FEventBus* Ancestor = InParent; Ancestor; Ancestor = Ancestor->Parent)
+		{
+			if (Ancestor == this)
+			{
+				UE_LOG(LogNFLEventBus, Warning, TEXT("SetParent failed. Error=%s"),
+					LexToString(EEventBusError::InvalidScopeParent));
+				return false;
+			}
+		}
+
+		if (InParent == Parent)
+		{
+			return true;
+		}
+
+		RetractAllForwarded();
+		Parent = InParent;
+		return true;
+	}
+
+	/**
+	 * @brief Returns forwarding parent.
+	 */
+	FEventBus* FEventBus::GetParent() const
+	{
+		return Parent;
+	}
+
+	/**
+	 * @brief Hands out a weak reference to the token only the bus holds strongly.
+	 */
+	TWeakPtr<uint8> FEventBus::GetLifetimeToken() const
+	{
+		return LifetimeToken;
+	}
+
+	/**
+	 * @brief Fully unbinds and clears every registered channel state.
+	 */
+	void FEventBus::Reset()
+	{
+		NFL_EVENTBUS_TRACE_SCOPE(EventBus_Reset);
+		EEventBusError Error = EEventBusError::None;
+		if (!FPolicies::EnterCall(TEXT("Reset"), Error))
+		{
+			return;
+		}
+
+		RetractAllForwarded();
+
+		for (TPair<FGameplayTag, FChannelStatePtr>& Pair : Channels)
+		{
+			if (Pair.Value)
+			{
+				Pair.Value->ClearAndUnbind();
+			}
+		}
+
+		Channels.Reset();
+		StaticSlots.Empty();
+		PublisherHolds.Reset();
+
+		for (TPair<FGameplayTag, FNativeChannelStatePtr>& Pair : NativeChannels)
+		{
+			Pair.Value->SetTopology(nullptr);
+			Pair.Value->Reset();
+		}
+
+		NativeChannels.Reset();
+		Topology.Reset();
+	}
+
+	/**
+	 * @brief Finds mutable channel state entry.
+	 */
+	Private::FEventChannelState* FEventBus::FindChannelState(const FGameplayTag& ChannelTag)
+	{
+		FChannelStatePtr* Found = Channels.Find(ChannelTag);
+		return Found ? Found->Get() : nullptr;
+	}
+
+	/**
+	 * @brief Finds immutable channel state entry.
+	 */
+	const Private::FEventChannelState* FEventBus::FindChannelState(const FGameplayTag& ChannelTag) const
+	{
+		const FChannelStatePtr* Found = Channels.Find(ChannelTag);
+		return Found ? Found->Get() : nullptr;
+	}
+
+	/**
+	 * @brief Finds mutable typed channel state by slot index and caches hashed hits into the slot.
+	 */
+	Private::FEventChannelState* FEventBus::FindChannelState(const FStaticChannelId& Channel)
+	{
+		if (!Channel.HasSlot())
+		{
+			return FindChannelState(Channel.ChannelTag);
+		}
+
+		checkSlow(Channel.SlotIndex < FEventBusStaticChannelRegistry::GetNumAllocatedSlots());
+		if (!StaticSlots.IsValidIndex(Channel.SlotIndex))
+		{
+			StaticSlots.SetNum(FMath::Max(Channel.SlotIndex + 1, FEventBusStaticChannelRegistry::GetNumAllocatedSlots()));
+		}
+
+		FStaticSlot& Slot = StaticSlots[Channel.SlotIndex];
+		if (Slot.State == nullptr || Slot.ChannelTag != Channel.ChannelTag)
+		{
+			Slot.ChannelTag = Channel.ChannelTag;
+			Slot.State = FindChannelState(Channel.ChannelTag);
+		}
+		return Slot.State;
+	}
+
+	/**
+	 * @brief Finds immutable typed channel state by slot index with hashed fallback for unbound or foreign slots.
+	 */
+	const Private::FEventChannelState* FEventBus::FindChannelState(const FStaticChannelId& Channel) const
+	{
+		if (StaticSlots.IsValidIndex(Channel.SlotIndex))
+		{
+			const FStaticSlot& Slot = StaticSlots[Channel.SlotIndex];
+			if (Slot.State != nullptr && Slot.ChannelTag == Channel.ChannelTag)
+			{
+				return Slot.State;
+			}
+		}
+		return FindChannelState(Channel.ChannelTag);
+	}
+
+	/**
+	 * @brief Clears slot cache entries for a channel state about to be destroyed.
+	 */
+	void FEventBus::UnbindStaticSlots(const Private::FEventChannelState* const ChannelState)
+	{
+		for (FStaticSlot& Slot : StaticSlots)
+		{
+			if (Slot.State == ChannelState)
+			{
+				Slot.State = nullptr;
+			}
+		}
+	}
+
+	/**
+	 * @brief Called after every delegate channel mutation, including failed ones, since binds also sweep stale entries.
+	 */
+	void FEventBus::PublishTopology(const FGameplayTag& ChannelTag, const Private::FEventChannelState& ChannelState)
+	{
+		Topology.Publish(ChannelState.GetTopology(ChannelTag));
+	}
+
+	/**
+	 * @brief Bulk calls mutate several entries of one channel before any topology callback runs.
+	 */
+	Private::FEventChannelState* FEventBus::FindBulkChannelState(const FGameplayTag& ChannelTag, FBulkChannelStates& Touched)
+	{
+		for (const TPair<FGameplayTag, Private::FEventChannelState*>& Entry : Touched)
+		{
+			if (Entry.Key == ChannelTag)
+			{
+				return Entry.Value;
+			}
+		}
+
+		Private::FEventChannelState* State = FindChannelState(ChannelTag);
+		Touched.Emplace(ChannelTag, State);
+		return State;
+	}
+
+	/**
+	 * @brief Presence callbacks may unregister channels, so each tag is looked up again before it publishes.
+	 */
+	void FEventBus::PublishBulkTopology(const FBulkChannelStates& Touched)
+	{
+		for (const TPair<FGameplayTag, Private::FEventChannelState*>& Entry : Touched)
+		{
+			if (!Entry.Value)
+			{
+				continue;
+			}
+
+			if (const Private::FEventChannelState* State = FindChannelState(Entry.Key))
+			{
+				PublishTopology(Entry.Key, *State);
+			}
+		}
+	}
+
+	/**
+	 * @brief Mirrors a publisher into the nearest ancestor registering the channel so its listeners bind to it.
+	 */
+	void FEventBus::ForwardPublisher(const FGameplayTag& ChannelTag, UObject* PublisherObj, const FPublisherBinding& Binding)
+	{
+		FEventBus* TargetBus = Parent;
+		while (TargetBus && !TargetBus->IsChannelRegistered(ChannelTag))
+		{
+			TargetBus = TargetBus->Parent;
+		}
+
+		if (!TargetBus)
+		{
+			return;
+		}
+
+		const TArray<FForwardedPublisher>* Existing = ForwardedPublishers.Find(ChannelTag);
+		const bool bAlreadyTracked = Existing && Existing->ContainsByPredicate([PublisherObj, TargetBus](const FForwardedPublisher& Entry)
+		{
+			return Entry.TargetBus == TargetBus && Entry.Publisher.Get() == PublisherObj;
+		});
+
+		const EPublisherSource Source = bAlreadyTracked ? EPublisherSource::ForwardRefresh : EPublisherSource::Forwarded;
+		if (!TargetBus->AddPublisherFrom(FStaticChannelId{INDEX_NONE, ChannelTag}, PublisherObj, Binding, Source) || bAlreadyTracked)
+		{
+			return;
+		}
+
+		ForwardedPublishers.FindOrAdd(ChannelTag).Add(FForwardedPublisher{PublisherObj, FObjectKey(PublisherObj), TargetBus});
+	}
+
+	/**
+	 * @brief Removes one publisher from the ancestor buses this bus forwarded it to.
+	 */
+	void FEventBus::RetractPublisher(const FGameplayTag& ChannelTag, UObject* PublisherObj)
+	{
+		TArray<FForwardedPublisher>* Forwarded = ForwardedPublishers.Find(ChannelTag);
+		if (!Forwarded)
+		{
+			return;
+		}
+
+		for (int32 Index = Forwarded->Num() - 1; Index >= 0; --Index)
+		{
+			const FForwardedPublisher Entry = (*Forwarded)[Index];
+			if (Entry.Publisher.Get() == PublisherObj)
+			{
+				Forwarded->RemoveAtSwap(Index);
+				Entry.TargetBus->ReleaseForwardedPublisher(ChannelTag, Entry.PublisherKey, PublisherObj);
+			}
+		}
+
+		if (Forwarded->IsEmpty())
+		{
+			ForwardedPublishers.Remove(ChannelTag);
+		}
+	}
+
+	/**
+	 * @brief Removes every publisher forwarded under one channel from ancestor buses.
+	 */
+	void FEventBus::RetractChannel(const FGameplayTag& ChannelTag)
+	{
+		TArray<FForwardedPublisher> Forwarded;
+		if (!ForwardedPublishers.RemoveAndCopyValue(ChannelTag, Forwarded))
+		{
+			return;
+		}
+
+		for (const FForwardedPublisher& Entry : Forwarded)
+		{
+			Entry.TargetBus->ReleaseForwardedPublisher(ChannelTag, Entry.PublisherKey, Entry.Publisher.Get());
+		}
+	}
+
+	/**
+	 * @brief Removes every forwarded publisher from ancestor buses.
+	 */
+	void FEventBus::RetractAllForwarded()
+	{
+		TArray<FGameplayTag> ForwardedTags;
+		ForwardedPublishers.GetKeys(ForwardedTags);
+		for (const FGameplayTag& ChannelTag : ForwardedTags)
+		{
+			RetractChannel(ChannelTag);
+		}
 	}
 } // namespace Nfrrlib::EventBus
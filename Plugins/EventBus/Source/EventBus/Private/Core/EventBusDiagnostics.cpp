@@ -0,0 +1,154 @@
+#include "EventBus/Core/EventBusDiagnostics.h"
+
+#include "UObject/Class.h"
+#include "UObject/Object.h"
+
+namespace Nfrrlib::EventBus
+{
+	namespace
+	{
+		/** @brief Returns Current - Baseline, or Current when the counter was reset in between. */
+		uint64 CounterDelta(const uint64 Current, const uint64 Baseline)
+		{
+			return Current >= Baseline ? Current - Baseline : Current;
+		}
+	} // namespace
+
+	/**
+	 * @brief Merges one bound object into the class/member row it belongs to.
+	 */
+	void AppendBindingSummary(TArray<FEventBindingSummary>& Summaries, const UObject* BoundObj, const FName MemberName)
+	{
+		if (!::IsValid(BoundObj))
+		{
+			return;
+		}
+
+		const FName ClassName = BoundObj->GetClass()->GetFName();
+		FEventBindingSummary* Existing = Summaries.FindByPredicate([ClassName, MemberName](const FEventBindingSummary& Summary)
+		{
+			return Summary.ClassName == ClassName && Summary.MemberName == MemberName;
+		});
+
+		if (Existing == nullptr)
+		{
+			Existing = &Summaries.AddDefaulted_GetRef();
+			Existing->ClassName = ClassName;
+			Existing->MemberName = MemberName;
+		}
+		++Existing->ObjectCount;
+	}
+
+	/**
+	 * @brief Appends a sample and trims history to the retention window.
+	 */
+	void FEventBusTopSampler::AddSample(const double TimeSeconds, TMap<FString, FEventChannelStats>&& Counters)
+	{
+		FSample& Sample = Samples.AddDefaulted_GetRef();
+		Sample.TimeSeconds = TimeSeconds;
+		Sample.Counters = MoveTemp(Counters);
+
+		const double OldestKept = TimeSeconds - MaxAgeSeconds;
+		int32 FirstKept = 0;
+		// Keep one sample at or before the cutoff so a full-length window still has a baseline.
+		while (FirstKept + 1 < Samples.Num() && Samples[FirstKept + 1].TimeSeconds <= OldestKept)
+		{
+			++FirstKept;
+		}
+
+		if (FirstKept > 0)
+		{
+			Samples.RemoveAt(0, FirstKept, EAllowShrinking::No);
+		}
+	}
+
+	/**
+	 * @brief Diffs the newest sample against the window baseline and ranks channels by the requested rate.
+	 */
+	bool FEventBusTopSampler::GetTop(
+		const double WindowSeconds,
+		const EEventBusTopSort Sort,
+		const int32 MaxRows,
+		TArray<FEventBusTopRow>& OutRows,
+		double& OutWindowSeconds) const
+	{
+		OutRows.Reset();
+		OutWindowSeconds = 0.0;
+		if (Samples.Num() < 2)
+		{
+			return false;
+		}
+
+		const FSample& Latest = Samples.Last();
+		const double WindowStart = Latest.TimeSeconds - WindowSeconds;
+		int32 BaselineIndex = 0;
+		for (int32 Index = Samples.Num() - 2; Index >= 0; --Index)
+		{
+			if (Samples[Index].TimeSeconds <= WindowStart)
+			{
+				BaselineIndex = Index;
+				break;
+			}
+		}
+
+		const FSample& Baseline = Samples[BaselineIndex];
+		const double Elapsed = Latest.TimeSeconds - Baseline.TimeSeconds;
+		if (Elapsed <= 0.0)
+		{
+			return false;
+		}
+
+		OutRows.Reserve(Latest.Counters.Num());
+		for (const TPair<FString, FEventChannelStats>& Pair : Latest.Counters)
+		{
+			// Channels registered inside the window count from zero.
+			const FEventChannelStats* const Before = Baseline.Counters.Find(Pair.Key);
+			const FEventChannelStats Zero;
+			const FEventChannelStats& Base = Before != nullptr ? *Before : Zero;
+
+			FEventBusTopRow& Row = OutRows.AddDefaulted_GetRef();
+			Row.Channel = Pair.Key;
+			Row.BroadcastsPerSecond = CounterDelta(Pair.Value.BroadcastCount, Base.BroadcastCount) / Elapsed;
+			Row.InvocationsPerSecond = CounterDelta(Pair.Value.ListenerInvocationCount, Base.ListenerInvocationCount) / Elapsed;
+			Row.DispatchMsPerSecond =
+				FPlatformTime::ToMilliseconds64(CounterDelta(Pair.Value.DispatchCycles, Base.DispatchCycles)) / Elapsed;
+		}
+
+		if (Sort == EEventBusTopSort::Cost)
+		{
+			OutRows.Sort([](const FEventBusTopRow& Left, const FEventBusTopRow& Right)
+			{
+				return Left.DispatchMsPerSecond > Right.DispatchMsPerSecond;
+			});
+		}
+		else
+		{
+			OutRows.Sort([](const FEventBusTopRow& Left, const FEventBusTopRow& Right)
+			{
+				return Left.InvocationsPerSecond > Right.InvocationsPerSecond;
+			});
+		}
+
+		if (MaxRows >= 0 && OutRows.Num() > MaxRows)
+		{
+			OutRows.SetNum(MaxRows);
+		}
+		OutWindowSeconds = Elapsed;
+		return true;
+	}
+
+	void FEventBusTopSampler::SetMaxAgeSeconds(const double InMaxAgeSeconds)
+	{
+		MaxAgeSeconds = FMath::Max(InMaxAgeSeconds, 0.0);
+	}
+
+	int32 FEventBusTopSampler::GetSampleCount() const
+	{
+		return Samples.Num();
+	}
+
+	void FEventBusTopSampler::Reset()
+	{
+		Samples.Reset();
+	}
+} // namespace Nfrrlib::EventBus
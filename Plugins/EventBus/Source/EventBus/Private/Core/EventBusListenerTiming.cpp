@@ -0,0 +1,163 @@
+#include "EventBus/Core/EventBusListenerTiming.h"
+
+#include "HAL/IConsoleManager.h"
+
+#include "EventBus/Core/EventBus.h"
+
+namespace Nfrrlib::EventBus
+{
+	bool FEventListenerTiming::bEnabled = false;
+
+	namespace
+	{
+		/** @brief Calls past this count fold into an exponential average over roughly this many calls. */
+		constexpr uint64 RollingAverageWindow = 32;
+
+		TAutoConsoleVariable<bool> CVarListenerTimingEnabled(
+			TEXT("EventBus.ListenerTiming.Enabled"),
+			false,
+			TEXT("Times every EventBus listener callback and tracks rolling average and maximum per listener."),
+			FConsoleVariableDelegate::CreateLambda([](IConsoleVariable* Variable)
+			{
+				FEventListenerTiming::SetEnabled(Variable->GetBool());
+			}));
+
+		TAutoConsoleVariable<float> CVarListenerTimingBudgetMs(
+			TEXT("EventBus.ListenerTiming.BudgetMs"),
+			1.0f,
+			TEXT("Per-invocation listener budget in milliseconds; slower callbacks are counted and logged."));
+
+		TAutoConsoleVariable<float> CVarListenerTimingWarnCooldown(
+			TEXT("EventBus.ListenerTiming.WarnCooldown"),
+			5.0f,
+			TEXT("Minimum seconds between over-budget warnings for the same listener."));
+
+		TAutoConsoleVariable<int32> CVarListenerTimingMaxEntries(
+			TEXT("EventBus.ListenerTiming.MaxEntriesPerChannel"),
+			256,
+			TEXT("Listeners tracked per channel before the one with the lowest maximum is evicted."));
+	} // namespace
+
+	void FEventListenerTiming::SetEnabled(const bool bInEnabled)
+	{
+		bEnabled = bInEnabled;
+	}
+
+	double FEventListenerTiming::GetBudgetMs()
+	{
+		return CVarListenerTimingBudgetMs.GetValueOnGameThread();
+	}
+
+	double FEventListenerTiming::GetWarnCooldownSeconds()
+	{
+		return CVarListenerTimingWarnCooldown.GetValueOnGameThread();
+	}
+
+	int32 FEventListenerTiming::GetMaxEntriesPerChannel()
+	{
+		return FMath::Max(CVarListenerTimingMaxEntries.GetValueOnGameThread(), 1);
+	}
+
+	/**
+	 * @brief Updates rolling statistics and emits a rate-limited warning for over-budget calls.
+	 */
+	void FEventListenerTimingTable::Record(const FListenerKey& ListenerKey, const UObject* ListenerObj, const uint64 Cycles, const FGameplayTag& ChannelTag)
+	{
+		FEntry* Entry = Entries.Find(ListenerKey);
+		if (Entry == nullptr)
+		{
+			if (Entries.Num() >= FEventListenerTiming::GetMaxEntriesPerChannel())
+			{
+				const FListenerKey* FastestKey = nullptr;
+				double FastestMaxMs = UE_DOUBLE_BIG_NUMBER;
+				for (const TPair<FListenerKey, FEntry>& Pair : Entries)
+				{
+					if (Pair.Value.Stats.MaxMs < FastestMaxMs)
+					{
+						FastestMaxMs = Pair.Value.Stats.MaxMs;
+						FastestKey = &Pair.Key;
+					}
+				}
+
+				if (FastestKey != nullptr)
+				{
+					Entries.Remove(FListenerKey(*FastestKey));
+				}
+			}
+
+			Entry = &Entries.Add(ListenerKey);
+			Entry->Stats.ClassName = ::IsValid(ListenerObj) ? ListenerObj->GetClass()->GetFName() : NAME_None;
+			Entry->Stats.FunctionName = ListenerKey.FunctionName;
+		}
+
+		FEventListenerTimingStats& Stats = Entry->Stats;
+		const double ElapsedMs = FPlatformTime::ToMilliseconds64(Cycles);
+		++Stats.CallCount;
+		Stats.AverageMs += (ElapsedMs - Stats.AverageMs) / static_cast<double>(FMath::Min(Stats.CallCount, RollingAverageWindow));
+		Stats.MaxMs = FMath::Max(Stats.MaxMs, ElapsedMs);
+		Stats.LastMs = ElapsedMs;
+
+		const double BudgetMs = FEventListenerTiming::GetBudgetMs();
+		if (ElapsedMs <= BudgetMs)
+		{
+			return;
+		}
+
+		++Stats.OverBudgetCount;
+		const double NowSeconds = FPlatformTime::Seconds();
+		if (NowSeconds - Entry->LastWarnSeconds < FEventListenerTiming::GetWarnCooldownSeconds())
+		{
+			return;
+		}
+
+		Entry->LastWarnSeconds = NowSeconds;
+		UE_LOG(LogNFLEventBus, Warning,
+			TEXT("Slow EventBus listener. Channel=%s Listener=%s Function=%s Ms=%.3f BudgetMs=%.3f AvgMs=%.3f MaxMs=%.3f OverBudget=%llu/%llu"),
+			*ChannelTag.ToString(),
+			*GetNameSafe(ListenerObj),
+			*ListenerKey.FunctionName.ToString(),
+			ElapsedMs,
+			BudgetMs,
+			Stats.AverageMs,
+			Stats.MaxMs,
+			Stats.OverBudgetCount,
+			Stats.CallCount);
+	}
+
+	/**
+	 * @brief Copies entries and keeps the slowest by maximum.
+	 */
+	void FEventListenerTimingTable::GetWorst(const int32 MaxRows, TArray<FEventListenerTimingStats>& OutStats) const
+	{
+		OutStats.Reset(Entries.Num());
+		for (const TPair<FListenerKey, FEntry>& Pair : Entries)
+		{
+			OutStats.Add(Pair.Value.Stats);
+		}
+
+		OutStats.Sort([](const FEventListenerTimingStats& Left, const FEventListenerTimingStats& Right)
+		{
+			return Left.MaxMs > Right.MaxMs;
+		});
+
+		if (MaxRows >= 0 && OutStats.Num() > MaxRows)
+		{
+			OutStats.SetNum(MaxRows);
+		}
+	}
+
+	int32 FEventListenerTimingTable::Num() const
+	{
+		return Entries.Num();
+	}
+
+	SIZE_T FEventListenerTimingTable::GetAllocatedSize() const
+	{
+		return Entries.GetAllocatedSize();
+	}
+
+	void FEventListenerTimingTable::Reset()
+	{
+		Entries.Reset();
+	}
+} // namespace Nfrrlib::EventBus
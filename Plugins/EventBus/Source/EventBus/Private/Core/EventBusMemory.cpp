@@ -0,0 +1,3 @@
+#include "EventBus/Core/EventBusMemory.h"
+
+LLM_DEFINE_TAG(EventBus);
@@ -0,0 +1,41 @@
+#include "EventBus/Core/EventBusPayloadType.h"
+
+#include "Misc/ScopeLock.h"
+#include "Templates/UniquePtr.h"
+
+namespace Nfrrlib::EventBus
+{
+	namespace
+	{
+		/**
+		 * @brief Interned signatures behind a function-local static; payload ids may be asked for while modules load.
+		 */
+		struct FPayloadTypeTable final
+		{
+			FCriticalSection Mutex;
+			/** @brief Boxed keys keep their address while the map grows. */
+			TMap<FString, TUniquePtr<uint8>> KeysBySignature;
+		};
+
+		FPayloadTypeTable& GetPayloadTypeTable()
+		{
+			static FPayloadTypeTable Table;
+			return Table;
+		}
+	}
+
+	/**
+	 * @brief Hands out one stable key per signature; repeated signatures get the key handed out first.
+	 */
+	FEventPayloadTypeId FEventPayloadTypeRegistry::Intern(const ANSICHAR* TypeSignature)
+	{
+		FPayloadTypeTable& Table = GetPayloadTypeTable();
+		FScopeLock Lock(&Table.Mutex);
+		TUniquePtr<uint8>& Key = Table.KeysBySignature.FindOrAdd(FString(TypeSignature));
+		if (!Key)
+		{
+			Key = MakeUnique<uint8>(0);
+		}
+		return FEventPayloadTypeId{Key.Get()};
+	}
+} // namespace Nfrrlib::EventBus
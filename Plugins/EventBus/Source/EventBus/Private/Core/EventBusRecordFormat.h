@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace Nfrrlib::EventBus::Private
+{
+	/**
+	 * @brief Event-stream file layout shared by FEventBusRecorder and FEventBusRecording.
+	 *
+	 * Header: Magic (uint32), Version (uint32), SecondsPerCycle (double), StartTime ticks (int64).
+	 * Record: Op (uint8) followed by varint fields. DefineName carries a UTF-8 string that takes the next
+	 * name index; index 0 is the empty string. Every other op carries DeltaCycles, BusIndex, ChannelName,
+	 * ObjectPath, ClassPath, MemberName, Flags, Count and PayloadSize, then PayloadSize raw bytes.
+	 */
+	namespace RecordFormat
+	{
+		constexpr uint32 Magic = 0x43524245; // "EBRC"
+		constexpr uint32 Version = 1;
+		constexpr int32 HeaderSize = sizeof(uint32) * 2 + sizeof(double) + sizeof(int64);
+
+		/** @brief Appends Value as a LEB128 varint. */
+		inline void WriteVarUInt(TArray<uint8>& Out, uint64 Value)
+		{
+			do
+			{
+				uint8 Byte = static_cast<uint8>(Value & 0x7F);
+				Value >>= 7;
+				if (Value != 0)
+				{
+					Byte |= 0x80;
+				}
+				Out.Add(Byte);
+			}
+			while (Value != 0);
+		}
+
+		/** @brief Reads one LEB128 varint at Offset. Returns false on truncated or overlong input. */
+		inline bool ReadVarUInt(const TArray<uint8>& In, int64& Offset, uint64& OutValue)
+		{
+			OutValue = 0;
+			for (int32 Shift = 0; Shift < 64; Shift += 7)
+			{
+				if (Offset >= In.Num())
+				{
+					return false;
+				}
+
+				const uint8 Byte = In[Offset++];
+				OutValue |= static_cast<uint64>(Byte & 0x7F) << Shift;
+				if ((Byte & 0x80) == 0)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+	} // namespace RecordFormat
+} // namespace Nfrrlib::EventBus::Private
@@ -0,0 +1,441 @@
+#include "EventBus/Core/EventBusRecorder.h"
+
+#include "Containers/Queue.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "Tasks/Task.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UnrealType.h"
+
+#include "EventBus/Core/EventBus.h"
+#include "Core/EventBusRecordFormat.h"
+
+#include <atomic>
+
+namespace Nfrrlib::EventBus
+{
+	bool FEventBusRecorder::bRecording = false;
+
+	/**
+	 * @brief Converts record operations into stable diagnostic strings.
+	 */
+	const TCHAR* LexToString(const EEventBusRecordOp Op)
+	{
+		switch (Op)
+		{
+		case EEventBusRecordOp::DefineName:
+			return TEXT("DefineName");
+		case EEventBusRecordOp::RegisterChannel:
+			return TEXT("RegisterChannel");
+		case EEventBusRecordOp::UnregisterChannel:
+			return TEXT("UnregisterChannel");
+		case EEventBusRecordOp::RegisterNativeChannel:
+			return TEXT("RegisterNativeChannel");
+		case EEventBusRecordOp::UnregisterNativeChannel:
+			return TEXT("UnregisterNativeChannel");
+		case EEventBusRecordOp::AddPublisher:
+			return TEXT("AddPublisher");
+		case EEventBusRecordOp::RemovePublisher:
+			return TEXT("RemovePublisher");
+		case EEventBusRecordOp::AddListener:
+			return TEXT("AddListener");
+		case EEventBusRecordOp::RemoveListener:
+			return TEXT("RemoveListener");
+		case EEventBusRecordOp::Broadcast:
+			return TEXT("Broadcast");
+		case EEventBusRecordOp::NativePublish:
+			return TEXT("NativePublish");
+		case EEventBusRecordOp::Flush:
+			return TEXT("Flush");
+		default:
+			return TEXT("Unknown");
+		}
+	}
+
+	namespace
+	{
+		using namespace Private::RecordFormat;
+
+		/** @brief Filled blocks are handed to the background writer once they reach this size. */
+		constexpr int32 BlockSize = 64 * 1024;
+
+		/**
+		 * @brief Recorder state shared by the game thread (producer) and the background writer (consumer).
+		 *
+		 * Only FilledBlocks, Writer and WrittenBytes are touched by the writer task, and Writer only while a
+		 * task is in flight; Start and Stop wait for it before opening or closing the file.
+		 */
+		struct FRecorderState final
+		{
+			FString FilePath;
+			TUniquePtr<FArchive> Writer;
+			/** @brief Block being filled on the game thread. */
+			TArray<uint8> Block;
+			TQueue<TArray<uint8>, EQueueMode::Spsc> FilledBlocks;
+			std::atomic<bool> bWriteScheduled{false};
+			UE::Tasks::FTask WriteTask;
+			std::atomic<uint64> WrittenBytes{0};
+
+			TMap<FName, uint32> NameIndices;
+			TMap<FObjectKey, uint32> ObjectPathIndices;
+			TMap<const FEventBus*, uint32> BusIndices;
+			uint32 NextNameIndex = 1;
+			uint64 LastCycles = 0;
+			FEventBusRecorderStats Stats;
+		};
+
+		FRecorderState& GetState()
+		{
+			static FRecorderState State;
+			return State;
+		}
+
+		/** @brief Appends every filled block to the file. Runs on the writer task, or on the game thread once it is idle. */
+		void WriteFilledBlocks(FRecorderState& State)
+		{
+			TArray<uint8> FilledBlock;
+			while (State.FilledBlocks.Dequeue(FilledBlock))
+			{
+				State.Writer->Serialize(FilledBlock.GetData(), FilledBlock.Num());
+				State.WrittenBytes += FilledBlock.Num();
+			}
+		}
+
+		/**
+		 * @brief Queues the current block and schedules the writer task unless one is already pending.
+		 *
+		 * A block queued while the running task is finishing waits for the next submit or for Stop.
+		 */
+		void SubmitBlock(FRecorderState& State)
+		{
+			if (State.Block.IsEmpty())
+			{
+				return;
+			}
+
+			State.FilledBlocks.Enqueue(MoveTemp(State.Block));
+			State.Block.Reset(BlockSize);
+			++State.Stats.FlushedBlocks;
+
+			if (!State.bWriteScheduled.exchange(true))
+			{
+				State.WriteTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [&State]()
+				{
+					WriteFilledBlocks(State);
+					State.bWriteScheduled = false;
+				});
+			}
+		}
+
+		/** @brief Writes a DefineName record for Value and returns its new index. */
+		uint32 DefineName(FRecorderState& State, const FString& Value)
+		{
+			const FTCHARToUTF8 Utf8(*Value);
+			State.Block.Add(static_cast<uint8>(EEventBusRecordOp::DefineName));
+			WriteVarUInt(State.Block, Utf8.Length());
+			State.Block.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+			return State.NextNameIndex++;
+		}
+
+		uint32 GetNameIndex(FRecorderState& State, const FName Name)
+		{
+			if (Name.IsNone())
+			{
+				return 0;
+			}
+			if (const uint32* Existing = State.NameIndices.Find(Name))
+			{
+				return *Existing;
+			}
+			return State.NameIndices.Add(Name, DefineName(State, Name.ToString()));
+		}
+
+		/** @brief Object paths are cached by FObjectKey, so a path string is built once per recorded object. */
+		uint32 GetObjectPathIndex(FRecorderState& State, const UObject* Object)
+		{
+			if (!Object)
+			{
+				return 0;
+			}
+			if (const uint32* Existing = State.ObjectPathIndices.Find(FObjectKey(Object)))
+			{
+				return *Existing;
+			}
+			return State.ObjectPathIndices.Add(FObjectKey(Object), DefineName(State, Object->GetPathName()));
+		}
+
+		uint32 GetBusIndex(FRecorderState& State, const FEventBus& Bus)
+		{
+			if (const uint32* Existing = State.BusIndices.Find(&Bus))
+			{
+				return *Existing;
+			}
+			return State.BusIndices.Add(&Bus, State.BusIndices.Num());
+		}
+
+		/** @brief Encodes one record into the current block and submits the block once it is full. */
+		void WriteRecord(
+			const EEventBusRecordOp Op,
+			const FEventBus& Bus,
+			const FGameplayTag& ChannelTag,
+			const UObject* Object,
+			const FName MemberName,
+			const uint32 Flags,
+			const int32 Count,
+			const TConstArrayView<uint8> Payload)
+		{
+			FRecorderState& State = GetState();
+			const uint64 NowCycles = FPlatformTime::Cycles64();
+			const int32 StartSize = State.Block.Num();
+
+			// Name definitions must precede the record that references them.
+			const uint32 BusIndex = GetBusIndex(State, Bus);
+			const uint32 ChannelIndex = GetNameIndex(State, ChannelTag.GetTagName());
+			const uint32 ObjectIndex = GetObjectPathIndex(State, Object);
+			const uint32 ClassIndex = GetObjectPathIndex(State, Object ? Object->GetClass() : nullptr);
+			const uint32 MemberIndex = GetNameIndex(State, MemberName);
+
+			State.Block.Add(static_cast<uint8>(Op));
+			WriteVarUInt(State.Block, NowCycles - State.LastCycles);
+			WriteVarUInt(State.Block, BusIndex);
+			WriteVarUInt(State.Block, ChannelIndex);
+			WriteVarUInt(State.Block, ObjectIndex);
+			WriteVarUInt(State.Block, ClassIndex);
+			WriteVarUInt(State.Block, MemberIndex);
+			WriteVarUInt(State.Block, Flags);
+			WriteVarUInt(State.Block, static_cast<uint64>(FMath::Max(Count, 0)));
+			WriteVarUInt(State.Block, Payload.Num());
+			State.Block.Append(Payload.GetData(), Payload.Num());
+
+			State.LastCycles = NowCycles;
+			++State.Stats.RecordCount;
+			State.Stats.RecordedBytes += State.Block.Num() - StartSize;
+
+			if (State.Block.Num() >= BlockSize)
+			{
+				SubmitBlock(State);
+			}
+		}
+	} // namespace
+
+	bool FEventBusRecorder::Start(const FString& FilePath)
+	{
+#if NFL_EVENTBUS_RECORDING
+		EEventBusError Error = EEventBusError::None;
+		if (!FEventBus::FPolicies::EnterCall(TEXT("StartRecording"), Error))
+		{
+			return false;
+		}
+
+		if (bRecording)
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("StartRecording failed. Error=%s File=%s"),
+				LexToString(EEventBusError::RecordingInProgress),
+				*GetState().FilePath);
+			return false;
+		}
+
+		FRecorderState& State = GetState();
+		State.WriteTask.Wait();
+
+		const FString ResolvedPath = FilePath.IsEmpty() ? GetDefaultFilePath() : FilePath;
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(ResolvedPath), true);
+		State.Writer.Reset(IFileManager::Get().CreateFileWriter(*ResolvedPath));
+		if (!State.Writer)
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("StartRecording failed. Error=%s File=%s"),
+				LexToString(EEventBusError::RecordingFileError),
+				*ResolvedPath);
+			return false;
+		}
+
+		uint32 HeaderMagic = Magic;
+		uint32 HeaderVersion = Version;
+		double SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+		int64 StartTicks = FDateTime::UtcNow().GetTicks();
+		*State.Writer << HeaderMagic << HeaderVersion << SecondsPerCycle << StartTicks;
+
+		State.FilePath = ResolvedPath;
+		State.Block.Reset(BlockSize);
+		State.NameIndices.Reset();
+		State.ObjectPathIndices.Reset();
+		State.BusIndices.Reset();
+		State.NextNameIndex = 1;
+		State.LastCycles = FPlatformTime::Cycles64();
+		State.Stats = FEventBusRecorderStats();
+		State.WrittenBytes = HeaderSize;
+		bRecording = true;
+
+		UE_LOG(LogNFLEventBus, Log, TEXT("EventBus recording started. File=%s"), *ResolvedPath);
+		return true;
+#else
+		UE_LOG(LogNFLEventBus, Warning, TEXT("StartRecording ignored; recording is compiled out (NFL_EVENTBUS_RECORDING=0). File=%s"), *FilePath);
+		return false;
+#endif
+	}
+
+	bool FEventBusRecorder::Stop()
+	{
+		if (!bRecording)
+		{
+			return false;
+		}
+
+		bRecording = false;
+		FRecorderState& State = GetState();
+		SubmitBlock(State);
+		State.WriteTask.Wait();
+		WriteFilledBlocks(State);
+
+		const bool bWriteSucceeded = !State.Writer->IsError() && State.Writer->Close();
+		State.Writer.Reset();
+		State.Block.Empty();
+		State.NameIndices.Empty();
+		State.ObjectPathIndices.Empty();
+		State.BusIndices.Empty();
+
+		if (!bWriteSucceeded)
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("StopRecording failed. Error=%s File=%s"),
+				LexToString(EEventBusError::RecordingFileError),
+				*State.FilePath);
+			return false;
+		}
+
+		UE_LOG(LogNFLEventBus, Log, TEXT("EventBus recording stopped. File=%s Records=%llu Bytes=%llu"),
+			*State.FilePath,
+			State.Stats.RecordCount,
+			State.WrittenBytes.load());
+		return true;
+	}
+
+	FString FEventBusRecorder::GetFilePath()
+	{
+		return GetState().FilePath;
+	}
+
+	FEventBusRecorderStats FEventBusRecorder::GetStats()
+	{
+		const FRecorderState& State = GetState();
+		FEventBusRecorderStats Stats = State.Stats;
+		Stats.WrittenBytes = State.WrittenBytes.load();
+		return Stats;
+	}
+
+	FString FEventBusRecorder::GetDefaultFilePath()
+	{
+		return FPaths::Combine(
+			FPaths::ProjectSavedDir(),
+			TEXT("EventBus"),
+			TEXT("Recordings"),
+			FString::Printf(TEXT("EventBus-%s.ebrec"), *FDateTime::Now().ToString()));
+	}
+
+	void FEventBusRecorder::RecordChannel(
+		const FEventBus& Bus,
+		const EEventBusRecordOp Op,
+		const FGameplayTag& ChannelTag,
+		const uint32 Flags,
+		const FName MemberName)
+	{
+		if (!IsRecording())
+		{
+			return;
+		}
+		WriteRecord(Op, Bus, ChannelTag, nullptr, MemberName, Flags, 1, {});
+	}
+
+	void FEventBusRecorder::RecordBinding(
+		const FEventBus& Bus,
+		const EEventBusRecordOp Op,
+		const FGameplayTag& ChannelTag,
+		const UObject* Object,
+		const FName MemberName)
+	{
+		if (!IsRecording())
+		{
+			return;
+		}
+		WriteRecord(Op, Bus, ChannelTag, Object, MemberName, 0, 1, {});
+	}
+
+	void FEventBusRecorder::RecordFlush(const FEventBus& Bus, const FGameplayTag& ChannelTag)
+	{
+		if (!IsRecording())
+		{
+			return;
+		}
+		WriteRecord(EEventBusRecordOp::Flush, Bus, ChannelTag, nullptr, NAME_None, 0, 1, {});
+	}
+
+	void FEventBusRecorder::RecordBroadcastParams(
+		const FEventBus& Bus,
+		const FGameplayTag& ChannelTag,
+		const UObject* Publisher,
+		const FName DelegatePropertyName,
+		const TConstArrayView<const void*> ParamPtrs)
+	{
+		if (!IsRecording() || !::IsValid(Publisher))
+		{
+			return;
+		}
+
+		TArray<uint8> Payload;
+		const FMulticastDelegateProperty* DelegateProperty =
+			FindFProperty<FMulticastDelegateProperty>(Publisher->GetClass(), DelegatePropertyName);
+		const UFunction* Signature = DelegateProperty ? DelegateProperty->SignatureFunction.Get() : nullptr;
+		if (Signature)
+		{
+			// Rebuild the generated parameter struct, then serialize it the way replay reads it back.
+			uint8* Params = static_cast<uint8*>(FMemory_Alloca_Aligned(Signature->ParmsSize, Signature->GetMinAlignment()));
+			Signature->InitializeStruct(Params);
+			int32 ParamIndex = 0;
+			for (TFieldIterator<FProperty> It(Signature); It && It->HasAnyPropertyFlags(CPF_Parm) && ParamIndex < ParamPtrs.Num(); ++It)
+			{
+				if (!It->HasAnyPropertyFlags(CPF_ReturnParm))
+				{
+					It->CopyCompleteValue(It->ContainerPtrToValuePtr<void>(Params), ParamPtrs[ParamIndex++]);
+				}
+			}
+
+			FMemoryWriter MemoryWriter(Payload);
+			FObjectAndNameAsStringProxyArchive Writer(MemoryWriter, false);
+			Signature->SerializeBin(Writer, Params);
+			Signature->DestroyStruct(Params);
+		}
+
+		WriteRecord(EEventBusRecordOp::Broadcast, Bus, ChannelTag, Publisher, DelegatePropertyName, 0, 1, Payload);
+	}
+
+	void FEventBusRecorder::RecordNativePublish(
+		const FEventBus& Bus,
+		const FGameplayTag& ChannelTag,
+		const FVector* Location,
+		const void* PayloadData,
+		const SIZE_T PayloadBytes,
+		const int32 PayloadCount)
+	{
+		if (!IsRecording())
+		{
+			return;
+		}
+
+		TArray<uint8> Payload;
+		Payload.Reserve((Location ? sizeof(FVector) : 0) + PayloadBytes);
+		if (Location)
+		{
+			Payload.Append(reinterpret_cast<const uint8*>(Location), sizeof(FVector));
+		}
+		if (PayloadData)
+		{
+			Payload.Append(static_cast<const uint8*>(PayloadData), PayloadBytes);
+		}
+
+		const EEventNativeChannelKind Kind = Location ? EEventNativeChannelKind::Spatial : EEventNativeChannelKind::Batch;
+		WriteRecord(EEventBusRecordOp::NativePublish, Bus, ChannelTag, nullptr, NAME_None, static_cast<uint32>(Kind), PayloadCount, Payload);
+	}
+} // namespace Nfrrlib::EventBus
@@ -0,0 +1,320 @@
+#include "EventBus/Core/EventBusReplay.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+
+#include "EventBus/Core/EventBus.h"
+#include "Core/EventBusRecordFormat.h"
+
+namespace Nfrrlib::EventBus
+{
+	namespace
+	{
+		using namespace Private::RecordFormat;
+
+		/** @brief Fixed varint fields that follow Op in every record except DefineName. */
+		enum ERecordField : int32
+		{
+			FieldDeltaCycles,
+			FieldBusIndex,
+			FieldChannelName,
+			FieldObjectPath,
+			FieldClassPath,
+			FieldMemberName,
+			FieldFlags,
+			FieldCount,
+			FieldPayloadSize,
+			FieldNum
+		};
+
+		bool FailLoad(const FString& FilePath, const EEventBusError Error, const int64 Offset)
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("LoadRecording failed. Error=%s File=%s Offset=%lld"),
+				LexToString(Error),
+				*FilePath,
+				Offset);
+			return false;
+		}
+	} // namespace
+
+	bool FEventBusRecording::Load(const FString& FilePath, FEventBusRecording& OutRecording)
+	{
+		OutRecording = FEventBusRecording();
+
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+		{
+			return FailLoad(FilePath, EEventBusError::RecordingFileError, 0);
+		}
+		if (Bytes.Num() < HeaderSize)
+		{
+			return FailLoad(FilePath, EEventBusError::InvalidRecording, 0);
+		}
+
+		uint32 HeaderMagic = 0;
+		uint32 HeaderVersion = 0;
+		double SecondsPerCycle = 0.0;
+		int64 StartTicks = 0;
+		FMemoryReader HeaderReader(Bytes);
+		HeaderReader << HeaderMagic << HeaderVersion << SecondsPerCycle << StartTicks;
+		if (HeaderMagic != Magic || HeaderVersion != Version)
+		{
+			return FailLoad(FilePath, EEventBusError::InvalidRecording, 0);
+		}
+		OutRecording.StartTime = FDateTime(StartTicks);
+
+		TArray<FString> Names;
+		Names.Emplace();
+		uint64 ElapsedCycles = 0;
+		int64 Offset = HeaderSize;
+		while (Offset < Bytes.Num())
+		{
+			const int64 RecordOffset = Offset;
+			const uint8 OpValue = Bytes[Offset++];
+			if (OpValue >= static_cast<uint8>(EEventBusRecordOp::Count))
+			{
+				return FailLoad(FilePath, EEventBusError::InvalidRecording, RecordOffset);
+			}
+
+			const EEventBusRecordOp Op = static_cast<EEventBusRecordOp>(OpValue);
+			if (Op == EEventBusRecordOp::DefineName)
+			{
+				uint64 Length = 0;
+				if (!ReadVarUInt(Bytes, Offset, Length) || Length > static_cast<uint64>(Bytes.Num() - Offset))
+				{
+					return FailLoad(FilePath, EEventBusError::InvalidRecording, RecordOffset);
+				}
+
+				const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData() + Offset), static_cast<int32>(Length));
+				Names.Emplace(Converted.Length(), Converted.Get());
+				Offset += Length;
+				continue;
+			}
+
+			uint64 Fields[FieldNum];
+			for (uint64& Field : Fields)
+			{
+				if (!ReadVarUInt(Bytes, Offset, Field))
+				{
+					return FailLoad(FilePath, EEventBusError::InvalidRecording, RecordOffset);
+				}
+			}
+
+			const uint64 NameCount = Names.Num();
+			if (Fields[FieldChannelName] >= NameCount || Fields[FieldObjectPath] >= NameCount || Fields[FieldClassPath] >= NameCount ||
+				Fields[FieldMemberName] >= NameCount || Fields[FieldPayloadSize] > static_cast<uint64>(Bytes.Num() - Offset))
+			{
+				return FailLoad(FilePath, EEventBusError::InvalidRecording, RecordOffset);
+			}
+
+			ElapsedCycles += Fields[FieldDeltaCycles];
+			FEventBusRecord& Record = OutRecording.Records.AddDefaulted_GetRef();
+			Record.Op = Op;
+			Record.BusIndex = static_cast<int32>(Fields[FieldBusIndex]);
+			Record.TimeSeconds = static_cast<double>(ElapsedCycles) * SecondsPerCycle;
+			Record.ChannelName = Names[Fields[FieldChannelName]].IsEmpty() ? NAME_None : FName(*Names[Fields[FieldChannelName]]);
+			Record.ChannelTag = FGameplayTag::RequestGameplayTag(Record.ChannelName, false);
+			Record.ObjectPath = Names[Fields[FieldObjectPath]];
+			Record.ClassPath = Names[Fields[FieldClassPath]];
+			Record.MemberName = Names[Fields[FieldMemberName]].IsEmpty() ? NAME_None : FName(*Names[Fields[FieldMemberName]]);
+			Record.Flags = static_cast<uint32>(Fields[FieldFlags]);
+			Record.Count = static_cast<int32>(Fields[FieldCount]);
+			Record.Payload.Append(Bytes.GetData() + Offset, static_cast<int32>(Fields[FieldPayloadSize]));
+			Offset += Fields[FieldPayloadSize];
+
+			OutRecording.BusCount = FMath::Max(OutRecording.BusCount, Record.BusIndex + 1);
+		}
+		return true;
+	}
+
+	double FEventBusRecording::GetDurationSeconds() const
+	{
+		return Records.IsEmpty() ? 0.0 : Records.Last().TimeSeconds;
+	}
+
+	FEventBusReplayer::FEventBusReplayer(const FEventBusRecording& InRecording)
+		: Recording(InRecording)
+	{
+	}
+
+	bool FEventBusReplayer::Replay(FEventBus& Bus, const FEventBusReplayOptions& Options, FEventBusReplayResult& OutResult)
+	{
+		OutResult = FEventBusReplayResult();
+		const double StartSeconds = FPlatformTime::Seconds();
+		for (const FEventBusRecord& Record : Recording.Records)
+		{
+			if (Options.BusIndex != INDEX_NONE && Record.BusIndex != Options.BusIndex)
+			{
+				++OutResult.SkippedCount;
+				continue;
+			}
+
+			bool bSkipped = false;
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			const bool bSucceeded = ReplayRecord(Bus, Record, Options, bSkipped);
+			const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+			if (bSkipped)
+			{
+				++OutResult.SkippedCount;
+				continue;
+			}
+
+			++OutResult.ReplayedCount;
+			OutResult.OpCycles[static_cast<int32>(Record.Op)] += Cycles;
+			if (!bSucceeded)
+			{
+				++OutResult.FailedCount;
+			}
+			if (Options.OnRecordReplayed)
+			{
+				Options.OnRecordReplayed(Record, Cycles);
+			}
+		}
+
+		OutResult.TotalSeconds = FPlatformTime::Seconds() - StartSeconds;
+		return OutResult.FailedCount == 0;
+	}
+
+	UObject* FEventBusReplayer::FindResolvedObject(const FString& ObjectPath) const
+	{
+		const TStrongObjectPtr<UObject>* Existing = Objects.Find(ObjectPath);
+		return Existing ? Existing->Get() : nullptr;
+	}
+
+	UObject* FEventBusReplayer::ResolveObject(const FEventBusRecord& Record, const FEventBusReplayOptions& Options)
+	{
+		if (Record.ObjectPath.IsEmpty())
+		{
+			return nullptr;
+		}
+		if (UObject* Existing = FindResolvedObject(Record.ObjectPath))
+		{
+			return Existing;
+		}
+
+		UObject* Object = Options.ResolveObject ? Options.ResolveObject(Record) : nullptr;
+		if (!Object)
+		{
+			UClass* Class = LoadObject<UClass>(nullptr, *Record.ClassPath, nullptr, LOAD_Quiet | LOAD_NoWarn);
+			if (!Class || Class->HasAnyClassFlags(CLASS_Abstract))
+			{
+				UE_LOG(LogNFLEventBus, Warning, TEXT("Replay could not create stand-in. Error=%s Object=%s Class=%s"),
+					LexToString(EEventBusError::InvalidObject),
+					*Record.ObjectPath,
+					*Record.ClassPath);
+				return nullptr;
+			}
+			Object = NewObject<UObject>(GetTransientPackage(), Class, NAME_None, RF_Transient);
+		}
+
+		Objects.Add(Record.ObjectPath, TStrongObjectPtr<UObject>(Object));
+		return Object;
+	}
+
+	bool FEventBusReplayer::ReplayBroadcast(FEventBus& Bus, const FEventBusRecord& Record, UObject* Publisher) const
+	{
+		const FMulticastDelegateProperty* DelegateProperty =
+			FindFProperty<FMulticastDelegateProperty>(Publisher->GetClass(), Record.MemberName);
+		const UFunction* Signature = DelegateProperty ? DelegateProperty->SignatureFunction.Get() : nullptr;
+		if (!Signature)
+		{
+			return false;
+		}
+
+		uint8* Params = static_cast<uint8*>(FMemory_Alloca_Aligned(Signature->ParmsSize, Signature->GetMinAlignment()));
+		Signature->InitializeStruct(Params);
+		FMemoryReader MemoryReader(Record.Payload);
+		FObjectAndNameAsStringProxyArchive Reader(MemoryReader, true);
+		Signature->SerializeBin(Reader, Params);
+
+		const bool bDecoded = !Reader.IsError();
+		if (bDecoded)
+		{
+			if (const FMulticastScriptDelegate* Delegate = DelegateProperty->GetMulticastDelegate(DelegateProperty->ContainerPtrToValuePtr<void>(Publisher)))
+			{
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				Delegate->ProcessMulticastDelegate<UObject>(Params);
+				Bus.RecordDispatch(FStaticChannelId{INDEX_NONE, Record.ChannelTag}, StartCycles, FPlatformTime::Cycles64());
+			}
+		}
+		Signature->DestroyStruct(Params);
+		return bDecoded;
+	}
+
+	bool FEventBusReplayer::ReplayRecord(FEventBus& Bus, const FEventBusRecord& Record, const FEventBusReplayOptions& Options, bool& bOutSkipped)
+	{
+		bOutSkipped = false;
+		switch (Record.Op)
+		{
+		case EEventBusRecordOp::RegisterChannel:
+		{
+			FChannelRegistration Registration;
+			Registration.ChannelTag = Record.ChannelTag;
+			Registration.bOwnsPublisherDelegates = Record.Flags != 0;
+			return Bus.RegisterChannel(Registration);
+		}
+		case EEventBusRecordOp::UnregisterChannel:
+			return Bus.UnregisterChannel(Record.ChannelTag);
+		case EEventBusRecordOp::UnregisterNativeChannel:
+			return static_cast<EEventNativeChannelKind>(Record.Flags) == EEventNativeChannelKind::Spatial
+				? Bus.UnregisterSpatialChannel(Record.ChannelTag)
+				: Bus.UnregisterBatchChannel(Record.ChannelTag);
+		case EEventBusRecordOp::RegisterNativeChannel:
+		case EEventBusRecordOp::NativePublish:
+			if (!Options.NativeChannelHandler)
+			{
+				bOutSkipped = true;
+				return true;
+			}
+			return Options.NativeChannelHandler(Bus, Record);
+		case EEventBusRecordOp::Flush:
+			if (Record.ChannelTag.IsValid())
+			{
+				Bus.FlushBatchChannel(Record.ChannelTag);
+			}
+			else
+			{
+				Bus.FlushBatchChannels();
+			}
+			return true;
+		default:
+			break;
+		}
+
+		UObject* Object = ResolveObject(Record, Options);
+		if (!Object)
+		{
+			return false;
+		}
+
+		switch (Record.Op)
+		{
+		case EEventBusRecordOp::AddPublisher:
+		{
+			FPublisherBinding Binding;
+			Binding.DelegatePropertyName = Record.MemberName;
+			return Bus.AddPublisher(Record.ChannelTag, Object, Binding);
+		}
+		case EEventBusRecordOp::RemovePublisher:
+			return Bus.RemovePublisher(Record.ChannelTag, Object);
+		case EEventBusRecordOp::AddListener:
+		case EEventBusRecordOp::RemoveListener:
+		{
+			FListenerBinding Binding;
+			Binding.FunctionName = Record.MemberName;
+			return Record.Op == EEventBusRecordOp::AddListener
+				? Bus.AddListener(Record.ChannelTag, Object, Binding)
+				: Bus.RemoveListener(Record.ChannelTag, Object, Binding);
+		}
+		case EEventBusRecordOp::Broadcast:
+			return ReplayBroadcast(Bus, Record, Object);
+		default:
+			bOutSkipped = true;
+			return true;
+		}
+	}
+} // namespace Nfrrlib::EventBus
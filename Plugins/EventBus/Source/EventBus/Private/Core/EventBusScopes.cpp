@@ -0,0 +1,327 @@
+#include "EventBus/Core/EventBusScopes.h"
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Binds the scope tree to its root bus.
+	 */
+	FEventBusScopeRegistry::FEventBusScopeRegistry(FEventBus& InRootBus)
+		: RootBus(InRootBus)
+	{
+	}
+
+	/**
+	 * @brief Releases every scope before the root bus can be torn down.
+	 */
+	FEventBusScopeRegistry::~FEventBusScopeRegistry()
+	{
+		ReleaseAll();
+	}
+
+	/**
+	 * @brief Creates or returns one scope bus and wires its forwarding parent.
+	 */
+	FEventBus* FEventBusScopeRegistry::CreateScope(
+		const UObject* ScopeOwner,
+		const UObject* ParentScopeOwner,
+		const bool bForwardToParent)
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (FEventBus::FPolicies::EnterCall(TEXT("CreateScope"), Error) && !::IsValid(ScopeOwner))
+		{
+			Error = EEventBusError::InvalidObject;
+		}
+
+		if (Error != EEventBusError::None)
+		{
+			UE_LOG(LogNFLEventBus, Warning, TEXT("CreateScope failed. Error=%s Scope=%s"),
+				LexToString(Error),
+				*GetNameSafe(ScopeOwner));
+			return nullptr;
+		}
+
+		const FObjectKey ParentKey = ParentScopeOwner ? FObjectKey(ParentScopeOwner) : FObjectKey();
+		if (const FScopeEntry* Existing = Scopes.Find(FObjectKey(ScopeOwner)))
+		{
+			if (Existing->ParentKey != ParentKey || Existing->bForwardToParent != bForwardToParent)
+			{
+				UE_LOG(LogNFLEventBus, Warning, TEXT("CreateScope failed. Error=%s Scope=%s RequestedParent=%s"),
+					LexToString(EEventBusError::InvalidScopeParent),
+					*GetNameSafe(ScopeOwner),
+					*GetNameSafe(ParentScopeOwner));
+				return nullptr;
+			}
+			return Existing->Bus.Get();
+		}
+
+		FEventBus* ParentBus = &RootBus;
+		if (ParentScopeOwner)
+		{
+			ParentBus = FindScope(ParentScopeOwner);
+			if (!ParentBus || ParentScopeOwner == ScopeOwner)
+			{
+				UE_LOG(LogNFLEventBus, Warning, TEXT("CreateScope failed. Error=%s Scope=%s Parent=%s"),
+					LexToString(EEventBusError::InvalidScopeParent),
+					*GetNameSafe(ScopeOwner),
+					*GetNameSafe(ParentScopeOwner));
+				return nullptr;
+			}
+		}
+
+		LLM_SCOPE_BYTAG(EventBus);
+		FScopeEntry NewEntry;
+		NewEntry.Bus = MakeUnique<FEventBus>();
+		NewEntry.Owner = ScopeOwner;
+		NewEntry.ParentKey = ParentKey;
+		NewEntry.bForwardToParent = bForwardToParent;
+		if (bForwardToParent)
+		{
+			NFL_EVENTBUS_UNUSED(NewEntry.Bus->SetParent(ParentBus));
+		}
+
+		FEventBus* const ScopeBus = NewEntry.Bus.Get();
+		Scopes.Add(FObjectKey(ScopeOwner), MoveTemp(NewEntry));
+
+		UE_LOG(LogNFLEventBus, Verbose, TEXT("CreateScope. Scope=%s Parent=%s Forward=%d"),
+			*GetNameSafe(ScopeOwner),
+			*GetNameSafe(ParentScopeOwner),
+			bForwardToParent ? 1 : 0);
+		return ScopeBus;
+	}
+
+	/**
+	 * @brief Finds one scope bus by owner identity.
+	 */
+	FEventBus* FEventBusScopeRegistry::FindScope(const UObject* ScopeOwner) const
+	{
+		if (!ScopeOwner)
+		{
+			return nullptr;
+		}
+
+		const FScopeEntry* Found = Scopes.Find(FObjectKey(ScopeOwner));
+		return Found ? Found->Bus.Get() : nullptr;
+	}
+
+	/**
+	 * @brief Walks the outer chain until a scope owner is found.
+	 */
+	FEventBus& FEventBusScopeRegistry::ResolveBus(const UObject* ContextObject) const
+	{
+		if (!Scopes.IsEmpty())
+		{
+			for (const UObject* Current = ContextObject; Current; Current = Current->GetOuter())
+			{
+				if (FEventBus* ScopeBus = FindScope(Current))
+				{
+					return *ScopeBus;
+				}
+			}
+		}
+
+		return RootBus;
+	}
+
+	/**
+	 * @brief Releases one scope subtree.
+	 */
+	bool FEventBusScopeRegistry::ReleaseScope(const UObject* ScopeOwner)
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FEventBus::FPolicies::EnterCall(TEXT("ReleaseScope"), Error) || !ScopeOwner)
+		{
+			return false;
+		}
+
+		return ReleaseScopeRecursive(FObjectKey(ScopeOwner)) > 0;
+	}
+
+	/**
+	 * @brief Releases scopes owned by OuterObject or by objects inside it, plus stale-owner scopes.
+	 */
+	int32 FEventBusScopeRegistry::ReleaseScopesWithin(const UObject* OuterObject)
+	{
+		EEventBusError Error = EEventBusError::None;
+		if (!FEventBus::FPolicies::EnterCall(TEXT("ReleaseScopesWithin"), Error) || Scopes.IsEmpty())
+		{
+			return 0;
+		}
+
+		TArray<FObjectKey, TInlineAllocator<16>> KeysToRelease;
+		for (const TPair<FObjectKey, FScopeEntry>& Pair : Scopes)
+		{
+			const UObject* Owner = Pair.Value.Owner.Get();
+			if (!Owner || (OuterObject && (Owner == OuterObject || Owner->IsIn(OuterObject))))
+			{
+				KeysToRelease.Add(Pair.Key);
+			}
+		}
+
+		int32 ReleasedCount = 0;
+		for (const FObjectKey& Key : KeysToRelease)
+		{
+			// Keys already removed as descendants of an earlier entry release nothing.
+			ReleasedCount += ReleaseScopeRecursive(Key);
+		}
+		return ReleasedCount;
+	}
+
+	/**
+	 * @brief Releases every scope, children before parents.
+	 */
+	void FEventBusScopeRegistry::ReleaseAll()
+	{
+		while (!Scopes.IsEmpty())
+		{
+			const FObjectKey Key = Scopes.CreateConstIterator().Key();
+			ReleaseScopeRecursive(Key);
+		}
+	}
+
+	/**
+	 * @brief Flushes batched channels on every scope bus.
+	 */
+	int32 FEventBusScopeRegistry::FlushBatchChannels()
+	{
+		if (Scopes.IsEmpty())
+		{
+			return 0;
+		}
+
+		// Snapshot buses so a flush callback releasing a scope cannot invalidate iteration.
+		TArray<FObjectKey, TInlineAllocator<16>> Keys;
+		Scopes.GetKeys(Keys);
+
+		++FlushDepth;
+		int32 DeliveredCount = 0;
+		for (const FObjectKey& Key : Keys)
+		{
+			if (const FScopeEntry* Entry = Scopes.Find(Key))
+			{
+				DeliveredCount += Entry->Bus->FlushBatchChannels();
+			}
+		}
+		--FlushDepth;
+
+		if (FlushDepth == 0)
+		{
+			RetiredBuses.Reset();
+		}
+		return DeliveredCount;
+	}
+
+	/**
+	 * @brief Presence callbacks fired by a sweep may release scopes, so buses are retired like during a flush.
+	 */
+	int32 FEventBusScopeRegistry::SweepStaleBindings()
+	{
+		if (Scopes.IsEmpty())
+		{
+			return 0;
+		}
+
+		TArray<FObjectKey, TInlineAllocator<16>> Keys;
+		Scopes.GetKeys(Keys);
+
+		++FlushDepth;
+		int32 DroppedCount = 0;
+		for (const FObjectKey& Key : Keys)
+		{
+			if (const FScopeEntry* Entry = Scopes.Find(Key))
+			{
+				DroppedCount += Entry->Bus->SweepStaleBindings();
+			}
+		}
+		--FlushDepth;
+
+		if (FlushDepth == 0)
+		{
+			RetiredBuses.Reset();
+		}
+		return DroppedCount;
+	}
+
+	/**
+	 * @brief Clears listener timings on every scope bus.
+	 */
+	void FEventBusScopeRegistry::ResetListenerTimings()
+	{
+		for (TPair<FObjectKey, FScopeEntry>& Pair : Scopes)
+		{
+			Pair.Value.Bus->ResetListenerTimings();
+		}
+	}
+
+	/**
+	 * @brief Returns number of live scopes.
+	 */
+	int32 FEventBusScopeRegistry::GetNumScopes() const
+	{
+		return Scopes.Num();
+	}
+
+	/**
+	 * @brief Visits scopes in map order.
+	 */
+	void FEventBusScopeRegistry::ForEachScope(const TFunctionRef<void(const UObject* ScopeOwner, const FEventBus& ScopeBus)> Visitor) const
+	{
+		for (const TPair<FObjectKey, FScopeEntry>& Pair : Scopes)
+		{
+			Visitor(Pair.Value.Owner.Get(), *Pair.Value.Bus);
+		}
+	}
+
+	/**
+	 * @brief Sums the scope map, each heap-allocated scope bus and buses retired during a flush.
+	 */
+	SIZE_T FEventBusScopeRegistry::GetAllocatedSize() const
+	{
+		SIZE_T Bytes = Scopes.GetAllocatedSize() + RetiredBuses.GetAllocatedSize();
+		for (const TPair<FObjectKey, FScopeEntry>& Pair : Scopes)
+		{
+			Bytes += sizeof(FEventBus) + Pair.Value.Bus->GetAllocatedSize();
+		}
+
+		for (const TUniquePtr<FEventBus>& RetiredBus : RetiredBuses)
+		{
+			Bytes += sizeof(FEventBus) + RetiredBus->GetAllocatedSize();
+		}
+		return Bytes;
+	}
+
+	/**
+	 * @brief Releases descendants first so each child retracts its forwards while its parent is alive.
+	 */
+	int32 FEventBusScopeRegistry::ReleaseScopeRecursive(const FObjectKey& Key)
+	{
+		if (!Scopes.Contains(Key))
+		{
+			return 0;
+		}
+
+		TArray<FObjectKey, TInlineAllocator<8>> ChildKeys;
+		for (const TPair<FObjectKey, FScopeEntry>& Pair : Scopes)
+		{
+			if (Pair.Value.ParentKey == Key)
+			{
+				ChildKeys.Add(Pair.Key);
+			}
+		}
+
+		int32 ReleasedCount = 0;
+		for (const FObjectKey& ChildKey : ChildKeys)
+		{
+			ReleasedCount += ReleaseScopeRecursive(ChildKey);
+		}
+
+		TUniquePtr<FEventBus> ReleasedBus = MoveTemp(Scopes.FindChecked(Key).Bus);
+		Scopes.Remove(Key);
+		ReleasedBus->Reset();
+		if (FlushDepth > 0)
+		{
+			// A flush callback released this scope; keep the bus alive until the flush unwinds.
+			RetiredBuses.Add(MoveTemp(ReleasedBus));
+		}
+		return ReleasedCount + 1;
+	}
+} // namespace Nfrrlib::EventBus
@@ -0,0 +1,91 @@
+#include "EventBus/Core/EventBusSnapshots.h"
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Re-reads the epoch after registering, so a reader never stays counted under an epoch that
+	 * advanced past it before the registration became visible.
+	 */
+	FEventBusEpochDomain::FReadScope::FReadScope(const FEventBusEpochDomain& InDomain)
+		: Domain(InDomain)
+	{
+		for (;;)
+		{
+			const uint64 ObservedEpoch = Domain.Epoch.load(std::memory_order_seq_cst);
+			Parity = static_cast<uint32>(ObservedEpoch & 1);
+			Domain.Readers[Parity].fetch_add(1, std::memory_order_seq_cst);
+			if (Domain.Epoch.load(std::memory_order_seq_cst) == ObservedEpoch)
+			{
+				return;
+			}
+			Domain.Readers[Parity].fetch_sub(1, std::memory_order_seq_cst);
+		}
+	}
+
+	FEventBusEpochDomain::FReadScope::~FReadScope()
+	{
+		Domain.Readers[Parity].fetch_sub(1, std::memory_order_release);
+	}
+
+	FEventBusEpochDomain::~FEventBusEpochDomain()
+	{
+		for (const FRetired& Entry : Retired)
+		{
+			Entry.Deleter(Entry.Context, Entry.Object);
+		}
+	}
+
+	/**
+	 * @brief Reclaims on every retire; the scan stops at the first object still in its grace period.
+	 */
+	void FEventBusEpochDomain::RetireErased(void* const Object, void* const Context, void (*const Deleter)(void*, void*))
+	{
+		Retired.Add({Object, Context, Deleter, Epoch.load(std::memory_order_relaxed)});
+		Reclaim();
+	}
+
+	bool FEventBusEpochDomain::TryAdvance()
+	{
+		const uint64 Current = Epoch.load(std::memory_order_seq_cst);
+		if (Readers[(Current + 1) & 1].load(std::memory_order_seq_cst) != 0)
+		{
+			return false;
+		}
+
+		Epoch.store(Current + 1, std::memory_order_seq_cst);
+		return true;
+	}
+
+	/**
+	 * @brief Two advances are enough to free everything retired before this call when no reader is active.
+	 */
+	int32 FEventBusEpochDomain::Reclaim()
+	{
+		if (Retired.IsEmpty())
+		{
+			return 0;
+		}
+
+		if (TryAdvance())
+		{
+			TryAdvance();
+		}
+
+		const uint64 Current = Epoch.load(std::memory_order_seq_cst);
+		int32 ReclaimedCount = 0;
+		while (ReclaimedCount < Retired.Num() && Retired[ReclaimedCount].Epoch + 2 <= Current)
+		{
+			const FRetired& Entry = Retired[ReclaimedCount];
+			Entry.Deleter(Entry.Context, Entry.Object);
+			++ReclaimedCount;
+		}
+
+		Retired.RemoveAt(0, ReclaimedCount, EAllowShrinking::No);
+		return ReclaimedCount;
+	}
+
+	int32 FEventBusEpochDomain::GetRetiredCount() const
+	{
+		return Retired.Num();
+	}
+} // namespace Nfrrlib::EventBus
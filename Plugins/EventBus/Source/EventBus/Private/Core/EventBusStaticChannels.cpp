@@ -0,0 +1,152 @@
+#include "EventBus/Core/EventBusStaticChannels.h"
+
+#include "Misc/ScopeLock.h"
+
+#include <atomic>
+
+namespace Nfrrlib::EventBus
+{
+	namespace
+	{
+		/**
+		 * @brief Returns slot counter through a function-local static to stay safe during static initialization.
+		 */
+		std::atomic<int32>& GetNextSlotCounter()
+		{
+			static std::atomic<int32> NextSlot{0};
+			return NextSlot;
+		}
+
+		/**
+		 * @brief One declaration: resolved data plus the accessors of every loaded module that compiled it.
+		 */
+		struct FDescriptorEntry final
+		{
+			FStaticChannelDescriptor Descriptor;
+			TArray<TPair<const FStaticChannelDescription*, FStaticChannelDeclaration>> Declarations;
+			bool bResolved = false;
+		};
+
+		/**
+		 * @brief Declaration list behind a function-local static; modules can describe channels while loading.
+		 */
+		struct FDescriptorList final
+		{
+			FCriticalSection Mutex;
+			TArray<FDescriptorEntry> Entries;
+			/** @brief Slot per declaration key; each module's copy of a declaration asks again. */
+			TMap<FString, int32> SlotsByKey;
+			TMap<FString, int32> DescriptorsByKey;
+		};
+
+		/**
+		 * @brief Never destroyed: modules withdraw declarations from static destructors, which may run after
+		 * this module's statics at process exit.
+		 */
+		FDescriptorList& GetDescriptorList()
+		{
+			static FDescriptorList* List = new FDescriptorList();
+			return *List;
+		}
+	}
+
+	/**
+	 * @brief Reserves one dense slot per declaration key; repeated keys get the slot handed out first.
+	 */
+	int32 FEventBusStaticChannelRegistry::AllocateSlot(const TCHAR* ChannelKey)
+	{
+		FDescriptorList& List = GetDescriptorList();
+		FScopeLock Lock(&List.Mutex);
+		if (const int32* Existing = List.SlotsByKey.Find(ChannelKey))
+		{
+			return *Existing;
+		}
+
+		const int32 NextSlot = GetNextSlotCounter().fetch_add(1, std::memory_order_relaxed);
+		const int32 SlotIndex = NextSlot < NFL_EVENTBUS_MAX_STATIC_CHANNELS ? NextSlot : INDEX_NONE;
+		List.SlotsByKey.Add(ChannelKey, SlotIndex);
+		return SlotIndex;
+	}
+
+	/**
+	 * @brief Returns reserved slot count bounded by table capacity.
+	 */
+	int32 FEventBusStaticChannelRegistry::GetNumAllocatedSlots()
+	{
+		return FMath::Min(GetNextSlotCounter().load(std::memory_order_relaxed), NFL_EVENTBUS_MAX_STATIC_CHANNELS);
+	}
+
+	/**
+	 * @brief Keeps one descriptor per key and one accessor set per module; nothing is evaluated yet.
+	 */
+	int32 FEventBusStaticChannelRegistry::DescribeChannel(
+		const TCHAR* ChannelKey,
+		const FStaticChannelDescription& Owner,
+		const FStaticChannelDeclaration& Declaration)
+	{
+		FDescriptorList& List = GetDescriptorList();
+		FScopeLock Lock(&List.Mutex);
+		int32 DescriptorIndex = INDEX_NONE;
+		if (const int32* Existing = List.DescriptorsByKey.Find(ChannelKey))
+		{
+			DescriptorIndex = *Existing;
+		}
+		else
+		{
+			DescriptorIndex = List.Entries.AddDefaulted();
+			List.Entries[DescriptorIndex].Descriptor.ChannelDefName = Declaration.ChannelDefName;
+			List.DescriptorsByKey.Add(ChannelKey, DescriptorIndex);
+		}
+
+		List.Entries[DescriptorIndex].Declarations.Emplace(&Owner, Declaration);
+		return DescriptorIndex;
+	}
+
+	/**
+	 * @brief Forgets the unloading module's accessors; other modules' copies keep the declaration resolvable.
+	 */
+	void FEventBusStaticChannelRegistry::WithdrawChannel(const int32 DescriptorIndex, const FStaticChannelDescription& Owner)
+	{
+		FDescriptorList& List = GetDescriptorList();
+		FScopeLock Lock(&List.Mutex);
+		if (List.Entries.IsValidIndex(DescriptorIndex))
+		{
+			List.Entries[DescriptorIndex].Declarations.RemoveAll([&Owner](const TPair<const FStaticChannelDescription*, FStaticChannelDeclaration>& Pair)
+			{
+				return Pair.Key == &Owner;
+			});
+		}
+	}
+
+	/**
+	 * @brief Resolves pending declarations once, then snapshots the plain data under the lock.
+	 */
+	void FEventBusStaticChannelRegistry::GetChannelDescriptors(TArray<FStaticChannelDescriptor>& OutDescriptors)
+	{
+		FDescriptorList& List = GetDescriptorList();
+		FScopeLock Lock(&List.Mutex);
+		OutDescriptors.Reset(List.Entries.Num());
+		for (FDescriptorEntry& Entry : List.Entries)
+		{
+			if (!Entry.bResolved && !Entry.Declarations.IsEmpty())
+			{
+				const FStaticChannelDeclaration& Declaration = Entry.Declarations[0].Value;
+				Entry.Descriptor.ChannelTag = Declaration.GetChannelTag();
+				Entry.Descriptor.PublisherClassPath = FSoftClassPath(Declaration.GetPublisherClass());
+				Entry.Descriptor.DelegatePropertyName = Declaration.GetDelegatePropertyName();
+				Entry.bResolved = true;
+			}
+			OutDescriptors.Add(Entry.Descriptor);
+		}
+	}
+
+	FStaticChannelDescription::FStaticChannelDescription(const TCHAR* ChannelKey, const FStaticChannelDeclaration& Declaration)
+		: DescriptorIndex(FEventBusStaticChannelRegistry::DescribeChannel(ChannelKey, *this, Declaration))
+	{
+	}
+
+	FStaticChannelDescription::~FStaticChannelDescription()
+	{
+		FEventBusStaticChannelRegistry::WithdrawChannel(DescriptorIndex, *this);
+	}
+} // namespace Nfrrlib::EventBus
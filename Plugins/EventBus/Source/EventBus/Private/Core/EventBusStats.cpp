@@ -0,0 +1,12 @@
+#include "EventBus/Core/EventBusStats.h"
+
+DEFINE_STAT(STAT_EventBus_Bind);
+DEFINE_STAT(STAT_EventBus_Unbind);
+DEFINE_STAT(STAT_EventBus_Cleanup);
+DEFINE_STAT(STAT_EventBus_Dispatch);
+DEFINE_STAT(STAT_EventBus_Broadcasts);
+DEFINE_STAT(STAT_EventBus_ListenerInvocations);
+DEFINE_STAT(STAT_EventBus_Binds);
+DEFINE_STAT(STAT_EventBus_Unbinds);
+
+CSV_DEFINE_CATEGORY_MODULE(EVENTBUS_API, EventBus, true);
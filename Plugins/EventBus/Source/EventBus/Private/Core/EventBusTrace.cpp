@@ -0,0 +1,95 @@
+#include "EventBus/Core/EventBusTrace.h"
+
+#include "HAL/PlatformTLS.h"
+
+#if NFL_EVENTBUS_TRACE_ENABLED
+UE_TRACE_CHANNEL_DEFINE(EventBusChannel);
+
+UE_TRACE_EVENT_BEGIN(EventBus, ListenerInvocation)
+	UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+	UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+	UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ChannelTag)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ListenerClass)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, FunctionName)
+UE_TRACE_EVENT_END()
+#endif
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Returns true when EventBusChannel is compiled in and enabled for the current session.
+	 */
+	bool FEventBusTrace::IsEnabled()
+	{
+#if NFL_EVENTBUS_TRACE_ENABLED
+		return UE_TRACE_CHANNELEXPR_IS_ENABLED(EventBusChannel);
+#else
+		return false;
+#endif
+	}
+
+	/**
+	 * @brief Writes one listener invocation event; strings are only built while the channel is enabled.
+	 */
+	void FEventBusTrace::OutputListenerInvocation(
+		const FGameplayTag& ChannelTag,
+		const UClass* ListenerClass,
+		const FName FunctionName,
+		const uint64 StartCycle,
+		const uint64 EndCycle)
+	{
+#if NFL_EVENTBUS_TRACE_ENABLED
+		if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(EventBusChannel))
+		{
+			return;
+		}
+
+		const FString ChannelTagString = ChannelTag.ToString();
+		const FString ListenerClassString = GetNameSafe(ListenerClass);
+		const FString FunctionNameString = FunctionName.ToString();
+		UE_TRACE_LOG(EventBus, ListenerInvocation, EventBusChannel)
+			<< ListenerInvocation.StartCycle(StartCycle)
+			<< ListenerInvocation.EndCycle(EndCycle)
+			<< ListenerInvocation.ThreadId(FPlatformTLS::GetCurrentThreadId())
+			<< ListenerInvocation.ChannelTag(*ChannelTagString, ChannelTagString.Len())
+			<< ListenerInvocation.ListenerClass(*ListenerClassString, ListenerClassString.Len())
+			<< ListenerInvocation.FunctionName(*FunctionNameString, FunctionNameString.Len());
+#else
+		NFL_EVENTBUS_UNUSED(ChannelTag);
+		NFL_EVENTBUS_UNUSED(ListenerClass);
+		NFL_EVENTBUS_UNUSED(FunctionName);
+		NFL_EVENTBUS_UNUSED(StartCycle);
+		NFL_EVENTBUS_UNUSED(EndCycle);
+#endif
+	}
+
+	/**
+	 * @brief Opens a dynamic CPU scope named "EventBus <Tag>" while EventBusChannel is enabled.
+	 */
+	FEventBusTraceChannelScope::FEventBusTraceChannelScope(const FGameplayTag& ChannelTag)
+	{
+#if NFL_EVENTBUS_TRACE_ENABLED
+		if (UE_TRACE_CHANNELEXPR_IS_ENABLED(EventBusChannel))
+		{
+			bActive = true;
+			FCpuProfilerTrace::OutputBeginDynamicEvent(*FString::Printf(TEXT("EventBus %s"), *ChannelTag.ToString()));
+		}
+#else
+		NFL_EVENTBUS_UNUSED(ChannelTag);
+#endif
+	}
+
+	/**
+	 * @brief Closes the dynamic CPU scope opened by the constructor.
+	 */
+	FEventBusTraceChannelScope::~FEventBusTraceChannelScope()
+	{
+#if NFL_EVENTBUS_TRACE_ENABLED
+		if (bActive)
+		{
+			FCpuProfilerTrace::OutputEndEvent();
+		}
+#endif
+	}
+} // namespace Nfrrlib::EventBus
@@ -33,6 +33,20 @@ namespace Nfrrlib::EventBus
 			return TEXT("SignatureMismatch");
 		case EEventBusError::OwnershipPolicyConflict:
 			return TEXT("OwnershipPolicyConflict");
+		case EEventBusError::ChannelKindConflict:
+			return TEXT("ChannelKindConflict");
+		case EEventBusError::PayloadTypeMismatch:
+			return TEXT("PayloadTypeMismatch");
+		case EEventBusError::InvalidSpatialQuery:
+			return TEXT("InvalidSpatialQuery");
+		case EEventBusError::InvalidScopeParent:
+			return TEXT("InvalidScopeParent");
+		case EEventBusError::RecordingInProgress:
+			return TEXT("RecordingInProgress");
+		case EEventBusError::RecordingFileError:
+			return TEXT("RecordingFileError");
+		case EEventBusError::InvalidRecording:
+			return TEXT("InvalidRecording");
 		default:
 			return TEXT("UnknownError");
 		}
@@ -177,6 +191,62 @@ namespace Nfrrlib::EventBus
 		return bCompatible;
 	}
 
+	/**
+	 * @brief Shipping trusts a name and class match; checked builds also compare against a by-name lookup, so a
+	 * stale or foreign token falls back instead of binding the wrong function.
+	 */
+	bool FEventBusValidation::IsTrustedListenerFunction(const UObject* ListenerObj, const FListenerBinding& Binding)
+	{
+		const UFunction* const Resolved = Binding.ResolvedFunction;
+		if (Resolved == nullptr ||
+			Resolved->GetFName() != Binding.FunctionName ||
+			!ListenerObj->GetClass()->IsChildOf(Resolved->GetOuterUClass()))
+		{
+			return false;
+		}
+
+#if NFL_EVENTBUS_CHECK_TRUSTED_BINDINGS
+		const UFunction* const Found = ListenerObj->FindFunction(Binding.FunctionName);
+		if (Found != Resolved)
+		{
+			UE_LOG(LogNFLEventBus, Verbose, TEXT("Trusted listener rejected. Listener=%s Func=%s Resolved=%s Found=%s"),
+				*GetNameSafe(ListenerObj),
+				*Binding.FunctionName.ToString(),
+				*GetPathNameSafe(Resolved),
+				*GetPathNameSafe(Found));
+			return false;
+		}
+#endif
+		return true;
+	}
+
+	/**
+	 * @brief Same policy as IsTrustedListenerFunction, applied to the publisher's delegate property.
+	 */
+	bool FEventBusValidation::IsTrustedDelegateProperty(const UObject* PublisherObj, const FPublisherBinding& Binding)
+	{
+		const FMulticastDelegateProperty* const Resolved = Binding.ResolvedDelegateProperty;
+		if (Resolved == nullptr ||
+			Resolved->SignatureFunction == nullptr ||
+			Resolved->GetFName() != Binding.DelegatePropertyName ||
+			!PublisherObj->GetClass()->IsChildOf(Resolved->GetOwnerClass()))
+		{
+			return false;
+		}
+
+#if NFL_EVENTBUS_CHECK_TRUSTED_BINDINGS
+		const FProperty* const Found = PublisherObj->GetClass()->FindPropertyByName(Binding.DelegatePropertyName);
+		if (Found != Resolved)
+		{
+			UE_LOG(LogNFLEventBus, Verbose, TEXT("Trusted publisher rejected. Publisher=%s Delegate=%s"),
+				*GetNameSafe(PublisherObj),
+				*Binding.DelegatePropertyName.ToString());
+			return false;
+		}
+#endif
+		return true;
+	}
+
 	/**
 	 * @brief Builds a script delegate callback and returns resolved listener function metadata.
 	 */
@@ -193,13 +263,10 @@ namespace Nfrrlib::EventBus
 			return false;
 		}
 
+		// IsBound would repeat the FindFunction above on an object already validated, so it is only asserted.
 		OutDelegate = FScriptDelegate();
 		OutDelegate.BindUFunction(ListenerObj, FunctionName);
-		if (!OutDelegate.IsBound())
-		{
-			OutError = EEventBusError::ListenerFunctionNotBindable;
-			return false;
-		}
+		checkSlow(OutDelegate.IsBound());
 
 		OutListenerFunction = ListenerFunction;
 		OutError = EEventBusError::None;
@@ -3,6 +3,7 @@
 #include "UObject/UnrealType.h"
 
 #include "EventBus/Core/EventBus.h"
+#include "EventBus/Core/EventBusTrace.h"
 #include "EventBus/Core/EventBusValidation.h"
 
 namespace Nfrrlib::EventBus::Private
@@ -36,19 +37,15 @@ namespace Nfrrlib::EventBus::Private
 	 */
 	bool FEventChannelState::AddPublisher(UObject* PublisherObj, const FPublisherBinding& Binding)
 	{
+		// ResolveDelegateProperty validates object and name itself, so the untrusted path checks them once.
 		EEventBusError Error = EEventBusError::None;
-		if (!FEventBusValidation::ValidateObject(PublisherObj, Error) ||
-			!FEventBusValidation::ValidateName(Binding.DelegatePropertyName, Error))
-		{
-			UE_LOG(LogNFLEventBus, Warning, TEXT("AddPublisher failed. Error=%s Publisher=%s Delegate=%s"),
-				LexToString(Error),
-				*GetNameSafe(PublisherObj),
-				*Binding.DelegatePropertyName.ToString());
-			return false;
-		}
-
+		const bool bTrusted =
+			FEventBus::FPolicies::FValidation::ValidateObject(PublisherObj, Error) &&
+			FEventBusValidation::IsTrustedDelegateProperty(PublisherObj, Binding);
 		const FMulticastDelegateProperty* DelegateProperty =
-			FEventBusValidation::ResolveDelegateProperty(PublisherObj, Binding.DelegatePropertyName, Error);
+			bTrusted
+				? Binding.ResolvedDelegateProperty
+				: FEventBusValidation::ResolveDelegateProperty(PublisherObj, Binding.DelegatePropertyName, Error);
 		if (DelegateProperty == nullptr)
 		{
 			UE_LOG(LogNFLEventBus, Warning, TEXT("AddPublisher failed. Error=%s Publisher=%s Delegate=%s"),
@@ -72,7 +69,10 @@ namespace Nfrrlib::EventBus::Private
 		CleanupListeners();
 		RefreshChannelSignature();
 
-		if (ChannelDelegateSignature != nullptr)
+		// Every live listener was checked against the channel signature when it or the first publisher joined,
+		// so a publisher carrying that exact signature needs no per-listener checks.
+		const bool bSameAsChannelSignature = ChannelDelegateSignature == DelegateSignature;
+		if (ChannelDelegateSignature != nullptr && !bSameAsChannelSignature)
 		{
 			const bool bChannelCompatible =
 				ChannelDelegateSignature->IsSignatureCompatibleWith(DelegateSignature) &&
@@ -89,24 +89,27 @@ namespace Nfrrlib::EventBus::Private
 			}
 		}
 
-		for (const TPair<FListenerKey, FListenerEntry>& Pair : Listeners)
+		if (!bSameAsChannelSignature)
 		{
-			const FListenerEntry& ListenerEntry = Pair.Value;
-			if (IsListenerEntryStale(ListenerEntry) || ListenerEntry.ListenerFunction == nullptr)
+			for (const TPair<FListenerKey, FListenerEntry>& Pair : Listeners)
 			{
-				continue;
-			}
+				const FListenerEntry& ListenerEntry = Pair.Value;
+				if (IsListenerEntryStale(ListenerEntry) || ListenerEntry.ListenerFunction == nullptr)
+				{
+					continue;
+				}
 
-			if (!FEventBusValidation::IsFunctionCompatibleWithDelegate(ListenerEntry.ListenerFunction, DelegateProperty, Error))
-			{
-				UE_LOG(LogNFLEventBus, Warning,
-					TEXT("AddPublisher failed. Error=%s Publisher=%s Delegate=%s Listener=%s Function=%s"),
-					LexToString(Error),
-					*GetNameSafe(PublisherObj),
-					*Binding.DelegatePropertyName.ToString(),
-					*GetNameSafe(ListenerEntry.Listener.Get()),
-					*ListenerEntry.FunctionName.ToString());
-				return false;
+				if (!FEventBusValidation::IsFunctionCompatibleWithDelegate(ListenerEntry.ListenerFunction, DelegateProperty, Error))
+				{
+					UE_LOG(LogNFLEventBus, Warning,
+						TEXT("AddPublisher failed. Error=%s Publisher=%s Delegate=%s Listener=%s Function=%s"),
+						LexToString(Error),
+						*GetNameSafe(PublisherObj),
+						*Binding.DelegatePropertyName.ToString(),
+						*GetNameSafe(ListenerEntry.Listener.Get()),
+						*ListenerEntry.FunctionName.ToString());
+					return false;
+				}
 			}
 		}
 
@@ -153,7 +156,7 @@ namespace Nfrrlib::EventBus::Private
 	bool FEventChannelState::RemovePublisher(UObject* PublisherObj)
 	{
 		EEventBusError Error = EEventBusError::None;
-		if (!FEventBusValidation::ValidateObject(PublisherObj, Error))
+		if (!FEventBus::FPolicies::FValidation::ValidateObject(PublisherObj, Error))
 		{
 			UE_LOG(LogNFLEventBus, Warning, TEXT("RemovePublisher failed. Error=%s Publisher=%s"),
 				LexToString(Error),
@@ -179,6 +182,17 @@ namespace Nfrrlib::EventBus::Private
 		return bRemoved;
 	}
 
+	/**
+	 * @brief Looks up a publisher entry by object, ignoring entries whose objects died.
+	 */
+	bool FEventChannelState::HasPublisher(const UObject* PublisherObj) const
+	{
+		return PublisherObj != nullptr && Publishers.ContainsByPredicate([PublisherObj](const FPublisherEntry& Entry)
+		{
+			return Entry.Publisher.Get() == PublisherObj;
+		});
+	}
+
 	/**
 	 * @brief Registers or updates one listener callback and binds it to all publishers.
 	 */
@@ -187,7 +201,15 @@ namespace Nfrrlib::EventBus::Private
 		EEventBusError Error = EEventBusError::None;
 		const UFunction* ListenerFunction = nullptr;
 		FScriptDelegate Callback;
-		if (!FEventBusValidation::BuildListenerBinding(ListenerObj, Binding.FunctionName, ListenerFunction, Callback, Error))
+		const bool bTrusted =
+			FEventBus::FPolicies::FValidation::ValidateObject(ListenerObj, Error) &&
+			FEventBusValidation::IsTrustedListenerFunction(ListenerObj, Binding);
+		if (bTrusted)
+		{
+			ListenerFunction = Binding.ResolvedFunction;
+			Callback.BindUFunction(ListenerObj, Binding.FunctionName);
+		}
+		else if (!FEventBusValidation::BuildListenerBinding(ListenerObj, Binding.FunctionName, ListenerFunction, Callback, Error))
 		{
 			UE_LOG(LogNFLEventBus, Warning, TEXT("AddListener failed. Error=%s Listener=%s Func=%s"),
 				LexToString(Error),
@@ -200,7 +222,8 @@ namespace Nfrrlib::EventBus::Private
 		CleanupListeners();
 		RefreshChannelSignature();
 
-		if (ChannelDelegateSignature != nullptr)
+		const bool bSignatureProven = bTrusted && Binding.ProvenSignature == ChannelDelegateSignature;
+		if (ChannelDelegateSignature != nullptr && !bSignatureProven)
 		{
 			const bool bCompatible =
 				ListenerFunction->IsSignatureCompatibleWith(ChannelDelegateSignature) &&
@@ -254,8 +277,8 @@ namespace Nfrrlib::EventBus::Private
 	bool FEventChannelState::RemoveListener(UObject* ListenerObj, const FListenerBinding& Binding)
 	{
 		EEventBusError Error = EEventBusError::None;
-		if (!FEventBusValidation::ValidateObject(ListenerObj, Error) ||
-			!FEventBusValidation::ValidateName(Binding.FunctionName, Error))
+		if (!FEventBus::FPolicies::FValidation::ValidateObject(ListenerObj, Error) ||
+			!FEventBus::FPolicies::FValidation::ValidateName(Binding.FunctionName, Error))
 		{
 			UE_LOG(LogNFLEventBus, Warning, TEXT("RemoveListener failed. Error=%s Listener=%s Func=%s"),
 				LexToString(Error),
@@ -336,11 +359,224 @@ namespace Nfrrlib::EventBus::Private
 		ChannelDelegatePropertyName = NAME_None;
 	}
 
+	/**
+	 * @brief Snapshots cumulative counters with current entry counts.
+	 */
+	FEventChannelStats FEventChannelState::GetStats() const
+	{
+		FEventChannelStats Snapshot = Stats;
+		Snapshot.PublisherCount = Publishers.Num();
+		Snapshot.ListenerCount = Listeners.Num();
+		return Snapshot;
+	}
+
+	/**
+	 * @brief Skips entries not yet swept, so presence matches the live count published in topology.
+	 */
+	bool FEventChannelState::HasListeners() const
+	{
+		for (const TPair<FListenerKey, FListenerEntry>& Pair : Listeners)
+		{
+			if (!IsListenerEntryStale(Pair.Value))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * @brief Lets the owner republish topology after GC without waiting for the next mutation on this channel.
+	 */
+	int32 FEventChannelState::SweepStaleEntries()
+	{
+		const int32 TrackedCount = Publishers.Num() + Listeners.Num();
+		CleanupPublishers();
+		CleanupListeners();
+		return TrackedCount - (Publishers.Num() + Listeners.Num());
+	}
+
+	/**
+	 * @brief Reports the signature function by name, so readers on other threads never touch the UFunction.
+	 */
+	FEventChannelTopology FEventChannelState::GetTopology(const FGameplayTag& ChannelTag) const
+	{
+		FEventChannelTopology Topology;
+		Topology.ChannelTag = ChannelTag;
+		Topology.Flags = bOwnsPublisherDelegates ? EEventChannelTopologyFlags::OwnsPublisherDelegates : EEventChannelTopologyFlags::None;
+		Topology.SignatureName = ChannelDelegateSignature ? ChannelDelegateSignature->GetFName() : NAME_None;
+		Topology.PublisherCount = 0;
+		for (const FPublisherEntry& PublisherEntry : Publishers)
+		{
+			Topology.PublisherCount += ::IsValid(PublisherEntry.Publisher.Get()) ? 1 : 0;
+		}
+		Topology.ListenerCount = CountLiveListeners();
+		return Topology;
+	}
+
+	/**
+	 * @brief Clears cumulative counters and CSV baselines.
+	 */
+	void FEventChannelState::ResetStats()
+	{
+		Stats = FEventChannelStats();
+		CsvLastBroadcastCount = 0;
+		CsvLastInvocationCount = 0;
+	}
+
+	/**
+	 * @brief Sums publisher array, listener map and listener timing storage.
+	 */
+	SIZE_T FEventChannelState::GetAllocatedSize() const
+	{
+		return Publishers.GetAllocatedSize() + Listeners.GetAllocatedSize() + ListenerTimings.GetAllocatedSize();
+	}
+
+	/**
+	 * @brief Breaks channel footprint down by container and adds publisher-side invocation lists.
+	 */
+	FEventChannelMemory FEventChannelState::GetMemory() const
+	{
+		FEventChannelMemory Memory;
+		Memory.PublisherBytes = Publishers.GetAllocatedSize();
+		Memory.ListenerBytes = Listeners.GetAllocatedSize();
+		Memory.OwnedBytes = sizeof(*this) + GetAllocatedSize();
+		Memory.PublisherCount = Publishers.Num();
+		Memory.ListenerCount = Listeners.Num();
+
+		for (const FPublisherEntry& PublisherEntry : Publishers)
+		{
+			UObject* const PublisherObj = PublisherEntry.Publisher.Get();
+			if (!::IsValid(PublisherObj) || PublisherEntry.DelegateProperty == nullptr)
+			{
+				continue;
+			}
+
+			const void* const PropertyValue = PublisherEntry.DelegateProperty->ContainerPtrToValuePtr<void>(PublisherObj);
+			if (const FMulticastScriptDelegate* const MulticastDelegate = PublisherEntry.DelegateProperty->GetMulticastDelegate(PropertyValue))
+			{
+				Memory.PublisherDelegateBytes += MulticastDelegate->GetAllocatedSize();
+			}
+		}
+		return Memory;
+	}
+
+	/**
+	 * @brief Snapshots live listener callbacks so timed dispatch survives listener changes from callbacks.
+	 */
+	void FEventChannelState::CollectTimedListeners(TArray<FEventTimedListener>& OutListeners) const
+	{
+		OutListeners.Reset(Listeners.Num());
+		for (const TPair<FListenerKey, FListenerEntry>& Pair : Listeners)
+		{
+			if (Pair.Value.Listener.IsValid() && Pair.Value.Callback.IsBound())
+			{
+				OutListeners.Add(FEventTimedListener{Pair.Key, Pair.Value.Callback});
+			}
+		}
+	}
+
+	/**
+	 * @brief Resolves the listener object for class attribution and folds the sample into the timing table.
+	 */
+	void FEventChannelState::RecordListenerTiming(const FGameplayTag& ChannelTag, const FListenerKey& ListenerKey, const uint64 Cycles)
+	{
+		const FListenerEntry* const ListenerEntry = Listeners.Find(ListenerKey);
+		const UObject* const ListenerObj = ListenerEntry != nullptr ? ListenerEntry->Listener.Get() : nullptr;
+		ListenerTimings.Record(ListenerKey, ListenerObj, Cycles, ChannelTag);
+	}
+
+	void FEventChannelState::GetListenerTimings(const int32 MaxRows, TArray<FEventListenerTimingStats>& OutTimings) const
+	{
+		ListenerTimings.GetWorst(MaxRows, OutTimings);
+	}
+
+	void FEventChannelState::ResetListenerTimings()
+	{
+		ListenerTimings.Reset();
+	}
+
+	/**
+	 * @brief Groups live publisher and listener entries by class and bound member.
+	 */
+	void FEventChannelState::GetBindingSummaries(TArray<FEventBindingSummary>& OutPublishers, TArray<FEventBindingSummary>& OutListeners) const
+	{
+		for (const FPublisherEntry& PublisherEntry : Publishers)
+		{
+			AppendBindingSummary(OutPublishers, PublisherEntry.Publisher.Get(), PublisherEntry.DelegatePropertyName);
+		}
+
+		for (const TPair<FListenerKey, FListenerEntry>& Pair : Listeners)
+		{
+			AppendBindingSummary(OutListeners, Pair.Value.Listener.Get(), Pair.Value.FunctionName);
+		}
+	}
+
+	/**
+	 * @brief Attributes one broadcast to this channel; every tracked listener is bound to every publisher.
+	 */
+	int32 FEventChannelState::RecordDispatch(const uint64 DispatchCycles)
+	{
+		const int32 InvocationCount = Listeners.Num();
+		++Stats.BroadcastCount;
+		Stats.ListenerInvocationCount += InvocationCount;
+		Stats.DispatchCycles += DispatchCycles;
+		return InvocationCount;
+	}
+
+	/**
+	 * @brief Reports every live listener callback inside one delegate broadcast window.
+	 */
+	void FEventChannelState::TraceListenerInvocations(const FGameplayTag& ChannelTag, const uint64 StartCycles, const uint64 EndCycles) const
+	{
+		for (const TPair<FListenerKey, FListenerEntry>& Pair : Listeners)
+		{
+			const UObject* const ListenerObj = Pair.Value.Listener.Get();
+			if (ListenerObj == nullptr)
+			{
+				continue;
+			}
+
+			FEventBusTrace::OutputListenerInvocation(ChannelTag, ListenerObj->GetClass(), Pair.Value.FunctionName, StartCycles, EndCycles);
+		}
+	}
+
+	/**
+	 * @brief Emits broadcasts and invocations since the previous sample plus the current listener count.
+	 */
+	void FEventChannelState::RecordCsvStats(const FGameplayTag& NFL_EVENTBUS_MAYBE_UNUSED ChannelTag)
+	{
+#if CSV_PROFILER
+		if (CsvBroadcastStatName.IsNone())
+		{
+			const FString TagString = ChannelTag.ToString();
+			CsvBroadcastStatName = FName(*FString::Printf(TEXT("%s/Broadcasts"), *TagString));
+			CsvInvocationStatName = FName(*FString::Printf(TEXT("%s/Invocations"), *TagString));
+			CsvListenerStatName = FName(*FString::Printf(TEXT("%s/Listeners"), *TagString));
+		}
+
+		const int32 CategoryIndex = CSV_CATEGORY_INDEX(EventBus);
+		FCsvProfiler::RecordCustomStat(CsvBroadcastStatName, CategoryIndex,
+			static_cast<int32>(Stats.BroadcastCount - CsvLastBroadcastCount), ECsvCustomStatOp::Set);
+		FCsvProfiler::RecordCustomStat(CsvInvocationStatName, CategoryIndex,
+			static_cast<int32>(Stats.ListenerInvocationCount - CsvLastInvocationCount), ECsvCustomStatOp::Set);
+		FCsvProfiler::RecordCustomStat(CsvListenerStatName, CategoryIndex, Listeners.Num(), ECsvCustomStatOp::Set);
+#endif
+
+		CsvLastBroadcastCount = Stats.BroadcastCount;
+		CsvLastInvocationCount = Stats.ListenerInvocationCount;
+	}
+
 	/**
 	 * @brief Removes stale publishers that are no longer valid and refreshes channel signature cache.
 	 */
 	void FEventChannelState::CleanupPublishers()
 	{
+		NFL_EVENTBUS_TRACE_SCOPE(EventBus_CleanupPublishers);
+		SCOPE_CYCLE_COUNTER(STAT_EventBus_Cleanup);
+		CSV_SCOPED_TIMING_STAT(EventBus, Cleanup);
+		const FScopedChannelCycles CleanupTimer(Stats.CleanupCycles);
+
 		for (int32 Index = Publishers.Num() - 1; Index >= 0; --Index)
 		{
 			if (!::IsValid(Publishers[Index].Publisher.Get()))
@@ -357,6 +593,11 @@ namespace Nfrrlib::EventBus::Private
 	 */
 	void FEventChannelState::CleanupListeners()
 	{
+		NFL_EVENTBUS_TRACE_SCOPE(EventBus_CleanupListeners);
+		SCOPE_CYCLE_COUNTER(STAT_EventBus_Cleanup);
+		CSV_SCOPED_TIMING_STAT(EventBus, Cleanup);
+		const FScopedChannelCycles CleanupTimer(Stats.CleanupCycles);
+
 		for (auto It = Listeners.CreateIterator(); It; ++It)
 		{
 			if (IsListenerEntryStale(It.Value()))
@@ -403,11 +644,22 @@ namespace Nfrrlib::EventBus::Private
 			!::IsValid(ListenerEntry.Listener.Get());
 	}
 
+	int32 FEventChannelState::CountLiveListeners() const
+	{
+		int32 LiveCount = 0;
+		for (const TPair<FListenerKey, FListenerEntry>& Pair : Listeners)
+		{
+			LiveCount += IsListenerEntryStale(Pair.Value) ? 0 : 1;
+		}
+		return LiveCount;
+	}
+
 	/**
 	 * @brief Recomputes channel delegate signature from currently valid publishers.
 	 */
 	void FEventChannelState::RefreshChannelSignature()
 	{
+		NFL_EVENTBUS_TRACE_SCOPE(EventBus_RefreshChannelSignature);
 		ChannelDelegateSignature = nullptr;
 		ChannelDelegatePropertyName = NAME_None;
 
@@ -481,8 +733,11 @@ namespace Nfrrlib::EventBus::Private
 			return;
 		}
 
+		SCOPE_CYCLE_COUNTER(STAT_EventBus_Bind);
 		RemoveBinding(PublisherObj, PublisherEntry.DelegateProperty, ListenerEntry.Callback);
 		PublisherEntry.DelegateProperty->AddDelegate(ListenerEntry.Callback, PublisherObj);
+		++Stats.BindCount;
+		INC_DWORD_STAT(STAT_EventBus_Binds);
 	}
 
 	/**
@@ -496,7 +751,10 @@ namespace Nfrrlib::EventBus::Private
 			return;
 		}
 
+		SCOPE_CYCLE_COUNTER(STAT_EventBus_Unbind);
 		RemoveBinding(PublisherObj, PublisherEntry.DelegateProperty, ListenerEntry.Callback);
+		++Stats.UnbindCount;
+		INC_DWORD_STAT(STAT_EventBus_Unbinds);
 	}
 
 	/**
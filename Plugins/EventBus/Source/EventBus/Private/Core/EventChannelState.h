@@ -2,7 +2,12 @@
 
 #include "CoreMinimal.h"
 #include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBusDiagnostics.h"
+#include "EventBus/Core/EventBusListenerTiming.h"
+#include "EventBus/Core/EventBusMemory.h"
+#include "EventBus/Core/EventBusStats.h"
 #include "EventBus/Core/EventBusTypes.h"
+#include "EventBus/Core/EventChannelTopology.h"
 
 class FMulticastDelegateProperty;
 
@@ -26,6 +31,8 @@ namespace Nfrrlib::EventBus::Private
 		NFL_EVENTBUS_NODISCARD bool AddPublisher(UObject* PublisherObj, const FPublisherBinding& Binding);
 		/** @brief Removes a publisher and unbinds listeners from it. */
 		NFL_EVENTBUS_NODISCARD bool RemovePublisher(UObject* PublisherObj);
+		/** @brief Returns true when PublisherObj has a tracked binding on this channel. */
+		NFL_EVENTBUS_NODISCARD bool HasPublisher(const UObject* PublisherObj) const;
 
 		/** @brief Registers or updates one listener callback for this channel. */
 		NFL_EVENTBUS_NODISCARD bool AddListener(UObject* ListenerObj, const FListenerBinding& Binding);
@@ -35,11 +42,45 @@ namespace Nfrrlib::EventBus::Private
 		/** @brief Unbinds every callback and clears publishers/listeners for this channel. */
 		void ClearAndUnbind();
 
+		/** @brief Returns cumulative counters plus current publisher and listener counts. */
+		NFL_EVENTBUS_NODISCARD FEventChannelStats GetStats() const;
+		/** @brief Returns true when at least one tracked listener is still alive. */
+		NFL_EVENTBUS_NODISCARD bool HasListeners() const;
+		/** @brief Drops publishers and listeners whose objects died. Returns dropped entry count. */
+		int32 SweepStaleEntries();
+		/** @brief Returns the current shape of this channel for the bus topology table. */
+		NFL_EVENTBUS_NODISCARD FEventChannelTopology GetTopology(const FGameplayTag& ChannelTag) const;
+		/** @brief Clears cumulative counters. */
+		void ResetStats();
+		/** @brief Records one publisher broadcast observed by the bus and returns listener invocations attributed to it. */
+		int32 RecordDispatch(uint64 DispatchCycles);
+		/** @brief Emits one trace listener invocation event per tracked listener for a broadcast window. */
+		void TraceListenerInvocations(const FGameplayTag& ChannelTag, uint64 StartCycles, uint64 EndCycles) const;
+		/** @brief Copies key and callback of every live listener for per-listener timed dispatch. */
+		void CollectTimedListeners(TArray<FEventTimedListener>& OutListeners) const;
+		/** @brief Records one timed listener invocation. */
+		void RecordListenerTiming(const FGameplayTag& ChannelTag, const FListenerKey& ListenerKey, uint64 Cycles);
+		/** @brief Replaces OutTimings with at most MaxRows listener timings, slowest maximum first. */
+		void GetListenerTimings(int32 MaxRows, TArray<FEventListenerTimingStats>& OutTimings) const;
+		/** @brief Drops recorded listener timings. */
+		void ResetListenerTimings();
+		/** @brief Emits per-channel frame deltas to the CSV profiler under the EventBus category. */
+		void RecordCsvStats(const FGameplayTag& ChannelTag);
+
+		/** @brief Returns heap bytes owned by publisher, listener and timing containers, excluding this object. */
+		NFL_EVENTBUS_NODISCARD SIZE_T GetAllocatedSize() const;
+		/** @brief Returns per-container footprint including this object and live publisher invocation lists. */
+		NFL_EVENTBUS_NODISCARD FEventChannelMemory GetMemory() const;
+		/** @brief Appends one summary row per live publisher class/property and listener class/function. */
+		void GetBindingSummaries(TArray<FEventBindingSummary>& OutPublishers, TArray<FEventBindingSummary>& OutListeners) const;
+
 	private:
 		/** @brief Removes dead publisher entries and refreshes cached channel signature data. */
 		void CleanupPublishers();
 		/** @brief Removes dead listener entries and detaches stale callbacks from live publishers. */
 		void CleanupListeners();
+		/** @brief Returns tracked listeners whose objects are still alive. */
+		NFL_EVENTBUS_NODISCARD int32 CountLiveListeners() const;
 		/** @brief Recomputes channel signature metadata from current live publishers. */
 		void RefreshChannelSignature();
 
@@ -72,5 +113,16 @@ namespace Nfrrlib::EventBus::Private
 		TMap<FListenerKey, FListenerEntry> Listeners;
 		const UFunction* ChannelDelegateSignature = nullptr;
 		FName ChannelDelegatePropertyName = NAME_None;
+		/** @brief Diagnostic counters; mutable because bind helpers are const with respect to routing state. */
+		mutable FEventChannelStats Stats;
+		/** @brief Per-listener timings recorded by the typed Broadcast helper while timing is enabled. */
+		FEventListenerTimingTable ListenerTimings;
+		/** @brief Counter values at the previous CSV sample, used to emit per-frame deltas. */
+		uint64 CsvLastBroadcastCount = 0;
+		uint64 CsvLastInvocationCount = 0;
+		/** @brief Lazily built CSV stat names for this channel. */
+		FName CsvBroadcastStatName = NAME_None;
+		FName CsvInvocationStatName = NAME_None;
+		FName CsvListenerStatName = NAME_None;
 	};
 } // namespace Nfrrlib::EventBus::Private
@@ -0,0 +1,152 @@
+#include "EventBus/Core/EventChannelTopology.h"
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Cells listed by the current map are owned here; retired maps and cells belong to the domain.
+	 */
+	FEventChannelTopologyTable::~FEventChannelTopologyTable()
+	{
+		if (const FView* const CurrentView = View.Load())
+		{
+			for (const TPair<FGameplayTag, FCell*>& Pair : CurrentView->Cells)
+			{
+				delete Pair.Value;
+			}
+		}
+	}
+
+	bool FEventChannelTopologyTable::Find(const FGameplayTag& ChannelTag, FEventChannelTopology& OutTopology) const
+	{
+		const FEventBusEpochDomain::FReadScope ReadScope(Domain);
+		const FView* const CurrentView = View.Load();
+		FCell* const* const Cell = CurrentView ? CurrentView->Cells.Find(ChannelTag) : nullptr;
+		const FEventChannelTopology* const Topology = Cell ? (*Cell)->Load() : nullptr;
+		if (!Topology)
+		{
+			return false;
+		}
+
+		OutTopology = *Topology;
+		return true;
+	}
+
+	/**
+	 * @brief Swaps one channel's snapshot in place; the map is copied only for a new channel.
+	 */
+	void FEventChannelTopologyTable::Publish(const FEventChannelTopology& Topology)
+	{
+		if (FCell* const Existing = FindCell(Topology.ChannelTag))
+		{
+			const FEventChannelTopology& Current = *Existing->Load();
+			if (Current != Topology)
+			{
+				const int32 OldListenerCount = Current.ListenerCount;
+				Existing->Publish(SnapshotPool.Acquire(Topology), Domain, SnapshotPool);
+				NotifyPresence(Topology.ChannelTag, OldListenerCount, Topology.ListenerCount);
+			}
+			return;
+		}
+
+		FCell* const NewCell = new FCell();
+		NewCell->Publish(SnapshotPool.Acquire(Topology), Domain, SnapshotPool);
+		FView* const NewView = View.Load() ? new FView(*View.Load()) : new FView();
+		NewView->Cells.Add(Topology.ChannelTag, NewCell);
+		View.Publish(NewView, Domain);
+		NotifyPresence(Topology.ChannelTag, 0, Topology.ListenerCount);
+	}
+
+	void FEventChannelTopologyTable::Remove(const FGameplayTag& ChannelTag)
+	{
+		FCell* const Existing = FindCell(ChannelTag);
+		if (!Existing)
+		{
+			return;
+		}
+
+		const int32 OldListenerCount = Existing->Load()->ListenerCount;
+		FView* const NewView = new FView(*View.Load());
+		NewView->Cells.Remove(ChannelTag);
+		View.Publish(NewView, Domain);
+		Domain.Retire(Existing);
+		NotifyPresence(ChannelTag, OldListenerCount, 0);
+	}
+
+	void FEventChannelTopologyTable::Reset()
+	{
+		const FView* const CurrentView = View.Load();
+		if (!CurrentView || CurrentView->Cells.IsEmpty())
+		{
+			return;
+		}
+
+		// Cells are retired only once no published map lists them; the old map may be freed by the swap.
+		TArray<FCell*> Removed;
+		TArray<TPair<FGameplayTag, int32>> Heard;
+		for (const TPair<FGameplayTag, FCell*>& Pair : CurrentView->Cells)
+		{
+			Removed.Add(Pair.Value);
+			if (Pair.Value->Load()->ListenerCount > 0)
+			{
+				Heard.Emplace(Pair.Key, Pair.Value->Load()->ListenerCount);
+			}
+		}
+		View.Publish(new FView(), Domain);
+		for (FCell* const Cell : Removed)
+		{
+			Domain.Retire(Cell);
+		}
+
+		for (const TPair<FGameplayTag, int32>& Entry : Heard)
+		{
+			NotifyPresence(Entry.Key, Entry.Value, 0);
+		}
+	}
+
+	FDelegateHandle FEventChannelTopologyTable::AddPresenceCallback(const FGameplayTag& ChannelTag, FOnChannelPresenceChanged::FDelegate&& Callback)
+	{
+		return PresenceCallbacks.FindOrAdd(ChannelTag).Add(MoveTemp(Callback));
+	}
+
+	bool FEventChannelTopologyTable::RemovePresenceCallback(const FGameplayTag& ChannelTag, const FDelegateHandle Handle)
+	{
+		FOnChannelPresenceChanged* const Callbacks = PresenceCallbacks.Find(ChannelTag);
+		if (!Callbacks || !Callbacks->Remove(Handle))
+		{
+			return false;
+		}
+
+		if (!Callbacks->IsBound())
+		{
+			PresenceCallbacks.Remove(ChannelTag);
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Broadcasts a copy, since callbacks may subscribe or unsubscribe and reallocate the subscription map.
+	 */
+	void FEventChannelTopologyTable::NotifyPresence(const FGameplayTag& ChannelTag, const int32 OldListenerCount, const int32 NewListenerCount) const
+	{
+		if ((OldListenerCount > 0) == (NewListenerCount > 0))
+		{
+			return;
+		}
+
+		const FOnChannelPresenceChanged* const Callbacks = PresenceCallbacks.Find(ChannelTag);
+		if (!Callbacks)
+		{
+			return;
+		}
+
+		const FOnChannelPresenceChanged Pinned = *Callbacks;
+		Pinned.Broadcast(ChannelTag, NewListenerCount > 0);
+	}
+
+	FEventChannelTopologyTable::FCell* FEventChannelTopologyTable::FindCell(const FGameplayTag& ChannelTag) const
+	{
+		const FView* const CurrentView = View.Load();
+		FCell* const* const Cell = CurrentView ? CurrentView->Cells.Find(ChannelTag) : nullptr;
+		return Cell ? *Cell : nullptr;
+	}
+} // namespace Nfrrlib::EventBus
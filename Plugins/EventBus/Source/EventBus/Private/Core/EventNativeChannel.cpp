@@ -0,0 +1,186 @@
+#include "EventBus/Core/EventNativeChannel.h"
+
+#include "EventBus/Core/EventBus.h"
+#include "EventBus/Core/EventChannelTopology.h"
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Converts native channel kinds into stable diagnostic strings.
+	 */
+	const TCHAR* LexToString(const EEventNativeChannelKind Kind)
+	{
+		switch (Kind)
+		{
+		case EEventNativeChannelKind::Batch:
+			return TEXT("Batch");
+		case EEventNativeChannelKind::Spatial:
+			return TEXT("Spatial");
+		default:
+			return TEXT("Unknown");
+		}
+	}
+
+	/**
+	 * @brief Constructs type-erased native channel state.
+	 */
+	FEventNativeChannelBase::FEventNativeChannelBase(
+		const EEventNativeChannelKind InKind,
+		const FEventPayloadTypeId InPayloadTypeId,
+		const FName InPayloadTypeName)
+		: Kind(InKind)
+		, PayloadTypeId(InPayloadTypeId)
+		, PayloadTypeName(InPayloadTypeName)
+	{
+	}
+
+	/**
+	 * @brief Returns dispatch model used to reject mismatched typed access.
+	 */
+	EEventNativeChannelKind FEventNativeChannelBase::GetKind() const
+	{
+		return Kind;
+	}
+
+	/**
+	 * @brief Returns payload type identity used to reject mismatched typed access.
+	 */
+	FEventPayloadTypeId FEventNativeChannelBase::GetPayloadTypeId() const
+	{
+		return PayloadTypeId;
+	}
+
+	/**
+	 * @brief Returns payload type name used in diagnostics.
+	 */
+	FName FEventNativeChannelBase::GetPayloadTypeName() const
+	{
+		return PayloadTypeName;
+	}
+
+	/**
+	 * @brief Returns channel tag recorded by the owning bus.
+	 */
+	const FGameplayTag& FEventNativeChannelBase::GetChannelTag() const
+	{
+		return ChannelTag;
+	}
+
+	/**
+	 * @brief Records channel tag once the owning bus has accepted registration.
+	 */
+	void FEventNativeChannelBase::SetChannelTag(const FGameplayTag& InChannelTag)
+	{
+		ChannelTag = InChannelTag;
+	}
+
+	/**
+	 * @brief Publishes the current shape at once so the snapshot exists as soon as the channel is registered.
+	 */
+	void FEventNativeChannelBase::SetTopology(FEventChannelTopologyTable* const InTopology)
+	{
+		Topology = InTopology;
+		PublishedListenerCount = INDEX_NONE;
+		SyncTopology(GetListenerCount());
+	}
+
+	/**
+	 * @brief Immediate channels have nothing buffered to deliver.
+	 */
+	int32 FEventNativeChannelBase::Flush()
+	{
+		return 0;
+	}
+
+	int32 FEventNativeChannelBase::SweepStaleListeners()
+	{
+		return 0;
+	}
+
+	/**
+	 * @brief Immediate channels never hold pending payloads.
+	 */
+	int32 FEventNativeChannelBase::GetPendingCount() const
+	{
+		return 0;
+	}
+
+	/**
+	 * @brief Snapshots cumulative counters with the current listener count.
+	 */
+	FEventChannelStats FEventNativeChannelBase::GetStats() const
+	{
+		FEventChannelStats Snapshot = Stats;
+		Snapshot.ListenerCount = GetListenerCount();
+		return Snapshot;
+	}
+
+	/**
+	 * @brief Clears cumulative counters.
+	 */
+	void FEventNativeChannelBase::ResetStats()
+	{
+		Stats = FEventChannelStats();
+	}
+
+	/**
+	 * @brief Returns the slowest tracked listeners.
+	 */
+	void FEventNativeChannelBase::GetListenerTimings(const int32 MaxRows, TArray<FEventListenerTimingStats>& OutTimings) const
+	{
+		ListenerTimings.GetWorst(MaxRows, OutTimings);
+	}
+
+	/**
+	 * @brief Drops recorded listener timings.
+	 */
+	void FEventNativeChannelBase::ResetListenerTimings()
+	{
+		ListenerTimings.Reset();
+	}
+
+	/**
+	 * @brief Native channels have no publishers; their signature is the payload type.
+	 */
+	void FEventNativeChannelBase::PublishTopology(const int32 ListenerCount)
+	{
+		FEventChannelTopology Snapshot;
+		Snapshot.ChannelTag = ChannelTag;
+		Snapshot.Flags = Kind == EEventNativeChannelKind::Batch ? EEventChannelTopologyFlags::Batch : EEventChannelTopologyFlags::Spatial;
+		Snapshot.SignatureName = PayloadTypeName;
+		Snapshot.ListenerCount = ListenerCount;
+		// Recorded first: presence callbacks fired by the publish may add or remove listeners and re-sync.
+		PublishedListenerCount = ListenerCount;
+		Topology->Publish(Snapshot);
+	}
+
+	/**
+	 * @brief Emits one warning line for a rejected native listener operation.
+	 */
+	void FEventNativeChannelBase::LogListenerFailure(
+		const TCHAR* Operation,
+		const EEventBusError Error,
+		const UObject* ListenerObj,
+		const FName FunctionName) const
+	{
+		UE_LOG(LogNFLEventBus, Warning, TEXT("%s failed. Error=%s Kind=%s Payload=%s Listener=%s Func=%s"),
+			Operation,
+			LexToString(Error),
+			LexToString(Kind),
+			*PayloadTypeName.ToString(),
+			*GetNameSafe(ListenerObj),
+			*FunctionName.ToString());
+	}
+
+	/**
+	 * @brief Emits one warning line for a rejected native channel operation.
+	 */
+	void FEventNativeChannelBase::LogChannelFailure(const TCHAR* Operation, const EEventBusError Error) const
+	{
+		UE_LOG(LogNFLEventBus, Warning, TEXT("%s failed. Error=%s Kind=%s Payload=%s"),
+			Operation,
+			LexToString(Error),
+			LexToString(Kind),
+			*PayloadTypeName.ToString());
+	}
+} // namespace Nfrrlib::EventBus
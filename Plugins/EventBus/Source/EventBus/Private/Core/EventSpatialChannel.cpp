@@ -0,0 +1,150 @@
+#include "EventBus/Core/EventSpatialChannel.h"
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Constructs an empty grid; invalid sizes fall back to one unit so lookups stay defined.
+	 */
+	FEventSpatialGrid::FEventSpatialGrid(const double InCellSize)
+		: CellSize(IsValidCellSize(InCellSize) ? InCellSize : 1.0)
+		, InvCellSize(1.0 / CellSize)
+	{
+	}
+
+	/**
+	 * @brief Validates a requested cell edge length.
+	 */
+	bool FEventSpatialGrid::IsValidCellSize(const double InCellSize)
+	{
+		return FMath::IsFinite(InCellSize) && InCellSize > UE_KINDA_SMALL_NUMBER;
+	}
+
+	/**
+	 * @brief Returns configured cell edge length.
+	 */
+	double FEventSpatialGrid::GetCellSize() const
+	{
+		return CellSize;
+	}
+
+	/**
+	 * @brief Quantizes a world location into cell coordinates.
+	 */
+	FIntVector FEventSpatialGrid::GetCell(const FVector& Location) const
+	{
+		return FIntVector(
+			FMath::FloorToInt32(Location.X * InvCellSize),
+			FMath::FloorToInt32(Location.Y * InvCellSize),
+			FMath::FloorToInt32(Location.Z * InvCellSize));
+	}
+
+	/**
+	 * @brief Returns number of allocated cell buckets.
+	 */
+	int32 FEventSpatialGrid::GetNumCells() const
+	{
+		return Cells.Num();
+	}
+
+	/**
+	 * @brief Adds ElementId to every overlapped cell, or to the overflow list when the span is too wide.
+	 */
+	FEventSpatialCellSpan FEventSpatialGrid::Insert(const int32 ElementId, const FVector& Center, const double Radius)
+	{
+		FEventSpatialCellSpan Span;
+		Span.MinCell = GetCell(Center - FVector(Radius));
+		Span.MaxCell = GetCell(Center + FVector(Radius));
+
+		const int64 CellCount =
+			int64(Span.MaxCell.X - Span.MinCell.X + 1) *
+			int64(Span.MaxCell.Y - Span.MinCell.Y + 1) *
+			int64(Span.MaxCell.Z - Span.MinCell.Z + 1);
+		if (CellCount > MaxCellsPerElement)
+		{
+			Span.bOverflow = true;
+			Overflow.Add(ElementId);
+			return Span;
+		}
+
+		for (int32 X = Span.MinCell.X; X <= Span.MaxCell.X; ++X)
+		{
+			for (int32 Y = Span.MinCell.Y; Y <= Span.MaxCell.Y; ++Y)
+			{
+				for (int32 Z = Span.MinCell.Z; Z <= Span.MaxCell.Z; ++Z)
+				{
+					Cells.FindOrAdd(FIntVector(X, Y, Z)).Add(ElementId);
+				}
+			}
+		}
+		return Span;
+	}
+
+	/**
+	 * @brief Removes ElementId from the cells of Span and frees emptied buckets.
+	 */
+	void FEventSpatialGrid::Remove(const int32 ElementId, const FEventSpatialCellSpan& Span)
+	{
+		if (Span.bOverflow)
+		{
+			Overflow.RemoveSingleSwap(ElementId, EAllowShrinking::No);
+			return;
+		}
+
+		for (int32 X = Span.MinCell.X; X <= Span.MaxCell.X; ++X)
+		{
+			for (int32 Y = Span.MinCell.Y; Y <= Span.MaxCell.Y; ++Y)
+			{
+				for (int32 Z = Span.MinCell.Z; Z <= Span.MaxCell.Z; ++Z)
+				{
+					const FIntVector Cell(X, Y, Z);
+					TArray<int32>* Bucket = Cells.Find(Cell);
+					if (!Bucket)
+					{
+						continue;
+					}
+
+					Bucket->RemoveSingleSwap(ElementId, EAllowShrinking::No);
+					if (Bucket->IsEmpty())
+					{
+						Cells.Remove(Cell);
+					}
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief Copies candidate ids for Location: its cell bucket plus every overflow element.
+	 */
+	void FEventSpatialGrid::Gather(const FVector& Location, TArray<int32>& OutElementIds) const
+	{
+		OutElementIds.Reset();
+		if (const TArray<int32>* Bucket = Cells.Find(GetCell(Location)))
+		{
+			OutElementIds.Append(*Bucket);
+		}
+		OutElementIds.Append(Overflow);
+	}
+
+	/**
+	 * @brief Drops all indexed elements.
+	 */
+	void FEventSpatialGrid::Reset()
+	{
+		Cells.Reset();
+		Overflow.Reset();
+	}
+
+	/**
+	 * @brief Sums the cell map and every bucket array.
+	 */
+	SIZE_T FEventSpatialGrid::GetAllocatedSize() const
+	{
+		SIZE_T Bytes = Cells.GetAllocatedSize() + Overflow.GetAllocatedSize();
+		for (const TPair<FIntVector, TArray<int32>>& Pair : Cells)
+		{
+			Bytes += Pair.Value.GetAllocatedSize();
+		}
+		return Bytes;
+	}
+} // namespace Nfrrlib::EventBus
@@ -2,6 +2,8 @@
 
 #include "EventBus.h"
 
+#include "EventBus/Core/EventBusRecorder.h"
+
 #define LOCTEXT_NAMESPACE "FEventBusModule"
 
 /**
@@ -16,6 +18,8 @@ void FEventBusModule::StartupModule()
  */
 void FEventBusModule::ShutdownModule()
 {
+	// Flushes and closes an active event-stream recording so the file is complete.
+	Nfrrlib::EventBus::FEventBusRecorder::Stop();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,284 @@
+#include "Misc/AutomationTest.h"
+
+#include "Async/Async.h"
+#include "NativeGameplayTags.h"
+#include "UObject/GarbageCollection.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBus.h"
+#include "EventBus/Typed/EventChannelApi.h"
+#include "EventBus/Typed/EventChannelDef.h"
+#include "Tests/EventBusTestObjects.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Batch, "EventBus.Test.Batch");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_BatchKind, "EventBus.Test.BatchKind");
+
+NFL_DECLARE_EVENTBUS_BATCH_CHANNEL(
+	FEventBusBatchTestChannel,
+	float,
+	TAG_EventBus_Test_Batch
+);
+
+NFL_DECLARE_EVENTBUS_BATCH_CHANNEL(
+	FEventBusBatchTestIntChannel,
+	int32,
+	TAG_EventBus_Test_Batch
+);
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusBatchChannelDeliveryTest,
+	"EventBus.Batch.FlushDeliversSpanOncePerListener",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusBatchChannelDeliveryTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+	using FBatchApi = TEventBatchChannelApi<FEventBusBatchTestChannel>;
+
+	FEventBus Bus;
+	TestFalse(TEXT("Publish fails before batch channel registration"), FBatchApi::Publish(Bus, 1.0f));
+	TestTrue(TEXT("Batch channel register succeeds"), FBatchApi::Register(Bus));
+	TestTrue(TEXT("Idempotent batch register succeeds"), FBatchApi::Register(Bus));
+	TestFalse(TEXT("Register with another payload type fails"), TEventBatchChannelApi<FEventBusBatchTestIntChannel>::Register(Bus));
+
+	UEventBusTestBatchListenerObject* Listener = NewObject<UEventBusTestBatchListenerObject>();
+	TestTrue(TEXT("AddBatchListener succeeds"),
+		NFL_EVENTBUS_ADD_BATCH_LISTENER(Bus, FEventBusBatchTestChannel, Listener, UEventBusTestBatchListenerObject, OnBatch));
+
+	const float Payloads[] = {1.0f, 2.0f, 3.0f};
+	TestTrue(TEXT("Publish single payload succeeds"), FBatchApi::Publish(Bus, 4.0f));
+	TestTrue(TEXT("Publish payload range succeeds"), FBatchApi::PublishRange(Bus, MakeArrayView(Payloads)));
+	TestEqual(TEXT("Listener is not invoked before flush"), Listener->BatchCallCount, 0);
+
+	TestEqual(TEXT("Flush reports delivered payload count"), Bus.FlushBatchChannels(), 4);
+	TestEqual(TEXT("Listener invoked once per flush"), Listener->BatchCallCount, 1);
+	TestEqual(TEXT("Listener receives every payload"), Listener->ReceivedPayloadCount, 4);
+	TestEqual(TEXT("Listener receives payload values"), Listener->ReceivedPayloadSum, 10.0f);
+
+	TestEqual(TEXT("Empty flush delivers nothing"), FBatchApi::Flush(Bus), 0);
+	TestEqual(TEXT("Empty flush does not invoke listener"), Listener->BatchCallCount, 1);
+
+	TestTrue(TEXT("RemoveBatchListener succeeds"),
+		NFL_EVENTBUS_REMOVE_BATCH_LISTENER(Bus, FEventBusBatchTestChannel, Listener, UEventBusTestBatchListenerObject, OnBatch));
+	TestTrue(TEXT("Publish after remove succeeds"), FBatchApi::Publish(Bus, 5.0f));
+	FBatchApi::Flush(Bus);
+	TestEqual(TEXT("Removed listener is not invoked"), Listener->BatchCallCount, 1);
+
+	TestTrue(TEXT("UnregisterBatchChannel succeeds"), Bus.UnregisterBatchChannel(TAG_EventBus_Test_Batch));
+	TestFalse(TEXT("Batch channel is no longer registered"), Bus.IsBatchChannelRegistered(TAG_EventBus_Test_Batch));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusBatchChannelReentrantRemoveTest,
+	"EventBus.Batch.ListenerRemovesItselfDuringFlush",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusBatchChannelReentrantRemoveTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+	using FBatchApi = TEventBatchChannelApi<FEventBusBatchTestChannel>;
+	using FChannel = TEventBatchChannel<float>;
+
+	FEventBus Bus;
+	TestTrue(TEXT("Batch channel register succeeds"), FBatchApi::Register(Bus));
+	FChannel* const Channel = Bus.FindBatchChannel<float>(TAG_EventBus_Test_Batch);
+	TestNotNull(TEXT("Batch channel resolves"), Channel);
+	if (!Channel)
+	{
+		return false;
+	}
+
+	UEventBusTestBatchListenerObject* SelfRemoving = NewObject<UEventBusTestBatchListenerObject>();
+	UEventBusTestBatchListenerObject* SelfReplacing = NewObject<UEventBusTestBatchListenerObject>();
+	const FName FunctionName(TEXT("OnBatch"));
+
+	// Captures are read after the re-entrant call, so a destroyed delegate instance would be observed here.
+	const FString Marker(TEXT("Alive"));
+	int32 RemovingCalls = 0;
+	int32 CountAfterRemoval = INDEX_NONE;
+	TestTrue(TEXT("Self-removing listener binds"), Channel->AddListener(SelfRemoving, FunctionName,
+		FChannel::FBatchDelegate::CreateLambda([Channel, SelfRemoving, FunctionName, Marker, &RemovingCalls, &CountAfterRemoval](TConstArrayView<float>)
+		{
+			const bool bRemoved = Channel->RemoveListener(SelfRemoving, FunctionName);
+			RemovingCalls += bRemoved && Marker == TEXT("Alive") ? 1 : 0;
+			CountAfterRemoval = Channel->GetListenerCount();
+		})));
+
+	int32 OriginalCalls = 0;
+	int32 ReplacementCalls = 0;
+	TestTrue(TEXT("Self-replacing listener binds"), Channel->AddListener(SelfReplacing, FunctionName,
+		FChannel::FBatchDelegate::CreateLambda([Channel, SelfReplacing, FunctionName, Marker, &OriginalCalls, &ReplacementCalls](TConstArrayView<float>)
+		{
+			const bool bReplaced = Channel->AddListener(SelfReplacing, FunctionName,
+				FChannel::FBatchDelegate::CreateLambda([&ReplacementCalls](TConstArrayView<float>)
+				{
+					++ReplacementCalls;
+				}));
+			OriginalCalls += bReplaced && Marker == TEXT("Alive") ? 1 : 0;
+		})));
+
+	TestTrue(TEXT("Publish succeeds"), FBatchApi::Publish(Bus, 1.0f));
+	TestEqual(TEXT("First flush delivers"), FBatchApi::Flush(Bus), 1);
+	TestEqual(TEXT("Self-removing listener ran once with intact captures"), RemovingCalls, 1);
+	TestEqual(TEXT("Self-replacing listener ran once with intact captures"), OriginalCalls, 1);
+	TestEqual(TEXT("Replacement does not run in the same flush"), ReplacementCalls, 0);
+	TestEqual(TEXT("Listener removed mid-flush is no longer counted"), CountAfterRemoval, 1);
+	TestEqual(TEXT("Removed listener is compacted after the flush"), Channel->GetListenerCount(), 1);
+
+	TestTrue(TEXT("Second publish succeeds"), FBatchApi::Publish(Bus, 2.0f));
+	FBatchApi::Flush(Bus);
+	TestEqual(TEXT("Removed listener stays removed"), RemovingCalls, 1);
+	TestEqual(TEXT("Original callback was replaced"), OriginalCalls, 1);
+	TestEqual(TEXT("Replacement runs on the next flush"), ReplacementCalls, 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusBatchChannelTopologyTest,
+	"EventBus.Batch.TopologySnapshot",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusBatchChannelTopologyTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+	using FBatchApi = TEventBatchChannelApi<FEventBusBatchTestChannel>;
+
+	FEventBus Bus;
+	TestTrue(TEXT("Batch channel register succeeds"), FBatchApi::Register(Bus));
+	UEventBusTestBatchListenerObject* Listener = NewObject<UEventBusTestBatchListenerObject>();
+	TestTrue(TEXT("AddBatchListener succeeds"),
+		NFL_EVENTBUS_ADD_BATCH_LISTENER(Bus, FEventBusBatchTestChannel, Listener, UEventBusTestBatchListenerObject, OnBatch));
+
+	FEventChannelTopology Topology;
+	const bool bRegisteredOffThread = Async(EAsyncExecution::ThreadPool, [&Bus, &Topology]()
+	{
+		return Bus.IsBatchChannelRegistered(TAG_EventBus_Test_Batch) && Bus.GetChannelTopology(TAG_EventBus_Test_Batch, Topology);
+	}).Get();
+	TestTrue(TEXT("Batch channel reads as registered off-thread"), bRegisteredOffThread);
+	TestTrue(TEXT("Batch flag is published"), EnumHasAnyFlags(Topology.Flags, EEventChannelTopologyFlags::Batch));
+	TestEqual(TEXT("Payload type is the signature"), Topology.SignatureName, FName(TEXT("float")));
+	TestEqual(TEXT("Listener add is published"), Topology.ListenerCount, 1);
+	TestFalse(TEXT("Batch channel is not a delegate channel"), Bus.IsChannelRegistered(TAG_EventBus_Test_Batch));
+
+	TestTrue(TEXT("RemoveBatchListener succeeds"),
+		NFL_EVENTBUS_REMOVE_BATCH_LISTENER(Bus, FEventBusBatchTestChannel, Listener, UEventBusTestBatchListenerObject, OnBatch));
+	TestTrue(TEXT("Topology still present"), Bus.GetChannelTopology(TAG_EventBus_Test_Batch, Topology));
+	TestEqual(TEXT("Listener removal is published"), Topology.ListenerCount, 0);
+
+	UEventBusTestBatchListenerObject* Doomed = NewObject<UEventBusTestBatchListenerObject>();
+	TestTrue(TEXT("Doomed listener add succeeds"),
+		NFL_EVENTBUS_ADD_BATCH_LISTENER(Bus, FEventBusBatchTestChannel, Doomed, UEventBusTestBatchListenerObject, OnBatch));
+	Doomed->MarkAsGarbage();
+	CollectGarbage(RF_NoFlags);
+	TestFalse(TEXT("Dead listener is not counted before any flush or sweep"), Bus.HasListeners(TAG_EventBus_Test_Batch));
+
+	TestTrue(TEXT("UnregisterBatchChannel succeeds"), Bus.UnregisterBatchChannel(TAG_EventBus_Test_Batch));
+	TestFalse(TEXT("Unregister drops the topology"), Bus.GetChannelTopology(TAG_EventBus_Test_Batch, Topology));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusBatchChannelPresenceTest,
+	"EventBus.Batch.PresenceCallbacks",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusBatchChannelPresenceTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+	using FBatchApi = TEventBatchChannelApi<FEventBusBatchTestChannel>;
+
+	FEventBus Bus;
+	TArray<bool> Changes;
+	const FDelegateHandle Handle = FBatchApi::AddPresenceCallback(Bus,
+		FOnChannelPresenceChanged::FDelegate::CreateLambda([&Changes](const FGameplayTag&, const bool bHasListeners)
+		{
+			Changes.Add(bHasListeners);
+		}));
+	TestTrue(TEXT("Batch channel register succeeds"), FBatchApi::Register(Bus));
+	TestFalse(TEXT("New batch channel has no listeners"), FBatchApi::HasListeners(Bus));
+
+	UEventBusTestBatchListenerObject* Listener = NewObject<UEventBusTestBatchListenerObject>();
+	TestTrue(TEXT("AddBatchListener succeeds"),
+		NFL_EVENTBUS_ADD_BATCH_LISTENER(Bus, FEventBusBatchTestChannel, Listener, UEventBusTestBatchListenerObject, OnBatch));
+	TestTrue(TEXT("Listener add reports presence"), Changes.Num() == 1 && Changes[0]);
+	TestTrue(TEXT("HasListeners after add"), FBatchApi::HasListeners(Bus));
+
+	TestTrue(TEXT("RemoveBatchListener succeeds"),
+		NFL_EVENTBUS_REMOVE_BATCH_LISTENER(Bus, FEventBusBatchTestChannel, Listener, UEventBusTestBatchListenerObject, OnBatch));
+	TestTrue(TEXT("Listener removal reports absence"), Changes.Num() == 2 && !Changes[1]);
+	TestFalse(TEXT("No listeners after remove"), FBatchApi::HasListeners(Bus));
+
+	TestTrue(TEXT("RemovePresenceCallback succeeds"), FBatchApi::RemovePresenceCallback(Bus, Handle));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusBatchChannelKindConflictTest,
+	"EventBus.Batch.ChannelKindConflict",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusBatchChannelKindConflictTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	FEventBus Bus;
+	FChannelRegistration Registration;
+	Registration.ChannelTag = TAG_EventBus_Test_BatchKind;
+	TestTrue(TEXT("Delegate channel register succeeds"), Bus.RegisterChannel(Registration));
+	TestFalse(TEXT("Batch register on delegate channel tag fails"),
+		Bus.RegisterBatchChannel<float>(TAG_EventBus_Test_BatchKind, TEXT("float")));
+
+	TestTrue(TEXT("Delegate channel unregister succeeds"), Bus.UnregisterChannel(TAG_EventBus_Test_BatchKind));
+	TestTrue(TEXT("Batch register succeeds once tag is free"),
+		Bus.RegisterBatchChannel<float>(TAG_EventBus_Test_BatchKind, TEXT("float")));
+	TestFalse(TEXT("Delegate register on batch channel tag fails"), Bus.RegisterChannel(Registration));
+	return true;
+}
+
+namespace EventBusBatchTestTypes
+{
+	struct FPayloadA
+	{
+		float Value = 0.0f;
+	};
+}
+
+namespace EventBusBatchTestOtherTypes
+{
+	struct FPayloadA
+	{
+		float Value = 0.0f;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusBatchChannelPayloadIdentityTest,
+	"EventBus.Batch.PayloadIdentityIgnoresDisplayName",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusBatchChannelPayloadIdentityTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+	using FPayloadAlias = EventBusBatchTestTypes::FPayloadA;
+
+	TestTrue(TEXT("Alias shares the payload id"),
+		GetPayloadTypeId<FPayloadAlias>() == GetPayloadTypeId<EventBusBatchTestTypes::FPayloadA>());
+	TestTrue(TEXT("Same-named types in different namespaces differ"),
+		GetPayloadTypeId<EventBusBatchTestTypes::FPayloadA>() != GetPayloadTypeId<EventBusBatchTestOtherTypes::FPayloadA>());
+
+	FEventBus Bus;
+	TestTrue(TEXT("Register succeeds"),
+		Bus.RegisterBatchChannel<EventBusBatchTestTypes::FPayloadA>(TAG_EventBus_Test_BatchKind, TEXT("FPayloadA")));
+	TestFalse(TEXT("Register of another type under the same display name fails"),
+		Bus.RegisterBatchChannel<EventBusBatchTestOtherTypes::FPayloadA>(TAG_EventBus_Test_BatchKind, TEXT("FPayloadA")));
+	TestNotNull(TEXT("Find through an alias succeeds"), Bus.FindBatchChannel<FPayloadAlias>(TAG_EventBus_Test_BatchKind));
+
+	TestNull(TEXT("Find with a same-named type from another namespace fails"),
+		Bus.FindBatchChannel<EventBusBatchTestOtherTypes::FPayloadA>(TAG_EventBus_Test_BatchKind));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
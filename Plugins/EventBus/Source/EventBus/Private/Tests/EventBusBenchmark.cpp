@@ -0,0 +1,490 @@
+#include "Tests/EventBusBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Algo/Count.h"
+#include "Dom/JsonObject.h"
+#include "HAL/MemoryBase.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+#include <atomic>
+
+namespace Nfrrlib::EventBus::Benchmark
+{
+	namespace
+	{
+		/**
+		 * @brief Forwarding allocator that counts game-thread Malloc/Realloc calls.
+		 */
+		class FCountingMalloc final : public FMalloc
+		{
+		public:
+			FMalloc* Inner = nullptr;
+			std::atomic<int64> AllocationCount{0};
+
+			virtual void* Malloc(const SIZE_T Count, const uint32 Alignment) override
+			{
+				Record();
+				return Inner->Malloc(Count, Alignment);
+			}
+
+			virtual void* TryMalloc(const SIZE_T Count, const uint32 Alignment) override
+			{
+				Record();
+				return Inner->TryMalloc(Count, Alignment);
+			}
+
+			virtual void* Realloc(void* Original, const SIZE_T Count, const uint32 Alignment) override
+			{
+				Record();
+				return Inner->Realloc(Original, Count, Alignment);
+			}
+
+			virtual void* TryRealloc(void* Original, const SIZE_T Count, const uint32 Alignment) override
+			{
+				Record();
+				return Inner->TryRealloc(Original, Count, Alignment);
+			}
+
+			virtual void Free(void* Original) override
+			{
+				Inner->Free(Original);
+			}
+
+			virtual SIZE_T QuantizeSize(const SIZE_T Count, const uint32 Alignment) override
+			{
+				return Inner->QuantizeSize(Count, Alignment);
+			}
+
+			virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+			{
+				return Inner->GetAllocationSize(Original, SizeOut);
+			}
+
+			virtual void Trim(const bool bTrimThreadCaches) override
+			{
+				Inner->Trim(bTrimThreadCaches);
+			}
+
+			virtual bool IsInternallyThreadSafe() const override
+			{
+				return Inner->IsInternallyThreadSafe();
+			}
+
+			virtual const TCHAR* GetDescriptiveName() override
+			{
+				return TEXT("EventBusBenchmarkCountingMalloc");
+			}
+
+		private:
+			void Record()
+			{
+				if (IsInGameThread())
+				{
+					AllocationCount.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		};
+
+		/** @brief Never destroyed: threads that loaded GMalloc while it was installed may still call into it. */
+		FCountingMalloc& GetCountingMalloc()
+		{
+			static FCountingMalloc* const Instance = new FCountingMalloc();
+			return *Instance;
+		}
+
+		FString FormatMicroseconds(const double Value)
+		{
+			return FString::Printf(TEXT("%.3f"), Value);
+		}
+
+		void AddDelta(
+			const FBenchmarkResult& Row,
+			const TCHAR* Metric,
+			const double BaselineValue,
+			const double CurrentValue,
+			const double Ratio,
+			const double Slack,
+			TArray<FRegressionDelta>& OutDeltas)
+		{
+			FRegressionDelta& Delta = OutDeltas.AddDefaulted_GetRef();
+			Delta.Key = Row.GetKey();
+			Delta.Metric = Metric;
+			Delta.Baseline = BaselineValue;
+			Delta.Current = CurrentValue;
+			Delta.Limit = BaselineValue * Ratio + Slack;
+			Delta.bRegressed = CurrentValue > Delta.Limit;
+		}
+	} // namespace
+
+	/**
+	 * @brief Formats "[REGRESSED] key metric baseline=.. current=.. limit=.. delta=..%".
+	 */
+	FString FRegressionDelta::ToString() const
+	{
+		const double DeltaPercent = Baseline > 0.0 ? (Current - Baseline) / Baseline * 100.0 : 0.0;
+		return FString::Printf(TEXT("%s %s %s baseline=%.3f current=%.3f limit=%.3f delta=%+.1f%%"),
+			bRegressed ? TEXT("[REGRESSED]") : TEXT("[ok]"),
+			*Key,
+			*Metric,
+			Baseline,
+			Current,
+			Limit,
+			DeltaPercent);
+	}
+
+	/**
+	 * @brief Builds the stable row key shared by reports and baselines.
+	 */
+	FString FBenchmarkResult::GetKey() const
+	{
+		return FString::Printf(TEXT("%s/%s/%d/%s"), *Topology, *Ownership, Scale, *Operation);
+	}
+
+	/**
+	 * @brief Clears samples while keeping capacity for the next measurement.
+	 */
+	void FLatencyRecorder::Reset(const int32 SampleCount)
+	{
+		Samples.Reset(SampleCount);
+	}
+
+	/**
+	 * @brief Appends one cycle sample.
+	 */
+	void FLatencyRecorder::Add(const uint64 Cycles)
+	{
+		Samples.Add(Cycles);
+	}
+
+	/**
+	 * @brief Sorts samples and writes nearest-rank p50, p99 and max in microseconds.
+	 */
+	void FLatencyRecorder::Summarize(FBenchmarkResult& OutResult)
+	{
+		OutResult.SampleCount = Samples.Num();
+		if (Samples.IsEmpty())
+		{
+			OutResult.P50Us = OutResult.P99Us = OutResult.MaxUs = 0.0;
+			return;
+		}
+
+		Samples.Sort();
+		const auto Percentile = [this](const double Fraction)
+		{
+			const int32 Rank = FMath::Clamp(FMath::CeilToInt32(Fraction * Samples.Num()) - 1, 0, Samples.Num() - 1);
+			return CyclesToMicroseconds(Samples[Rank]);
+		};
+
+		OutResult.P50Us = Percentile(0.50);
+		OutResult.P99Us = Percentile(0.99);
+		OutResult.MaxUs = CyclesToMicroseconds(Samples.Last());
+	}
+
+	/**
+	 * @brief Installs the counting allocator unless an outer scope already did.
+	 */
+	FScopedAllocationCounter::FScopedAllocationCounter()
+	{
+		FCountingMalloc& Counting = GetCountingMalloc();
+		if (GMalloc != &Counting)
+		{
+			Counting.Inner = GMalloc;
+			GMalloc = &Counting;
+			bInstalled = true;
+		}
+		StartCount = Counting.AllocationCount.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Restores the wrapped allocator when this scope installed it.
+	 */
+	FScopedAllocationCounter::~FScopedAllocationCounter()
+	{
+		if (bInstalled)
+		{
+			GMalloc = GetCountingMalloc().Inner;
+		}
+	}
+
+	/**
+	 * @brief Returns counted allocations since construction.
+	 */
+	int64 FScopedAllocationCounter::GetCount() const
+	{
+		return GetCountingMalloc().AllocationCount.load(std::memory_order_relaxed) - StartCount;
+	}
+
+	/**
+	 * @brief Writes a header plus one row per result.
+	 */
+	FString FBenchmarkReport::ToCsv() const
+	{
+		FString Csv = TEXT("Suite,Topology,Ownership,Scale,Operation,Samples,P50Us,P99Us,MaxUs,Allocations\n");
+		for (const FBenchmarkResult& Result : Results)
+		{
+			Csv += FString::Printf(TEXT("%s,%s,%s,%d,%s,%d,%s,%s,%s,%lld\n"),
+				*Suite,
+				*Result.Topology,
+				*Result.Ownership,
+				Result.Scale,
+				*Result.Operation,
+				Result.SampleCount,
+				*FormatMicroseconds(Result.P50Us),
+				*FormatMicroseconds(Result.P99Us),
+				*FormatMicroseconds(Result.MaxUs),
+				Result.Allocations);
+		}
+		return Csv;
+	}
+
+	/**
+	 * @brief Writes `{ "Suite": ..., "Results": [ ... ] }`.
+	 */
+	FString FBenchmarkReport::ToJson() const
+	{
+		const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetStringField(TEXT("Suite"), Suite);
+
+		TArray<TSharedPtr<FJsonValue>> Rows;
+		Rows.Reserve(Results.Num());
+		for (const FBenchmarkResult& Result : Results)
+		{
+			const TSharedRef<FJsonObject> Row = MakeShared<FJsonObject>();
+			Row->SetStringField(TEXT("Topology"), Result.Topology);
+			Row->SetStringField(TEXT("Ownership"), Result.Ownership);
+			Row->SetNumberField(TEXT("Scale"), Result.Scale);
+			Row->SetStringField(TEXT("Operation"), Result.Operation);
+			Row->SetNumberField(TEXT("Samples"), Result.SampleCount);
+			Row->SetNumberField(TEXT("P50Us"), Result.P50Us);
+			Row->SetNumberField(TEXT("P99Us"), Result.P99Us);
+			Row->SetNumberField(TEXT("MaxUs"), Result.MaxUs);
+			Row->SetNumberField(TEXT("Allocations"), static_cast<double>(Result.Allocations));
+			Rows.Add(MakeShared<FJsonValueObject>(Row));
+		}
+		Root->SetArrayField(TEXT("Results"), Rows);
+
+		const TSharedRef<FJsonObject> ToleranceObject = MakeShared<FJsonObject>();
+		ToleranceObject->SetNumberField(TEXT("LatencyRatio"), Tolerances.LatencyRatio);
+		ToleranceObject->SetNumberField(TEXT("LatencySlackUs"), Tolerances.LatencySlackUs);
+		ToleranceObject->SetNumberField(TEXT("AllocationRatio"), Tolerances.AllocationRatio);
+		ToleranceObject->SetNumberField(TEXT("AllocationSlack"), static_cast<double>(Tolerances.AllocationSlack));
+		Root->SetObjectField(TEXT("Tolerances"), ToleranceObject);
+
+		FString Json;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+		FJsonSerializer::Serialize(Root, Writer);
+		return Json;
+	}
+
+	/**
+	 * @brief Reads a report written by ToJson; rows missing required fields are rejected.
+	 */
+	bool FBenchmarkReport::FromJson(const FString& Json, FBenchmarkReport& OutReport)
+	{
+		TSharedPtr<FJsonObject> Root;
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+		if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+		{
+			return false;
+		}
+
+		OutReport = FBenchmarkReport();
+		Root->TryGetStringField(TEXT("Suite"), OutReport.Suite);
+
+		const TSharedPtr<FJsonObject>* ToleranceObject = nullptr;
+		if (Root->TryGetObjectField(TEXT("Tolerances"), ToleranceObject))
+		{
+			double AllocationSlack = static_cast<double>(OutReport.Tolerances.AllocationSlack);
+			(*ToleranceObject)->TryGetNumberField(TEXT("LatencyRatio"), OutReport.Tolerances.LatencyRatio);
+			(*ToleranceObject)->TryGetNumberField(TEXT("LatencySlackUs"), OutReport.Tolerances.LatencySlackUs);
+			(*ToleranceObject)->TryGetNumberField(TEXT("AllocationRatio"), OutReport.Tolerances.AllocationRatio);
+			(*ToleranceObject)->TryGetNumberField(TEXT("AllocationSlack"), AllocationSlack);
+			OutReport.Tolerances.AllocationSlack = static_cast<int64>(AllocationSlack);
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* Rows = nullptr;
+		if (!Root->TryGetArrayField(TEXT("Results"), Rows))
+		{
+			return false;
+		}
+
+		for (const TSharedPtr<FJsonValue>& RowValue : *Rows)
+		{
+			const TSharedPtr<FJsonObject>* Row = nullptr;
+			if (!RowValue.IsValid() || !RowValue->TryGetObject(Row))
+			{
+				return false;
+			}
+
+			FBenchmarkResult Result;
+			double Allocations = 0.0;
+			if (!(*Row)->TryGetStringField(TEXT("Topology"), Result.Topology) ||
+				!(*Row)->TryGetStringField(TEXT("Ownership"), Result.Ownership) ||
+				!(*Row)->TryGetNumberField(TEXT("Scale"), Result.Scale) ||
+				!(*Row)->TryGetStringField(TEXT("Operation"), Result.Operation) ||
+				!(*Row)->TryGetNumberField(TEXT("P50Us"), Result.P50Us) ||
+				!(*Row)->TryGetNumberField(TEXT("P99Us"), Result.P99Us) ||
+				!(*Row)->TryGetNumberField(TEXT("MaxUs"), Result.MaxUs))
+			{
+				return false;
+			}
+
+			(*Row)->TryGetNumberField(TEXT("Samples"), Result.SampleCount);
+			(*Row)->TryGetNumberField(TEXT("Allocations"), Allocations);
+			Result.Allocations = static_cast<int64>(Allocations);
+			OutReport.Results.Add(MoveTemp(Result));
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Writes JSON and CSV files side by side.
+	 */
+	bool FBenchmarkReport::SaveTo(const FString& Directory) const
+	{
+		const FString BasePath = FPaths::Combine(Directory, Suite);
+		const bool bJsonSaved = FFileHelper::SaveStringToFile(ToJson(), *(BasePath + TEXT(".json")));
+		const bool bCsvSaved = FFileHelper::SaveStringToFile(ToCsv(), *(BasePath + TEXT(".csv")));
+		return bJsonSaved && bCsvSaved;
+	}
+
+	/**
+	 * @brief Writes JSON to FilePath, creating parent directories as needed.
+	 */
+	bool FBenchmarkReport::SaveJsonTo(const FString& FilePath) const
+	{
+		return FFileHelper::SaveStringToFile(ToJson(), *FilePath);
+	}
+
+	/**
+	 * @brief Matches rows by key and checks p50, p99 and allocation counts against tolerance.
+	 */
+	int32 CompareToBaseline(
+		const FBenchmarkReport& Baseline,
+		const FBenchmarkReport& Current,
+		const FRegressionTolerance& Tolerance,
+		TArray<FRegressionDelta>& OutDeltas)
+	{
+		OutDeltas.Reset();
+
+		TMap<FString, const FBenchmarkResult*> BaselineRows;
+		BaselineRows.Reserve(Baseline.Results.Num());
+		for (const FBenchmarkResult& Row : Baseline.Results)
+		{
+			BaselineRows.Add(Row.GetKey(), &Row);
+		}
+
+		for (const FBenchmarkResult& Row : Current.Results)
+		{
+			const FBenchmarkResult* const* BaselineRow = BaselineRows.Find(Row.GetKey());
+			if (BaselineRow == nullptr)
+			{
+				continue;
+			}
+
+			AddDelta(Row, TEXT("P50Us"), (*BaselineRow)->P50Us, Row.P50Us, Tolerance.LatencyRatio, Tolerance.LatencySlackUs, OutDeltas);
+			AddDelta(Row, TEXT("P99Us"), (*BaselineRow)->P99Us, Row.P99Us, Tolerance.LatencyRatio, Tolerance.LatencySlackUs, OutDeltas);
+			AddDelta(
+				Row,
+				TEXT("Allocations"),
+				static_cast<double>((*BaselineRow)->Allocations),
+				static_cast<double>(Row.Allocations),
+				Tolerance.AllocationRatio,
+				static_cast<double>(Tolerance.AllocationSlack),
+				OutDeltas);
+		}
+
+		return static_cast<int32>(Algo::CountIf(OutDeltas, [](const FRegressionDelta& Delta)
+		{
+			return Delta.bRegressed;
+		}));
+	}
+
+	/**
+	 * @brief Resolves baseline path from the command line or the plugin resources directory.
+	 */
+	FString GetBaselinePath(const FString& Suite)
+	{
+		FString BaselinePath;
+		if (FParse::Value(FCommandLine::Get(), TEXT("EventBusBenchBaseline="), BaselinePath) && !BaselinePath.IsEmpty())
+		{
+			return BaselinePath;
+		}
+
+		const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("EventBus"));
+		const FString PluginDir = Plugin.IsValid() ? Plugin->GetBaseDir() : FPaths::ProjectPluginsDir() / TEXT("EventBus");
+		return FPaths::Combine(PluginDir, TEXT("Resources"), TEXT("Benchmarks"), Suite + TEXT(".json"));
+	}
+
+	/**
+	 * @brief Reads and parses a baseline report file.
+	 */
+	bool LoadBaseline(const FString& FilePath, FBenchmarkReport& OutBaseline)
+	{
+		FString Json;
+		return FFileHelper::LoadFileToString(Json, *FilePath) && FBenchmarkReport::FromJson(Json, OutBaseline);
+	}
+
+	/**
+	 * @brief Checks the command line for the baseline recording switch.
+	 */
+	bool ShouldUpdateBaseline()
+	{
+		return FParse::Param(FCommandLine::Get(), TEXT("EventBusBenchUpdateBaseline"));
+	}
+
+	/**
+	 * @brief Applies command-line tolerance overrides on top of baseline-stored defaults.
+	 */
+	FRegressionTolerance ResolveTolerance(const FRegressionTolerance& Defaults)
+	{
+		FRegressionTolerance Tolerance = Defaults;
+		const TCHAR* const CommandLine = FCommandLine::Get();
+		FParse::Value(CommandLine, TEXT("EventBusBenchLatencyRatio="), Tolerance.LatencyRatio);
+		FParse::Value(CommandLine, TEXT("EventBusBenchLatencySlackUs="), Tolerance.LatencySlackUs);
+		FParse::Value(CommandLine, TEXT("EventBusBenchAllocRatio="), Tolerance.AllocationRatio);
+		FParse::Value(CommandLine, TEXT("EventBusBenchAllocSlack="), Tolerance.AllocationSlack);
+		return Tolerance;
+	}
+
+	/**
+	 * @brief Resolves report directory from the command line with a Saved fallback.
+	 */
+	FString GetOutputDirectory()
+	{
+		FString Directory;
+		if (FParse::Value(FCommandLine::Get(), TEXT("EventBusBenchOut="), Directory) && !Directory.IsEmpty())
+		{
+			return Directory;
+		}
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EventBus"), TEXT("Benchmarks"));
+	}
+
+	/**
+	 * @brief Resolves the largest benchmark scale from the command line.
+	 */
+	int32 GetMaxScale(const int32 DefaultMaxScale)
+	{
+		int32 MaxScale = DefaultMaxScale;
+		FParse::Value(FCommandLine::Get(), TEXT("EventBusBenchMaxScale="), MaxScale);
+		return FMath::Max(MaxScale, 1);
+	}
+
+	/**
+	 * @brief Converts cycles to microseconds using the platform cycle frequency.
+	 */
+	double CyclesToMicroseconds(const uint64 Cycles)
+	{
+		return FPlatformTime::ToMilliseconds64(Cycles) * 1000.0;
+	}
+} // namespace Nfrrlib::EventBus::Benchmark
+
+#endif // WITH_DEV_AUTOMATION_TESTS
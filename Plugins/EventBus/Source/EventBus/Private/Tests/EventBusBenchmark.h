@@ -0,0 +1,157 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace Nfrrlib::EventBus::Benchmark
+{
+	/**
+	 * @brief Latency summary for one operation at one topology, ownership mode and scale.
+	 */
+	struct FBenchmarkResult final
+	{
+		/** @brief Scaled dimension: "Listeners" (one publisher) or "Publishers" (one listener). */
+		FString Topology;
+		/** @brief "Owning" or "NonOwning" publisher delegate policy. */
+		FString Ownership;
+		/** @brief Number of scaled bindings present while sampling. */
+		int32 Scale = 0;
+		/** @brief Measured operation: Add, Remove, Cleanup or Broadcast. */
+		FString Operation;
+		int32 SampleCount = 0;
+		double P50Us = 0.0;
+		double P99Us = 0.0;
+		double MaxUs = 0.0;
+		/** @brief Game-thread heap allocations across all samples. */
+		int64 Allocations = 0;
+
+		/** @brief Returns "Topology/Ownership/Scale/Operation", the key used to match baseline rows. */
+		NFL_EVENTBUS_NODISCARD FString GetKey() const;
+	};
+
+	/**
+	 * @brief Limits applied when comparing a benchmark run against a stored baseline.
+	 *
+	 * A metric regresses when Current > Baseline * Ratio + Slack. Slack keeps sub-microsecond rows from flapping.
+	 */
+	struct FRegressionTolerance final
+	{
+		double LatencyRatio = 1.5;
+		double LatencySlackUs = 1.0;
+		double AllocationRatio = 1.1;
+		int64 AllocationSlack = 2;
+	};
+
+	/**
+	 * @brief One compared metric for one benchmark row.
+	 */
+	struct FRegressionDelta final
+	{
+		FString Key;
+		/** @brief P50Us, P99Us or Allocations. */
+		FString Metric;
+		double Baseline = 0.0;
+		double Current = 0.0;
+		double Limit = 0.0;
+		bool bRegressed = false;
+
+		/** @brief Formats one line of the per-scenario delta report. */
+		NFL_EVENTBUS_NODISCARD FString ToString() const;
+	};
+
+	/**
+	 * @brief Collects per-sample cycle counts and reduces them to nearest-rank percentiles.
+	 */
+	class FLatencyRecorder final
+	{
+	public:
+		/** @brief Drops previous samples and reserves room for SampleCount new ones. */
+		void Reset(int32 SampleCount);
+		/** @brief Records one sample in CPU cycles. */
+		void Add(uint64 Cycles);
+		/** @brief Fills percentile fields of OutResult from recorded samples. */
+		void Summarize(FBenchmarkResult& OutResult);
+
+	private:
+		TArray<uint64> Samples;
+	};
+
+	/**
+	 * @brief Counts game-thread heap allocations while in scope by wrapping GMalloc.
+	 *
+	 * Every call is forwarded to the wrapped allocator, so memory allocated before or after
+	 * the scope is freed normally. Allocations on other threads are forwarded but not counted.
+	 */
+	class FScopedAllocationCounter final
+	{
+	public:
+		FScopedAllocationCounter();
+		~FScopedAllocationCounter();
+
+		FScopedAllocationCounter(const FScopedAllocationCounter&) = delete;
+		FScopedAllocationCounter& operator=(const FScopedAllocationCounter&) = delete;
+
+		/** @brief Returns allocations counted since construction. */
+		NFL_EVENTBUS_NODISCARD int64 GetCount() const;
+
+	private:
+		int64 StartCount = 0;
+		bool bInstalled = false;
+	};
+
+	/**
+	 * @brief Named list of benchmark results with CSV and JSON round-tripping.
+	 */
+	struct FBenchmarkReport final
+	{
+		FString Suite;
+		TArray<FBenchmarkResult> Results;
+		/** @brief Stored with baselines so tolerances travel with the numbers they apply to. */
+		FRegressionTolerance Tolerances;
+
+		/** @brief Serializes results as one CSV row per result with a header line. */
+		NFL_EVENTBUS_NODISCARD FString ToCsv() const;
+		/** @brief Serializes suite name and results as a JSON object. */
+		NFL_EVENTBUS_NODISCARD FString ToJson() const;
+		/** @brief Parses a report previously written by ToJson. */
+		NFL_EVENTBUS_NODISCARD static bool FromJson(const FString& Json, FBenchmarkReport& OutReport);
+		/** @brief Writes `<Suite>.json` and `<Suite>.csv` into Directory; returns false on any write failure. */
+		NFL_EVENTBUS_NODISCARD bool SaveTo(const FString& Directory) const;
+		/** @brief Writes the JSON form only, to an explicit file path. */
+		NFL_EVENTBUS_NODISCARD bool SaveJsonTo(const FString& FilePath) const;
+	};
+
+	/**
+	 * @brief Compares p50, p99 and allocations of every current row that has a baseline row.
+	 *
+	 * Rows present on only one side are skipped, so capped runs compare against a fuller baseline.
+	 * Returns the number of regressed metrics; OutDeltas receives every compared metric.
+	 */
+	NFL_EVENTBUS_NODISCARD int32 CompareToBaseline(
+		const FBenchmarkReport& Baseline,
+		const FBenchmarkReport& Current,
+		const FRegressionTolerance& Tolerance,
+		TArray<FRegressionDelta>& OutDeltas);
+
+	/** @brief Returns `-EventBusBenchBaseline=` or `<EventBusPlugin>/Resources/Benchmarks/<Suite>.json`. */
+	NFL_EVENTBUS_NODISCARD FString GetBaselinePath(const FString& Suite);
+	/** @brief Loads a baseline report; returns false when the file is missing or malformed. */
+	NFL_EVENTBUS_NODISCARD bool LoadBaseline(const FString& FilePath, FBenchmarkReport& OutBaseline);
+	/** @brief Returns true when `-EventBusBenchUpdateBaseline` asks the gate to record instead of compare. */
+	NFL_EVENTBUS_NODISCARD bool ShouldUpdateBaseline();
+	/** @brief Applies `-EventBusBench{LatencyRatio,LatencySlackUs,AllocRatio,AllocSlack}=` overrides to Defaults. */
+	NFL_EVENTBUS_NODISCARD FRegressionTolerance ResolveTolerance(const FRegressionTolerance& Defaults);
+
+	/** @brief Returns `-EventBusBenchOut=` or `<ProjectSaved>/EventBus/Benchmarks`. */
+	NFL_EVENTBUS_NODISCARD FString GetOutputDirectory();
+	/** @brief Returns `-EventBusBenchMaxScale=` or DefaultMaxScale. */
+	NFL_EVENTBUS_NODISCARD int32 GetMaxScale(int32 DefaultMaxScale);
+	/** @brief Converts a cycle count to microseconds. */
+	NFL_EVENTBUS_NODISCARD double CyclesToMicroseconds(uint64 Cycles);
+} // namespace Nfrrlib::EventBus::Benchmark
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,739 @@
+#include "Misc/AutomationTest.h"
+
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "NativeGameplayTags.h"
+
+#include "EventBus/Core/ConcurrentEventBus.h"
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBus.h"
+#include "EventBus/Core/EventBusPolicies.h"
+#include "EventBus/Core/EventBusReplay.h"
+#include "EventBus/Typed/EventChannelApi.h"
+#include "EventBus/Typed/EventChannelDef.h"
+#include "Tests/EventBusBenchmark.h"
+#include "Tests/EventBusTestObjects.h"
+
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Benchmark, "EventBus.Test.Benchmark");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Contention0, "EventBus.Test.Contention.0");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Contention1, "EventBus.Test.Contention.1");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Contention2, "EventBus.Test.Contention.2");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Contention3, "EventBus.Test.Contention.3");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Contention4, "EventBus.Test.Contention.4");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Contention5, "EventBus.Test.Contention.5");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Contention6, "EventBus.Test.Contention.6");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Contention7, "EventBus.Test.Contention.7");
+
+NFL_DECLARE_EVENTBUS_CHANNEL(
+	FEventBusBenchmarkChannel,
+	FEventBusTestFloatDelegate,
+	UEventBusTestPublisherObject,
+	TAG_EventBus_Test_Benchmark,
+	OnValueChanged
+);
+
+namespace
+{
+	using namespace Nfrrlib::EventBus;
+	using namespace Nfrrlib::EventBus::Benchmark;
+	using FBenchmarkApi = TEventChannelApi<FEventBusBenchmarkChannel>;
+
+	/** @brief Scales swept by the core suite; larger entries are skipped above `-EventBusBenchMaxScale=`. */
+	constexpr int32 CoreScales[] = {10, 100, 1000, 10000, 100000};
+	/** @brief Add/remove samples are taken from the last (first) operations at full scale. */
+	constexpr int32 MaxEdgeSamples = 1000;
+	/** @brief Cleanup samples each retire one scaled binding from the front of the range. */
+	constexpr int32 MaxCleanupSamples = 200;
+
+	/** @brief Cleanup retires even indices below 2x this count, leaving the tail for remove samples. */
+	int32 GetCleanupSampleCount(const int32 Scale)
+	{
+		return FMath::Min(Scale / 4, MaxCleanupSamples);
+	}
+
+	/** @brief Which side of the channel the suite grows. */
+	enum class EBenchmarkTopology : uint8
+	{
+		/** @brief One publisher, Scale listeners. */
+		Listeners,
+		/** @brief Scale publishers, one listener. */
+		Publishers
+	};
+
+	/** @brief Broadcast sample count shrinks with fan-out so large scales finish in bounded time. */
+	int32 GetBroadcastSampleCount(const int32 Scale)
+	{
+		return FMath::Clamp(1000000 / Scale, 20, 1000);
+	}
+
+	/**
+	 * @brief Drives one topology at one scale and ownership mode.
+	 */
+	class FCoreScalingRun final
+	{
+	public:
+		FCoreScalingRun(const EBenchmarkTopology InTopology, const bool bInOwnsPublisherDelegates, const int32 InScale)
+			: Topology(InTopology)
+			, bOwnsPublisherDelegates(bInOwnsPublisherDelegates)
+			, Scale(InScale)
+		{
+		}
+
+		/** @brief Runs add, broadcast, cleanup and remove phases and appends one result per phase. */
+		bool Run(FBenchmarkReport& Report)
+		{
+			if (!FBenchmarkApi::Register(Bus, bOwnsPublisherDelegates))
+			{
+				return false;
+			}
+
+			CreateObjects();
+			if (!MeasureAdd(Report))
+			{
+				return false;
+			}
+			MeasureBroadcast(Report);
+			if (!MeasureCleanup(Report))
+			{
+				return false;
+			}
+			if (!MeasureRemove(Report))
+			{
+				return false;
+			}
+			Bus.Reset();
+			return true;
+		}
+
+	private:
+		void CreateObjects()
+		{
+			const int32 PublisherCount = Topology == EBenchmarkTopology::Publishers ? Scale : 1;
+			const int32 ListenerCount = Topology == EBenchmarkTopology::Listeners ? Scale : 1;
+			Publishers.Reserve(PublisherCount);
+			Listeners.Reserve(ListenerCount);
+			for (int32 Index = 0; Index < PublisherCount; ++Index)
+			{
+				Publishers.Add(NewObject<UEventBusTestPublisherObject>());
+			}
+			for (int32 Index = 0; Index < ListenerCount; ++Index)
+			{
+				Listeners.Add(NewObject<UEventBusTestListenerObject>());
+			}
+		}
+
+		/** @brief Adds the scaled side at index Index; the fixed side is added before the loop. */
+		bool AddScaled(const int32 Index)
+		{
+			return Topology == EBenchmarkTopology::Listeners
+				? NFL_EVENTBUS_ADD_LISTENER(Bus, FEventBusBenchmarkChannel, Listeners[Index], UEventBusTestListenerObject, OnValue)
+				: FBenchmarkApi::AddPublisher(Bus, Publishers[Index]);
+		}
+
+		bool RemoveScaled(const int32 Index)
+		{
+			return Topology == EBenchmarkTopology::Listeners
+				? NFL_EVENTBUS_REMOVE_LISTENER(Bus, FEventBusBenchmarkChannel, Listeners[Index], UEventBusTestListenerObject, OnValue)
+				: FBenchmarkApi::RemovePublisher(Bus, Publishers[Index]);
+		}
+
+		UObject* GetScaled(const int32 Index) const
+		{
+			return Topology == EBenchmarkTopology::Listeners
+				? static_cast<UObject*>(Listeners[Index])
+				: static_cast<UObject*>(Publishers[Index]);
+		}
+
+		FBenchmarkResult MakeResult(const TCHAR* Operation) const
+		{
+			FBenchmarkResult Result;
+			Result.Topology = Topology == EBenchmarkTopology::Listeners ? TEXT("Listeners") : TEXT("Publishers");
+			Result.Ownership = bOwnsPublisherDelegates ? TEXT("Owning") : TEXT("NonOwning");
+			Result.Scale = Scale;
+			Result.Operation = Operation;
+			return Result;
+		}
+
+		/** @brief Grows to Scale and samples the final adds, which run against a full channel. */
+		bool MeasureAdd(FBenchmarkReport& Report)
+		{
+			const bool bFixedAdded = Topology == EBenchmarkTopology::Listeners
+				? FBenchmarkApi::AddPublisher(Bus, Publishers[0])
+				: NFL_EVENTBUS_ADD_LISTENER(Bus, FEventBusBenchmarkChannel, Listeners[0], UEventBusTestListenerObject, OnValue);
+			if (!bFixedAdded)
+			{
+				return false;
+			}
+
+			const int32 SampleCount = FMath::Min(Scale, MaxEdgeSamples);
+			const int32 FirstSampled = Scale - SampleCount;
+			for (int32 Index = 0; Index < FirstSampled; ++Index)
+			{
+				if (!AddScaled(Index))
+				{
+					return false;
+				}
+			}
+
+			FBenchmarkResult Result = MakeResult(TEXT("Add"));
+			Recorder.Reset(SampleCount);
+			int64 Allocations = 0;
+			for (int32 Index = FirstSampled; Index < Scale; ++Index)
+			{
+				const FScopedAllocationCounter AllocationCounter;
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				const bool bAdded = AddScaled(Index);
+				Recorder.Add(FPlatformTime::Cycles64() - StartCycles);
+				Allocations += AllocationCounter.GetCount();
+				if (!bAdded)
+				{
+					return false;
+				}
+			}
+
+			Recorder.Summarize(Result);
+			Result.Allocations = Allocations;
+			Report.Results.Add(MoveTemp(Result));
+			return true;
+		}
+
+		/** @brief Samples typed broadcasts; publisher topology rotates through publishers. */
+		void MeasureBroadcast(FBenchmarkReport& Report)
+		{
+			const int32 SampleCount = GetBroadcastSampleCount(Scale);
+			FBenchmarkResult Result = MakeResult(TEXT("Broadcast"));
+			Recorder.Reset(SampleCount);
+			int64 Allocations = 0;
+			for (int32 Sample = 0; Sample < SampleCount; ++Sample)
+			{
+				UEventBusTestPublisherObject* Publisher = Publishers[Sample % Publishers.Num()];
+				const FScopedAllocationCounter AllocationCounter;
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				FBenchmarkApi::Broadcast(Bus, Publisher, static_cast<float>(Sample));
+				Recorder.Add(FPlatformTime::Cycles64() - StartCycles);
+				Allocations += AllocationCounter.GetCount();
+			}
+
+			Recorder.Summarize(Result);
+			Result.Allocations = Allocations;
+			Report.Results.Add(MoveTemp(Result));
+		}
+
+		/**
+		 * @brief Retires one scaled object per sample and times the cleanup pass the next add triggers.
+		 *
+		 * Latency comes from the channel's cleanup cycle counter, so it excludes rebind cost.
+		 */
+		bool MeasureCleanup(FBenchmarkReport& Report)
+		{
+			const int32 SampleCount = GetCleanupSampleCount(Scale);
+			FBenchmarkResult Result = MakeResult(TEXT("Cleanup"));
+			Recorder.Reset(SampleCount);
+			int64 Allocations = 0;
+			for (int32 Sample = 0; Sample < SampleCount; ++Sample)
+			{
+				const int32 RetiredIndex = Sample * 2;
+				GetScaled(RetiredIndex)->MarkAsGarbage();
+
+				FEventChannelStats Before;
+				FEventChannelStats After;
+				if (!Bus.GetChannelStats(FEventBusBenchmarkChannel::GetChannelTag(), Before))
+				{
+					return false;
+				}
+
+				const FScopedAllocationCounter AllocationCounter;
+				const bool bRefreshed = AddScaled(RetiredIndex + 1);
+				Allocations += AllocationCounter.GetCount();
+				if (!bRefreshed || !Bus.GetChannelStats(FEventBusBenchmarkChannel::GetChannelTag(), After))
+				{
+					return false;
+				}
+				Recorder.Add(After.CleanupCycles - Before.CleanupCycles);
+			}
+
+			Recorder.Summarize(Result);
+			Result.Allocations = Allocations;
+			Report.Results.Add(MoveTemp(Result));
+			return true;
+		}
+
+		/** @brief Samples removal of the last scaled objects, none of which were retired by cleanup. */
+		bool MeasureRemove(FBenchmarkReport& Report)
+		{
+			const int32 SampleCount = FMath::Min(Scale - 2 * GetCleanupSampleCount(Scale), MaxEdgeSamples);
+			FBenchmarkResult Result = MakeResult(TEXT("Remove"));
+			Recorder.Reset(SampleCount);
+			int64 Allocations = 0;
+			for (int32 Index = Scale - 1; Index >= Scale - SampleCount; --Index)
+			{
+				const FScopedAllocationCounter AllocationCounter;
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				const bool bRemoved = RemoveScaled(Index);
+				Recorder.Add(FPlatformTime::Cycles64() - StartCycles);
+				Allocations += AllocationCounter.GetCount();
+				if (!bRemoved)
+				{
+					return false;
+				}
+			}
+
+			Recorder.Summarize(Result);
+			Result.Allocations = Allocations;
+			Report.Results.Add(MoveTemp(Result));
+			return true;
+		}
+
+	private:
+		EBenchmarkTopology Topology = EBenchmarkTopology::Listeners;
+		bool bOwnsPublisherDelegates = false;
+		int32 Scale = 0;
+		FEventBus Bus;
+		FLatencyRecorder Recorder;
+		TArray<UEventBusTestPublisherObject*> Publishers;
+		TArray<UEventBusTestListenerObject*> Listeners;
+	};
+
+	/**
+	 * @brief Runs every topology, ownership mode and scale up to MaxScale into Report.
+	 */
+	bool RunCoreScalingSuite(const int32 MaxScale, FBenchmarkReport& Report, FString& OutError)
+	{
+		Report.Suite = TEXT("CoreScaling");
+		for (const EBenchmarkTopology Topology : {EBenchmarkTopology::Listeners, EBenchmarkTopology::Publishers})
+		{
+			for (const bool bOwnsPublisherDelegates : {false, true})
+			{
+				for (const int32 Scale : CoreScales)
+				{
+					if (Scale > MaxScale)
+					{
+						continue;
+					}
+
+					FCoreScalingRun ScalingRun(Topology, bOwnsPublisherDelegates, Scale);
+					if (!ScalingRun.Run(Report))
+					{
+						OutError = FString::Printf(TEXT("Benchmark setup failed at scale %d"), Scale);
+						return false;
+					}
+				}
+			}
+		}
+		return true;
+	}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusCoreScalingBenchmarkTest,
+	"EventBus.Perf.Core.Scaling",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FEventBusCoreScalingBenchmarkTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	FBenchmarkReport Report;
+	FString Error;
+	if (!RunCoreScalingSuite(GetMaxScale(100000), Report, Error))
+	{
+		AddError(Error);
+		return false;
+	}
+
+	for (const FBenchmarkResult& Result : Report.Results)
+	{
+		AddInfo(FString::Printf(TEXT("%s p50=%.3fus p99=%.3fus max=%.3fus allocs=%lld samples=%d"),
+			*Result.GetKey(),
+			Result.P50Us,
+			Result.P99Us,
+			Result.MaxUs,
+			Result.Allocations,
+			Result.SampleCount));
+	}
+
+	const FString OutputDirectory = GetOutputDirectory();
+	TestTrue(TEXT("Benchmark report written"), Report.SaveTo(OutputDirectory));
+	AddInfo(FString::Printf(TEXT("Benchmark report: %s"), *OutputDirectory));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusCoreRegressionGateTest,
+	"EventBus.Perf.Core.RegressionGate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FEventBusCoreRegressionGateTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	const FString BaselinePath = GetBaselinePath(TEXT("CoreScaling"));
+	FBenchmarkReport Baseline;
+	const bool bHasBaseline = LoadBaseline(BaselinePath, Baseline);
+
+	FBenchmarkReport Report;
+	FString Error;
+	if (!RunCoreScalingSuite(GetMaxScale(10000), Report, Error))
+	{
+		AddError(Error);
+		return false;
+	}
+
+	if (ShouldUpdateBaseline())
+	{
+		Report.Tolerances = bHasBaseline ? Baseline.Tolerances : FRegressionTolerance();
+		TestTrue(TEXT("Baseline written"), Report.SaveJsonTo(BaselinePath));
+		AddInfo(FString::Printf(TEXT("Baseline updated: %s"), *BaselinePath));
+		return true;
+	}
+
+	if (!bHasBaseline)
+	{
+		AddWarning(FString::Printf(TEXT("No benchmark baseline at %s; rerun with -EventBusBenchUpdateBaseline to record one."), *BaselinePath));
+		return true;
+	}
+
+	const FRegressionTolerance Tolerance = ResolveTolerance(Baseline.Tolerances);
+	TArray<FRegressionDelta> Deltas;
+	const int32 RegressionCount = CompareToBaseline(Baseline, Report, Tolerance, Deltas);
+	for (const FRegressionDelta& Delta : Deltas)
+	{
+		const FString Line = Delta.ToString();
+		if (Delta.bRegressed)
+		{
+			AddError(Line);
+		}
+		else
+		{
+			AddInfo(Line);
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("Compared %d metrics against %s; %d regressed."), Deltas.Num(), *BaselinePath, RegressionCount));
+	return RegressionCount == 0;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusReplayBenchmarkTest,
+	"EventBus.Perf.Replay",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FEventBusReplayBenchmarkTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	FString RecordingPath;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("EventBusReplay="), RecordingPath) || RecordingPath.IsEmpty())
+	{
+		AddInfo(TEXT("No -EventBusReplay=<file> given; nothing to replay."));
+		return true;
+	}
+
+	FEventBusRecording Recording;
+	if (!FEventBusRecording::Load(RecordingPath, Recording))
+	{
+		AddError(FString::Printf(TEXT("Could not load recording %s"), *RecordingPath));
+		return false;
+	}
+
+	constexpr int32 OpCount = static_cast<int32>(EEventBusRecordOp::Count);
+	TStaticArray<FLatencyRecorder, OpCount> Recorders;
+	TStaticArray<int32, OpCount> OpRecordCounts = MakeUniformStaticArray<int32, OpCount>(0);
+	for (const FEventBusRecord& Record : Recording.Records)
+	{
+		++OpRecordCounts[static_cast<int32>(Record.Op)];
+	}
+	for (int32 OpIndex = 0; OpIndex < OpCount; ++OpIndex)
+	{
+		Recorders[OpIndex].Reset(OpRecordCounts[OpIndex]);
+	}
+
+	FEventBusReplayOptions Options;
+	Options.OnRecordReplayed = [&Recorders](const FEventBusRecord& Record, const uint64 Cycles)
+	{
+		Recorders[static_cast<int32>(Record.Op)].Add(Cycles);
+	};
+
+	FEventBus Bus;
+	FEventBusReplayer Replayer(Recording);
+	FEventBusReplayResult ReplayResult;
+	Replayer.Replay(Bus, Options, ReplayResult);
+	AddInfo(FString::Printf(TEXT("Replayed %d of %d records (%d skipped, %d failed) from a %.2fs recording in %.3fs"),
+		ReplayResult.ReplayedCount,
+		Recording.Records.Num(),
+		ReplayResult.SkippedCount,
+		ReplayResult.FailedCount,
+		Recording.GetDurationSeconds(),
+		ReplayResult.TotalSeconds));
+
+	FBenchmarkReport Report;
+	Report.Suite = TEXT("Replay");
+	for (int32 OpIndex = 0; OpIndex < OpCount; ++OpIndex)
+	{
+		FBenchmarkResult Result;
+		Result.Topology = TEXT("Replay");
+		Result.Ownership = FPaths::GetBaseFilename(RecordingPath);
+		Result.Scale = Recording.Records.Num();
+		Result.Operation = LexToString(static_cast<EEventBusRecordOp>(OpIndex));
+		Recorders[OpIndex].Summarize(Result);
+		if (Result.SampleCount == 0)
+		{
+			continue;
+		}
+
+		AddInfo(FString::Printf(TEXT("%s p50=%.3fus p99=%.3fus max=%.3fus samples=%d"),
+			*Result.GetKey(),
+			Result.P50Us,
+			Result.P99Us,
+			Result.MaxUs,
+			Result.SampleCount));
+		Report.Results.Add(MoveTemp(Result));
+	}
+
+	const FString OutputDirectory = GetOutputDirectory();
+	TestTrue(TEXT("Replay report written"), Report.SaveTo(OutputDirectory));
+	AddInfo(FString::Printf(TEXT("Replay report: %s"), *OutputDirectory));
+	return true;
+}
+
+namespace
+{
+	/** @brief What the assert policies reduce to in a build without `check`. */
+	struct FCompiledOutValidationPolicy final
+	{
+		FORCEINLINE static bool ValidateChannelTag(const FGameplayTag&, EEventBusError& OutError)
+		{
+			OutError = EEventBusError::None;
+			return true;
+		}
+	};
+
+	struct FCompiledOutThreadingPolicy final
+	{
+		FORCEINLINE static bool EnsureThread(const TCHAR*, EEventBusError& OutError)
+		{
+			OutError = EEventBusError::None;
+			return true;
+		}
+	};
+
+	using FCompiledOutPolicies = TEventBusPolicies<FCompiledOutValidationPolicy, FCompiledOutThreadingPolicy>;
+
+	constexpr int32 EntryCheckSamples = 1000;
+	constexpr int32 EntryCheckCallsPerSample = 1000;
+
+	/**
+	 * @brief Samples blocks of EnterChannelCall; OutPassedCount keeps the calls observable to the optimizer.
+	 */
+	template <typename PoliciesType>
+	FBenchmarkResult MeasureEntryChecks(const TCHAR* PolicyName, const FGameplayTag& ChannelTag, int32& OutPassedCount)
+	{
+		FLatencyRecorder Recorder;
+		Recorder.Reset(EntryCheckSamples);
+		OutPassedCount = 0;
+		for (int32 Sample = 0; Sample < EntryCheckSamples; ++Sample)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 Call = 0; Call < EntryCheckCallsPerSample; ++Call)
+			{
+				EEventBusError Error = EEventBusError::None;
+				OutPassedCount += PoliciesType::EnterChannelCall(TEXT("EntryCheckBenchmark"), ChannelTag, Error) ? 1 : 0;
+			}
+			Recorder.Add(FPlatformTime::Cycles64() - StartCycles);
+		}
+
+		FBenchmarkResult Result;
+		Result.Topology = TEXT("EntryCheck");
+		Result.Ownership = PolicyName;
+		Result.Scale = EntryCheckCallsPerSample;
+		Result.Operation = TEXT("EnterChannelCall");
+		Recorder.Summarize(Result);
+		return Result;
+	}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusEntryCheckBenchmarkTest,
+	"EventBus.Perf.Core.EntryChecks",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FEventBusEntryCheckBenchmarkTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	const FGameplayTag ChannelTag = TAG_EventBus_Test_Benchmark;
+	FBenchmarkReport Report;
+	Report.Suite = TEXT("EntryChecks");
+
+	int32 PassedCount = 0;
+	Report.Results.Add(MeasureEntryChecks<FEventBusCheckedPolicies>(TEXT("Checked"), ChannelTag, PassedCount));
+	TestEqual(TEXT("Checked policies pass every call"), PassedCount, EntryCheckSamples * EntryCheckCallsPerSample);
+	Report.Results.Add(MeasureEntryChecks<FEventBusAssertPolicies>(TEXT("Assert"), ChannelTag, PassedCount));
+	TestEqual(TEXT("Assert policies pass every call"), PassedCount, EntryCheckSamples * EntryCheckCallsPerSample);
+	Report.Results.Add(MeasureEntryChecks<FCompiledOutPolicies>(TEXT("CompiledOut"), ChannelTag, PassedCount));
+	TestEqual(TEXT("Compiled-out policies pass every call"), PassedCount, EntryCheckSamples * EntryCheckCallsPerSample);
+
+	const double CheckedNs = Report.Results[0].P50Us * 1000.0 / EntryCheckCallsPerSample;
+	for (const FBenchmarkResult& Result : Report.Results)
+	{
+		const double PerCallNs = Result.P50Us * 1000.0 / EntryCheckCallsPerSample;
+		AddInfo(FString::Printf(TEXT("%s p50=%.3fns/call p99=%.3fns/call saved=%.3fns/call"),
+			*Result.GetKey(),
+			PerCallNs,
+			Result.P99Us * 1000.0 / EntryCheckCallsPerSample,
+			CheckedNs - PerCallNs));
+	}
+
+	const FString OutputDirectory = GetOutputDirectory();
+	TestTrue(TEXT("Entry check report written"), Report.SaveTo(OutputDirectory));
+	return true;
+}
+
+namespace
+{
+	/** @brief Thread counts swept by the contention suite. */
+	constexpr int32 ContentionThreadCounts[] = {8, 16, 32};
+	/** @brief Add, publish and remove rounds each thread runs. */
+	constexpr int32 ContentionRoundsPerThread = 2000;
+
+	const FName ContentionPayloadName(TEXT("int32"));
+
+	/** @brief Cycle samples one worker took per operation; merged after every worker joined. */
+	struct FContentionSamples final
+	{
+		TArray<uint64> Add;
+		TArray<uint64> Publish;
+		TArray<uint64> Remove;
+		bool bSucceeded = true;
+	};
+
+	/**
+	 * @brief Runs ThreadCount workers against one bus with ShardCount shards. Worker N binds, publishes and removes
+	 * on channel N % ChannelTags.Num(), so channels collide on a shard only when ShardCount is small.
+	 */
+	bool MeasureContention(const int32 ShardCount, const int32 ThreadCount, TConstArrayView<FGameplayTag> ChannelTags, FBenchmarkReport& Report)
+	{
+		FConcurrentEventBus Bus(ShardCount);
+		for (const FGameplayTag& ChannelTag : ChannelTags)
+		{
+			if (!Bus.RegisterChannel<int32>(ChannelTag, ContentionPayloadName))
+			{
+				return false;
+			}
+		}
+
+		TArray<FContentionSamples> Samples;
+		Samples.SetNum(ThreadCount);
+		std::atomic<bool> bStart{false};
+		TArray<TFuture<void>> Workers;
+		Workers.Reserve(ThreadCount);
+		for (int32 ThreadIndex = 0; ThreadIndex < ThreadCount; ++ThreadIndex)
+		{
+			Workers.Add(Async(EAsyncExecution::Thread, [&Bus, &bStart, &ThreadSamples = Samples[ThreadIndex], ChannelTag = ChannelTags[ThreadIndex % ChannelTags.Num()]]()
+			{
+				ThreadSamples.Add.Reserve(ContentionRoundsPerThread);
+				ThreadSamples.Publish.Reserve(ContentionRoundsPerThread);
+				ThreadSamples.Remove.Reserve(ContentionRoundsPerThread);
+				while (!bStart.load(std::memory_order_acquire))
+				{
+					FPlatformProcess::Yield();
+				}
+
+				for (int32 Round = 0; Round < ContentionRoundsPerThread; ++Round)
+				{
+					uint64 StartCycles = FPlatformTime::Cycles64();
+					const FConcurrentListenerHandle Handle = Bus.AddListener<int32>(ChannelTag, [](const int32)
+					{
+					});
+					ThreadSamples.Add.Add(FPlatformTime::Cycles64() - StartCycles);
+
+					StartCycles = FPlatformTime::Cycles64();
+					const int32 Delivered = Bus.Publish(ChannelTag, 1);
+					ThreadSamples.Publish.Add(FPlatformTime::Cycles64() - StartCycles);
+
+					StartCycles = FPlatformTime::Cycles64();
+					const bool bRemoved = Bus.RemoveListener(Handle);
+					ThreadSamples.Remove.Add(FPlatformTime::Cycles64() - StartCycles);
+					ThreadSamples.bSucceeded &= Handle.IsValid() && Delivered >= 1 && bRemoved;
+				}
+			}));
+		}
+
+		bStart.store(true, std::memory_order_release);
+		for (TFuture<void>& Worker : Workers)
+		{
+			Worker.Wait();
+		}
+
+		const TCHAR* const Operations[] = {TEXT("Add"), TEXT("Publish"), TEXT("Remove")};
+		TArray<uint64> FContentionSamples::* const Members[] = {&FContentionSamples::Add, &FContentionSamples::Publish, &FContentionSamples::Remove};
+		bool bSucceeded = true;
+		for (int32 OperationIndex = 0; OperationIndex < static_cast<int32>(UE_ARRAY_COUNT(Operations)); ++OperationIndex)
+		{
+			FLatencyRecorder Recorder;
+			Recorder.Reset(ThreadCount * ContentionRoundsPerThread);
+			for (const FContentionSamples& ThreadSamples : Samples)
+			{
+				bSucceeded &= ThreadSamples.bSucceeded;
+				for (const uint64 Cycles : ThreadSamples.*Members[OperationIndex])
+				{
+					Recorder.Add(Cycles);
+				}
+			}
+
+			FBenchmarkResult Result;
+			Result.Topology = TEXT("Threads");
+			Result.Ownership = FString::Printf(TEXT("Shards=%d"), Bus.GetShardCount());
+			Result.Scale = ThreadCount;
+			Result.Operation = Operations[OperationIndex];
+			Recorder.Summarize(Result);
+			Report.Results.Add(MoveTemp(Result));
+		}
+		return bSucceeded;
+	}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusContentionBenchmarkTest,
+	"EventBus.Perf.Concurrent.Contention",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FEventBusContentionBenchmarkTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	const FGameplayTag ChannelTags[] = {
+		TAG_EventBus_Test_Contention0,
+		TAG_EventBus_Test_Contention1,
+		TAG_EventBus_Test_Contention2,
+		TAG_EventBus_Test_Contention3,
+		TAG_EventBus_Test_Contention4,
+		TAG_EventBus_Test_Contention5,
+		TAG_EventBus_Test_Contention6,
+		TAG_EventBus_Test_Contention7
+	};
+
+	FBenchmarkReport Report;
+	Report.Suite = TEXT("Contention");
+	for (const int32 ShardCount : {1, NFL_EVENTBUS_CONCURRENT_SHARDS})
+	{
+		for (const int32 ThreadCount : ContentionThreadCounts)
+		{
+			TestTrue(FString::Printf(TEXT("Contention run Shards=%d Threads=%d"), ShardCount, ThreadCount),
+				MeasureContention(ShardCount, ThreadCount, ChannelTags, Report));
+		}
+	}
+
+	for (const FBenchmarkResult& Result : Report.Results)
+	{
+		AddInfo(FString::Printf(TEXT("%s p50=%.3fus p99=%.3fus max=%.3fus samples=%d"),
+			*Result.GetKey(),
+			Result.P50Us,
+			Result.P99Us,
+			Result.MaxUs,
+			Result.SampleCount));
+	}
+
+	const FString OutputDirectory = GetOutputDirectory();
+	TestTrue(TEXT("Contention report written"), Report.SaveTo(OutputDirectory));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
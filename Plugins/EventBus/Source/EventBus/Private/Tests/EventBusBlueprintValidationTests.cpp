@@ -1,9 +1,15 @@
 #include "Misc/AutomationTest.h"
 
+#include "Misc/ScopeExit.h"
 #include "NativeGameplayTags.h"
+#include "UObject/GarbageCollection.h"
 
 #include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/BP/EventBusBlueprintDiagnostics.h"
+#include "EventBus/BP/EventBusBlueprintLibrary.h"
 #include "EventBus/BP/EventBusRegistryAsset.h"
+#include "EventBus/BP/EventBusSettings.h"
+#include "EventBus/BP/EventBusSubsystem.h"
 #include "Tests/EventBusTestObjects.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
@@ -127,4 +133,301 @@ bool FEventBusBlueprintRegistryBoundedHistoryTest::RunTest(const FString& NFL_EV
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusBlueprintRegistryIndexTest,
+	"EventBus.Blueprint.RegistryIndex",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusBlueprintRegistryIndexTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	UEventBusRegistryAsset* Registry = NewObject<UEventBusRegistryAsset>();
+	const FName Names[] = {TEXT("Zeta"), TEXT("Alpha"), TEXT("Mid"), TEXT("Alpha")};
+	for (const FName Name : Names)
+	{
+		Registry->RecordListenerBinding(TAG_EventBus_Test_BP, UEventBusTestListenerObject::StaticClass(), Name);
+	}
+
+	TestEqual(TEXT("One entry per channel/class"), Registry->ListenerHistory.Num(), 1);
+	const TArray<FName> KnownFunctions = Registry->GetKnownListenerFunctions(TAG_EventBus_Test_BP, UEventBusTestListenerObject::StaticClass());
+	if (TestEqual(TEXT("Duplicate function recorded once"), KnownFunctions.Num(), 3))
+	{
+		TestEqual(TEXT("Sorted first"), KnownFunctions[0], FName(TEXT("Alpha")));
+		TestEqual(TEXT("Sorted second"), KnownFunctions[1], FName(TEXT("Mid")));
+		TestEqual(TEXT("Sorted third"), KnownFunctions[2], FName(TEXT("Zeta")));
+	}
+
+	const FName DelegateName = GET_MEMBER_NAME_CHECKED(UEventBusTestPublisherObject, OnValueChanged);
+	Registry->RecordPublisherBinding(TAG_EventBus_Test_BP, UEventBusTestPublisherObject::StaticClass(), DelegateName);
+	Registry->RecordPublisherBinding(TAG_EventBus_Test_BP, UEventBusTestPublisherObject::StaticClass(), DelegateName);
+	Registry->RecordPublisherBinding(TAG_EventBus_Test_BP_Unknown, UEventBusTestPublisherObject::StaticClass(), DelegateName);
+	TestEqual(TEXT("Publisher entries deduplicated per channel/class/delegate"), Registry->PublisherHistory.Num(), 2);
+
+	FEventBusListenerHistoryEntry EditedEntry;
+	EditedEntry.ChannelTag = TAG_EventBus_Test_BP;
+	EditedEntry.ListenerClass = UEventBusTestListenerObject::StaticClass();
+	EditedEntry.KnownFunctions = {TEXT("Beta"), NAME_None};
+	Registry->ListenerHistory.Add(MoveTemp(EditedEntry));
+	const TArray<FName> MergedFunctions = Registry->GetKnownListenerFunctions(TAG_EventBus_Test_BP, UEventBusTestListenerObject::StaticClass());
+	TestEqual(TEXT("Directly added entry is merged before reindex"), MergedFunctions.Num(), 4);
+
+	Registry->RecordListenerBinding(TAG_EventBus_Test_BP, UEventBusTestListenerObject::StaticClass(), TEXT("Gamma"));
+	const TArray<FName> ReindexedFunctions = Registry->GetKnownListenerFunctions(TAG_EventBus_Test_BP, UEventBusTestListenerObject::StaticClass());
+	TestTrue(TEXT("Reindexed lookup keeps directly added function"), ReindexedFunctions.Contains(FName(TEXT("Beta"))));
+	TestTrue(TEXT("Reindexed lookup keeps new function"), ReindexedFunctions.Contains(FName(TEXT("Gamma"))));
+	TestFalse(TEXT("None is never returned"), ReindexedFunctions.Contains(NAME_None));
+
+	Registry->ResetHistory();
+	TestEqual(TEXT("Reset clears indexed lookups"),
+		Registry->GetKnownListenerFunctions(TAG_EventBus_Test_BP, UEventBusTestListenerObject::StaticClass()).Num(), 0);
+
+	// Same-size edit: the indexed slot now holds another class, so only the edit serial reveals it.
+	Registry->RecordListenerBinding(TAG_EventBus_Test_BP, UEventBusTestListenerObject::StaticClass(), TEXT("Gamma"));
+	Registry->ListenerHistory[0].ListenerClass = UEventBusTestDerivedListenerObject::StaticClass();
+	Registry->MarkHistoryEdited();
+	TestEqual(TEXT("In-place edit moves functions off the old class"),
+		Registry->GetKnownListenerFunctions(TAG_EventBus_Test_BP, UEventBusTestListenerObject::StaticClass()).Num(), 0);
+	Registry->RecordListenerBinding(TAG_EventBus_Test_BP, UEventBusTestDerivedListenerObject::StaticClass(), TEXT("Delta"));
+	const TArray<FName> EditedFunctions = Registry->GetKnownListenerFunctions(TAG_EventBus_Test_BP, UEventBusTestDerivedListenerObject::StaticClass());
+	TestTrue(TEXT("Reindex finds the edited entry"), EditedFunctions.Contains(FName(TEXT("Gamma"))));
+	TestTrue(TEXT("Record after the edit lands on the edited entry"), EditedFunctions.Contains(FName(TEXT("Delta"))));
+	TestEqual(TEXT("Record after the edit adds no duplicate"), Registry->ListenerHistory.Num(), 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusBlueprintRegistryLruTest,
+	"EventBus.Blueprint.RegistryLru",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusBlueprintRegistryLruTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	UEventBusSettings* Settings = GetMutableDefault<UEventBusSettings>();
+	const int32 SavedCapacity = Settings->MaxListenerHistoryEntries;
+	Settings->MaxListenerHistoryEntries = 3;
+	ON_SCOPE_EXIT
+	{
+		Settings->MaxListenerHistoryEntries = SavedCapacity;
+	};
+
+	UClass* const BaseClass = UEventBusTestListenerObject::StaticClass();
+	UClass* const DerivedClass = UEventBusTestDerivedListenerObject::StaticClass();
+	const FName FunctionName = GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValue);
+
+	UEventBusRegistryAsset* Registry = NewObject<UEventBusRegistryAsset>();
+	Registry->RecordListenerBinding(TAG_EventBus_Test_BP, BaseClass, FunctionName);
+	Registry->RecordListenerBinding(TAG_EventBus_Test_BP, DerivedClass, FunctionName);
+	Registry->RecordListenerBinding(TAG_EventBus_Test_BP_Unknown, BaseClass, FunctionName);
+	TestEqual(TEXT("Capacity not yet exceeded"), Registry->GetStats().Evictions, static_cast<uint64>(0));
+
+	TestEqual(TEXT("Lookup refreshes the oldest entry"), Registry->GetKnownListenerFunctions(TAG_EventBus_Test_BP, BaseClass).Num(), 1);
+	Registry->RecordListenerBinding(TAG_EventBus_Test_BP_Unknown, DerivedClass, FunctionName);
+
+	TestEqual(TEXT("History stays at capacity"), Registry->ListenerHistory.Num(), 3);
+	TestEqual(TEXT("One entry evicted"), Registry->GetStats().Evictions, static_cast<uint64>(1));
+	TestEqual(TEXT("Recently used entry survives"), Registry->GetKnownListenerFunctions(TAG_EventBus_Test_BP, BaseClass).Num(), 1);
+	TestEqual(TEXT("Least recently used entry evicted"), Registry->GetKnownListenerFunctions(TAG_EventBus_Test_BP, DerivedClass).Num(), 0);
+	TestEqual(TEXT("Newest entry kept"), Registry->GetKnownListenerFunctions(TAG_EventBus_Test_BP_Unknown, DerivedClass).Num(), 1);
+
+	TestEqual(TEXT("Lookup hits counted"), Registry->GetStats().LookupHits, static_cast<uint64>(3));
+	TestEqual(TEXT("Lookup misses counted"), Registry->GetStats().LookupMisses, static_cast<uint64>(1));
+	Registry->ResetStats();
+	TestEqual(TEXT("ResetStats clears counters"), Registry->GetStats().LookupHits, static_cast<uint64>(0));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusBlueprintRegistryGcKeepsRecencyTest,
+	"EventBus.Blueprint.RegistryGcKeepsRecency",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusBlueprintRegistryGcKeepsRecencyTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	UEventBusSettings* Settings = GetMutableDefault<UEventBusSettings>();
+	const int32 SavedCapacity = Settings->MaxListenerHistoryEntries;
+	Settings->MaxListenerHistoryEntries = 3;
+
+	UClass* const BaseClass = UEventBusTestListenerObject::StaticClass();
+	UClass* const DerivedClass = UEventBusTestDerivedListenerObject::StaticClass();
+	const FName FunctionName = GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValue);
+
+	UEventBusRegistryAsset* Registry = NewObject<UEventBusRegistryAsset>();
+	Registry->AddToRoot();
+	Registry->EnableGarbageCollectPruning();
+	ON_SCOPE_EXIT
+	{
+		Settings->MaxListenerHistoryEntries = SavedCapacity;
+		Registry->RemoveFromRoot();
+	};
+
+	Registry->RecordListenerBinding(TAG_EventBus_Test_BP, BaseClass, FunctionName);
+	Registry->RecordListenerBinding(TAG_EventBus_Test_BP, DerivedClass, FunctionName);
+	Registry->RecordListenerBinding(TAG_EventBus_Test_BP_Unknown, BaseClass, FunctionName);
+	TestEqual(TEXT("Lookup refreshes the oldest entry"), Registry->GetKnownListenerFunctions(TAG_EventBus_Test_BP, BaseClass).Num(), 1);
+
+	CollectGarbage(RF_NoFlags);
+	TestEqual(TEXT("Live classes survive the GC prune"), Registry->ListenerHistory.Num(), 3);
+
+	Registry->RecordListenerBinding(TAG_EventBus_Test_BP_Unknown, DerivedClass, FunctionName);
+	TestEqual(TEXT("History stays at capacity"), Registry->ListenerHistory.Num(), 3);
+	TestEqual(TEXT("Entry touched before GC survives the overfill"), Registry->GetKnownListenerFunctions(TAG_EventBus_Test_BP, BaseClass).Num(), 1);
+	TestEqual(TEXT("Least recently used entry evicted"), Registry->GetKnownListenerFunctions(TAG_EventBus_Test_BP, DerivedClass).Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusBlueprintRegistryCopyTest,
+	"EventBus.Blueprint.RegistryCopy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusBlueprintRegistryCopyTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	UClass* const ListenerClass = UEventBusTestListenerObject::StaticClass();
+	const FName FunctionName = GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValue);
+
+	UEventBusRegistryAsset* Baked = NewObject<UEventBusRegistryAsset>();
+	Baked->RecordListenerBinding(TAG_EventBus_Test_BP, ListenerClass, FunctionName);
+	Baked->RecordPublisherBinding(TAG_EventBus_Test_BP, UEventBusTestPublisherObject::StaticClass(), TEXT("OnValueChanged"));
+
+	UEventBusRegistryAsset* Runtime = NewObject<UEventBusRegistryAsset>();
+	Runtime->RecordListenerBinding(TAG_EventBus_Test_BP_Unknown, ListenerClass, FunctionName);
+	Runtime->CopyHistoryFrom(*Baked);
+
+	TestEqual(TEXT("Copy replaces listener history"), Runtime->ListenerHistory.Num(), 1);
+	TestEqual(TEXT("Copy replaces publisher history"), Runtime->PublisherHistory.Num(), 1);
+	TestEqual(TEXT("Copied entry is indexed"), Runtime->GetKnownListenerFunctions(TAG_EventBus_Test_BP, ListenerClass).Num(), 1);
+	TestEqual(TEXT("Previous entry dropped"), Runtime->GetKnownListenerFunctions(TAG_EventBus_Test_BP_Unknown, ListenerClass).Num(), 0);
+
+	Runtime->RecordListenerBinding(TAG_EventBus_Test_BP, ListenerClass, GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValueAlt));
+	TestEqual(TEXT("Recording merges into copied entry"), Runtime->ListenerHistory.Num(), 1);
+	TestEqual(TEXT("Source is untouched"), Baked->ListenerHistory[0].KnownFunctions.Num(), 1);
+
+	UEventBusSettings* Settings = GetMutableDefault<UEventBusSettings>();
+	const bool bSavedRecord = Settings->bRecordRuntimeHistory;
+	ON_SCOPE_EXIT
+	{
+		Settings->bRecordRuntimeHistory = bSavedRecord;
+	};
+	Settings->bRecordRuntimeHistory = false;
+	TestFalse(TEXT("Recording can be disabled"), UEventBusRegistryAsset::IsRecordingEnabled());
+	Settings->bRecordRuntimeHistory = true;
+	TestEqual(TEXT("Recording follows the build flag"), UEventBusRegistryAsset::IsRecordingEnabled(), NFL_EVENTBUS_RUNTIME_HISTORY != 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusBlueprintRegistryBakedPathsTest,
+	"EventBus.Blueprint.RegistryBakedPaths",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusBlueprintRegistryBakedPathsTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	UClass* const BaseClass = UEventBusTestListenerObject::StaticClass();
+	UClass* const DerivedClass = UEventBusTestDerivedListenerObject::StaticClass();
+	const FName FunctionName = GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValue);
+	const FName AltFunctionName = GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValueAlt);
+
+	UEventBusRegistryAsset* Scratch = NewObject<UEventBusRegistryAsset>();
+	Scratch->RecordListenerBinding(TAG_EventBus_Test_BP, BaseClass, FunctionName);
+	Scratch->RecordPublisherBinding(TAG_EventBus_Test_BP, UEventBusTestPublisherObject::StaticClass(), TEXT("OnValueChanged"));
+
+	UEventBusRegistryAsset* Baked = NewObject<UEventBusRegistryAsset>();
+	Baked->BakeFrom(*Scratch);
+	TestEqual(TEXT("Bake keeps no class references"), Baked->ListenerHistory.Num(), 0);
+	TestEqual(TEXT("Bake writes one publisher path"), Baked->BakedPublishers.Num(), 1);
+	if (TestEqual(TEXT("Bake writes one listener path"), Baked->BakedListeners.Num(), 1))
+	{
+		TestTrue(TEXT("Listener class stored as its path"), Baked->BakedListeners[0].ListenerClassPath == FSoftClassPath(BaseClass));
+	}
+
+	UEventBusRegistryAsset* Runtime = NewObject<UEventBusRegistryAsset>();
+	Runtime->RecordListenerBinding(TAG_EventBus_Test_BP, DerivedClass, FunctionName);
+	Runtime->SetBakedSource(Baked);
+	TestEqual(TEXT("Lookup miss falls back to the baked entry"), Runtime->GetKnownListenerFunctions(TAG_EventBus_Test_BP, BaseClass).Num(), 1);
+	TestEqual(TEXT("Fallback adds no runtime entry"), Runtime->ListenerHistory.Num(), 1);
+	TestEqual(TEXT("Runtime entries answer first"), Runtime->GetKnownListenerFunctions(TAG_EventBus_Test_BP, DerivedClass).Num(), 1);
+
+	Runtime->RecordListenerBinding(TAG_EventBus_Test_BP, BaseClass, AltFunctionName);
+	Runtime->SetBakedSource(nullptr);
+	const TArray<FName> SeededFunctions = Runtime->GetKnownListenerFunctions(TAG_EventBus_Test_BP, BaseClass);
+	TestTrue(TEXT("New runtime entry is seeded with baked functions"), SeededFunctions.Contains(FunctionName));
+	TestTrue(TEXT("New runtime entry keeps the recorded function"), SeededFunctions.Contains(AltFunctionName));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusBlueprintFacadeCountersTest,
+	"EventBus.Blueprint.FacadeCounters",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusBlueprintFacadeCountersTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	TestTrue(TEXT("Verbose logs every call"), FEventBusBlueprintDiagnostics::ShouldLogCall(7, EEventBusBlueprintLogMode::Verbose, 256));
+	TestFalse(TEXT("Off logs nothing"), FEventBusBlueprintDiagnostics::ShouldLogCall(1, EEventBusBlueprintLogMode::Off, 256));
+	TestTrue(TEXT("Sampled logs the first call"), FEventBusBlueprintDiagnostics::ShouldLogCall(1, EEventBusBlueprintLogMode::Sampled, 4));
+	TestFalse(TEXT("Sampled skips calls inside the interval"), FEventBusBlueprintDiagnostics::ShouldLogCall(4, EEventBusBlueprintLogMode::Sampled, 4));
+	TestTrue(TEXT("Sampled logs one call per interval"), FEventBusBlueprintDiagnostics::ShouldLogCall(5, EEventBusBlueprintLogMode::Sampled, 4));
+
+	FEventBusBlueprintDiagnostics::ResetCounters();
+	UEventBusRegistryAsset* Registry = NewObject<UEventBusRegistryAsset>();
+	Registry->RecordListenerBinding(
+		TAG_EventBus_Test_BP,
+		UEventBusTestListenerObject::StaticClass(),
+		GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValue));
+
+	AddExpectedError(TEXT("RecordListenerBinding invalid input"), EAutomationExpectedErrorFlags::Contains, 1);
+	Registry->RecordListenerBinding(TAG_EventBus_Test_BP, nullptr, NAME_None);
+
+	const FEventBusBlueprintApiCounters Counters = FEventBusBlueprintDiagnostics::GetCounters(EEventBusBlueprintApi::RecordListenerBinding);
+	TestEqual(TEXT("Every call counted"), Counters.Calls, static_cast<uint64>(2));
+	TestEqual(TEXT("Rejected call counted as failure"), Counters.Failures, static_cast<uint64>(1));
+	TestTrue(TEXT("Logged calls never exceed calls"), Counters.LoggedCalls <= Counters.Calls);
+	TestEqual(TEXT("Other entry points untouched"),
+		FEventBusBlueprintDiagnostics::GetCounters(EEventBusBlueprintApi::RecordPublisherBinding).Calls, static_cast<uint64>(0));
+
+	FEventBusBlueprintDiagnostics::ResetCounters();
+	TestEqual(TEXT("Reset clears counters"),
+		FEventBusBlueprintDiagnostics::GetCounters(EEventBusBlueprintApi::RecordListenerBinding).Calls, static_cast<uint64>(0));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusBlueprintBindingHandleTest,
+	"EventBus.Blueprint.BindingHandles",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusBlueprintBindingHandleTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	UEventBusSubsystem::ResetCache();
+	TestNull(TEXT("Null world never hits the cache"), UEventBusSubsystem::FindCachedForWorld(nullptr));
+	TestEqual(TEXT("Null world lookup counted as miss"), UEventBusSubsystem::GetCacheStats().Misses, static_cast<uint64>(1));
+	TestEqual(TEXT("Nothing cached"), UEventBusSubsystem::GetCacheStats().NumWorlds, 0);
+
+	FEventBusBindingHandle EmptyHandle;
+	TestFalse(TEXT("Default handle is invalid"), UEventBusBlueprintLibrary::IsBindingHandleValid(EmptyHandle));
+	AddExpectedError(TEXT("RemoveBindingByHandle denied"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("Removing through an empty handle fails"), UEventBusBlueprintLibrary::RemoveBindingByHandle(EmptyHandle));
+
+	UEventBusTestListenerObject* Listener = NewObject<UEventBusTestListenerObject>();
+	AddExpectedError(TEXT("ResolveEventBusSubsystem failed"), EAutomationExpectedErrorFlags::Contains, 1);
+	AddExpectedError(TEXT("AddListenerWithHandle denied"), EAutomationExpectedErrorFlags::Contains, 1);
+	const FEventBusBindingHandle FailedHandle = UEventBusBlueprintLibrary::AddListenerWithHandle(
+		nullptr,
+		TAG_EventBus_Test_BP,
+		Listener,
+		GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValue));
+	TestFalse(TEXT("Failed bind returns an invalid handle"), FailedHandle.IsValid());
+
+	FEventBusBindingHandle OrphanHandle;
+	OrphanHandle.ChannelTag = TAG_EventBus_Test_BP;
+	OrphanHandle.BoundObject = Listener;
+	OrphanHandle.MemberName = GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValue);
+	OrphanHandle.bIsListener = true;
+	TestFalse(TEXT("Handle without a live subsystem is invalid"), OrphanHandle.IsValid());
+
+	UEventBusSubsystem::ResetCache();
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
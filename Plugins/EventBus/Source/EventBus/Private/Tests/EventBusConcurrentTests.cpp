@@ -0,0 +1,191 @@
+#include "Misc/AutomationTest.h"
+
+#include "Async/Async.h"
+#include "NativeGameplayTags.h"
+
+#include "EventBus/Core/ConcurrentEventBus.h"
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBusSnapshots.h"
+
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Concurrent, "EventBus.Test.Concurrent");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_ConcurrentOther, "EventBus.Test.ConcurrentOther");
+
+namespace
+{
+	const FName ConcurrentTestPayloadName(TEXT("int32"));
+
+	/** @brief Flags its own destruction so grace-period tests can observe reclamation. */
+	struct FEpochTestObject final
+	{
+		explicit FEpochTestObject(bool& bInDestroyed)
+			: bDestroyed(bInDestroyed)
+		{
+		}
+
+		~FEpochTestObject()
+		{
+			bDestroyed = true;
+		}
+
+		bool& bDestroyed;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusEpochDomainTest,
+	"EventBus.Concurrent.EpochGracePeriod",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusEpochDomainTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	FEventBusEpochDomain Domain;
+	bool bFirstDestroyed = false;
+	bool bSecondDestroyed = false;
+	{
+		const FEventBusEpochDomain::FReadScope ReadScope(Domain);
+		Domain.Retire(new FEpochTestObject(bFirstDestroyed));
+		TestFalse(TEXT("Object survives while a reader is active"), bFirstDestroyed);
+		TestEqual(TEXT("Object waits in the retired list"), Domain.GetRetiredCount(), 1);
+	}
+
+	Domain.Reclaim();
+	TestTrue(TEXT("Object is reclaimed after the reader leaves"), bFirstDestroyed);
+	TestEqual(TEXT("Retired list is empty"), Domain.GetRetiredCount(), 0);
+
+	Domain.Retire(new FEpochTestObject(bSecondDestroyed));
+	TestTrue(TEXT("Retire without readers reclaims at once"), bSecondDestroyed);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusSnapshotPoolTest,
+	"EventBus.Concurrent.SnapshotPoolReuse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusSnapshotPoolTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	TEventBusSnapshotPool<int32> Pool;
+	FEventBusEpochDomain Domain;
+	TEventBusSnapshotCell<int32> Cell;
+	Cell.Publish(Pool.Acquire(1), Domain, Pool);
+	const int32* const First = Cell.Load();
+	{
+		const FEventBusEpochDomain::FReadScope ReadScope(Domain);
+		Cell.Publish(Pool.Acquire(2), Domain, Pool);
+		TestEqual(TEXT("Replaced snapshot is not pooled while a reader is active"), Pool.Num(), 0);
+	}
+
+	Domain.Reclaim();
+	TestEqual(TEXT("Replaced snapshot returns to the pool"), Pool.Num(), 1);
+	const int32* const Reused = Pool.Acquire(3);
+	TestTrue(TEXT("Acquire reuses the pooled object"), Reused == First);
+	TestEqual(TEXT("Reused object takes the new value"), *Reused, 3);
+	Cell.Publish(Reused, Domain, Pool);
+	TestEqual(TEXT("Cell reads the newest value"), *Cell.Load(), 3);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusConcurrentBasicsTest,
+	"EventBus.Concurrent.RegisterPublishRemove",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusConcurrentBasicsTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	FConcurrentEventBus Bus(4);
+	TestEqual(TEXT("Shard count is kept"), Bus.GetShardCount(), 4);
+	TestTrue(TEXT("Register succeeds"), Bus.RegisterChannel<int32>(TAG_EventBus_Test_Concurrent, ConcurrentTestPayloadName));
+	TestTrue(TEXT("Register is idempotent"), Bus.RegisterChannel<int32>(TAG_EventBus_Test_Concurrent, ConcurrentTestPayloadName));
+	AddExpectedError(TEXT("RegisterConcurrentChannel failed"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("Register with another payload fails"), Bus.RegisterChannel<float>(TAG_EventBus_Test_Concurrent, ConcurrentTestPayloadName));
+	TestTrue(TEXT("Channel reads as registered"), Bus.IsChannelRegistered(TAG_EventBus_Test_Concurrent));
+	TestFalse(TEXT("Other channel reads as missing"), Bus.IsChannelRegistered(TAG_EventBus_Test_ConcurrentOther));
+
+	int32 Sum = 0;
+	const FConcurrentListenerHandle Handle = Bus.AddListener<int32>(TAG_EventBus_Test_Concurrent, [&Sum](const int32 Value)
+	{
+		Sum += Value;
+	});
+	TestTrue(TEXT("AddListener returns a valid handle"), Handle.IsValid());
+	TestEqual(TEXT("Listener is counted"), Bus.GetListenerCount(TAG_EventBus_Test_Concurrent), 1);
+	TestEqual(TEXT("Publish reaches one listener"), Bus.Publish(TAG_EventBus_Test_Concurrent, 5), 1);
+	TestEqual(TEXT("Payload delivered"), Sum, 5);
+
+	AddExpectedError(TEXT("ConcurrentPublish failed"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestEqual(TEXT("Publish with another payload reaches nobody"), Bus.Publish(TAG_EventBus_Test_Concurrent, 1.0f), 0);
+	AddExpectedError(TEXT("AddConcurrentListener failed"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("AddListener with another payload fails"), Bus.AddListener<float>(TAG_EventBus_Test_Concurrent, [](const float)
+	{
+	}).IsValid());
+
+	TestTrue(TEXT("RemoveListener succeeds"), Bus.RemoveListener(Handle));
+	TestFalse(TEXT("Second remove fails"), Bus.RemoveListener(Handle));
+	TestEqual(TEXT("Publish after remove reaches nobody"), Bus.Publish(TAG_EventBus_Test_Concurrent, 7), 0);
+	TestEqual(TEXT("Removed listener is not called"), Sum, 5);
+	TestTrue(TEXT("Unregister succeeds"), Bus.UnregisterChannel(TAG_EventBus_Test_Concurrent));
+	TestFalse(TEXT("Channel is gone"), Bus.IsChannelRegistered(TAG_EventBus_Test_Concurrent));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusConcurrentWorkerThreadsTest,
+	"EventBus.Concurrent.WorkerThreads",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusConcurrentWorkerThreadsTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	constexpr int32 WorkerCount = 8;
+	constexpr int32 PublishesPerWorker = 2000;
+
+	FConcurrentEventBus Bus;
+	TestTrue(TEXT("Register succeeds"), Bus.RegisterChannel<int32>(TAG_EventBus_Test_Concurrent, ConcurrentTestPayloadName));
+
+	std::atomic<int64> PersistentSum{0};
+	const FConcurrentListenerHandle Persistent = Bus.AddListener<int32>(TAG_EventBus_Test_Concurrent, [&PersistentSum](const int32 Value)
+	{
+		PersistentSum.fetch_add(Value, std::memory_order_relaxed);
+	});
+
+	TArray<TFuture<bool>> Workers;
+	for (int32 WorkerIndex = 0; WorkerIndex < WorkerCount; ++WorkerIndex)
+	{
+		Workers.Add(Async(EAsyncExecution::Thread, [&Bus]()
+		{
+			bool bAllSucceeded = Bus.IsChannelRegistered(TAG_EventBus_Test_Concurrent);
+			for (int32 Publish = 0; Publish < PublishesPerWorker; ++Publish)
+			{
+				const FConcurrentListenerHandle Transient = Bus.AddListener<int32>(TAG_EventBus_Test_Concurrent, [](const int32)
+				{
+				});
+				bAllSucceeded &= Transient.IsValid();
+				bAllSucceeded &= Bus.Publish(TAG_EventBus_Test_Concurrent, 1) >= 1;
+				bAllSucceeded &= Bus.RemoveListener(Transient);
+			}
+			return bAllSucceeded;
+		}));
+	}
+
+	for (TFuture<bool>& Worker : Workers)
+	{
+		TestTrue(TEXT("Worker binds, publishes and removes"), Worker.Get());
+	}
+
+	TestEqual(TEXT("Persistent listener heard every publish"), PersistentSum.load(), static_cast<int64>(WorkerCount * PublishesPerWorker));
+	TestEqual(TEXT("Only the persistent listener remains"), Bus.GetListenerCount(TAG_EventBus_Test_Concurrent), 1);
+	TestTrue(TEXT("Persistent listener removes"), Bus.RemoveListener(Persistent));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -3,6 +3,7 @@
 #include "Async/Async.h"
 #include "NativeGameplayTags.h"
 #include "UObject/GarbageCollection.h"
+#include "UObject/UnrealType.h"
 
 #include "EventBus/Core/EventBusAttributes.h"
 #include "EventBus/Core/EventBus.h"
@@ -20,6 +21,12 @@ UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_OwningMultiFunc, "EventBus.Test.
 UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_NonOwningSelective, "EventBus.Test.NonOwningSelective");
 UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_RemovePublisherStopsDispatch, "EventBus.Test.RemovePublisherStopsDispatch");
 UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_ChannelRequiredBeforeBind, "EventBus.Test.ChannelRequiredBeforeBind");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_BulkA, "EventBus.Test.BulkA");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_BulkB, "EventBus.Test.BulkB");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_BulkUnregistered, "EventBus.Test.BulkUnregistered");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Trusted, "EventBus.Test.Trusted");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Topology, "EventBus.Test.Topology");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Presence, "EventBus.Test.Presence");
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 	FEventBusCoreRegisterUnregisterTest,
@@ -191,11 +198,11 @@ bool FEventBusListenerIdentityRenameSafeTest::RunTest(const FString& NFL_EVENTBU
 }
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
-	FEventBusThreadGuardIsChannelRegisteredTest,
-	"EventBus.Core.ThreadGuardIsChannelRegistered",
+	FEventBusIsChannelRegisteredOffThreadTest,
+	"EventBus.Core.IsChannelRegisteredOffThread",
 	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
 
-bool FEventBusThreadGuardIsChannelRegisteredTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+bool FEventBusIsChannelRegisteredOffThreadTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
 {
 	using namespace Nfrrlib::EventBus;
 
@@ -204,12 +211,182 @@ bool FEventBusThreadGuardIsChannelRegisteredTest::RunTest(const FString& NFL_EVE
 	Registration.ChannelTag = TAG_EventBus_Test_ThreadGuard;
 	TestTrue(TEXT("Register channel succeeds"), Bus.RegisterChannel(Registration));
 
-	const bool bOffThreadResult = Async(EAsyncExecution::ThreadPool, [&Bus]()
+	const auto IsRegisteredOffThread = [&Bus]()
 	{
-		return Bus.IsChannelRegistered(TAG_EventBus_Test_ThreadGuard);
+		return Async(EAsyncExecution::ThreadPool, [&Bus]()
+		{
+			return Bus.IsChannelRegistered(TAG_EventBus_Test_ThreadGuard);
+		}).Get();
+	};
+
+	TestTrue(TEXT("IsChannelRegistered reads the topology snapshot off-thread"), IsRegisteredOffThread());
+	TestTrue(TEXT("Unregister channel succeeds"), Bus.UnregisterChannel(TAG_EventBus_Test_ThreadGuard));
+	TestFalse(TEXT("Unregistered channel reads as missing off-thread"), IsRegisteredOffThread());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusTopologySnapshotTest,
+	"EventBus.Core.TopologySnapshot",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusTopologySnapshotTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	FEventBus Bus;
+	FEventChannelTopology Topology;
+	TestFalse(TEXT("Unregistered channel has no topology"), Bus.GetChannelTopology(TAG_EventBus_Test_Topology, Topology));
+
+	FChannelRegistration Registration;
+	Registration.ChannelTag = TAG_EventBus_Test_Topology;
+	Registration.bOwnsPublisherDelegates = true;
+	TestTrue(TEXT("Register channel succeeds"), Bus.RegisterChannel(Registration));
+	TestTrue(TEXT("Registered channel has topology"), Bus.GetChannelTopology(TAG_EventBus_Test_Topology, Topology));
+	TestTrue(TEXT("Ownership flag is published"), EnumHasAnyFlags(Topology.Flags, EEventChannelTopologyFlags::OwnsPublisherDelegates));
+	TestTrue(TEXT("Signature is unknown before a publisher joins"), Topology.SignatureName.IsNone());
+
+	UEventBusTestPublisherObject* Publisher = NewObject<UEventBusTestPublisherObject>();
+	UEventBusTestListenerObject* Listener = NewObject<UEventBusTestListenerObject>();
+	FPublisherBinding PublisherBinding;
+	PublisherBinding.DelegatePropertyName = GET_MEMBER_NAME_CHECKED(UEventBusTestPublisherObject, OnValueChanged);
+	FListenerBinding ListenerBinding;
+	ListenerBinding.FunctionName = GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValue);
+	TestTrue(TEXT("AddPublisher succeeds"), Bus.AddPublisher(TAG_EventBus_Test_Topology, Publisher, PublisherBinding));
+	TestTrue(TEXT("AddListener succeeds"), Bus.AddListener(TAG_EventBus_Test_Topology, Listener, ListenerBinding));
+
+	const FEventChannelTopology OffThreadTopology = Async(EAsyncExecution::ThreadPool, [&Bus]()
+	{
+		FEventChannelTopology Result;
+		const bool bFound = Bus.GetChannelTopology(TAG_EventBus_Test_Topology, Result);
+		return bFound ? Result : FEventChannelTopology();
 	}).Get();
 
-	TestFalse(TEXT("IsChannelRegistered returns false off-thread"), bOffThreadResult);
+	const FMulticastDelegateProperty* DelegateProperty = FindFProperty<FMulticastDelegateProperty>(
+		UEventBusTestPublisherObject::StaticClass(),
+		GET_MEMBER_NAME_CHECKED(UEventBusTestPublisherObject, OnValueChanged));
+	TestEqual(TEXT("Worker sees the channel"), OffThreadTopology.ChannelTag, TAG_EventBus_Test_Topology.GetTag());
+	TestEqual(TEXT("Worker sees one publisher"), OffThreadTopology.PublisherCount, 1);
+	TestEqual(TEXT("Worker sees one listener"), OffThreadTopology.ListenerCount, 1);
+	TestEqual(TEXT("Worker sees the delegate signature"), OffThreadTopology.SignatureName, DelegateProperty->SignatureFunction->GetFName());
+	TestFalse(TEXT("Delegate channel is not native"), OffThreadTopology.IsNative());
+
+	TestTrue(TEXT("RemoveListener succeeds"), Bus.RemoveListener(TAG_EventBus_Test_Topology, Listener, ListenerBinding));
+	TestTrue(TEXT("Topology still present"), Bus.GetChannelTopology(TAG_EventBus_Test_Topology, Topology));
+	TestEqual(TEXT("Listener removal is published"), Topology.ListenerCount, 0);
+
+	Bus.Reset();
+	TestFalse(TEXT("Reset drops every topology"), Bus.GetChannelTopology(TAG_EventBus_Test_Topology, Topology));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusPresenceCallbacksTest,
+	"EventBus.Core.PresenceCallbacks",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusPresenceCallbacksTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	FEventBus Bus;
+	TArray<bool> Changes;
+	const FDelegateHandle Handle = Bus.AddPresenceCallback(TAG_EventBus_Test_Presence,
+		FOnChannelPresenceChanged::FDelegate::CreateLambda([&Changes](const FGameplayTag&, const bool bHasListeners)
+		{
+			Changes.Add(bHasListeners);
+		}));
+	TestTrue(TEXT("Callback subscribes before registration"), Handle.IsValid());
+
+	AddExpectedError(TEXT("AddPresenceCallback failed"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("Unbound callback is rejected"),
+		Bus.AddPresenceCallback(TAG_EventBus_Test_Presence, FOnChannelPresenceChanged::FDelegate()).IsValid());
+
+	FChannelRegistration Registration;
+	Registration.ChannelTag = TAG_EventBus_Test_Presence;
+	TestTrue(TEXT("Register channel succeeds"), Bus.RegisterChannel(Registration));
+	TestEqual(TEXT("Registration alone does not notify"), Changes.Num(), 0);
+	TestFalse(TEXT("New channel has no listeners"), Bus.HasListeners(TAG_EventBus_Test_Presence));
+
+	UEventBusTestListenerObject* FirstListener = NewObject<UEventBusTestListenerObject>();
+	UEventBusTestListenerObject* SecondListener = NewObject<UEventBusTestListenerObject>();
+	FListenerBinding ListenerBinding;
+	ListenerBinding.FunctionName = GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValue);
+
+	TestTrue(TEXT("First AddListener succeeds"), Bus.AddListener(TAG_EventBus_Test_Presence, FirstListener, ListenerBinding));
+	TestEqual(TEXT("First listener notifies once"), Changes.Num(), 1);
+	TestTrue(TEXT("First notification reports presence"), Changes.Num() == 1 && Changes[0]);
+	TestTrue(TEXT("HasListeners after first add"), Bus.HasListeners(TAG_EventBus_Test_Presence));
+	TestTrue(TEXT("Worker sees listeners"), Async(EAsyncExecution::ThreadPool, [&Bus]()
+	{
+		return Bus.HasListeners(TAG_EventBus_Test_Presence);
+	}).Get());
+
+	TestTrue(TEXT("Second AddListener succeeds"), Bus.AddListener(TAG_EventBus_Test_Presence, SecondListener, ListenerBinding));
+	TestTrue(TEXT("Second RemoveListener succeeds"), Bus.RemoveListener(TAG_EventBus_Test_Presence, SecondListener, ListenerBinding));
+	TestEqual(TEXT("Counts above zero do not notify"), Changes.Num(), 1);
+
+	TestTrue(TEXT("Last RemoveListener succeeds"), Bus.RemoveListener(TAG_EventBus_Test_Presence, FirstListener, ListenerBinding));
+	TestEqual(TEXT("Last listener notifies"), Changes.Num(), 2);
+	TestTrue(TEXT("Second notification reports absence"), Changes.Num() == 2 && !Changes[1]);
+	TestFalse(TEXT("Worker sees no listeners"), Async(EAsyncExecution::ThreadPool, [&Bus]()
+	{
+		return Bus.HasListeners(TAG_EventBus_Test_Presence);
+	}).Get());
+
+	TestTrue(TEXT("Listener rejoins"), Bus.AddListener(TAG_EventBus_Test_Presence, FirstListener, ListenerBinding));
+	TestTrue(TEXT("Unregister succeeds"), Bus.UnregisterChannel(TAG_EventBus_Test_Presence));
+	TestEqual(TEXT("Unregister with listeners notifies absence"), Changes.Num(), 4);
+	TestTrue(TEXT("Unregister notification reports absence"), Changes.Num() == 4 && !Changes[3]);
+	TestFalse(TEXT("Unregistered channel has no listeners"), Bus.HasListeners(TAG_EventBus_Test_Presence));
+
+	TestTrue(TEXT("RemovePresenceCallback succeeds"), Bus.RemovePresenceCallback(TAG_EventBus_Test_Presence, Handle));
+	TestFalse(TEXT("Second RemovePresenceCallback fails"), Bus.RemovePresenceCallback(TAG_EventBus_Test_Presence, Handle));
+	TestTrue(TEXT("Register channel again succeeds"), Bus.RegisterChannel(Registration));
+	TestTrue(TEXT("AddListener after unsubscribe succeeds"), Bus.AddListener(TAG_EventBus_Test_Presence, FirstListener, ListenerBinding));
+	TestEqual(TEXT("Unsubscribed callback is silent"), Changes.Num(), 4);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusPresenceDeadListenerTest,
+	"EventBus.Core.PresenceDropsCollectedListeners",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusPresenceDeadListenerTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	FEventBus Bus;
+	TArray<bool> Changes;
+	const FDelegateHandle Handle = Bus.AddPresenceCallback(TAG_EventBus_Test_Presence,
+		FOnChannelPresenceChanged::FDelegate::CreateLambda([&Changes](const FGameplayTag&, const bool bHasListeners)
+		{
+			Changes.Add(bHasListeners);
+		}));
+
+	FChannelRegistration Registration;
+	Registration.ChannelTag = TAG_EventBus_Test_Presence;
+	TestTrue(TEXT("Register channel succeeds"), Bus.RegisterChannel(Registration));
+
+	UEventBusTestListenerObject* Listener = NewObject<UEventBusTestListenerObject>();
+	FListenerBinding ListenerBinding;
+	ListenerBinding.FunctionName = GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValue);
+	TestTrue(TEXT("AddListener succeeds"), Bus.AddListener(TAG_EventBus_Test_Presence, Listener, ListenerBinding));
+	TestEqual(TEXT("Listener notifies presence"), Changes.Num(), 1);
+
+	Listener->MarkAsGarbage();
+	CollectGarbage(RF_NoFlags);
+	TestFalse(TEXT("Collected listener is not counted"), Bus.HasListeners(TAG_EventBus_Test_Presence));
+	TestEqual(TEXT("Sweep drops the collected listener"), Bus.SweepStaleBindings(), 1);
+	TestEqual(TEXT("Sweep notifies absence"), Changes.Num(), 2);
+	TestTrue(TEXT("Absence is reported"), Changes.Num() == 2 && !Changes[1]);
+
+	FEventChannelTopology Topology;
+	TestTrue(TEXT("Topology still present"), Bus.GetChannelTopology(TAG_EventBus_Test_Presence, Topology));
+	TestEqual(TEXT("Topology counts no listeners"), Topology.ListenerCount, 0);
+	TestEqual(TEXT("Second sweep drops nothing"), Bus.SweepStaleBindings(), 0);
+	TestTrue(TEXT("RemovePresenceCallback succeeds"), Bus.RemovePresenceCallback(TAG_EventBus_Test_Presence, Handle));
 	return true;
 }
 
@@ -372,4 +549,140 @@ bool FEventBusRemovePublisherStopsDispatchTest::RunTest(const FString& NFL_EVENT
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusBulkBindingTest,
+	"EventBus.Core.BulkBinding",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusBulkBindingTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	FEventBus Bus;
+	const FChannelRegistration Registrations[] = {{TAG_EventBus_Test_BulkA}, {TAG_EventBus_Test_BulkB}};
+	TestTrue(TEXT("Register channels succeeds"), Bus.RegisterChannels(Registrations));
+
+	UEventBusTestPublisherObject* Publisher = NewObject<UEventBusTestPublisherObject>();
+	UEventBusTestListenerObject* Listener = NewObject<UEventBusTestListenerObject>();
+	const FName DelegateName = GET_MEMBER_NAME_CHECKED(UEventBusTestPublisherObject, OnValueChanged);
+	const FName FunctionName = GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValue);
+	const FName AltFunctionName = GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValueAlt);
+
+	const FChannelPublisherBinding PublisherBindings[] = {
+		{TAG_EventBus_Test_BulkA, {DelegateName}},
+		{TAG_EventBus_Test_BulkB, {DelegateName}}
+	};
+	TArray<bool> Results;
+	TestEqual(TEXT("Publisher joins both channels"), Bus.AddPublishers(Publisher, PublisherBindings, Results), 2);
+	TestEqual(TEXT("One publisher result per entry"), Results.Num(), 2);
+
+	const FChannelListenerBinding ListenerBindings[] = {
+		{TAG_EventBus_Test_BulkA, {FunctionName}},
+		{TAG_EventBus_Test_BulkB, {AltFunctionName}},
+		{TAG_EventBus_Test_BulkUnregistered, {FunctionName}}
+	};
+	AddExpectedError(TEXT("AddListener failed"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestEqual(TEXT("Listener joins registered channels only"), Bus.AddListeners(Listener, ListenerBindings, Results), 2);
+	if (TestEqual(TEXT("One listener result per entry"), Results.Num(), 3))
+	{
+		TestTrue(TEXT("First entry succeeds"), Results[0]);
+		TestTrue(TEXT("Second entry succeeds"), Results[1]);
+		TestFalse(TEXT("Unregistered entry fails"), Results[2]);
+	}
+
+	Publisher->EmitValue(1.0f);
+	TestEqual(TEXT("First channel function called"), Listener->ValueCallCount, 1);
+	TestEqual(TEXT("Second channel function called"), Listener->ValueAltCallCount, 1);
+
+	TestEqual(TEXT("Bulk remove drops both bindings"), Bus.RemoveListeners(Listener, ListenerBindings, Results), 2);
+	Publisher->EmitValue(2.0f);
+	TestEqual(TEXT("First function silent after bulk remove"), Listener->ValueCallCount, 1);
+	TestEqual(TEXT("Second function silent after bulk remove"), Listener->ValueAltCallCount, 1);
+
+	AddExpectedError(TEXT("AddListeners failed"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestEqual(TEXT("Null listener fails the whole batch"), Bus.AddListeners(nullptr, ListenerBindings, Results), 0);
+	TestEqual(TEXT("Failed batch still reports every entry"), Results.Num(), 3);
+
+	int32 PresenceChanges = 0;
+	const FDelegateHandle Handle = Bus.AddPresenceCallback(TAG_EventBus_Test_BulkA,
+		FOnChannelPresenceChanged::FDelegate::CreateLambda([&PresenceChanges](const FGameplayTag&, const bool)
+		{
+			++PresenceChanges;
+		}));
+	const FChannelListenerBinding SameChannelBindings[] = {
+		{TAG_EventBus_Test_BulkA, {FunctionName}},
+		{TAG_EventBus_Test_BulkA, {AltFunctionName}}
+	};
+	TestEqual(TEXT("Both bindings join one channel"), Bus.AddListeners(Listener, SameChannelBindings, Results), 2);
+	TestEqual(TEXT("One channel notifies once per bulk add"), PresenceChanges, 1);
+	TestEqual(TEXT("Both bindings leave one channel"), Bus.RemoveListeners(Listener, SameChannelBindings, Results), 2);
+	TestEqual(TEXT("One channel notifies once per bulk remove"), PresenceChanges, 2);
+	TestTrue(TEXT("RemovePresenceCallback succeeds"), Bus.RemovePresenceCallback(TAG_EventBus_Test_BulkA, Handle));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusTrustedBindingTest,
+	"EventBus.Core.TrustedBindings",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusTrustedBindingTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	FEventBus Bus;
+	FChannelRegistration Registration;
+	Registration.ChannelTag = TAG_EventBus_Test_Trusted;
+	TestTrue(TEXT("Register channel succeeds"), Bus.RegisterChannel(Registration));
+
+	UEventBusTestPublisherObject* Publisher = NewObject<UEventBusTestPublisherObject>();
+	UEventBusTestDerivedListenerObject* Listener = NewObject<UEventBusTestDerivedListenerObject>();
+
+	const FMulticastDelegateProperty* const ValueProperty = FindFProperty<FMulticastDelegateProperty>(
+		UEventBusTestPublisherObject::StaticClass(), GET_MEMBER_NAME_CHECKED(UEventBusTestPublisherObject, OnValueChanged));
+	const FMulticastDelegateProperty* const PairProperty = FindFProperty<FMulticastDelegateProperty>(
+		UEventBusTestPublisherObject::StaticClass(), GET_MEMBER_NAME_CHECKED(UEventBusTestPublisherObject, OnPairChanged));
+	const UFunction* const OnValueFunction =
+		UEventBusTestListenerObject::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValue));
+	const UFunction* const OnNoArgsFunction =
+		UEventBusTestListenerObject::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnNoArgs));
+
+	FPublisherBinding ForeignPublisherBinding;
+	ForeignPublisherBinding.DelegatePropertyName = GET_MEMBER_NAME_CHECKED(UEventBusTestPublisherObject, OnValueChanged);
+	ForeignPublisherBinding.ResolvedDelegateProperty = PairProperty;
+	TestTrue(TEXT("Mismatched publisher token falls back to the named delegate"),
+		Bus.AddPublisher(TAG_EventBus_Test_Trusted, Publisher, ForeignPublisherBinding));
+
+	FPublisherBinding PublisherBinding;
+	PublisherBinding.DelegatePropertyName = GET_MEMBER_NAME_CHECKED(UEventBusTestPublisherObject, OnValueChanged);
+	PublisherBinding.ResolvedDelegateProperty = ValueProperty;
+	TestTrue(TEXT("Trusted publisher rebinds"), Bus.AddPublisher(TAG_EventBus_Test_Trusted, Publisher, PublisherBinding));
+
+	FListenerBinding ListenerBinding;
+	ListenerBinding.FunctionName = GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValue);
+	ListenerBinding.ResolvedFunction = OnValueFunction;
+	ListenerBinding.ProvenSignature = ValueProperty->SignatureFunction;
+	TestTrue(TEXT("Base-class token is trusted for a derived listener"), Bus.AddListener(TAG_EventBus_Test_Trusted, Listener, ListenerBinding));
+
+	FListenerBinding RenamedBinding;
+	RenamedBinding.FunctionName = GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValueAlt);
+	RenamedBinding.ResolvedFunction = OnValueFunction;
+	TestTrue(TEXT("Token for another function falls back to the named function"),
+		Bus.AddListener(TAG_EventBus_Test_Trusted, Listener, RenamedBinding));
+
+	FListenerBinding UnprovenBinding;
+	UnprovenBinding.FunctionName = GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnNoArgs);
+	UnprovenBinding.ResolvedFunction = OnNoArgsFunction;
+	AddExpectedError(TEXT("AddListener failed"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("Token without a matching proven signature is still signature-checked"),
+		Bus.AddListener(TAG_EventBus_Test_Trusted, Listener, UnprovenBinding));
+
+	Publisher->EmitValue(2.0f);
+	TestEqual(TEXT("Trusted listener is invoked"), Listener->ValueCallCount, 1);
+	TestEqual(TEXT("Fallback listener is invoked"), Listener->ValueAltCallCount, 1);
+	TestEqual(TEXT("Trusted listener receives payload"), Listener->LastValue, 2.0f);
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,114 @@
+#include "Misc/AutomationTest.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBusDiagnostics.h"
+#include "Tests/EventBusTestChannels.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusChannelSnapshotTest,
+	"EventBus.Diagnostics.ChannelSnapshots",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusChannelSnapshotTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	Tests::FValueChannelFixture Fixture;
+	FEventBus& Bus = Fixture.Bus;
+	if (!TestTrue(TEXT("Fixture setup succeeds"), Fixture.Setup()))
+	{
+		return false;
+	}
+
+	UEventBusTestListenerObject* ListenerA = NewObject<UEventBusTestListenerObject>();
+	UEventBusTestListenerObject* ListenerB = NewObject<UEventBusTestListenerObject>();
+	UEventBusTestBatchListenerObject* BatchListener = NewObject<UEventBusTestBatchListenerObject>();
+	TestTrue(TEXT("AddListener A succeeds"),
+		NFL_EVENTBUS_ADD_LISTENER(Bus, FEventBusTestValueChannel, ListenerA, UEventBusTestListenerObject, OnValue));
+	TestTrue(TEXT("AddListener B succeeds"),
+		NFL_EVENTBUS_ADD_LISTENER(Bus, FEventBusTestValueChannel, ListenerB, UEventBusTestListenerObject, OnValue));
+	TestTrue(TEXT("AddBatchListener succeeds"),
+		NFL_EVENTBUS_ADD_BATCH_LISTENER(Bus, FEventBusTestValueBatchChannel, BatchListener, UEventBusTestBatchListenerObject, OnBatch));
+
+	TArray<FEventChannelSnapshot> Snapshots;
+	Bus.GetChannelSnapshots(Snapshots);
+	if (!TestEqual(TEXT("Snapshot per channel"), Snapshots.Num(), 2))
+	{
+		return false;
+	}
+
+	const FEventChannelSnapshot& Delegate = Snapshots[0];
+	const FEventChannelSnapshot& Batch = Snapshots[1];
+	TestEqual(TEXT("Snapshots sorted by tag"), Delegate.ChannelTag, TAG_EventBus_Test_Value.GetTag());
+	TestEqual(TEXT("Delegate kind"), FString(Delegate.Kind), FString(TEXT("Delegate")));
+	TestEqual(TEXT("Batch kind"), FString(Batch.Kind), FString(TEXT("Batch")));
+	TestEqual(TEXT("One publisher class row"), Delegate.Publishers.Num(), 1);
+	if (TestEqual(TEXT("Listeners of one class and function share a row"), Delegate.Listeners.Num(), 1))
+	{
+		TestEqual(TEXT("Listener row class"), Delegate.Listeners[0].ClassName, UEventBusTestListenerObject::StaticClass()->GetFName());
+		TestEqual(TEXT("Listener row object count"), Delegate.Listeners[0].ObjectCount, 2);
+	}
+	TestEqual(TEXT("Batch listener row"), Batch.Listeners.Num(), 1);
+	TestTrue(TEXT("Snapshot carries memory"), Delegate.Memory.OwnedBytes > 0);
+
+	FStringOutputDevice Dump;
+	Bus.DumpChannels(Dump, TEXT("ValueBatch"));
+	TestTrue(TEXT("Filtered dump lists batch channel"), Dump.Contains(TEXT("EventBus.Test.ValueBatch")));
+	TestFalse(TEXT("Filtered dump skips delegate channel listeners"), Dump.Contains(TEXT("OnValue")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusTopSamplerTest,
+	"EventBus.Diagnostics.TopSampler",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusTopSamplerTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	const auto MakeCounters = [](const uint64 HotInvocations, const uint64 ColdInvocations)
+	{
+		TMap<FString, FEventChannelStats> Counters;
+		Counters.Add(TEXT("Bus/Hot")).ListenerInvocationCount = HotInvocations;
+		Counters.Add(TEXT("Bus/Cold")).ListenerInvocationCount = ColdInvocations;
+		return Counters;
+	};
+
+	FEventBusTopSampler Sampler;
+	Sampler.SetMaxAgeSeconds(10.0);
+	TArray<FEventBusTopRow> Rows;
+	double Window = 0.0;
+
+	Sampler.AddSample(0.0, MakeCounters(0, 0));
+	TestFalse(TEXT("One sample has no rate"), Sampler.GetTop(5.0, EEventBusTopSort::Invocations, 10, Rows, Window));
+
+	Sampler.AddSample(1.0, MakeCounters(100, 10));
+	Sampler.AddSample(2.0, MakeCounters(300, 20));
+	TestTrue(TEXT("Two samples produce rates"), Sampler.GetTop(1.0, EEventBusTopSort::Invocations, 1, Rows, Window));
+	TestEqual(TEXT("Row limit applied"), Rows.Num(), 1);
+	if (Rows.Num() == 1)
+	{
+		TestEqual(TEXT("Hottest channel first"), Rows[0].Channel, FString(TEXT("Bus/Hot")));
+		TestEqual(TEXT("Rate over last second"), Rows[0].InvocationsPerSecond, 200.0);
+	}
+	TestEqual(TEXT("Window snaps to sample spacing"), Window, 1.0);
+
+	TestTrue(TEXT("Long window uses oldest sample"), Sampler.GetTop(60.0, EEventBusTopSort::Invocations, 10, Rows, Window));
+	TestEqual(TEXT("Covered window clamps to history"), Window, 2.0);
+
+	Sampler.AddSample(3.0, MakeCounters(50, 25));
+	TestTrue(TEXT("Reset counters still produce rates"), Sampler.GetTop(1.0, EEventBusTopSort::Invocations, 10, Rows, Window));
+	TestEqual(TEXT("Counter reset restarts from zero"), Rows[0].InvocationsPerSecond, 50.0);
+
+	Sampler.AddSample(20.0, MakeCounters(60, 25));
+	TestTrue(TEXT("Old samples trimmed to retention plus one baseline"), Sampler.GetSampleCount() <= 2);
+
+	Sampler.Reset();
+	TestEqual(TEXT("Reset drops history"), Sampler.GetSampleCount(), 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
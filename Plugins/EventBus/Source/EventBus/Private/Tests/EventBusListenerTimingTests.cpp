@@ -0,0 +1,83 @@
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBusListenerTiming.h"
+#include "Tests/EventBusTestChannels.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusListenerTimingTest,
+	"EventBus.Diagnostics.ListenerTiming",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusListenerTimingTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+	using FApi = Tests::FValueChannelFixture::FApi;
+	using FBatchApi = Tests::FValueChannelFixture::FBatchApi;
+
+	const bool bWasEnabled = FEventListenerTiming::IsEnabled();
+	ON_SCOPE_EXIT
+	{
+		FEventListenerTiming::SetEnabled(bWasEnabled);
+	};
+
+	Tests::FValueChannelFixture Fixture;
+	FEventBus& Bus = Fixture.Bus;
+	if (!TestTrue(TEXT("Fixture setup succeeds"), Fixture.Setup()))
+	{
+		return false;
+	}
+
+	UEventBusTestPublisherObject* Publisher = Fixture.Publisher;
+	UEventBusTestListenerObject* Listener = NewObject<UEventBusTestListenerObject>();
+	UEventBusTestListenerObject* ExternalListener = NewObject<UEventBusTestListenerObject>();
+	TestTrue(TEXT("AddListener succeeds"),
+		NFL_EVENTBUS_ADD_LISTENER(Bus, FEventBusTestValueChannel, Listener, UEventBusTestListenerObject, OnValue));
+	TestTrue(TEXT("AddListener alt succeeds"),
+		NFL_EVENTBUS_ADD_LISTENER(Bus, FEventBusTestValueChannel, Listener, UEventBusTestListenerObject, OnValueAlt));
+	Publisher->OnValueChanged.AddDynamic(ExternalListener, &UEventBusTestListenerObject::OnValue);
+
+	TArray<FEventListenerTimingStats> Timings;
+	FEventListenerTiming::SetEnabled(false);
+	FApi::Broadcast(Bus, Publisher, 1.0f);
+	TestTrue(TEXT("Timing query succeeds"), Bus.GetListenerTimings(TAG_EventBus_Test_Value, 10, Timings));
+	TestEqual(TEXT("Disabled timing records nothing"), Timings.Num(), 0);
+
+	FEventListenerTiming::SetEnabled(true);
+	FApi::Broadcast(Bus, Publisher, 2.0f);
+	FApi::Broadcast(Bus, Publisher, 3.0f);
+	TestEqual(TEXT("Tracked listener called once per broadcast"), Listener->ValueCallCount, 3);
+	TestEqual(TEXT("Second tracked function called once per broadcast"), Listener->ValueAltCallCount, 3);
+	TestEqual(TEXT("Binding made outside the bus still called once per broadcast"), ExternalListener->ValueCallCount, 3);
+
+	TestTrue(TEXT("Timing query after timed broadcasts succeeds"), Bus.GetListenerTimings(TAG_EventBus_Test_Value, 10, Timings));
+	TestEqual(TEXT("One row per tracked listener function"), Timings.Num(), 2);
+	for (const FEventListenerTimingStats& Timing : Timings)
+	{
+		TestEqual(TEXT("Timed call count"), Timing.CallCount, static_cast<uint64>(2));
+		TestEqual(TEXT("Listener class recorded"), Timing.ClassName, UEventBusTestListenerObject::StaticClass()->GetFName());
+		TestTrue(TEXT("Maximum covers average"), Timing.MaxMs >= Timing.AverageMs);
+	}
+
+	TestTrue(TEXT("Row limit query succeeds"), Bus.GetListenerTimings(TAG_EventBus_Test_Value, 1, Timings));
+	TestEqual(TEXT("Row limit applied"), Timings.Num(), 1);
+
+	UEventBusTestBatchListenerObject* BatchListener = NewObject<UEventBusTestBatchListenerObject>();
+	TestTrue(TEXT("AddBatchListener succeeds"),
+		NFL_EVENTBUS_ADD_BATCH_LISTENER(Bus, FEventBusTestValueBatchChannel, BatchListener, UEventBusTestBatchListenerObject, OnBatch));
+	TestTrue(TEXT("Publish succeeds"), FBatchApi::Publish(Bus, 1.0f));
+	FBatchApi::Flush(Bus);
+	TestTrue(TEXT("Batch timing query succeeds"), Bus.GetListenerTimings(TAG_EventBus_Test_ValueBatch, 10, Timings));
+	TestEqual(TEXT("Batch listener timed"), Timings.Num(), 1);
+
+	Bus.ResetListenerTimings();
+	TestTrue(TEXT("Timing query after reset succeeds"), Bus.GetListenerTimings(TAG_EventBus_Test_Value, 10, Timings));
+	TestEqual(TEXT("Reset drops timings"), Timings.Num(), 0);
+	TestFalse(TEXT("Unknown channel reports failure"), Bus.GetListenerTimings(FGameplayTag(), 10, Timings));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,57 @@
+#include "Misc/AutomationTest.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "Tests/EventBusTestChannels.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusChannelMemoryTest,
+	"EventBus.Memory.ChannelBreakdown",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusChannelMemoryTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+	using FBatchApi = Tests::FValueChannelFixture::FBatchApi;
+
+	Tests::FValueChannelFixture Fixture;
+	FEventBus& Bus = Fixture.Bus;
+	FEventChannelMemory Memory;
+	TestFalse(TEXT("Memory query fails for unregistered channel"), Bus.GetChannelMemory(TAG_EventBus_Test_Value, Memory));
+	if (!TestTrue(TEXT("Fixture setup succeeds"), Fixture.Setup()))
+	{
+		return false;
+	}
+	const SIZE_T RegisteredBytes = Bus.GetAllocatedSize();
+	TestTrue(TEXT("Registered bus reports owned bytes"), RegisteredBytes > 0);
+
+	UEventBusTestListenerObject* Listener = NewObject<UEventBusTestListenerObject>();
+	TestTrue(TEXT("AddListener succeeds"),
+		NFL_EVENTBUS_ADD_LISTENER(Bus, FEventBusTestValueChannel, Listener, UEventBusTestListenerObject, OnValue));
+	TestTrue(TEXT("Bus grows with bindings"), Bus.GetAllocatedSize() > RegisteredBytes);
+
+	TestTrue(TEXT("Memory query succeeds"), Bus.GetChannelMemory(TAG_EventBus_Test_Value, Memory));
+	TestEqual(TEXT("Publisher count"), Memory.PublisherCount, 1);
+	TestEqual(TEXT("Listener count"), Memory.ListenerCount, 1);
+	TestTrue(TEXT("Listener storage reported"), Memory.ListenerBytes > 0);
+	TestTrue(TEXT("Publisher invocation list reported"), Memory.PublisherDelegateBytes > 0);
+	TestTrue(TEXT("Owned bytes cover containers"), Memory.OwnedBytes >= Memory.PublisherBytes + Memory.ListenerBytes);
+
+	const float Payloads[] = {1.0f, 2.0f, 3.0f};
+	TestTrue(TEXT("PublishRange succeeds"), FBatchApi::PublishRange(Bus, MakeArrayView(Payloads)));
+	TestTrue(TEXT("Batch memory query succeeds"), Bus.GetChannelMemory(TAG_EventBus_Test_ValueBatch, Memory));
+	TestTrue(TEXT("Pending payloads reported as dispatch bytes"), Memory.DispatchBytes >= sizeof(Payloads));
+
+	TMap<FGameplayTag, FEventChannelMemory> AllMemory;
+	Bus.GetAllChannelMemory(AllMemory);
+	TestEqual(TEXT("All-channel query covers delegate and batch channels"), AllMemory.Num(), 2);
+
+	FStringOutputDevice Dump;
+	Bus.DumpMemory(Dump);
+	TestTrue(TEXT("Dump lists delegate channel"), Dump.Contains(TAG_EventBus_Test_Value.GetTag().ToString()));
+	TestTrue(TEXT("Dump lists batch channel"), Dump.Contains(TAG_EventBus_Test_ValueBatch.GetTag().ToString()));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
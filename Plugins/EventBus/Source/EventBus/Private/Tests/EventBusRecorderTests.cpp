@@ -0,0 +1,128 @@
+#include "Misc/AutomationTest.h"
+
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBusRecorder.h"
+#include "EventBus/Core/EventBusReplay.h"
+#include "Tests/EventBusTestChannels.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && NFL_EVENTBUS_RECORDING
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusRecorderRoundTripTest,
+	"EventBus.Recorder.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusRecorderRoundTripTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+	using FRecordApi = Tests::FValueChannelFixture::FApi;
+	using FBatchApi = Tests::FValueChannelFixture::FBatchApi;
+
+	const FString FilePath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("EventBusRecorderRoundTrip.ebrec"));
+	ON_SCOPE_EXIT
+	{
+		FEventBusRecorder::Stop();
+	};
+
+	UEventBusTestPublisherObject* Publisher = NewObject<UEventBusTestPublisherObject>();
+	UEventBusTestListenerObject* Listener = NewObject<UEventBusTestListenerObject>();
+	{
+		FEventBus Bus;
+		TestTrue(TEXT("Recording starts"), FEventBusRecorder::Start(FilePath));
+		AddExpectedError(TEXT("StartRecording failed"), EAutomationExpectedErrorFlags::Contains, 1);
+		TestFalse(TEXT("Second start is rejected"), FEventBusRecorder::Start(FilePath));
+
+		TestTrue(TEXT("Register succeeds"), FRecordApi::Register(Bus));
+		TestTrue(TEXT("AddPublisher succeeds"), FRecordApi::AddPublisher(Bus, Publisher));
+		TestTrue(TEXT("AddListener succeeds"), NFL_EVENTBUS_ADD_LISTENER(Bus, FEventBusTestValueChannel, Listener, UEventBusTestListenerObject, OnValue));
+		FRecordApi::Broadcast(Bus, Publisher, 2.5f);
+		FRecordApi::Broadcast(Bus, Publisher, 7);
+		TestTrue(TEXT("RemoveListener succeeds"), NFL_EVENTBUS_REMOVE_LISTENER(Bus, FEventBusTestValueChannel, Listener, UEventBusTestListenerObject, OnValue));
+
+		const float Payloads[] = {1.0f, 2.0f};
+		TestTrue(TEXT("Batch register succeeds"), FBatchApi::Register(Bus));
+		TestTrue(TEXT("Batch publish succeeds"), FBatchApi::PublishRange(Bus, MakeArrayView(Payloads)));
+		FBatchApi::Flush(Bus);
+
+		TestTrue(TEXT("Recording stops"), FEventBusRecorder::Stop());
+		TestFalse(TEXT("Recorder is idle after stop"), FEventBusRecorder::IsRecording());
+	}
+
+	const FEventBusRecorderStats Stats = FEventBusRecorder::GetStats();
+	TestEqual(TEXT("Every operation recorded"), Stats.RecordCount, static_cast<uint64>(9));
+
+	FEventBusRecording Recording;
+	if (!TestTrue(TEXT("Recording loads"), FEventBusRecording::Load(FilePath, Recording)))
+	{
+		return false;
+	}
+
+	const EEventBusRecordOp ExpectedOps[] = {
+		EEventBusRecordOp::RegisterChannel,
+		EEventBusRecordOp::AddPublisher,
+		EEventBusRecordOp::AddListener,
+		EEventBusRecordOp::Broadcast,
+		EEventBusRecordOp::Broadcast,
+		EEventBusRecordOp::RemoveListener,
+		EEventBusRecordOp::RegisterNativeChannel,
+		EEventBusRecordOp::NativePublish,
+		EEventBusRecordOp::Flush
+	};
+	if (!TestEqual(TEXT("Record count matches"), Recording.Records.Num(), static_cast<int32>(UE_ARRAY_COUNT(ExpectedOps))))
+	{
+		return false;
+	}
+	for (int32 Index = 0; Index < Recording.Records.Num(); ++Index)
+	{
+		TestEqual(FString::Printf(TEXT("Record %d op"), Index), LexToString(Recording.Records[Index].Op), LexToString(ExpectedOps[Index]));
+	}
+	TestEqual(TEXT("Single bus recorded"), Recording.BusCount, 1);
+	TestEqual(TEXT("Channel tag resolves"), Recording.Records[0].ChannelTag, TAG_EventBus_Test_Value.GetTag());
+	TestEqual(TEXT("Listener function recorded"), Recording.Records[2].MemberName, GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValue));
+	TestEqual(TEXT("Listener path recorded"), Recording.Records[2].ObjectPath, Listener->GetPathName());
+	TestEqual(TEXT("Native publish keeps payload count"), Recording.Records[7].Count, 2);
+	TestEqual(TEXT("Native publish keeps payload bytes"), Recording.Records[7].Payload.Num(), static_cast<int32>(sizeof(float) * 2));
+	TestTrue(TEXT("Timestamps are monotonic"), Recording.Records.Last().TimeSeconds >= Recording.Records[0].TimeSeconds);
+
+	UEventBusTestBatchListenerObject* BatchListener = NewObject<UEventBusTestBatchListenerObject>();
+	FEventBusReplayOptions Options;
+	Options.NativeChannelHandler = [BatchListener](FEventBus& TargetBus, const FEventBusRecord& Record)
+	{
+		if (Record.Op == EEventBusRecordOp::RegisterNativeChannel)
+		{
+			return FBatchApi::Register(TargetBus) &&
+				NFL_EVENTBUS_ADD_BATCH_LISTENER(TargetBus, FEventBusTestValueBatchChannel, BatchListener, UEventBusTestBatchListenerObject, OnBatch);
+		}
+
+		TArray<float> Values;
+		Values.SetNumUninitialized(Record.Count);
+		if (Record.Payload.Num() != Values.Num() * static_cast<int32>(sizeof(float)))
+		{
+			return false;
+		}
+		FMemory::Memcpy(Values.GetData(), Record.Payload.GetData(), Record.Payload.Num());
+		return FBatchApi::PublishRange(TargetBus, Values);
+	};
+
+	FEventBus ReplayBus;
+	FEventBusReplayer Replayer(Recording);
+	FEventBusReplayResult Result;
+	TestTrue(TEXT("Replay succeeds"), Replayer.Replay(ReplayBus, Options, Result));
+	TestEqual(TEXT("Every record replayed"), Result.ReplayedCount, Recording.Records.Num());
+	TestEqual(TEXT("No record failed"), Result.FailedCount, 0);
+
+	const UEventBusTestListenerObject* StandIn = Cast<UEventBusTestListenerObject>(Replayer.FindResolvedObject(Listener->GetPathName()));
+	if (TestNotNull(TEXT("Listener stand-in created"), StandIn))
+	{
+		TestEqual(TEXT("Stand-in heard both broadcasts"), StandIn->ValueCallCount, 2);
+		TestEqual(TEXT("Converted broadcast argument replays as float"), StandIn->LastValue, 7.0f);
+	}
+	TestEqual(TEXT("Live listener is untouched by replay"), Listener->ValueCallCount, 2);
+	TestEqual(TEXT("Batch payloads replayed through handler"), BatchListener->ReceivedPayloadSum, 3.0f);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && NFL_EVENTBUS_RECORDING
@@ -0,0 +1,161 @@
+#include "Misc/AutomationTest.h"
+
+#include "NativeGameplayTags.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBus.h"
+#include "EventBus/Core/EventBusScopes.h"
+#include "Tests/EventBusTestObjects.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Scope, "EventBus.Test.Scope");
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusScopeForwardingTest,
+	"EventBus.Scope.ForwardingReachesParentListeners",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusScopeForwardingTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	FEventBus RootBus;
+	FEventBusScopeRegistry Scopes(RootBus);
+
+	UEventBusTestListenerObject* WorldOwner = NewObject<UEventBusTestListenerObject>();
+	UEventBusTestListenerObject* LevelOwner = NewObject<UEventBusTestListenerObject>(WorldOwner);
+	UEventBusTestListenerObject* TeamOwner = NewObject<UEventBusTestListenerObject>();
+
+	FEventBus* WorldBus = Scopes.CreateScope(WorldOwner);
+	FEventBus* LevelBus = Scopes.CreateScope(LevelOwner, WorldOwner);
+	FEventBus* TeamBus = Scopes.CreateScope(TeamOwner, nullptr, false);
+	if (!TestNotNull(TEXT("World scope created"), WorldBus) ||
+		!TestNotNull(TEXT("Level scope created"), LevelBus) ||
+		!TestNotNull(TEXT("Isolated team scope created"), TeamBus))
+	{
+		return false;
+	}
+
+	TestTrue(TEXT("Level scope forwards into world scope"), LevelBus->GetParent() == WorldBus);
+	TestTrue(TEXT("World scope forwards into root bus"), WorldBus->GetParent() == &RootBus);
+	TestNull(TEXT("Isolated scope has no parent"), TeamBus->GetParent());
+	TestTrue(TEXT("Repeated create returns same scope"), Scopes.CreateScope(LevelOwner, WorldOwner) == LevelBus);
+	TestNull(TEXT("Create with a different parent fails"), Scopes.CreateScope(LevelOwner));
+
+	FChannelRegistration Registration;
+	Registration.ChannelTag = TAG_EventBus_Test_Scope;
+	TestTrue(TEXT("Root channel register succeeds"), RootBus.RegisterChannel(Registration));
+	TestTrue(TEXT("Level channel register succeeds"), LevelBus->RegisterChannel(Registration));
+	TestTrue(TEXT("Team channel register succeeds"), TeamBus->RegisterChannel(Registration));
+
+	UEventBusTestPublisherObject* LevelPublisher = NewObject<UEventBusTestPublisherObject>();
+	UEventBusTestPublisherObject* TeamPublisher = NewObject<UEventBusTestPublisherObject>();
+	UEventBusTestListenerObject* RootListener = NewObject<UEventBusTestListenerObject>();
+	UEventBusTestListenerObject* LevelListener = NewObject<UEventBusTestListenerObject>();
+
+	FPublisherBinding PublisherBinding;
+	PublisherBinding.DelegatePropertyName = GET_MEMBER_NAME_CHECKED(UEventBusTestPublisherObject, OnValueChanged);
+	FListenerBinding ListenerBinding;
+	ListenerBinding.FunctionName = GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValue);
+
+	TestTrue(TEXT("Root listener add succeeds"), RootBus.AddListener(TAG_EventBus_Test_Scope, RootListener, ListenerBinding));
+	TestTrue(TEXT("Level listener add succeeds"), LevelBus->AddListener(TAG_EventBus_Test_Scope, LevelListener, ListenerBinding));
+	TestTrue(TEXT("Level publisher add succeeds"), LevelBus->AddPublisher(TAG_EventBus_Test_Scope, LevelPublisher, PublisherBinding));
+	TestTrue(TEXT("Team publisher add succeeds"), TeamBus->AddPublisher(TAG_EventBus_Test_Scope, TeamPublisher, PublisherBinding));
+
+	LevelPublisher->EmitValue(1.0f);
+	TestEqual(TEXT("Level listener hears level publisher"), LevelListener->ValueCallCount, 1);
+	TestEqual(TEXT("Root listener hears forwarded level publisher"), RootListener->ValueCallCount, 1);
+
+	TeamPublisher->EmitValue(2.0f);
+	TestEqual(TEXT("Root listener does not hear isolated scope"), RootListener->ValueCallCount, 1);
+
+	TestTrue(TEXT("Releasing world scope succeeds"), Scopes.ReleaseScope(WorldOwner));
+	TestEqual(TEXT("World release drops its level scope"), Scopes.GetNumScopes(), 1);
+	TestNull(TEXT("Level scope is gone"), Scopes.FindScope(LevelOwner));
+
+	LevelPublisher->EmitValue(3.0f);
+	TestEqual(TEXT("Level listener unbound with its scope"), LevelListener->ValueCallCount, 1);
+	TestEqual(TEXT("Forwarded publisher retracted from root"), RootListener->ValueCallCount, 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusScopeResolveReleaseTest,
+	"EventBus.Scope.ResolveAndReleaseWithinOuter",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusScopeResolveReleaseTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	FEventBus RootBus;
+	FEventBusScopeRegistry Scopes(RootBus);
+
+	UEventBusTestListenerObject* WorldOwner = NewObject<UEventBusTestListenerObject>();
+	UEventBusTestListenerObject* LevelOwner = NewObject<UEventBusTestListenerObject>(WorldOwner);
+	UEventBusTestListenerObject* Actor = NewObject<UEventBusTestListenerObject>(LevelOwner);
+	UEventBusTestListenerObject* Unscoped = NewObject<UEventBusTestListenerObject>();
+
+	FEventBus* WorldBus = Scopes.CreateScope(WorldOwner);
+	FEventBus* LevelBus = Scopes.CreateScope(LevelOwner, WorldOwner);
+	TestTrue(TEXT("Actor resolves to its level scope"), &Scopes.ResolveBus(Actor) == LevelBus);
+	TestTrue(TEXT("Level owner resolves to its own scope"), &Scopes.ResolveBus(LevelOwner) == LevelBus);
+	TestTrue(TEXT("Unscoped object resolves to root bus"), &Scopes.ResolveBus(Unscoped) == &RootBus);
+	TestFalse(TEXT("Parent cycle is rejected"), WorldBus && WorldBus->SetParent(LevelBus));
+
+	TestEqual(TEXT("Releasing within level drops only the level scope"), Scopes.ReleaseScopesWithin(LevelOwner), 1);
+	TestTrue(TEXT("Actor falls back to world scope"), &Scopes.ResolveBus(Actor) == WorldBus);
+	TestEqual(TEXT("Releasing within world drops the world scope"), Scopes.ReleaseScopesWithin(WorldOwner), 1);
+	TestEqual(TEXT("No scopes remain"), Scopes.GetNumScopes(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusScopeSharedPublisherTest,
+	"EventBus.Scope.ChildRemovalKeepsParentPublisher",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusScopeSharedPublisherTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	FEventBus ParentBus;
+	FEventBus ChildBus;
+	TestTrue(TEXT("Child parents onto parent bus"), ChildBus.SetParent(&ParentBus));
+
+	FChannelRegistration Registration;
+	Registration.ChannelTag = TAG_EventBus_Test_Scope;
+	TestTrue(TEXT("Parent channel register succeeds"), ParentBus.RegisterChannel(Registration));
+	TestTrue(TEXT("Child channel register succeeds"), ChildBus.RegisterChannel(Registration));
+
+	UEventBusTestPublisherObject* ParentFirst = NewObject<UEventBusTestPublisherObject>();
+	UEventBusTestPublisherObject* ChildFirst = NewObject<UEventBusTestPublisherObject>();
+	UEventBusTestListenerObject* ParentListener = NewObject<UEventBusTestListenerObject>();
+
+	FPublisherBinding PublisherBinding;
+	PublisherBinding.DelegatePropertyName = GET_MEMBER_NAME_CHECKED(UEventBusTestPublisherObject, OnValueChanged);
+	FListenerBinding ListenerBinding;
+	ListenerBinding.FunctionName = GET_FUNCTION_NAME_CHECKED(UEventBusTestListenerObject, OnValue);
+	TestTrue(TEXT("Parent listener add succeeds"), ParentBus.AddListener(TAG_EventBus_Test_Scope, ParentListener, ListenerBinding));
+
+	TestTrue(TEXT("Parent registers publisher directly"), ParentBus.AddPublisher(TAG_EventBus_Test_Scope, ParentFirst, PublisherBinding));
+	TestTrue(TEXT("Child registers the same publisher"), ChildBus.AddPublisher(TAG_EventBus_Test_Scope, ParentFirst, PublisherBinding));
+	TestTrue(TEXT("Child removes its registration"), ChildBus.RemovePublisher(TAG_EventBus_Test_Scope, ParentFirst));
+	ParentFirst->EmitValue(1.0f);
+	TestEqual(TEXT("Parent keeps its direct registration"), ParentListener->ValueCallCount, 1);
+
+	TestTrue(TEXT("Child forwards before the parent registers"), ChildBus.AddPublisher(TAG_EventBus_Test_Scope, ChildFirst, PublisherBinding));
+	TestTrue(TEXT("Parent registers the forwarded publisher"), ParentBus.AddPublisher(TAG_EventBus_Test_Scope, ChildFirst, PublisherBinding));
+	ChildBus.Reset();
+	ChildFirst->EmitValue(2.0f);
+	TestEqual(TEXT("Child reset keeps the parent's registration"), ParentListener->ValueCallCount, 2);
+
+	TestTrue(TEXT("Parent removes its own registration"), ParentBus.RemovePublisher(TAG_EventBus_Test_Scope, ChildFirst));
+	ChildFirst->EmitValue(3.0f);
+	TestEqual(TEXT("Parent removal unbinds the publisher"), ParentListener->ValueCallCount, 2);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,332 @@
+#include "Misc/AutomationTest.h"
+
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "NativeGameplayTags.h"
+#include "UObject/GarbageCollection.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBus.h"
+#include "EventBus/Typed/EventChannelApi.h"
+#include "EventBus/Typed/EventChannelDef.h"
+#include "Tests/EventBusTestObjects.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Spatial, "EventBus.Test.Spatial");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_SpatialPerf, "EventBus.Test.SpatialPerf");
+
+NFL_DECLARE_EVENTBUS_SPATIAL_CHANNEL(
+	FEventBusSpatialTestChannel,
+	float,
+	TAG_EventBus_Test_Spatial,
+	1000.0
+);
+
+NFL_DECLARE_EVENTBUS_SPATIAL_CHANNEL(
+	FEventBusSpatialPerfChannel,
+	float,
+	TAG_EventBus_Test_SpatialPerf,
+	2000.0
+);
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusSpatialChannelRadiusTest,
+	"EventBus.Spatial.PublishReachesListenersInRadius",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusSpatialChannelRadiusTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+	using FSpatialApi = TEventSpatialChannelApi<FEventBusSpatialTestChannel>;
+
+	FEventBus Bus;
+	TestEqual(TEXT("Publish before registration reaches nobody"), FSpatialApi::Publish(Bus, FVector::ZeroVector, 1.0f), 0);
+	TestTrue(TEXT("Spatial channel register succeeds"), FSpatialApi::Register(Bus));
+	TestFalse(TEXT("Batch register on spatial channel tag fails"),
+		Bus.RegisterBatchChannel<float>(TAG_EventBus_Test_Spatial, TEXT("float")));
+
+	UEventBusTestSpatialListenerObject* Near = NewObject<UEventBusTestSpatialListenerObject>();
+	UEventBusTestSpatialListenerObject* Far = NewObject<UEventBusTestSpatialListenerObject>();
+	UEventBusTestSpatialListenerObject* Wide = NewObject<UEventBusTestSpatialListenerObject>();
+
+	TestTrue(TEXT("Near listener add succeeds"), NFL_EVENTBUS_ADD_SPATIAL_LISTENER(
+		Bus, FEventBusSpatialTestChannel, Near, UEventBusTestSpatialListenerObject, OnSpatialEvent, FVector(0.0, 0.0, 0.0), 500.0));
+	TestTrue(TEXT("Far listener add succeeds"), NFL_EVENTBUS_ADD_SPATIAL_LISTENER(
+		Bus, FEventBusSpatialTestChannel, Far, UEventBusTestSpatialListenerObject, OnSpatialEvent, FVector(50000.0, 0.0, 0.0), 500.0));
+	TestTrue(TEXT("Overflow-sized listener add succeeds"), NFL_EVENTBUS_ADD_SPATIAL_LISTENER(
+		Bus, FEventBusSpatialTestChannel, Wide, UEventBusTestSpatialListenerObject, OnSpatialEvent, FVector::ZeroVector, 100000.0));
+	TestFalse(TEXT("Negative radius is rejected"), NFL_EVENTBUS_ADD_SPATIAL_LISTENER(
+		Bus, FEventBusSpatialTestChannel, Near, UEventBusTestSpatialListenerObject, OnSpatialEvent, FVector::ZeroVector, -1.0));
+
+	TestEqual(TEXT("Publish near origin reaches near and wide listeners"), FSpatialApi::Publish(Bus, FVector(100.0, 0.0, 0.0), 2.0f), 2);
+	TestEqual(TEXT("Near listener invoked"), Near->ReceivedCount, 1);
+	TestEqual(TEXT("Near listener receives payload"), Near->LastValue, 2.0f);
+	TestEqual(TEXT("Far listener not invoked"), Far->ReceivedCount, 0);
+
+	TestEqual(TEXT("Publish in same cell but outside radius skips near listener"),
+		FSpatialApi::Publish(Bus, FVector(900.0, 0.0, 0.0), 3.0f), 1);
+	TestEqual(TEXT("Near listener still invoked once"), Near->ReceivedCount, 1);
+
+	TestTrue(TEXT("Listener update succeeds"), NFL_EVENTBUS_UPDATE_SPATIAL_LISTENER(
+		Bus, FEventBusSpatialTestChannel, Near, UEventBusTestSpatialListenerObject, OnSpatialEvent, FVector(50000.0, 0.0, 0.0), 500.0));
+	TestEqual(TEXT("Publish at new location reaches moved and far listeners"),
+		FSpatialApi::Publish(Bus, FVector(50100.0, 0.0, 0.0), 4.0f), 3);
+	TestEqual(TEXT("Moved listener invoked at new location"), Near->ReceivedCount, 2);
+	TestEqual(TEXT("Far listener invoked"), Far->ReceivedCount, 1);
+
+	TestTrue(TEXT("Listener remove succeeds"), NFL_EVENTBUS_REMOVE_SPATIAL_LISTENER(
+		Bus, FEventBusSpatialTestChannel, Far, UEventBusTestSpatialListenerObject, OnSpatialEvent));
+	TestFalse(TEXT("Second remove fails"), NFL_EVENTBUS_REMOVE_SPATIAL_LISTENER(
+		Bus, FEventBusSpatialTestChannel, Far, UEventBusTestSpatialListenerObject, OnSpatialEvent));
+	TestEqual(TEXT("Removed listener is skipped"), FSpatialApi::Publish(Bus, FVector(50100.0, 0.0, 0.0), 5.0f), 2);
+	TestEqual(TEXT("Removed listener count unchanged"), Far->ReceivedCount, 1);
+
+	TestTrue(TEXT("UnregisterSpatialChannel succeeds"), Bus.UnregisterSpatialChannel(TAG_EventBus_Test_Spatial));
+	TestFalse(TEXT("Spatial channel is no longer registered"), Bus.IsSpatialChannelRegistered(TAG_EventBus_Test_Spatial));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusSpatialChannelReentrantRemoveTest,
+	"EventBus.Spatial.ListenerRemovesItselfDuringPublish",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusSpatialChannelReentrantRemoveTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+	using FSpatialApi = TEventSpatialChannelApi<FEventBusSpatialTestChannel>;
+	using FChannel = TEventSpatialChannel<float>;
+
+	FEventBus Bus;
+	TestTrue(TEXT("Spatial channel register succeeds"), FSpatialApi::Register(Bus));
+	FChannel* const Channel = Bus.FindSpatialChannel<float>(TAG_EventBus_Test_Spatial);
+	TestNotNull(TEXT("Spatial channel resolves"), Channel);
+	if (!Channel)
+	{
+		return false;
+	}
+
+	UEventBusTestSpatialListenerObject* SelfRemoving = NewObject<UEventBusTestSpatialListenerObject>();
+	UEventBusTestSpatialListenerObject* SelfReplacing = NewObject<UEventBusTestSpatialListenerObject>();
+	const FName FunctionName(TEXT("OnSpatialEvent"));
+
+	// Captures are read after the re-entrant call, so a destroyed delegate instance would be observed here.
+	const FString Marker(TEXT("Alive"));
+	int32 RemovingCalls = 0;
+	TestTrue(TEXT("Self-removing listener binds"), Channel->AddListener(SelfRemoving, FunctionName, FVector::ZeroVector, 500.0,
+		FChannel::FSpatialDelegate::CreateLambda([Channel, SelfRemoving, FunctionName, Marker, &RemovingCalls](const float&)
+		{
+			const bool bRemoved = Channel->RemoveListener(SelfRemoving, FunctionName);
+			RemovingCalls += bRemoved && Marker == TEXT("Alive") ? 1 : 0;
+		})));
+
+	int32 OriginalCalls = 0;
+	int32 ReplacementCalls = 0;
+	TestTrue(TEXT("Self-replacing listener binds"), Channel->AddListener(SelfReplacing, FunctionName, FVector::ZeroVector, 500.0,
+		FChannel::FSpatialDelegate::CreateLambda([Channel, SelfReplacing, FunctionName, Marker, &OriginalCalls, &ReplacementCalls](const float&)
+		{
+			const bool bReplaced = Channel->AddListener(SelfReplacing, FunctionName, FVector::ZeroVector, 500.0,
+				FChannel::FSpatialDelegate::CreateLambda([&ReplacementCalls](const float&)
+				{
+					++ReplacementCalls;
+				}));
+			OriginalCalls += bReplaced && Marker == TEXT("Alive") ? 1 : 0;
+		})));
+
+	TestEqual(TEXT("First publish reaches both listeners"), FSpatialApi::Publish(Bus, FVector::ZeroVector, 1.0f), 2);
+	TestEqual(TEXT("Self-removing listener ran once with intact captures"), RemovingCalls, 1);
+	TestEqual(TEXT("Self-replacing listener ran once with intact captures"), OriginalCalls, 1);
+	TestEqual(TEXT("Replacement does not run in the same publish"), ReplacementCalls, 0);
+	TestEqual(TEXT("Removed listener is no longer tracked"), Channel->GetListenerCount(), 1);
+
+	TestEqual(TEXT("Second publish reaches the replaced listener only"), FSpatialApi::Publish(Bus, FVector::ZeroVector, 2.0f), 1);
+	TestEqual(TEXT("Removed listener stays removed"), RemovingCalls, 1);
+	TestEqual(TEXT("Original callback was replaced"), OriginalCalls, 1);
+	TestEqual(TEXT("Replacement runs on the next publish"), ReplacementCalls, 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusSpatialChannelTeardownDuringPublishTest,
+	"EventBus.Spatial.CallbackTearsDownChannelDuringPublish",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusSpatialChannelTeardownDuringPublishTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+	using FSpatialApi = TEventSpatialChannelApi<FEventBusSpatialTestChannel>;
+	using FChannel = TEventSpatialChannel<float>;
+
+	FEventBus Bus;
+	TestTrue(TEXT("Spatial channel register succeeds"), FSpatialApi::Register(Bus));
+	FChannel* const Channel = Bus.FindSpatialChannel<float>(TAG_EventBus_Test_Spatial);
+	TestNotNull(TEXT("Spatial channel resolves"), Channel);
+	if (!Channel)
+	{
+		return false;
+	}
+
+	UEventBusTestSpatialListenerObject* Unregistering = NewObject<UEventBusTestSpatialListenerObject>();
+	UEventBusTestSpatialListenerObject* Later = NewObject<UEventBusTestSpatialListenerObject>();
+	const FName FunctionName(TEXT("OnSpatialEvent"));
+	bool bUnregistered = false;
+	TestTrue(TEXT("Unregistering listener binds"), Channel->AddListener(Unregistering, FunctionName, FVector::ZeroVector, 500.0,
+		FChannel::FSpatialDelegate::CreateLambda([&Bus, &bUnregistered](const float&)
+		{
+			bUnregistered = Bus.UnregisterSpatialChannel(TAG_EventBus_Test_Spatial);
+		})));
+	TestTrue(TEXT("Later listener binds"), NFL_EVENTBUS_ADD_SPATIAL_LISTENER(
+		Bus, FEventBusSpatialTestChannel, Later, UEventBusTestSpatialListenerObject, OnSpatialEvent, FVector::ZeroVector, 500.0));
+
+	TestEqual(TEXT("Publish stops at the listener that unregistered the channel"), FSpatialApi::Publish(Bus, FVector::ZeroVector, 1.0f), 1);
+	TestTrue(TEXT("Channel was unregistered from its own callback"), bUnregistered);
+	TestEqual(TEXT("Listener dropped with the channel is not invoked"), Later->ReceivedCount, 0);
+	TestFalse(TEXT("Channel stays unregistered"), Bus.IsSpatialChannelRegistered(TAG_EventBus_Test_Spatial));
+
+	// A child bus destroyed by its own listener must not be read again to find its parent.
+	TestTrue(TEXT("Parent channel register succeeds"), FSpatialApi::Register(Bus));
+	UEventBusTestSpatialListenerObject* ParentListener = NewObject<UEventBusTestSpatialListenerObject>();
+	TestTrue(TEXT("Parent listener add succeeds"), NFL_EVENTBUS_ADD_SPATIAL_LISTENER(
+		Bus, FEventBusSpatialTestChannel, ParentListener, UEventBusTestSpatialListenerObject, OnSpatialEvent, FVector::ZeroVector, 500.0));
+
+	TUniquePtr<FEventBus> Child = MakeUnique<FEventBus>();
+	TestTrue(TEXT("Child parent link succeeds"), Child->SetParent(&Bus));
+	TestTrue(TEXT("Child channel register succeeds"), FSpatialApi::Register(*Child));
+	FChannel* const ChildChannel = Child->FindSpatialChannel<float>(TAG_EventBus_Test_Spatial);
+	TestNotNull(TEXT("Child channel resolves"), ChildChannel);
+	if (!ChildChannel)
+	{
+		return false;
+	}
+
+	TestTrue(TEXT("Child-destroying listener binds"), ChildChannel->AddListener(Unregistering, FunctionName, FVector::ZeroVector, 500.0,
+		FChannel::FSpatialDelegate::CreateLambda([&Child](const float&)
+		{
+			Child.Reset();
+		})));
+
+	FEventBus& ChildBus = *Child;
+	TestEqual(TEXT("Publish ends with the destroyed child bus"), FSpatialApi::Publish(ChildBus, FVector::ZeroVector, 2.0f), 1);
+	TestFalse(TEXT("Child bus was destroyed from its own callback"), Child.IsValid());
+	TestEqual(TEXT("Parent is not reached through a destroyed child"), ParentListener->ReceivedCount, 0);
+	TestEqual(TEXT("Parent channel still publishes"), FSpatialApi::Publish(Bus, FVector::ZeroVector, 3.0f), 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusSpatialChannelStaleSweepTest,
+	"EventBus.Spatial.SweepDropsUngatheredStaleListeners",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusSpatialChannelStaleSweepTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+	using FSpatialApi = TEventSpatialChannelApi<FEventBusSpatialTestChannel>;
+
+	FEventBus Bus;
+	TestTrue(TEXT("Spatial channel register succeeds"), FSpatialApi::Register(Bus));
+	TEventSpatialChannel<float>* const Channel =
+		Bus.FindSpatialChannel<float>(TAG_EventBus_Test_Spatial);
+	TestNotNull(TEXT("Spatial channel resolves"), Channel);
+	if (!Channel)
+	{
+		return false;
+	}
+
+	UEventBusTestSpatialListenerObject* Survivor = NewObject<UEventBusTestSpatialListenerObject>();
+	UEventBusTestSpatialListenerObject* Doomed = NewObject<UEventBusTestSpatialListenerObject>();
+	Survivor->AddToRoot();
+	TestTrue(TEXT("Survivor add succeeds"), NFL_EVENTBUS_ADD_SPATIAL_LISTENER(
+		Bus, FEventBusSpatialTestChannel, Survivor, UEventBusTestSpatialListenerObject, OnSpatialEvent, FVector::ZeroVector, 500.0));
+	TestTrue(TEXT("Listener in an unpublished cell adds"), NFL_EVENTBUS_ADD_SPATIAL_LISTENER(
+		Bus, FEventBusSpatialTestChannel, Doomed, UEventBusTestSpatialListenerObject, OnSpatialEvent, FVector(90000.0, 0.0, 0.0), 500.0));
+
+	Doomed->MarkAsGarbage();
+	CollectGarbage(RF_NoFlags);
+	TestEqual(TEXT("Publishing elsewhere never gathers the dead listener"), FSpatialApi::Publish(Bus, FVector::ZeroVector, 1.0f), 1);
+	TestEqual(TEXT("Dead listener is still tracked before the sweep"), Channel->GetListenerCount(), 2);
+	TestEqual(TEXT("Sweep drops the dead listener"), Channel->SweepStaleListeners(), 1);
+	TestEqual(TEXT("Only the survivor remains"), Channel->GetListenerCount(), 1);
+	TestEqual(TEXT("Survivor still receives payloads"), FSpatialApi::Publish(Bus, FVector::ZeroVector, 2.0f), 1);
+	Survivor->RemoveFromRoot();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusSpatialChannelScalingTest,
+	"EventBus.Perf.Spatial.TenThousandListeners",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FEventBusSpatialChannelScalingTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+	using FSpatialApi = TEventSpatialChannelApi<FEventBusSpatialPerfChannel>;
+
+	constexpr int32 ListenerCount = 10000;
+	constexpr int32 EventCount = 2000;
+	constexpr double MapExtent = 200000.0;
+	constexpr double ListenerRadius = 1500.0;
+
+	FEventBus Bus;
+	TestTrue(TEXT("Spatial perf channel register succeeds"), FSpatialApi::Register(Bus));
+
+	FRandomStream Random(0x5EB1);
+	TArray<UEventBusTestSpatialListenerObject*> Listeners;
+	TArray<FVector> ListenerLocations;
+	Listeners.Reserve(ListenerCount);
+	ListenerLocations.Reserve(ListenerCount);
+	for (int32 Index = 0; Index < ListenerCount; ++Index)
+	{
+		UEventBusTestSpatialListenerObject* Listener = NewObject<UEventBusTestSpatialListenerObject>();
+		const FVector Location(Random.FRandRange(-MapExtent, MapExtent), Random.FRandRange(-MapExtent, MapExtent), 0.0);
+		if (!NFL_EVENTBUS_ADD_SPATIAL_LISTENER(
+			Bus, FEventBusSpatialPerfChannel, Listener, UEventBusTestSpatialListenerObject, OnSpatialEvent, Location, ListenerRadius))
+		{
+			AddError(TEXT("Spatial listener add failed"));
+			return false;
+		}
+		Listeners.Add(Listener);
+		ListenerLocations.Add(Location);
+	}
+
+	TArray<FVector> EventLocations;
+	EventLocations.Reserve(EventCount);
+	for (int32 Index = 0; Index < EventCount; ++Index)
+	{
+		EventLocations.Emplace(Random.FRandRange(-MapExtent, MapExtent), Random.FRandRange(-MapExtent, MapExtent), 0.0);
+	}
+
+	// Reference cost: one distance check per listener per event, as a flat listener list would pay.
+	int64 BruteForceMatches = 0;
+	const double BruteForceStart = FPlatformTime::Seconds();
+	for (const FVector& EventLocation : EventLocations)
+	{
+		for (const FVector& ListenerLocation : ListenerLocations)
+		{
+			BruteForceMatches += FVector::DistSquared(EventLocation, ListenerLocation) <= FMath::Square(ListenerRadius) ? 1 : 0;
+		}
+	}
+	const double BruteForceSeconds = FPlatformTime::Seconds() - BruteForceStart;
+
+	int64 SpatialMatches = 0;
+	const double SpatialStart = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < EventCount; ++Index)
+	{
+		SpatialMatches += FSpatialApi::Publish(Bus, EventLocations[Index], static_cast<float>(Index));
+	}
+	const double SpatialSeconds = FPlatformTime::Seconds() - SpatialStart;
+
+	TestEqual(TEXT("Spatial publish reaches exactly the listeners a full scan selects"), SpatialMatches, BruteForceMatches);
+	AddInfo(FString::Printf(
+		TEXT("Spatial publish: %d listeners, %d events, %lld deliveries. Grid=%.3f ms (%.3f us/event) FullScan(distance only)=%.3f ms"),
+		ListenerCount,
+		EventCount,
+		SpatialMatches,
+		SpatialSeconds * 1000.0,
+		SpatialSeconds * 1000000.0 / EventCount,
+		BruteForceSeconds * 1000.0));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
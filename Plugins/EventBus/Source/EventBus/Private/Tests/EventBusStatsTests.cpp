@@ -0,0 +1,70 @@
+#include "Misc/AutomationTest.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "Tests/EventBusTestChannels.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusChannelStatsTest,
+	"EventBus.Stats.PerChannelCounters",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusChannelStatsTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+	using FApi = Tests::FValueChannelFixture::FApi;
+	using FBatchApi = Tests::FValueChannelFixture::FBatchApi;
+
+	Tests::FValueChannelFixture Fixture;
+	FEventBus& Bus = Fixture.Bus;
+	FEventChannelStats Stats;
+	TestFalse(TEXT("Stats query fails for unregistered channel"), Bus.GetChannelStats(TAG_EventBus_Test_Value, Stats));
+	if (!TestTrue(TEXT("Fixture setup succeeds"), Fixture.Setup()))
+	{
+		return false;
+	}
+
+	UEventBusTestListenerObject* Listener = NewObject<UEventBusTestListenerObject>();
+	TestTrue(TEXT("AddListener succeeds"),
+		NFL_EVENTBUS_ADD_LISTENER(Bus, FEventBusTestValueChannel, Listener, UEventBusTestListenerObject, OnValue));
+	TestTrue(TEXT("AddListener alt succeeds"),
+		NFL_EVENTBUS_ADD_LISTENER(Bus, FEventBusTestValueChannel, Listener, UEventBusTestListenerObject, OnValueAlt));
+
+	FApi::Broadcast(Bus, Fixture.Publisher, 1.0f);
+	FApi::Broadcast(Bus, Fixture.Publisher, 2.0f);
+
+	TestTrue(TEXT("Stats query succeeds"), Bus.GetChannelStats(TAG_EventBus_Test_Value, Stats));
+	TestEqual(TEXT("Publisher count"), Stats.PublisherCount, 1);
+	TestEqual(TEXT("Listener count"), Stats.ListenerCount, 2);
+	TestEqual(TEXT("Broadcast count"), Stats.BroadcastCount, static_cast<uint64>(2));
+	TestEqual(TEXT("Listener invocation count"), Stats.ListenerInvocationCount, static_cast<uint64>(4));
+	TestTrue(TEXT("Bind count covers both listeners"), Stats.BindCount >= 2);
+
+	TestTrue(TEXT("RemoveListener succeeds"),
+		NFL_EVENTBUS_REMOVE_LISTENER(Bus, FEventBusTestValueChannel, Listener, UEventBusTestListenerObject, OnValueAlt));
+	TestTrue(TEXT("Stats query after remove succeeds"), Bus.GetChannelStats(TAG_EventBus_Test_Value, Stats));
+	TestTrue(TEXT("Unbind counted"), Stats.UnbindCount > 0);
+
+	UEventBusTestBatchListenerObject* BatchListener = NewObject<UEventBusTestBatchListenerObject>();
+	TestTrue(TEXT("AddBatchListener succeeds"),
+		NFL_EVENTBUS_ADD_BATCH_LISTENER(Bus, FEventBusTestValueBatchChannel, BatchListener, UEventBusTestBatchListenerObject, OnBatch));
+	const float Payloads[] = {1.0f, 2.0f, 3.0f};
+	TestTrue(TEXT("PublishRange succeeds"), FBatchApi::PublishRange(Bus, MakeArrayView(Payloads)));
+	FBatchApi::Flush(Bus);
+	TestTrue(TEXT("Batch stats query succeeds"), Bus.GetChannelStats(TAG_EventBus_Test_ValueBatch, Stats));
+	TestEqual(TEXT("Batch broadcast count counts payloads"), Stats.BroadcastCount, static_cast<uint64>(3));
+	TestEqual(TEXT("Batch invocation count counts listener calls"), Stats.ListenerInvocationCount, static_cast<uint64>(1));
+
+	TMap<FGameplayTag, FEventChannelStats> AllStats;
+	Bus.GetAllChannelStats(AllStats);
+	TestEqual(TEXT("All-channel query covers delegate and batch channels"), AllStats.Num(), 2);
+
+	Bus.ResetChannelStats();
+	TestTrue(TEXT("Stats query after reset succeeds"), Bus.GetChannelStats(TAG_EventBus_Test_Value, Stats));
+	TestEqual(TEXT("Reset clears broadcast count"), Stats.BroadcastCount, static_cast<uint64>(0));
+	TestEqual(TEXT("Reset keeps live listener count"), Stats.ListenerCount, 1);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,17 @@
+#include "Tests/EventBusTestChannels.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+UE_DEFINE_GAMEPLAY_TAG(TAG_EventBus_Test_Value, "EventBus.Test.Value");
+UE_DEFINE_GAMEPLAY_TAG(TAG_EventBus_Test_ValueBatch, "EventBus.Test.ValueBatch");
+
+namespace Nfrrlib::EventBus::Tests
+{
+	bool FValueChannelFixture::Setup()
+	{
+		Publisher = NewObject<UEventBusTestPublisherObject>();
+		return FApi::Register(Bus) && FBatchApi::Register(Bus) && FApi::AddPublisher(Bus, Publisher);
+	}
+} // namespace Nfrrlib::EventBus::Tests
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NativeGameplayTags.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBus.h"
+#include "EventBus/Typed/EventChannelApi.h"
+#include "EventBus/Typed/EventChannelDef.h"
+#include "Tests/EventBusTestObjects.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_EventBus_Test_Value);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_EventBus_Test_ValueBatch);
+
+/** @brief Delegate channel shared by the stats, memory, diagnostics, timing and recorder suites. */
+NFL_DECLARE_EVENTBUS_CHANNEL(
+	FEventBusTestValueChannel,
+	FEventBusTestFloatDelegate,
+	UEventBusTestPublisherObject,
+	TAG_EventBus_Test_Value,
+	OnValueChanged
+);
+
+/** @brief Float batch channel shared by the same suites. */
+NFL_DECLARE_EVENTBUS_BATCH_CHANNEL(
+	FEventBusTestValueBatchChannel,
+	float,
+	TAG_EventBus_Test_ValueBatch
+);
+
+namespace Nfrrlib::EventBus::Tests
+{
+	/**
+	 * @brief Bus with both shared channels registered and one publisher bound to the delegate channel.
+	 */
+	struct FValueChannelFixture final
+	{
+		using FApi = TEventChannelApi<FEventBusTestValueChannel>;
+		using FBatchApi = TEventBatchChannelApi<FEventBusTestValueBatchChannel>;
+
+		FEventBus Bus;
+		UEventBusTestPublisherObject* Publisher = nullptr;
+
+		/** @brief Registers both channels and binds a new publisher. Returns false when any step fails. */
+		NFL_EVENTBUS_NODISCARD bool Setup();
+	};
+} // namespace Nfrrlib::EventBus::Tests
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -17,11 +17,12 @@ void UEventBusTestPublisherObject::EmitPair(const float InFirst, const int32 InS
 }
 
 /**
- * @brief Increments value callback counter.
+ * @brief Increments value callback counter and keeps the delivered value.
  */
-void UEventBusTestListenerObject::OnValue(const float NFL_EVENTBUS_MAYBE_UNUSED InValue)
+void UEventBusTestListenerObject::OnValue(const float InValue)
 {
 	++ValueCallCount;
+	LastValue = InValue;
 }
 
 /**
@@ -56,3 +57,22 @@ void UEventBusTestDerivedListenerObject::OnDerivedValue(const float NFL_EVENTBUS
 {
 	++DerivedValueCallCount;
 }
+
+/**
+ * @brief Accumulates batch call count and payload totals.
+ */
+void UEventBusTestBatchListenerObject::OnBatch(const TConstArrayView<float> Values)
+{
+	++BatchCallCount;
+	ReceivedPayloadCount += Values.Num();
+	for (const float Value : Values)
+	{
+		ReceivedPayloadSum += Value;
+	}
+}
+
+void UEventBusTestSpatialListenerObject::OnSpatialEvent(const float& Value)
+{
+	++ReceivedCount;
+	LastValue = Value;
+}
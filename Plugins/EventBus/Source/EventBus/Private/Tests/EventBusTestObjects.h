@@ -44,6 +44,7 @@ class EVENTBUS_API UEventBusTestListenerObject : public UObject
 
 public:
 	int32 ValueCallCount = 0;
+	float LastValue = 0.0f;
 	int32 ValueAltCallCount = 0;
 	int32 PairCallCount = 0;
 
@@ -79,3 +80,36 @@ public:
 	UFUNCTION()
 	void OnDerivedValue(float InValue);
 };
+
+/**
+ * @brief Native batch listener used to validate batched channel delivery.
+ */
+UCLASS()
+class EVENTBUS_API UEventBusTestBatchListenerObject : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	int32 BatchCallCount = 0;
+	int32 ReceivedPayloadCount = 0;
+	float ReceivedPayloadSum = 0.0f;
+
+	/** @brief Native batch callback accumulating every payload in the delivered span. */
+	void OnBatch(TConstArrayView<float> Values);
+};
+
+/**
+ * @brief Native spatial listener used to validate spatial channel delivery.
+ */
+UCLASS()
+class EVENTBUS_API UEventBusTestSpatialListenerObject : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	int32 ReceivedCount = 0;
+	float LastValue = 0.0f;
+
+	/** @brief Native spatial callback recording the delivered payload. */
+	void OnSpatialEvent(const float& Value);
+};
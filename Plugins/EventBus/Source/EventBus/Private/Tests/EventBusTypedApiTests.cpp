@@ -11,6 +11,8 @@
 #if WITH_DEV_AUTOMATION_TESTS
 
 UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_Typed, "EventBus.Test.Typed");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_TypedSlot, "EventBus.Test.TypedSlot");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_EventBus_Test_TypedSlotPair, "EventBus.Test.TypedSlotPair");
 
 NFL_DECLARE_EVENTBUS_CHANNEL(
 	FEventBusTypedTestChannel,
@@ -20,6 +22,22 @@ NFL_DECLARE_EVENTBUS_CHANNEL(
 	OnValueChanged
 );
 
+NFL_DECLARE_EVENTBUS_CHANNEL(
+	FEventBusTypedSlotTestChannel,
+	FEventBusTestFloatDelegate,
+	UEventBusTestPublisherObject,
+	TAG_EventBus_Test_TypedSlot,
+	OnValueChanged
+);
+
+NFL_DECLARE_EVENTBUS_CHANNEL(
+	FEventBusTypedSlotPairTestChannel,
+	FEventBusTestPairDelegate,
+	UEventBusTestPublisherObject,
+	TAG_EventBus_Test_TypedSlotPair,
+	OnPairChanged
+);
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 	FEventBusTypedApiRegisterTest,
 	"EventBus.Typed.RegisterAndPointerBinding",
@@ -50,4 +68,80 @@ bool FEventBusTypedApiRegisterTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UN
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusTypedApiStaticSlotTest,
+	"EventBus.Typed.StaticSlotRegistration",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusTypedApiStaticSlotTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+	using FSlotApi = TEventChannelApi<FEventBusTypedSlotTestChannel>;
+	using FPairApi = TEventChannelApi<FEventBusTypedSlotPairTestChannel>;
+
+	TestTrue(TEXT("Typed channel owns a static slot"), FEventBusTypedSlotTestChannel::GetChannelId().HasSlot());
+	TestNotEqual(TEXT("Typed channels own distinct slots"),
+		FEventBusTypedSlotTestChannel::GetStaticSlotIndex(),
+		FEventBusTypedSlotPairTestChannel::GetStaticSlotIndex());
+	TestEqual(TEXT("Repeated declaration keys share one slot"),
+		FEventBusStaticChannelRegistry::AllocateSlot(FEventBusTypedSlotTestChannel::GetChannelKey()),
+		FEventBusTypedSlotTestChannel::GetStaticSlotIndex());
+
+	FEventBus Bus;
+	const bool bRegistered = RegisterEventChannels<FEventBusTypedSlotTestChannel, FEventBusTypedSlotPairTestChannel>(Bus);
+	TestTrue(TEXT("Bulk typed registration succeeds"), bRegistered);
+	TestTrue(TEXT("First typed channel is registered"), FSlotApi::IsRegistered(Bus));
+	TestTrue(TEXT("Second typed channel is registered"), FPairApi::IsRegistered(Bus));
+
+	UEventBusTestPublisherObject* Publisher = NewObject<UEventBusTestPublisherObject>();
+	UEventBusTestListenerObject* Listener = NewObject<UEventBusTestListenerObject>();
+	TestTrue(TEXT("Typed AddPublisher through slot succeeds"), FSlotApi::AddPublisher(Bus, Publisher));
+	TestTrue(TEXT("Typed AddListener through slot succeeds"),
+		NFL_EVENTBUS_ADD_LISTENER(Bus, FEventBusTypedSlotTestChannel, Listener, UEventBusTestListenerObject, OnValue));
+
+	Publisher->EmitValue(1.0f);
+	TestEqual(TEXT("Listener called through slot route"), Listener->ValueCallCount, 1);
+
+	const FStaticChannelId ForeignId{FEventBusTypedSlotTestChannel::GetStaticSlotIndex(), TAG_EventBus_Test_Typed};
+	TestFalse(TEXT("Slot hit for another tag falls back to tag lookup"), Bus.IsChannelRegistered(ForeignId));
+	TestTrue(TEXT("Slot still resolves its own channel"), FSlotApi::IsRegistered(Bus));
+
+	TestTrue(TEXT("Unregister by tag succeeds"), Bus.UnregisterChannel(TAG_EventBus_Test_TypedSlot));
+	TestFalse(TEXT("Slot is cleared after tag unregistration"), FSlotApi::IsRegistered(Bus));
+	TestFalse(TEXT("Typed AddPublisher fails after unregistration"), FSlotApi::AddPublisher(Bus, Publisher));
+
+	FChannelRegistration Registration;
+	Registration.ChannelTag = TAG_EventBus_Test_TypedSlot;
+	TestTrue(TEXT("Re-register by tag succeeds"), Bus.RegisterChannel(Registration));
+	TestTrue(TEXT("Slot rebinds after tag re-registration"), FSlotApi::AddPublisher(Bus, Publisher));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEventBusTypedApiDescriptorTest,
+	"EventBus.Typed.ChannelDescriptors",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEventBusTypedApiDescriptorTest::RunTest(const FString& NFL_EVENTBUS_MAYBE_UNUSED Parameters)
+{
+	using namespace Nfrrlib::EventBus;
+
+	TArray<FStaticChannelDescriptor> Descriptors;
+	FEventBusStaticChannelRegistry::GetChannelDescriptors(Descriptors);
+	if (!TestTrue(TEXT("Descriptor index is in range"), Descriptors.IsValidIndex(FEventBusTypedSlotPairTestChannel::DescriptorIndex)))
+	{
+		return false;
+	}
+
+	const FStaticChannelDescriptor& Descriptor = Descriptors[FEventBusTypedSlotPairTestChannel::DescriptorIndex];
+	TestEqual(TEXT("Definition name is recorded"), Descriptor.ChannelDefName, FString(TEXT("FEventBusTypedSlotPairTestChannel")));
+	TestEqual(TEXT("Channel tag resolves"), Descriptor.ChannelTag, TAG_EventBus_Test_TypedSlotPair.GetTag());
+	TestEqual(TEXT("Publisher class path resolves"), Descriptor.PublisherClassPath, FSoftClassPath(UEventBusTestPublisherObject::StaticClass()));
+	TestEqual(TEXT("Delegate property resolves"), Descriptor.DelegatePropertyName, GET_MEMBER_NAME_CHECKED(UEventBusTestPublisherObject, OnPairChanged));
+	TestNotEqual(TEXT("Each declaration has its own descriptor"),
+		FEventBusTypedTestChannel::DescriptorIndex,
+		FEventBusTypedSlotTestChannel::DescriptorIndex);
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+
+/**
+ * @brief Compiles Log-level Blueprint facade diagnostics in or out.
+ *
+ * Defaults to off in Shipping. Warnings for rejected calls and the structured counters are kept
+ * either way; only request/result trace lines are stripped.
+ */
+#ifndef NFL_EVENTBUS_FACADE_LOGGING
+	#define NFL_EVENTBUS_FACADE_LOGGING (!UE_BUILD_SHIPPING)
+#endif
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Blueprint facade entry points tracked by FEventBusBlueprintDiagnostics.
+	 *
+	 * Validated and unvalidated node variants share one entry.
+	 */
+	enum class EEventBusBlueprintApi : uint8
+	{
+		RegisterChannel,
+		UnregisterChannel,
+		AddPublisher,
+		RemovePublisher,
+		AddListener,
+		RemoveListener,
+		GetKnownListenerFunctions,
+		RecordPublisherBinding,
+		RecordListenerBinding,
+		AddPublisherBindings,
+		AddListenerBindings,
+		RemoveListenerBindings,
+		Count
+	};
+
+	/**
+	 * @brief Returns a readable string for EEventBusBlueprintApi values.
+	 */
+	NFL_EVENTBUS_NODISCARD EVENTBUS_API const TCHAR* LexToString(EEventBusBlueprintApi Api);
+
+	/**
+	 * @brief Verbosity tier for facade request/result lines, selected by `EventBus.BP.LogMode`.
+	 */
+	enum class EEventBusBlueprintLogMode : uint8
+	{
+		/** @brief Counters only. */
+		Off,
+		/** @brief One call in `EventBus.BP.LogSampleInterval` per API is logged. */
+		Sampled,
+		/** @brief Every call is logged. */
+		Verbose
+	};
+
+	/**
+	 * @brief Cumulative counters for one facade entry point.
+	 */
+	struct FEventBusBlueprintApiCounters final
+	{
+		uint64 Calls = 0;
+		uint64 Failures = 0;
+		/** @brief Calls whose request/result lines were written to the log. */
+		uint64 LoggedCalls = 0;
+	};
+
+	/**
+	 * @brief Structured counters and tiered logging decisions for the Blueprint facade.
+	 *
+	 * Game-thread only, like the facade itself.
+	 */
+	class EVENTBUS_API FEventBusBlueprintDiagnostics final
+	{
+	public:
+		/** @brief Counts one call and returns true when its request/result lines should be logged. */
+		NFL_EVENTBUS_NODISCARD static bool BeginCall(EEventBusBlueprintApi Api);
+		/** @brief Counts one call outcome. */
+		static void EndCall(EEventBusBlueprintApi Api, bool bSucceeded);
+		/** @brief Returns counters for one entry point. */
+		NFL_EVENTBUS_NODISCARD static FEventBusBlueprintApiCounters GetCounters(EEventBusBlueprintApi Api);
+		/** @brief Clears every counter. */
+		static void ResetCounters();
+		/** @brief Writes one counter row per entry point. */
+		static void DumpCounters(FOutputDevice& Ar);
+
+		/** @brief Returns the active tier; always Off when facade logging is compiled out. */
+		NFL_EVENTBUS_NODISCARD static EEventBusBlueprintLogMode GetLogMode();
+		/** @brief Returns true when the CallIndex-th call (1-based) is logged under Mode with SampleInterval. */
+		NFL_EVENTBUS_NODISCARD static bool ShouldLogCall(uint64 CallIndex, EEventBusBlueprintLogMode Mode, int32 SampleInterval);
+	};
+
+	/**
+	 * @brief Counts one facade call for its lifetime; the outcome defaults to failure until SetSucceeded.
+	 */
+	class FScopedBlueprintCall final
+	{
+	public:
+		explicit FScopedBlueprintCall(const EEventBusBlueprintApi InApi)
+			: Api(InApi)
+			, bLogCall(FEventBusBlueprintDiagnostics::BeginCall(InApi))
+		{
+		}
+
+		~FScopedBlueprintCall()
+		{
+			FEventBusBlueprintDiagnostics::EndCall(Api, bSucceeded);
+		}
+
+		FScopedBlueprintCall(const FScopedBlueprintCall&) = delete;
+		FScopedBlueprintCall& operator=(const FScopedBlueprintCall&) = delete;
+
+		/** @brief Returns true when this call's request/result lines should be logged. */
+		NFL_EVENTBUS_NODISCARD bool ShouldLog() const
+		{
+			return bLogCall;
+		}
+
+		/** @brief Records the call outcome and returns it unchanged. */
+		bool SetSucceeded(const bool bInSucceeded)
+		{
+			bSucceeded = bInSucceeded;
+			return bInSucceeded;
+		}
+
+	private:
+		EEventBusBlueprintApi Api = EEventBusBlueprintApi::Count;
+		bool bLogCall = false;
+		bool bSucceeded = false;
+	};
+} // namespace Nfrrlib::EventBus
+
+/**
+ * @brief Writes one facade Log line when bLogCall is true; arguments are evaluated only in that case.
+ */
+#if NFL_EVENTBUS_FACADE_LOGGING
+	#define NFL_EVENTBUS_FACADE_LOG(bLogCall, Format, ...) \
+		do { if (bLogCall) { UE_LOG(LogNFLEventBus, Log, Format, ##__VA_ARGS__); } } while (0)
+#else
+	#define NFL_EVENTBUS_FACADE_LOG(bLogCall, Format, ...) \
+		do { NFL_EVENTBUS_UNUSED(bLogCall); } while (0)
+#endif
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "UObject/FieldPath.h"
+#include "UObject/UnrealType.h"
 
 #include "EventBus/Core/EventBusAttributes.h"
 
@@ -10,6 +12,110 @@
 
 class UEventBusSubsystem;
 
+/**
+ * @brief Result of a handle-returning bind; removing through it skips subsystem resolution entirely.
+ */
+USTRUCT(BlueprintType)
+struct EVENTBUS_API FEventBusBindingHandle
+{
+	GENERATED_BODY()
+
+	/** @brief Subsystem whose bus accepted the binding; the handle goes stale when it is torn down. */
+	UPROPERTY()
+	TWeakObjectPtr<UEventBusSubsystem> Subsystem;
+
+	/** @brief Channel the binding was added to. */
+	UPROPERTY(BlueprintReadOnly, Category = "EventBus")
+	FGameplayTag ChannelTag;
+
+	/** @brief Bound publisher or listener object. */
+	UPROPERTY()
+	TWeakObjectPtr<UObject> BoundObject;
+
+	/** @brief Listener function name, or publisher delegate property name. */
+	UPROPERTY(BlueprintReadOnly, Category = "EventBus")
+	FName MemberName = NAME_None;
+
+	/** @brief True for listener bindings, false for publisher bindings. */
+	UPROPERTY(BlueprintReadOnly, Category = "EventBus")
+	bool bIsListener = false;
+
+	/** @brief Returns true while the subsystem and bound object are both alive. */
+	NFL_EVENTBUS_NODISCARD bool IsValid() const
+	{
+		return ChannelTag.IsValid() && Subsystem.IsValid() && BoundObject.IsValid();
+	}
+};
+
+/**
+ * @brief Binding members resolved and checked by a filtered EventBus node when its Blueprint compiled.
+ *
+ * The node passes the token to AddListenerTrusted or AddPublisherTrusted, and the core uses the resolved members
+ * in place of reflection lookups. Builds with NFL_EVENTBUS_CHECK_TRUSTED_BINDINGS re-resolve by name and fall back
+ * to full validation on mismatch.
+ */
+USTRUCT(BlueprintType)
+struct EVENTBUS_API FEventBusBindingToken
+{
+	GENERATED_BODY()
+
+	/** @brief Class the binding was proven against; bound objects must be this class or a subclass. */
+	UPROPERTY()
+	TObjectPtr<UClass> ObjectClass;
+
+	/** @brief Listener function resolved at compile time; null for publisher tokens. */
+	UPROPERTY()
+	TObjectPtr<UFunction> ListenerFunction;
+
+	/** @brief Channel signature ListenerFunction was proven compatible with; null when the channel was unknown. */
+	UPROPERTY()
+	TObjectPtr<UFunction> ProvenSignature;
+
+	/** @brief Publisher delegate property resolved at compile time; empty for listener tokens. */
+	UPROPERTY()
+	TFieldPath<FMulticastDelegateProperty> DelegateProperty;
+
+	/** @brief Returns true when the token carries a resolved member. */
+	NFL_EVENTBUS_NODISCARD bool IsValid() const
+	{
+		return ObjectClass != nullptr && (ListenerFunction != nullptr || !DelegateProperty.IsPathToFieldEmpty());
+	}
+};
+
+/**
+ * @brief One channel/delegate pair for AddPublisherBindings.
+ */
+USTRUCT(BlueprintType)
+struct EVENTBUS_API FEventBusPublisherBindingEntry
+{
+	GENERATED_BODY()
+
+	/** @brief Channel the publisher joins. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EventBus")
+	FGameplayTag ChannelTag;
+
+	/** @brief Publisher multicast delegate property bound on that channel. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EventBus")
+	FName DelegatePropertyName = NAME_None;
+};
+
+/**
+ * @brief One channel/function pair for AddListenerBindings and RemoveListenerBindings.
+ */
+USTRUCT(BlueprintType)
+struct EVENTBUS_API FEventBusListenerBindingEntry
+{
+	GENERATED_BODY()
+
+	/** @brief Channel the listener joins or leaves. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EventBus")
+	FGameplayTag ChannelTag;
+
+	/** @brief Listener UFUNCTION bound on that channel. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EventBus")
+	FName FunctionName = NAME_None;
+};
+
 /**
  * @brief Blueprint facade for the v2 EventBus runtime.
  */
@@ -31,6 +137,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "EventBus", meta = (WorldContext = "WorldContextObject"))
 	static bool AddPublisherValidated(UObject* WorldContextObject, FGameplayTag ChannelTag, UObject* PublisherObj, FName DelegatePropertyName);
 
+	/** @brief Compiled form of the filtered AddPublisherValidated node; Token carries the delegate property resolved at compile time. */
+	UFUNCTION(BlueprintCallable, Category = "EventBus", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
+	static bool AddPublisherTrusted(UObject* WorldContextObject, FGameplayTag ChannelTag, UObject* PublisherObj, FName DelegatePropertyName, const FEventBusBindingToken& Token);
+
 	/** @brief Adds a publisher binding to a channel. Successful binds are stored in runtime history. */
 	UFUNCTION(BlueprintCallable, Category = "EventBus", meta = (WorldContext = "WorldContextObject"))
 	static bool AddPublisher(UObject* WorldContextObject, FGameplayTag ChannelTag, UObject* PublisherObj, FName DelegatePropertyName);
@@ -43,6 +153,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "EventBus", meta = (WorldContext = "WorldContextObject"))
 	static bool AddListenerValidated(UObject* WorldContextObject, FGameplayTag ChannelTag, UObject* ListenerObj, FName FunctionName);
 
+	/** @brief Compiled form of the filtered AddListenerValidated node; Token carries the function and signature proven at compile time. */
+	UFUNCTION(BlueprintCallable, Category = "EventBus", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
+	static bool AddListenerTrusted(UObject* WorldContextObject, FGameplayTag ChannelTag, UObject* ListenerObj, FName FunctionName, const FEventBusBindingToken& Token);
+
 	/** @brief Adds a listener binding to a channel. Successful binds are stored in runtime history. */
 	UFUNCTION(BlueprintCallable, Category = "EventBus", meta = (WorldContext = "WorldContextObject"))
 	static bool AddListener(UObject* WorldContextObject, FGameplayTag ChannelTag, UObject* ListenerObj, FName FunctionName);
@@ -51,6 +165,50 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "EventBus", meta = (WorldContext = "WorldContextObject"))
 	static bool RemoveListener(UObject* WorldContextObject, FGameplayTag ChannelTag, UObject* ListenerObj, FName FunctionName);
 
+	/** @brief Adds a publisher binding and returns a handle for RemoveBindingByHandle; the handle is invalid on failure. */
+	UFUNCTION(BlueprintCallable, Category = "EventBus", meta = (WorldContext = "WorldContextObject"))
+	static FEventBusBindingHandle AddPublisherWithHandle(UObject* WorldContextObject, FGameplayTag ChannelTag, UObject* PublisherObj, FName DelegatePropertyName);
+
+	/** @brief Adds a listener binding and returns a handle for RemoveBindingByHandle; the handle is invalid on failure. */
+	UFUNCTION(BlueprintCallable, Category = "EventBus", meta = (WorldContext = "WorldContextObject"))
+	static FEventBusBindingHandle AddListenerWithHandle(UObject* WorldContextObject, FGameplayTag ChannelTag, UObject* ListenerObj, FName FunctionName);
+
+	/** @brief Removes the binding behind Handle without resolving the subsystem, then clears Handle on success. */
+	UFUNCTION(BlueprintCallable, Category = "EventBus")
+	static bool RemoveBindingByHandle(UPARAM(ref) FEventBusBindingHandle& Handle);
+
+	/** @brief Returns true while Handle's subsystem and bound object are alive. */
+	UFUNCTION(BlueprintPure, Category = "EventBus")
+	static bool IsBindingHandleValid(const FEventBusBindingHandle& Handle);
+
+	/**
+	 * @brief Binds one publisher to several channels with one subsystem lookup.
+	 * OutResults holds one flag per entry in order. Returns the number of successful binds.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EventBus", meta = (WorldContext = "WorldContextObject"))
+	static int32 AddPublisherBindings(UObject* WorldContextObject, UObject* PublisherObj, const TArray<FEventBusPublisherBindingEntry>& Bindings, TArray<bool>& OutResults);
+
+	/**
+	 * @brief Binds one listener to several channels with one subsystem lookup.
+	 * OutResults holds one flag per entry in order. Returns the number of successful binds.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EventBus", meta = (WorldContext = "WorldContextObject"))
+	static int32 AddListenerBindings(UObject* WorldContextObject, UObject* ListenerObj, const TArray<FEventBusListenerBindingEntry>& Bindings, TArray<bool>& OutResults);
+
+	/**
+	 * @brief Binds one listener function to every channel in ChannelTags with one subsystem lookup.
+	 * OutResults follows the container's iteration order. Returns the number of successful binds.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EventBus", meta = (WorldContext = "WorldContextObject"))
+	static int32 AddListenerToChannels(UObject* WorldContextObject, const FGameplayTagContainer& ChannelTags, UObject* ListenerObj, FName FunctionName, TArray<bool>& OutResults);
+
+	/**
+	 * @brief Removes several listener bindings of one object with one subsystem lookup.
+	 * OutResults holds one flag per entry in order. Returns the number of removed bindings.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EventBus", meta = (WorldContext = "WorldContextObject"))
+	static int32 RemoveListenerBindings(UObject* WorldContextObject, UObject* ListenerObj, const TArray<FEventBusListenerBindingEntry>& Bindings, TArray<bool>& OutResults);
+
 	/** @brief Returns listener functions recorded in runtime history for a channel/class pair. */
 	UFUNCTION(BlueprintPure, Category = "EventBus", meta = (WorldContext = "WorldContextObject"))
 	static TArray<FName> GetKnownListenerFunctions(UObject* WorldContextObject, FGameplayTag ChannelTag, TSubclassOf<UObject> ListenerClass);
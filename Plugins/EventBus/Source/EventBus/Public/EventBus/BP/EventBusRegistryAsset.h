@@ -3,9 +3,120 @@
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
 #include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/TopLevelAssetPath.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
 
 #include "EventBusRegistryAsset.generated.h"
 
+/**
+ * @brief Compiles runtime history recording of Blueprint binds in when non-zero.
+ *
+ * Defaults to off in Shipping, where pickers and lookups read a baked registry instead
+ * (UEventBusSettings::BakedRegistry). The `bRecordRuntimeHistory` setting can also turn recording off at runtime.
+ */
+#ifndef NFL_EVENTBUS_RUNTIME_HISTORY
+	#define NFL_EVENTBUS_RUNTIME_HISTORY (!UE_BUILD_SHIPPING)
+#endif
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Hash key of one runtime history entry: channel and class, plus the delegate name for publishers.
+	 */
+	struct FRegistryHistoryKey final
+	{
+		/** @brief Channel of the history entry. */
+		FGameplayTag ChannelTag;
+		/** @brief Publisher or listener class identity. */
+		FObjectKey Class;
+		/** @brief Publisher delegate property name; NAME_None for listener entries. */
+		FName MemberName = NAME_None;
+
+		friend bool operator==(const FRegistryHistoryKey& Lhs, const FRegistryHistoryKey& Rhs)
+		{
+			return Lhs.ChannelTag == Rhs.ChannelTag && Lhs.Class == Rhs.Class && Lhs.MemberName == Rhs.MemberName;
+		}
+
+		friend uint32 GetTypeHash(const FRegistryHistoryKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.ChannelTag), GetTypeHash(Key.Class)), GetTypeHash(Key.MemberName));
+		}
+	};
+
+	/**
+	 * @brief Hash key of one baked listener entry: channel and class path, so lookups never load the class.
+	 */
+	struct FRegistryBakedKey final
+	{
+		/** @brief Channel of the baked entry. */
+		FGameplayTag ChannelTag;
+		/** @brief Listener class path. */
+		FTopLevelAssetPath ClassPath;
+
+		friend bool operator==(const FRegistryBakedKey& Lhs, const FRegistryBakedKey& Rhs)
+		{
+			return Lhs.ChannelTag == Rhs.ChannelTag && Lhs.ClassPath == Rhs.ClassPath;
+		}
+
+		friend uint32 GetTypeHash(const FRegistryBakedKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.ChannelTag), GetTypeHash(Key.ClassPath));
+		}
+	};
+
+	/**
+	 * @brief Recency order over the slots of one history array, as an index-linked list.
+	 *
+	 * Touch, insert and eviction are O(1). Evicted slots are filled by swapping in the last array element.
+	 * MoveSlot keeps the links in step with that swap.
+	 */
+	struct EVENTBUS_API FRegistryHistoryLru final
+	{
+		/** @brief Rebuilds the order from array order: slot 0 least recent, Num - 1 most recent. */
+		void Reset(int32 Num);
+		/** @brief Appends a new slot Num() as most recent. */
+		void Add();
+		/** @brief Marks Slot most recently used. */
+		void Touch(int32 Slot);
+		/** @brief Returns the least recently used slot, or INDEX_NONE when empty. */
+		NFL_EVENTBUS_NODISCARD int32 GetLeastRecent() const { return Tail; }
+		/**
+		 * @brief Drops Slot. When Slot is not the last slot, the last slot takes its place, matching
+		 * TArray::RemoveAtSwap on the history array.
+		 */
+		void RemoveSwap(int32 Slot);
+		/** @brief Returns the number of tracked slots. */
+		NFL_EVENTBUS_NODISCARD int32 Num() const { return Prev.Num(); }
+
+	private:
+		void Unlink(int32 Slot);
+		void LinkFront(int32 Slot);
+
+		TArray<int32> Prev;
+		TArray<int32> Next;
+		/** @brief Most recently used slot. */
+		int32 Head = INDEX_NONE;
+		/** @brief Least recently used slot. */
+		int32 Tail = INDEX_NONE;
+	};
+
+	/**
+	 * @brief Runtime history counters for picker lookups and capacity evictions.
+	 */
+	struct FRegistryHistoryStats final
+	{
+		/** @brief GetKnownListenerFunctions calls that found an entry. */
+		uint64 LookupHits = 0;
+		/** @brief GetKnownListenerFunctions calls that found nothing. */
+		uint64 LookupMisses = 0;
+		/** @brief Entries evicted because a capacity from UEventBusSettings was reached. */
+		uint64 Evictions = 0;
+	};
+} // namespace Nfrrlib::EventBus
+
 USTRUCT(BlueprintType)
 struct EVENTBUS_API FEventBusPublisherHistoryEntry
 {
@@ -42,11 +153,58 @@ struct EVENTBUS_API FEventBusListenerHistoryEntry
 	TArray<FName> KnownFunctions;
 };
 
+USTRUCT(BlueprintType)
+struct EVENTBUS_API FEventBusBakedPublisherEntry
+{
+	GENERATED_BODY()
+
+	/** @brief Channel for this baked publisher binding. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "EventBus")
+	FGameplayTag ChannelTag;
+
+	/** @brief Publisher class path; loading the baked registry does not load the class. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "EventBus")
+	FSoftClassPath PublisherClassPath;
+
+	/** @brief Publisher multicast delegate property name. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "EventBus")
+	FName DelegatePropertyName = NAME_None;
+};
+
+USTRUCT(BlueprintType)
+struct EVENTBUS_API FEventBusBakedListenerEntry
+{
+	GENERATED_BODY()
+
+	/** @brief Channel for this baked listener entry. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "EventBus")
+	FGameplayTag ChannelTag;
+
+	/** @brief Listener class path; loading the baked registry does not load the class. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "EventBus")
+	FSoftClassPath ListenerClassPath;
+
+	/** @brief Sorted listener function names baked for this class/channel pair. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "EventBus")
+	TArray<FName> KnownFunctions;
+};
+
 /**
  * @brief Runtime history registry for blueprint channel/publisher/listener bindings.
  *
  * This object is not used as a manual rule table. It is populated dynamically
  * at runtime when successful binds occur.
+ *
+ * Entries are indexed by channel and class, so recording and lookups are hash lookups, and each entry's
+ * KnownFunctions stays sorted through binary-search inserts. On the subsystem's runtime registry, entries whose
+ * class was collected are pruned after garbage collection (EnableGarbageCollectPruning) without disturbing the
+ * recency of the rest. Direct edits to the history arrays are picked up by a full reindex on the next record.
+ * Records and lookups refresh an entry's recency. Past the UEventBusSettings capacities the least recently
+ * used entry is evicted in O(1), so array order is not insertion order.
+ *
+ * Saved instances are baked registries, written by the editor's `EventBus.Registry.Bake` command. They hold
+ * class paths only (BakedPublishers, BakedListeners), so loading one loads no Blueprint class. The runtime
+ * instance answers lookups its own history misses from the baked entries (SetBakedSource).
  */
 UCLASS(BlueprintType)
 class EVENTBUS_API UEventBusRegistryAsset : public UDataAsset
@@ -54,6 +212,11 @@ class EVENTBUS_API UEventBusRegistryAsset : public UDataAsset
 	GENERATED_BODY()
 
 public:
+	virtual void BeginDestroy() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 	/** @brief Records one publisher binding into runtime history. */
 	UFUNCTION(BlueprintCallable, Category = "EventBus")
 	void RecordPublisherBinding(const FGameplayTag& ChannelTag, UClass* PublisherClass, FName DelegatePropertyName);
@@ -70,10 +233,98 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "EventBus")
 	void ResetHistory();
 
+	/** @brief Replaces this registry's history with Source's and reindexes it. */
+	void CopyHistoryFrom(const UEventBusRegistryAsset& Source);
+
+	/** @brief Replaces the baked entries with Source's runtime history stored as class paths. */
+	void BakeFrom(const UEventBusRegistryAsset& Source);
+
+	/**
+	 * @brief Answers lookups this registry's history misses from Baked's entries, and seeds listener entries
+	 * with them. Indexes the baked listeners by class path once; no class is loaded. nullptr drops the source.
+	 */
+	void SetBakedSource(UEventBusRegistryAsset* Baked);
+
+	/**
+	 * @brief Call after editing PublisherHistory or ListenerHistory in place; the next record or lookup reindexes.
+	 * Resizing the arrays is detected without it.
+	 */
+	void MarkHistoryEdited();
+
+	/**
+	 * @brief Prunes entries whose class was collected after every garbage collection, until this registry is destroyed.
+	 * Only the subsystem's transient runtime registry opts in; baked assets and scratch copies never record.
+	 */
+	void EnableGarbageCollectPruning();
+
+	/** @brief Returns true when Blueprint binds should be recorded; false when compiled out or disabled in settings. */
+	NFL_EVENTBUS_NODISCARD
+	static bool IsRecordingEnabled();
+
+	/** @brief Returns picker lookup hit/miss and eviction counters. */
+	NFL_EVENTBUS_NODISCARD
+	const Nfrrlib::EventBus::FRegistryHistoryStats& GetStats() const;
+	/** @brief Zeroes the lookup and eviction counters. */
+	void ResetStats();
+
 public:
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient, Category = "EventBus|History")
+	/** @brief Runtime publisher history of loaded classes; never saved. */
+	UPROPERTY(Transient, VisibleAnywhere, BlueprintReadOnly, Category = "EventBus|History")
 	TArray<FEventBusPublisherHistoryEntry> PublisherHistory;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient, Category = "EventBus|History")
+	/** @brief Runtime listener history of loaded classes; never saved. */
+	UPROPERTY(Transient, VisibleAnywhere, BlueprintReadOnly, Category = "EventBus|History")
 	TArray<FEventBusListenerHistoryEntry> ListenerHistory;
+
+	/** @brief Publisher entries saved by `EventBus.Registry.Bake`. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "EventBus|Baked")
+	TArray<FEventBusBakedPublisherEntry> BakedPublishers;
+
+	/** @brief Listener entries saved by `EventBus.Registry.Bake`. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "EventBus|Baked")
+	TArray<FEventBusBakedListenerEntry> BakedListeners;
+
+private:
+	/** @brief Returns true when the indexes were built for the current history contents. */
+	NFL_EVENTBUS_NODISCARD bool AreHistoryIndexesCurrent() const;
+	/** @brief Reindexes when the history was edited or resized outside the record/reset API. */
+	void EnsureHistoryIndexes();
+	/** @brief Drops invalid entries, normalizes function lists and rebuilds both indexes. */
+	void RebuildHistoryIndexes();
+	/** @brief Prunes entries whose class was collected, keeping the indexes and recency of the rest. */
+	void HandlePostGarbageCollect();
+	/** @brief Evicts least recently used publishers until the configured capacity holds. */
+	void EnforcePublisherCapacity();
+	/** @brief Evicts least recently used listeners until the configured capacity holds. */
+	void EnforceListenerCapacity();
+	/** @brief Returns the baked listener entry for ListenerClass on ChannelTag, or nullptr. */
+	const FEventBusBakedListenerEntry* FindBakedListener(const FGameplayTag& ChannelTag, const UClass* ListenerClass) const;
+
+	/** @brief PublisherHistory position per (channel, class, delegate). */
+	TMap<Nfrrlib::EventBus::FRegistryHistoryKey, int32> PublisherIndex;
+	/** @brief ListenerHistory position per (channel, class); the first entry wins when edits left duplicates. */
+	TMap<Nfrrlib::EventBus::FRegistryHistoryKey, int32> ListenerIndex;
+	/** @brief PublisherHistory size the index was built for. */
+	int32 IndexedPublisherCount = 0;
+	/** @brief ListenerHistory size the index was built for. */
+	int32 IndexedListenerCount = 0;
+	/** @brief Bumped by MarkHistoryEdited and editor property changes. */
+	uint32 HistoryEditSerial = 0;
+	/** @brief HistoryEditSerial the indexes were built for. */
+	uint32 IndexedEditSerial = 0;
+	/** @brief True when direct edits left several listener entries per (channel, class); lookups then merge linearly. */
+	bool bHasDuplicateListenerKeys = false;
+	/** @brief Recency order of PublisherHistory slots. */
+	Nfrrlib::EventBus::FRegistryHistoryLru PublisherLru;
+	/** @brief Recency order of ListenerHistory slots; lookups refresh it, hence mutable. */
+	mutable Nfrrlib::EventBus::FRegistryHistoryLru ListenerLru;
+	/** @brief Lookup and eviction counters. */
+	mutable Nfrrlib::EventBus::FRegistryHistoryStats Stats;
+	/** @brief Post-GC hook used to prune collected classes. */
+	FDelegateHandle PostGarbageCollectHandle;
+	/** @brief Baked registry consulted on lookup misses; referenced so it stays loaded. */
+	UPROPERTY(Transient)
+	TObjectPtr<UEventBusRegistryAsset> BakedSource;
+	/** @brief BakedSource->BakedListeners position per (channel, class path). */
+	TMap<Nfrrlib::EventBus::FRegistryBakedKey, int32> BakedListenerIndex;
 };
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "UObject/SoftObjectPtr.h"
+
+#include "EventBusSettings.generated.h"
+
+class UEventBusRegistryAsset;
+
+/**
+ * @brief Project-wide EventBus settings, edited under Project Settings > Plugins > EventBus.
+ */
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "EventBus"))
+class EVENTBUS_API UEventBusSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UEventBusSettings();
+
+	/** @brief Publisher history entries kept by the runtime registry before the least recently used is evicted. 0 disables the bound. */
+	UPROPERTY(Config, EditAnywhere, Category = "Runtime History", meta = (ClampMin = "0"))
+	int32 MaxPublisherHistoryEntries = 512;
+
+	/** @brief Listener history entries kept by the runtime registry before the least recently used is evicted. 0 disables the bound. */
+	UPROPERTY(Config, EditAnywhere, Category = "Runtime History", meta = (ClampMin = "0"))
+	int32 MaxListenerHistoryEntries = 512;
+
+	/**
+	 * @brief Records successful Blueprint binds into runtime history. Ignored when NFL_EVENTBUS_RUNTIME_HISTORY
+	 * compiles recording out.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Runtime History")
+	bool bRecordRuntimeHistory = true;
+
+	/**
+	 * @brief Baked registry that answers runtime history lookup misses, written by `EventBus.Registry.Bake`.
+	 * Each subsystem loads it asynchronously at startup. The bake adds its directory to DirectoriesToAlwaysCook,
+	 * since a config soft reference alone is not followed by the cooker.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Runtime History")
+	TSoftObjectPtr<UEventBusRegistryAsset> BakedRegistry;
+};
@@ -2,13 +2,34 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "UObject/UObjectGlobals.h"
 
 #include "EventBus/Core/EventBusAttributes.h"
 #include "EventBus/Core/EventBus.h"
+#include "EventBus/Core/EventBusScopes.h"
 
 #include "EventBusSubsystem.generated.h"
 
 class UEventBusRegistryAsset;
+class ULevel;
+class UPackage;
+class UWorld;
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Counters of the per-world subsystem cache used by Blueprint facade calls.
+	 */
+	struct FEventBusSubsystemCacheStats final
+	{
+		/** @brief Lookups answered from the cache. */
+		uint64 Hits = 0;
+		/** @brief Lookups that fell back to the full world/game-instance resolution. */
+		uint64 Misses = 0;
+		/** @brief Worlds currently cached. */
+		int32 NumWorlds = 0;
+	};
+} // namespace Nfrrlib::EventBus
 
 /**
  * @brief Game-instance host for the v2 EventBus runtime.
@@ -27,15 +48,68 @@ public:
 	/** @brief Returns mutable EventBus runtime owned by this subsystem. */
 	NFL_EVENTBUS_NODISCARD
 	Nfrrlib::EventBus::FEventBus& GetEventBus();
+	/** @brief Returns scoped sub-bus tree rooted at the game-instance bus. */
+	NFL_EVENTBUS_NODISCARD
+	Nfrrlib::EventBus::FEventBusScopeRegistry& GetScopes();
+	/** @brief Returns nearest scoped bus for ContextObject (level, then world), or the game-instance bus. */
+	NFL_EVENTBUS_NODISCARD
+	Nfrrlib::EventBus::FEventBus& GetEventBusForContext(const UObject* ContextObject);
 	/** @brief Returns active runtime history store used by Blueprint APIs. */
 	NFL_EVENTBUS_NODISCARD
 	const UEventBusRegistryAsset* GetRuntimeRegistry() const;
 
+	/** @brief Visits the game-instance bus, then every scope bus, with a display name (game instance or scope owner path). */
+	void ForEachBus(TFunctionRef<void(const FString& BusName, const Nfrrlib::EventBus::FEventBus& Bus)> Visitor) const;
+	/** @brief Drops listener timings on the game-instance bus and every scope bus. */
+	void ResetListenerTimings();
+	/** @brief Writes per-channel memory tables for the game-instance bus and every scope bus. */
+	void DumpMemory(FOutputDevice& Ar) const;
+
+	/**
+	 * @brief Returns the subsystem cached for World, or nullptr on a miss or when the cached subsystem died.
+	 *
+	 * Entries are dropped when their world is cleaned up and when their subsystem deinitializes. Game thread only.
+	 */
+	NFL_EVENTBUS_NODISCARD
+	static UEventBusSubsystem* FindCachedForWorld(const UWorld* World);
+	/** @brief Caches Subsystem as the resolution result for World. */
+	static void CacheForWorld(const UWorld* World, UEventBusSubsystem* Subsystem);
+	/** @brief Returns hit/miss counters and the number of cached worlds. */
+	NFL_EVENTBUS_NODISCARD
+	static Nfrrlib::EventBus::FEventBusSubsystemCacheStats GetCacheStats();
+	/** @brief Drops every cached world and zeroes the counters. */
+	static void ResetCache();
+
 private:
+	/** @brief Hands the loaded baked registry to the runtime registry; lookups before this see runtime history only. */
+	void HandleBakedRegistryLoaded(const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result);
+	/** @brief Makes Baked answer runtime registry lookup misses. */
+	void UseBakedRegistry(UEventBusRegistryAsset* Baked);
+	/** @brief Delivers pending batched channel payloads once per engine frame. */
+	void FlushBatchChannelsAtEndOfFrame();
+	/** @brief Sweeps bindings of collected objects so topology and presence stop counting them. */
+	void HandlePostGarbageCollect();
+	/** @brief Drops every scope owned by or inside a world being cleaned up. */
+	void HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+	/** @brief Drops every scope owned by or inside a level leaving its world. */
+	void HandleLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+
 	/** @brief Core runtime orchestrator owned by this game-instance subsystem. */
 	Nfrrlib::EventBus::FEventBus EventBus;
 
+	/** @brief Scoped sub-buses forwarding into EventBus; released before EventBus on teardown. */
+	TUniquePtr<Nfrrlib::EventBus::FEventBusScopeRegistry> Scopes;
+
 	/** @brief Transient runtime history store used by BP helpers and filtered picker nodes. */
 	UPROPERTY(Transient)
 	TObjectPtr<UEventBusRegistryAsset> RuntimeRegistry;
+
+	/** @brief End-of-frame hook used to flush batched channels. */
+	FDelegateHandle EndFrameHandle;
+	/** @brief Post-GC hook used to sweep dead bindings. */
+	FDelegateHandle PostGarbageCollectHandle;
+	/** @brief World cleanup hook used to release world scopes. */
+	FDelegateHandle WorldCleanupHandle;
+	/** @brief Level removal hook used to release level scopes. */
+	FDelegateHandle LevelRemovedHandle;
 };
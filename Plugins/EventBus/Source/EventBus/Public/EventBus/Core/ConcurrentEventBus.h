@@ -0,0 +1,123 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Templates/Function.h"
+#include "Templates/UniquePtr.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBusPayloadType.h"
+#include "EventBus/Core/EventBusPolicies.h"
+
+#include <atomic>
+
+/**
+ * @brief Default number of channel shards in FConcurrentEventBus; each shard has its own lock.
+ */
+#ifndef NFL_EVENTBUS_CONCURRENT_SHARDS
+#define NFL_EVENTBUS_CONCURRENT_SHARDS 16
+#endif
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Identifies one listener added to an FConcurrentEventBus.
+	 */
+	struct FConcurrentListenerHandle final
+	{
+		FGameplayTag ChannelTag;
+		/** @brief Bus-unique listener id; 0 means the add failed. */
+		uint64 ListenerId = 0;
+
+		/** @brief Returns true when the handle refers to a listener that was added. */
+		NFL_EVENTBUS_NODISCARD bool IsValid() const
+		{
+			return ListenerId != 0;
+		}
+	};
+
+	/**
+	 * @brief Thread-safe event bus for native payload channels, for servers that run gameplay on worker threads.
+	 *
+	 * API Contract:
+	 * - Channels are registered by tag with a payload type, like FEventBus native channels. Listeners and publishes
+	 *   name the payload type as a template argument and fail when it is not the registered one.
+	 * - Listeners are native callables that receive the payload by const reference on the publishing thread.
+	 * - Publish delivers immediately and returns the number of listeners invoked.
+	 *
+	 * Threading:
+	 * - Every call is safe from any thread.
+	 * - Channels are sharded by tag hash. Mutations copy the shard's channel map and publish it under the shard lock.
+	 * - IsChannelRegistered, GetListenerCount and Publish take no lock; they read the published snapshot inside an
+	 *   epoch read scope, and replaced snapshots are deleted after their grace period.
+	 * - A listener removed on one thread may still receive publishes that had already started on another.
+	 * - UObject delegate channels stay on FEventBus; binding or broadcasting them off the game thread is unsafe.
+	 */
+	class EVENTBUS_API FConcurrentEventBus final
+	{
+	public:
+		/** @brief Entry checks: the active validation policy on any thread. */
+		using FPolicies = TEventBusPolicies<FEventBusActivePolicies::FValidation, FEventBusAnyThreadPolicy>;
+
+		explicit FConcurrentEventBus(int32 InShardCount = NFL_EVENTBUS_CONCURRENT_SHARDS);
+		/** @brief Deletes every channel and listener; no other thread may still be using the bus. */
+		~FConcurrentEventBus();
+
+		FConcurrentEventBus(const FConcurrentEventBus&) = delete;
+		FConcurrentEventBus& operator=(const FConcurrentEventBus&) = delete;
+
+		/**
+		 * @brief Registers a channel carrying TPayload. Idempotent when the payload type matches.
+		 * PayloadTypeName is only used in logs.
+		 */
+		template <typename TPayload>
+		NFL_EVENTBUS_NODISCARD bool RegisterChannel(const FGameplayTag& ChannelTag, const FName PayloadTypeName)
+		{
+			return RegisterChannelErased(ChannelTag, GetPayloadTypeId<TPayload>(), PayloadTypeName);
+		}
+		/** @brief Unregisters a channel and drops its listeners. */
+		NFL_EVENTBUS_NODISCARD bool UnregisterChannel(const FGameplayTag& ChannelTag);
+		/** @brief Returns true when the channel is registered. Lock-free. */
+		NFL_EVENTBUS_NODISCARD bool IsChannelRegistered(const FGameplayTag& ChannelTag) const;
+		/** @brief Returns the channel's listener count, or 0 when it is not registered. Lock-free. */
+		NFL_EVENTBUS_NODISCARD int32 GetListenerCount(const FGameplayTag& ChannelTag) const;
+
+		/** @brief Adds Callback to a channel registered with TPayload. Returns an invalid handle on failure. */
+		template <typename TPayload, typename CallbackType>
+		NFL_EVENTBUS_NODISCARD FConcurrentListenerHandle AddListener(const FGameplayTag& ChannelTag, CallbackType&& Callback)
+		{
+			return AddListenerErased(ChannelTag, GetPayloadTypeId<TPayload>(), [Callback = Forward<CallbackType>(Callback)](const void* const Payload)
+			{
+				Callback(*static_cast<const TPayload*>(Payload));
+			});
+		}
+
+		/** @brief Removes the listener Handle refers to. Returns false when it is already gone. */
+		NFL_EVENTBUS_NODISCARD bool RemoveListener(const FConcurrentListenerHandle& Handle);
+
+		/** @brief Delivers Payload to every listener of a channel registered with TPayload. Lock-free. */
+		template <typename TPayload>
+		int32 Publish(const FGameplayTag& ChannelTag, const TPayload& Payload) const
+		{
+			return PublishErased(ChannelTag, GetPayloadTypeId<TPayload>(), &Payload);
+		}
+
+		/** @brief Returns the shard count chosen at construction. */
+		NFL_EVENTBUS_NODISCARD int32 GetShardCount() const;
+
+	private:
+		using FErasedCallback = TFunction<void(const void*)>;
+
+		struct FShard;
+
+		bool RegisterChannelErased(const FGameplayTag& ChannelTag, FEventPayloadTypeId PayloadTypeId, FName PayloadTypeName);
+		FConcurrentListenerHandle AddListenerErased(const FGameplayTag& ChannelTag, FEventPayloadTypeId PayloadTypeId, FErasedCallback&& Callback);
+		int32 PublishErased(const FGameplayTag& ChannelTag, FEventPayloadTypeId PayloadTypeId, const void* Payload) const;
+
+		FShard& GetShard(const FGameplayTag& ChannelTag) const;
+
+		TArray<TUniquePtr<FShard>> Shards;
+		/** @brief Source of listener ids; shared by all shards so handles stay unique bus-wide. */
+		std::atomic<uint64> NextListenerId{1};
+	};
+} // namespace Nfrrlib::EventBus
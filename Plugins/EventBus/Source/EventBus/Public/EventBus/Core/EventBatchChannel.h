@@ -0,0 +1,333 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBusErrors.h"
+#include "EventBus/Core/EventBusTypes.h"
+#include "EventBus/Core/EventNativeChannel.h"
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Batched channel storage for one homogeneous payload type.
+	 *
+	 * Payloads published during a flush are queued for the next flush. Listener removal and callback
+	 * replacement during a flush are deferred until delivery completes, so indices stay stable and a
+	 * callback never destroys the delegate that is running it.
+	 */
+	template <typename TPayload>
+	class TEventBatchChannel final : public FEventNativeChannelBase
+	{
+	public:
+		/** @brief Native listener callback receiving one contiguous batch. */
+		using FBatchDelegate = TDelegate<void(TConstArrayView<TPayload>)>;
+
+		explicit TEventBatchChannel(const FName InPayloadTypeName)
+			: FEventNativeChannelBase(EEventNativeChannelKind::Batch, GetPayloadTypeId<TPayload>(), InPayloadTypeName)
+		{
+		}
+
+		/** @brief Appends one payload to the pending batch. */
+		void Enqueue(const TPayload& Payload)
+		{
+			LLM_SCOPE_BYTAG(EventBus);
+			Pending.Add(Payload);
+			RecordEnqueued(1);
+		}
+
+		/** @brief Appends one payload to the pending batch by move. */
+		void Enqueue(TPayload&& Payload)
+		{
+			LLM_SCOPE_BYTAG(EventBus);
+			Pending.Add(MoveTemp(Payload));
+			RecordEnqueued(1);
+		}
+
+		/** @brief Appends a contiguous range of payloads to the pending batch. */
+		void EnqueueRange(const TConstArrayView<TPayload> Payloads)
+		{
+			LLM_SCOPE_BYTAG(EventBus);
+			Pending.Append(Payloads.GetData(), Payloads.Num());
+			RecordEnqueued(Payloads.Num());
+		}
+
+		/** @brief Constructs one payload in place at the end of the pending batch. */
+		template <typename... TArgs>
+		TPayload& Emplace(TArgs&&... Args)
+		{
+			LLM_SCOPE_BYTAG(EventBus);
+			RecordEnqueued(1);
+			return Pending.Emplace_GetRef(Forward<TArgs>(Args)...);
+		}
+
+		/** @brief Adds or replaces one listener callback keyed by object identity and function name. */
+		NFL_EVENTBUS_NODISCARD bool AddListener(UObject* ListenerObj, const FName FunctionName, FBatchDelegate&& Callback)
+		{
+			EEventBusError Error = EEventBusError::None;
+			if (!FPolicies::FValidation::ValidateObject(ListenerObj, Error) ||
+				!FPolicies::FValidation::ValidateName(FunctionName, Error))
+			{
+				LogListenerFailure(TEXT("AddBatchListener"), Error, ListenerObj, FunctionName);
+				return false;
+			}
+
+			if (!Callback.IsBound())
+			{
+				LogListenerFailure(TEXT("AddBatchListener"), EEventBusError::ListenerFunctionNotBindable, ListenerObj, FunctionName);
+				return false;
+			}
+
+			FListenerKey ListenerKey;
+			ListenerKey.ListenerObjectKey = FObjectKey(ListenerObj);
+			ListenerKey.FunctionName = FunctionName;
+
+			if (FBatchListenerEntry* Existing = FindListener(ListenerKey))
+			{
+				Existing->Listener = ListenerObj;
+				if (bFlushing)
+				{
+					// The entry's callback may be the one executing; swap it in after delivery.
+					Existing->StagedCallback = MoveTemp(Callback);
+				}
+				else
+				{
+					Existing->Callback = MoveTemp(Callback);
+				}
+				return true;
+			}
+
+			LLM_SCOPE_BYTAG(EventBus);
+			FBatchListenerEntry& NewEntry = Listeners.AddDefaulted_GetRef();
+			NewEntry.ListenerKey = ListenerKey;
+			NewEntry.Listener = ListenerObj;
+			NewEntry.Callback = MoveTemp(Callback);
+			++Stats.BindCount;
+			INC_DWORD_STAT(STAT_EventBus_Binds);
+			SyncTopology(CountLiveListeners());
+			return true;
+		}
+
+		/** @brief Removes one listener callback keyed by object identity and function name. */
+		NFL_EVENTBUS_NODISCARD bool RemoveListener(UObject* ListenerObj, const FName FunctionName)
+		{
+			EEventBusError Error = EEventBusError::None;
+			if (!FPolicies::FValidation::ValidateObject(ListenerObj, Error) ||
+				!FPolicies::FValidation::ValidateName(FunctionName, Error))
+			{
+				LogListenerFailure(TEXT("RemoveBatchListener"), Error, ListenerObj, FunctionName);
+				return false;
+			}
+
+			FListenerKey ListenerKey;
+			ListenerKey.ListenerObjectKey = FObjectKey(ListenerObj);
+			ListenerKey.FunctionName = FunctionName;
+
+			FBatchListenerEntry* Existing = FindListener(ListenerKey);
+			if (!Existing)
+			{
+				return false;
+			}
+
+			++Stats.UnbindCount;
+			INC_DWORD_STAT(STAT_EventBus_Unbinds);
+			if (bFlushing)
+			{
+				// The entry's callback may be the one executing; compaction after delivery drops it.
+				Existing->bPendingRemoval = true;
+				SyncTopology(CountLiveListeners());
+				return true;
+			}
+
+			Existing->Callback.Unbind();
+			CompactListeners();
+			SyncTopology(CountLiveListeners());
+			return true;
+		}
+
+		virtual int32 Flush() override
+		{
+			if (Pending.IsEmpty() || bFlushing)
+			{
+				return 0;
+			}
+
+			SCOPE_CYCLE_COUNTER(STAT_EventBus_Dispatch);
+			CSV_SCOPED_TIMING_STAT(EventBus, Dispatch);
+			NFL_EVENTBUS_TRACE_CHANNEL_SCOPE(GetChannelTag());
+			const FScopedChannelCycles DispatchTimer(Stats.DispatchCycles);
+
+			Swap(Pending, Delivering);
+			bFlushing = true;
+
+			const TConstArrayView<TPayload> Batch(Delivering);
+			const int32 ListenerCount = Listeners.Num();
+			int32 InvocationCount = 0;
+			for (int32 Index = 0; Index < ListenerCount; ++Index)
+			{
+				// Iterate by index and fetch Entry afresh each time: callbacks may append listeners and reallocate
+				// storage, so Entry is not used once its callback has run.
+				FBatchListenerEntry& Entry = Listeners[Index];
+				if (Entry.bPendingRemoval)
+				{
+					continue;
+				}
+
+				if (!Entry.Listener.IsValid())
+				{
+					Entry.Callback.Unbind();
+					continue;
+				}
+
+				NFL_EVENTBUS_TRACE_LISTENER_SCOPE(GetChannelTag(), Entry.Listener.Get(), Entry.ListenerKey.FunctionName);
+				const FScopedListenerTiming ListenerTimer(ListenerTimings, Entry.ListenerKey, Entry.Listener.Get(), GetChannelTag());
+				InvocationCount += Entry.Callback.ExecuteIfBound(Batch) ? 1 : 0;
+			}
+
+			bFlushing = false;
+			Stats.ListenerInvocationCount += InvocationCount;
+			INC_DWORD_STAT_BY(STAT_EventBus_ListenerInvocations, InvocationCount);
+			CompactListeners();
+			SyncTopology(CountLiveListeners());
+
+			const int32 DeliveredCount = Delivering.Num();
+			Delivering.Reset();
+			return DeliveredCount;
+		}
+
+		virtual int32 GetPendingCount() const override
+		{
+			return Pending.Num();
+		}
+
+		virtual int32 GetListenerCount() const override
+		{
+			return CountLiveListeners();
+		}
+
+		/** @brief Compaction during a flush would shift the entries being delivered, so it waits for the flush. */
+		virtual int32 SweepStaleListeners() override
+		{
+			if (bFlushing)
+			{
+				return 0;
+			}
+
+			const int32 TrackedCount = Listeners.Num();
+			CompactListeners();
+			SyncTopology(CountLiveListeners());
+			return TrackedCount - Listeners.Num();
+		}
+
+		virtual void Reset() override
+		{
+			Pending.Reset();
+			if (bFlushing)
+			{
+				// The in-flight batch view still points at Delivering; defer teardown to flush completion.
+				for (FBatchListenerEntry& Entry : Listeners)
+				{
+					Entry.bPendingRemoval = true;
+				}
+				SyncTopology(0);
+				return;
+			}
+
+			Delivering.Reset();
+			Listeners.Reset();
+			SyncTopology(0);
+		}
+
+		virtual void GetMemory(FEventChannelMemory& OutMemory) const override
+		{
+			OutMemory = FEventChannelMemory();
+			OutMemory.ListenerBytes = Listeners.GetAllocatedSize();
+			OutMemory.DispatchBytes = Pending.GetAllocatedSize() + Delivering.GetAllocatedSize();
+			OutMemory.OwnedBytes = sizeof(*this) + OutMemory.ListenerBytes + OutMemory.DispatchBytes + ListenerTimings.GetAllocatedSize();
+			OutMemory.ListenerCount = CountLiveListeners();
+		}
+
+		virtual void GetListenerSummaries(TArray<FEventBindingSummary>& OutSummaries) const override
+		{
+			for (const FBatchListenerEntry& Entry : Listeners)
+			{
+				if (Entry.Callback.IsBound() && !Entry.bPendingRemoval)
+				{
+					AppendBindingSummary(OutSummaries, Entry.Listener.Get(), Entry.ListenerKey.FunctionName);
+				}
+			}
+		}
+
+	private:
+		/**
+		 * @brief Internal listener storage for one batched channel.
+		 */
+		struct FBatchListenerEntry final
+		{
+			/** @brief Stable key used for deduplication and remove operations. */
+			FListenerKey ListenerKey;
+			/** @brief Weak listener reference for stale-object cleanup safety. */
+			TWeakObjectPtr<UObject> Listener;
+			/** @brief Native callback invoked with each flushed batch. */
+			FBatchDelegate Callback;
+			/** @brief Replacement callback registered during a flush; applied on compaction. */
+			FBatchDelegate StagedCallback;
+			/** @brief Set when the listener is removed during a flush; dropped on compaction. */
+			bool bPendingRemoval = false;
+		};
+
+		/** @brief Counts enqueued payloads as broadcasts. */
+		void RecordEnqueued(const int32 PayloadCount)
+		{
+			Stats.BroadcastCount += PayloadCount;
+			INC_DWORD_STAT_BY(STAT_EventBus_Broadcasts, PayloadCount);
+		}
+
+		/** @brief Returns live listener entry for key, or nullptr when absent or pending removal. */
+		FBatchListenerEntry* FindListener(const FListenerKey& ListenerKey)
+		{
+			return Listeners.FindByPredicate([&ListenerKey](const FBatchListenerEntry& Entry)
+			{
+				return Entry.ListenerKey == ListenerKey && Entry.Callback.IsBound() && !Entry.bPendingRemoval;
+			});
+		}
+
+		/** @brief Returns entries that would still be delivered: bound, alive and not removed during a flush. */
+		int32 CountLiveListeners() const
+		{
+			int32 LiveCount = 0;
+			for (const FBatchListenerEntry& Entry : Listeners)
+			{
+				LiveCount += Entry.Callback.IsBound() && !Entry.bPendingRemoval && Entry.Listener.IsValid() ? 1 : 0;
+			}
+			return LiveCount;
+		}
+
+		/** @brief Applies staged callbacks, then drops removed, unbound and stale entries while preserving delivery order. */
+		void CompactListeners()
+		{
+			for (FBatchListenerEntry& Entry : Listeners)
+			{
+				if (Entry.StagedCallback.IsBound())
+				{
+					Entry.Callback = MoveTemp(Entry.StagedCallback);
+					Entry.StagedCallback.Unbind();
+				}
+			}
+
+			Listeners.RemoveAll([](const FBatchListenerEntry& Entry)
+			{
+				return Entry.bPendingRemoval || !Entry.Callback.IsBound() || !Entry.Listener.IsValid();
+			});
+		}
+
+	private:
+		TArray<TPayload> Pending;
+		TArray<TPayload> Delivering;
+		TArray<FBatchListenerEntry> Listeners;
+		bool bFlushing = false;
+	};
+} // namespace Nfrrlib::EventBus
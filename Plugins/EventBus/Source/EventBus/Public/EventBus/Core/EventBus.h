@@ -2,11 +2,25 @@
 
 #include "CoreMinimal.h"
 #include "Containers/Map.h"
+#include "Templates/Function.h"
+#include "Templates/SharedPointer.h"
 #include "Templates/UniquePtr.h"
 
+#include "EventBus/Core/EventBatchChannel.h"
+#include "EventBus/Core/EventSpatialChannel.h"
 #include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBusDiagnostics.h"
 #include "EventBus/Core/EventBusErrors.h"
+#include "EventBus/Core/EventBusListenerTiming.h"
+#include "EventBus/Core/EventBusMemory.h"
+#include "EventBus/Core/EventBusPayloadType.h"
+#include "EventBus/Core/EventBusPolicies.h"
+#include "EventBus/Core/EventBusRecorder.h"
+#include "EventBus/Core/EventBusStaticChannels.h"
+#include "EventBus/Core/EventBusStats.h"
+#include "EventBus/Core/EventBusTrace.h"
 #include "EventBus/Core/EventBusTypes.h"
+#include "EventBus/Core/EventChannelTopology.h"
 
 namespace Nfrrlib::EventBus::Private
 {
@@ -35,14 +49,28 @@ namespace Nfrrlib::EventBus
 	 * - Register/Unregister channel explicitly.
 	 * - Add/Remove publisher by channel + publisher + delegate binding.
 	 * - Add/Remove listener by channel + listener + function binding.
+	 * - Batched channels buffer payloads and deliver them to native listeners on flush.
+	 * - Spatial channels deliver located payloads only to native listeners whose interest radius covers them.
+	 * - Typed channels may be addressed by FStaticChannelId, resolved through a fixed slot table.
+	 * - An optional parent bus receives forwarded publishers and native payloads; the parent must outlive the child.
+	 * - Per-channel counters are queryable; delegate dispatch is observed through typed Broadcast helpers.
+	 * - While FEventBusRecorder is recording, every call above is appended to the event stream before it runs.
 	 *
 	 * Threading:
 	 * - Not thread-safe.
-	 * - All operations must run on the Game Thread.
+	 * - All operations must run on the Game Thread, except the topology queries below.
+	 * - GetChannelTopology, HasListeners and the Is*ChannelRegistered queries may be called from any thread. Off the
+	 *   game thread they read per-channel snapshots published after each mutation, without locks.
+	 * - Presence callbacks run on the game thread, inside the call that added the first or removed the last listener.
+	 *
+	 * Entry checks go through FPolicies, selected at build time by `NFL_EVENTBUS_ASSERT_ONLY_VALIDATION`.
 	 */
 	class EVENTBUS_API FEventBus final
 	{
 	public:
+		/** @brief Validation and threading policies every entry point and channel state check through. */
+		using FPolicies = FEventBusActivePolicies;
+
 		FEventBus() = default;
 		~FEventBus();
 
@@ -51,24 +79,234 @@ namespace Nfrrlib::EventBus
 
 		/** @brief Registers a channel and its ownership policy. Idempotent when policy matches existing route. */
 		NFL_EVENTBUS_NODISCARD bool RegisterChannel(const FChannelRegistration& Registration);
+		/** @brief Registers several channels with one map reservation. Returns true when every registration succeeds. */
+		NFL_EVENTBUS_NODISCARD bool RegisterChannels(TConstArrayView<FChannelRegistration> Registrations);
 		/** @brief Unregisters a channel and unbinds all tracked callbacks under it. */
 		NFL_EVENTBUS_NODISCARD bool UnregisterChannel(const FGameplayTag& ChannelTag);
 		/** @brief Returns true when channel is currently registered. */
 		NFL_EVENTBUS_NODISCARD bool IsChannelRegistered(const FGameplayTag& ChannelTag) const;
+		/** @brief Returns true when typed channel is currently registered. */
+		NFL_EVENTBUS_NODISCARD bool IsChannelRegistered(const FStaticChannelId& Channel) const;
+		/**
+		 * @brief Copies the topology snapshot of a delegate or native channel. Returns false when not registered.
+		 * Callable from any thread; the snapshot reflects the channel as of its last mutation.
+		 */
+		NFL_EVENTBUS_NODISCARD bool GetChannelTopology(const FGameplayTag& ChannelTag, FEventChannelTopology& OutTopology) const;
+
+		/**
+		 * @brief Returns true when a delegate or native channel has at least one live listener. Callable from any thread.
+		 * Presence is per bus: listeners on ancestors that receive forwarded publishers are not counted.
+		 */
+		NFL_EVENTBUS_NODISCARD bool HasListeners(const FGameplayTag& ChannelTag) const;
+		/** @brief Returns true when a typed channel has at least one listener, resolved through its static slot. */
+		NFL_EVENTBUS_NODISCARD bool HasListeners(const FStaticChannelId& Channel) const;
+		/**
+		 * @brief Calls Callback with true when ChannelTag gains its first listener and with false when it loses its last,
+		 * including through unregistration or Reset. The channel need not be registered yet.
+		 * Returns an invalid handle when the tag is invalid or Callback is unbound.
+		 */
+		FDelegateHandle AddPresenceCallback(const FGameplayTag& ChannelTag, FOnChannelPresenceChanged::FDelegate&& Callback);
+		/** @brief Removes one presence callback. Returns false when Handle is not subscribed to ChannelTag. */
+		bool RemovePresenceCallback(const FGameplayTag& ChannelTag, FDelegateHandle Handle);
 
 		/** @brief Adds or updates publisher delegate binding for one channel. */
 		NFL_EVENTBUS_NODISCARD bool AddPublisher(const FGameplayTag& ChannelTag, UObject* PublisherObj, const FPublisherBinding& Binding);
+		/** @brief Adds or updates publisher delegate binding for one typed channel. */
+		NFL_EVENTBUS_NODISCARD bool AddPublisher(const FStaticChannelId& Channel, UObject* PublisherObj, const FPublisherBinding& Binding);
 		/** @brief Removes publisher delegate binding for one channel. */
 		NFL_EVENTBUS_NODISCARD bool RemovePublisher(const FGameplayTag& ChannelTag, UObject* PublisherObj);
+		/** @brief Removes publisher delegate binding for one typed channel. */
+		NFL_EVENTBUS_NODISCARD bool RemovePublisher(const FStaticChannelId& Channel, UObject* PublisherObj);
 
 		/** @brief Adds or updates one listener function binding for one channel. */
 		NFL_EVENTBUS_NODISCARD bool AddListener(const FGameplayTag& ChannelTag, UObject* ListenerObj, const FListenerBinding& Binding);
+		/** @brief Adds or updates one listener function binding for one typed channel. */
+		NFL_EVENTBUS_NODISCARD bool AddListener(const FStaticChannelId& Channel, UObject* ListenerObj, const FListenerBinding& Binding);
 		/** @brief Removes one listener function binding for one channel. */
 		NFL_EVENTBUS_NODISCARD bool RemoveListener(const FGameplayTag& ChannelTag, UObject* ListenerObj, const FListenerBinding& Binding);
+		/** @brief Removes one listener function binding for one typed channel. */
+		NFL_EVENTBUS_NODISCARD bool RemoveListener(const FStaticChannelId& Channel, UObject* ListenerObj, const FListenerBinding& Binding);
+
+		/**
+		 * @brief Adds one publisher to several channels behind a single game-thread check.
+		 * Each channel is looked up once and publishes its topology once, after every entry is bound.
+		 * OutResults receives one flag per entry in order. Returns the number of successful binds.
+		 */
+		int32 AddPublishers(UObject* PublisherObj, TConstArrayView<FChannelPublisherBinding> Bindings, TArray<bool>& OutResults);
+		/**
+		 * @brief Adds one listener to several channels behind a single game-thread check.
+		 * Each channel is looked up once and publishes its topology once, after every entry is bound.
+		 * OutResults receives one flag per entry in order. Returns the number of successful binds.
+		 */
+		int32 AddListeners(UObject* ListenerObj, TConstArrayView<FChannelListenerBinding> Bindings, TArray<bool>& OutResults);
+		/**
+		 * @brief Removes one listener from several channels behind a single game-thread check.
+		 * Each channel is looked up once and publishes its topology once, after every entry is unbound.
+		 * OutResults receives one flag per entry in order. Returns the number of removed bindings.
+		 */
+		int32 RemoveListeners(UObject* ListenerObj, TConstArrayView<FChannelListenerBinding> Bindings, TArray<bool>& OutResults);
+
+		/**
+		 * @brief Registers a batched channel carrying TPayload. Idempotent when payload type matches.
+		 * PayloadTypeName is only used for logs, topology and recordings; TPayload decides type checks.
+		 */
+		template <typename TPayload>
+		NFL_EVENTBUS_NODISCARD bool RegisterBatchChannel(const FGameplayTag& ChannelTag, const FName PayloadTypeName)
+		{
+			return RegisterNativeChannelState(ChannelTag, EEventNativeChannelKind::Batch, GetPayloadTypeId<TPayload>(), PayloadTypeName, [PayloadTypeName]()
+			{
+				return MakeShared<TEventBatchChannel<TPayload>>(PayloadTypeName);
+			});
+		}
+
+		/** @brief Returns typed batched channel state, or nullptr when missing or registered with another payload type. */
+		template <typename TPayload>
+		NFL_EVENTBUS_NODISCARD TEventBatchChannel<TPayload>* FindBatchChannel(const FGameplayTag& ChannelTag)
+		{
+			return static_cast<TEventBatchChannel<TPayload>*>(
+				FindNativeChannelState(ChannelTag, EEventNativeChannelKind::Batch, GetPayloadTypeId<TPayload>()));
+		}
+
+		/** @brief Unregisters a batched channel and drops its pending payloads and listeners. */
+		NFL_EVENTBUS_NODISCARD bool UnregisterBatchChannel(const FGameplayTag& ChannelTag);
+		/** @brief Returns true when a batched channel is currently registered. */
+		NFL_EVENTBUS_NODISCARD bool IsBatchChannelRegistered(const FGameplayTag& ChannelTag) const;
+		/** @brief Flushes one batched channel and returns delivered payload count. */
+		int32 FlushBatchChannel(const FGameplayTag& ChannelTag);
+		/** @brief Flushes every batched channel and returns total delivered payload count. */
+		int32 FlushBatchChannels();
+		/**
+		 * @brief Drops bindings whose objects died on every channel and republishes topology, firing presence
+		 * callbacks for channels that lost their last listener. Returns dropped entry count.
+		 */
+		int32 SweepStaleBindings();
+
+		/**
+		 * @brief Registers a spatial channel carrying TPayload with a uniform grid of CellSize units. Idempotent when payload type matches.
+		 * PayloadTypeName is only used for logs, topology and recordings; TPayload decides type checks.
+		 */
+		template <typename TPayload>
+		NFL_EVENTBUS_NODISCARD bool RegisterSpatialChannel(const FGameplayTag& ChannelTag, const FName PayloadTypeName, const double CellSize)
+		{
+			if (!FEventSpatialGrid::IsValidCellSize(CellSize))
+			{
+				UE_LOG(LogNFLEventBus, Warning, TEXT("RegisterSpatialChannel failed. Error=%s Channel=%s CellSize=%f"),
+					LexToString(EEventBusError::InvalidSpatialQuery),
+					*ChannelTag.ToString(),
+					CellSize);
+				return false;
+			}
+
+			return RegisterNativeChannelState(ChannelTag, EEventNativeChannelKind::Spatial, GetPayloadTypeId<TPayload>(), PayloadTypeName, [PayloadTypeName, CellSize]()
+			{
+				return MakeShared<TEventSpatialChannel<TPayload>>(PayloadTypeName, CellSize);
+			});
+		}
+
+		/** @brief Returns typed spatial channel state, or nullptr when missing or registered with another payload type. */
+		template <typename TPayload>
+		NFL_EVENTBUS_NODISCARD TEventSpatialChannel<TPayload>* FindSpatialChannel(const FGameplayTag& ChannelTag)
+		{
+			return static_cast<TEventSpatialChannel<TPayload>*>(
+				FindNativeChannelState(ChannelTag, EEventNativeChannelKind::Spatial, GetPayloadTypeId<TPayload>()));
+		}
+
+		/**
+		 * @brief Returns typed spatial channel state with shared ownership, or nullptr like FindSpatialChannel.
+		 * The state stays valid while held even if a callback unregisters the channel.
+		 */
+		template <typename TPayload>
+		NFL_EVENTBUS_NODISCARD TSharedPtr<TEventSpatialChannel<TPayload>> PinSpatialChannel(const FGameplayTag& ChannelTag)
+		{
+			return StaticCastSharedPtr<TEventSpatialChannel<TPayload>>(
+				PinNativeChannelState(ChannelTag, EEventNativeChannelKind::Spatial, GetPayloadTypeId<TPayload>()));
+		}
+
+		/** @brief Unregisters a spatial channel and drops its listeners. */
+		NFL_EVENTBUS_NODISCARD bool UnregisterSpatialChannel(const FGameplayTag& ChannelTag);
+		/** @brief Returns true when a spatial channel is currently registered. */
+		NFL_EVENTBUS_NODISCARD bool IsSpatialChannelRegistered(const FGameplayTag& ChannelTag) const;
+
+		/** @brief Copies counters for one delegate or native channel. Returns false when the channel is not registered. */
+		NFL_EVENTBUS_NODISCARD bool GetChannelStats(const FGameplayTag& ChannelTag, FEventChannelStats& OutStats) const;
+		/** @brief Replaces OutStats with counters for every delegate and native channel on this bus. */
+		void GetAllChannelStats(TMap<FGameplayTag, FEventChannelStats>& OutStats) const;
+		/** @brief Clears cumulative counters on every channel. */
+		void ResetChannelStats();
+		/**
+		 * @brief Attributes one publisher broadcast spanning [StartCycles, EndCycles] to a delegate channel.
+		 *
+		 * While EventBusChannel tracing is enabled and listener timing is not, also emits one listener
+		 * invocation event per tracked listener covering the whole broadcast window.
+		 */
+		void RecordDispatch(const FStaticChannelId& Channel, uint64 StartCycles, uint64 EndCycles);
+		/** @brief Emits per-channel frame deltas to the CSV profiler. No-op unless a CSV capture is running. */
+		void RecordCsvChannelStats();
+
+		/** @brief Replaces OutListeners with key and callback of every live listener on a typed delegate channel. */
+		void CollectTimedListeners(const FStaticChannelId& Channel, TArray<FEventTimedListener>& OutListeners) const;
+		/** @brief Records one timed delegate listener invocation; used by typed Broadcast while listener timing is enabled. */
+		void RecordListenerTiming(const FStaticChannelId& Channel, const FListenerKey& ListenerKey, uint64 Cycles);
+		/** @brief Copies the slowest listener timings of one channel. Returns false when the channel is not registered. */
+		NFL_EVENTBUS_NODISCARD bool GetListenerTimings(const FGameplayTag& ChannelTag, int32 MaxRows, TArray<FEventListenerTimingStats>& OutTimings) const;
+		/** @brief Drops listener timings on every channel. */
+		void ResetListenerTimings();
+		/** @brief Writes the MaxPerChannel slowest listeners of every channel that has timings. */
+		void DumpSlowListeners(FOutputDevice& Ar, int32 MaxPerChannel) const;
+
+		/** @brief Returns heap bytes owned by this bus: channel maps, channel states and their containers. */
+		NFL_EVENTBUS_NODISCARD SIZE_T GetAllocatedSize() const;
+		/** @brief Fills OutMemory with the footprint of one delegate or native channel. Returns false when not registered. */
+		NFL_EVENTBUS_NODISCARD bool GetChannelMemory(const FGameplayTag& ChannelTag, FEventChannelMemory& OutMemory) const;
+		/** @brief Replaces OutMemory with the footprint of every delegate and native channel on this bus. */
+		void GetAllChannelMemory(TMap<FGameplayTag, FEventChannelMemory>& OutMemory) const;
+		/** @brief Writes a per-channel memory table, largest first, followed by bus totals. */
+		void DumpMemory(FOutputDevice& Ar) const;
+
+		/** @brief Replaces OutSnapshots with kind, counters, memory and bound classes of every channel, sorted by tag. */
+		void GetChannelSnapshots(TArray<FEventChannelSnapshot>& OutSnapshots) const;
+		/** @brief Writes every channel whose tag contains ChannelFilter (all when empty) with its bindings, memory and counters. */
+		void DumpChannels(FOutputDevice& Ar, const FString& ChannelFilter) const;
+		/** @brief Writes a per-channel counter table, hottest by invocation count first. */
+		void DumpStats(FOutputDevice& Ar) const;
+
+		/**
+		 * @brief Sets the forwarding parent, or clears it when InParent is nullptr.
+		 *
+		 * Publishers added afterwards are also added to the nearest ancestor that has the channel
+		 * registered, so ancestor-scope listeners hear child-scope events. Publishers forwarded through
+		 * the previous parent are retracted. Fails when InParent would create a cycle.
+		 */
+		NFL_EVENTBUS_NODISCARD bool SetParent(FEventBus* InParent);
+		/** @brief Returns forwarding parent, or nullptr for a root bus. */
+		NFL_EVENTBUS_NODISCARD FEventBus* GetParent() const;
+		/** @brief Returns a token that expires when this bus is destroyed, so callers can tell whether a callback tore it down. */
+		NFL_EVENTBUS_NODISCARD TWeakPtr<uint8> GetLifetimeToken() const;
 
 		/** @brief Clears every channel and unbinds all tracked callbacks. */
 		void Reset();
 
+	private:
+		using FNativeChannelStatePtr = TSharedPtr<FEventNativeChannelBase>;
+
+		/** @brief Registers native channel state created by Factory unless the tag is already in use. */
+		NFL_EVENTBUS_NODISCARD bool RegisterNativeChannelState(
+			const FGameplayTag& ChannelTag,
+			EEventNativeChannelKind Kind,
+			FEventPayloadTypeId PayloadTypeId,
+			FName PayloadTypeName,
+			TFunctionRef<FNativeChannelStatePtr()> Factory);
+
+		/** @brief Returns native channel state when registered with Kind and PayloadTypeId, otherwise nullptr. */
+		FEventNativeChannelBase* FindNativeChannelState(const FGameplayTag& ChannelTag, EEventNativeChannelKind Kind, FEventPayloadTypeId PayloadTypeId);
+		/** @brief FindNativeChannelState returning shared ownership of the state. */
+		FNativeChannelStatePtr PinNativeChannelState(const FGameplayTag& ChannelTag, EEventNativeChannelKind Kind, FEventPayloadTypeId PayloadTypeId);
+
+		/** @brief Unregisters native channel state of Kind and drops its pending payloads and listeners. */
+		NFL_EVENTBUS_NODISCARD bool UnregisterNativeChannel(const FGameplayTag& ChannelTag, EEventNativeChannelKind Kind);
+		/** @brief Returns true when native channel state of Kind is registered for ChannelTag. */
+		NFL_EVENTBUS_NODISCARD bool IsNativeChannelRegistered(const FGameplayTag& ChannelTag, EEventNativeChannelKind Kind) const;
+
 	private:
 		using FChannelStatePtr = TUniquePtr<Private::FEventChannelState, Private::FEventChannelStateDeleter>;
 
@@ -82,7 +320,110 @@ namespace Nfrrlib::EventBus
 		 */
 		const Private::FEventChannelState* FindChannelState(const FGameplayTag& ChannelTag) const;
 
+		/**
+		 * @brief Returns mutable state for a typed channel through its slot, binding the slot on first hashed hit.
+		 */
+		Private::FEventChannelState* FindChannelState(const FStaticChannelId& Channel);
+
+		/**
+		 * @brief Returns immutable state for a typed channel through its slot, falling back to hashed lookup.
+		 */
+		const Private::FEventChannelState* FindChannelState(const FStaticChannelId& Channel) const;
+
+		/** @brief Clears every static slot that points at ChannelState. */
+		void UnbindStaticSlots(const Private::FEventChannelState* ChannelState);
+		/** @brief Publishes the topology snapshot of one delegate channel; no-op when its shape did not change. */
+		void PublishTopology(const FGameplayTag& ChannelTag, const Private::FEventChannelState& ChannelState);
+
+		/** @brief Channels touched by one bulk call; a null state marks a tag already found unregistered. */
+		using FBulkChannelStates = TArray<TPair<FGameplayTag, Private::FEventChannelState*>, TInlineAllocator<8>>;
+		/** @brief Resolves ChannelTag at most once per bulk call. */
+		Private::FEventChannelState* FindBulkChannelState(const FGameplayTag& ChannelTag, FBulkChannelStates& Touched);
+		/** @brief Publishes topology once per registered channel a bulk call touched, re-resolving each tag first. */
+		void PublishBulkTopology(const FBulkChannelStates& Touched);
+
+		/**
+		 * @brief Origin of a publisher registration on this bus.
+		 */
+		enum class EPublisherSource : uint8
+		{
+			/** @brief Public AddPublisher call. */
+			Direct,
+			/** @brief First forward of the publisher from one descendant bus. */
+			Forwarded,
+			/** @brief Repeated forward from a descendant that already holds a reference. */
+			ForwardRefresh
+		};
+
+		/** @brief AddPublisher body; Source decides how the registration is counted in PublisherHolds. */
+		bool AddPublisherFrom(const FStaticChannelId& Channel, UObject* PublisherObj, const FPublisherBinding& Binding, EPublisherSource Source);
+		/** @brief Marks an existing forwarded hold on PublisherObj as also registered directly. */
+		void MarkDirectPublisher(const FGameplayTag& ChannelTag, const UObject* PublisherObj);
+		/** @brief Unbinds PublisherObj from ChannelState and retracts it from ancestors. */
+		bool DetachPublisher(const FGameplayTag& ChannelTag, Private::FEventChannelState& ChannelState, UObject* PublisherObj);
+		/** @brief Drops one descendant's reference; detaches the publisher once no reference and no direct registration remain. */
+		void ReleaseForwardedPublisher(const FGameplayTag& ChannelTag, const FObjectKey& PublisherKey, UObject* PublisherObj);
+
+		/** @brief Adds PublisherObj to the nearest ancestor bus that has ChannelTag registered. */
+		void ForwardPublisher(const FGameplayTag& ChannelTag, UObject* PublisherObj, const FPublisherBinding& Binding);
+		/** @brief Removes one forwarded publisher from the ancestor bus that received it. */
+		void RetractPublisher(const FGameplayTag& ChannelTag, UObject* PublisherObj);
+		/** @brief Removes every publisher forwarded under ChannelTag from ancestor buses. */
+		void RetractChannel(const FGameplayTag& ChannelTag);
+		/** @brief Removes every forwarded publisher from ancestor buses. */
+		void RetractAllForwarded();
+
 	private:
+		/**
+		 * @brief One cached typed channel; the tag is kept so a hit is only trusted for the channel that filled it.
+		 */
+		struct FStaticSlot final
+		{
+			FGameplayTag ChannelTag;
+			Private::FEventChannelState* State = nullptr;
+		};
+
 		TMap<FGameplayTag, FChannelStatePtr> Channels;
+		/**
+		 * @brief Non-owning typed channel cache indexed by FStaticChannelId::SlotIndex; states point into Channels.
+		 * Grown on first typed access up to the registry's slot count, so buses without typed traffic pay nothing.
+		 */
+		TArray<FStaticSlot> StaticSlots;
+		/** @brief Native channels are shared so in-flight delivery survives unregistration from a callback. */
+		TMap<FGameplayTag, FNativeChannelStatePtr> NativeChannels;
+		/** @brief Lock-free per-channel snapshots for queries from other threads; written on the game thread only. */
+		FEventChannelTopologyTable Topology;
+		/** @brief Non-owning forwarding parent; scope owners guarantee it outlives this bus. */
+		FEventBus* Parent = nullptr;
+		/** @brief Sole strong reference behind GetLifetimeToken; released with the bus. */
+		TSharedRef<uint8> LifetimeToken = MakeShared<uint8>(0);
+		/**
+		 * @brief One publisher this bus added to an ancestor bus.
+		 */
+		struct FForwardedPublisher final
+		{
+			/** @brief Forwarded publisher; destroyed publishers are left to the ancestor's stale cleanup. */
+			TWeakObjectPtr<UObject> Publisher;
+			/** @brief Identity of Publisher, still usable to release the ancestor's reference once it is destroyed. */
+			FObjectKey PublisherKey;
+			/** @brief Ancestor bus holding the forwarded entry. */
+			FEventBus* TargetBus = nullptr;
+		};
+
+		/**
+		 * @brief Who keeps one publisher registered on this bus while descendants forward it.
+		 */
+		struct FPublisherHold final
+		{
+			/** @brief Descendant buses currently forwarding the publisher here. */
+			int32 ForwardCount = 0;
+			/** @brief True when this bus's own caller also registered the publisher. */
+			bool bDirect = false;
+		};
+
+		/** @brief Publishers this bus added to ancestors, per channel, so teardown can retract exactly those. */
+		TMap<FGameplayTag, TArray<FForwardedPublisher>> ForwardedPublishers;
+		/** @brief Forwarded publishers received from descendants, per channel; empty on buses without scopes. */
+		TMap<FGameplayTag, TMap<FObjectKey, FPublisherHold>> PublisherHolds;
 	};
 } // namespace Nfrrlib::EventBus
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBusMemory.h"
+#include "EventBus/Core/EventBusStats.h"
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Live bindings of one class and member on one channel.
+	 */
+	struct FEventBindingSummary final
+	{
+		/** @brief Class of the bound publisher or listener objects. */
+		FName ClassName = NAME_None;
+		/** @brief Publisher delegate property or listener function name. */
+		FName MemberName = NAME_None;
+		/** @brief Number of live objects bound through ClassName::MemberName. */
+		int32 ObjectCount = 0;
+	};
+
+	/**
+	 * @brief Adds one live binding to Summaries, merging with an existing class/member row.
+	 */
+	EVENTBUS_API void AppendBindingSummary(TArray<FEventBindingSummary>& Summaries, const UObject* BoundObj, FName MemberName);
+
+	/**
+	 * @brief Point-in-time description of one channel for console dumps and tooling.
+	 */
+	struct FEventChannelSnapshot final
+	{
+		FGameplayTag ChannelTag;
+		/** @brief "Delegate", "Batch" or "Spatial". */
+		const TCHAR* Kind = TEXT("Delegate");
+		FEventChannelStats Stats;
+		FEventChannelMemory Memory;
+		/** @brief Publisher classes and delegate properties; empty for native channels. */
+		TArray<FEventBindingSummary> Publishers;
+		/** @brief Listener classes and functions. */
+		TArray<FEventBindingSummary> Listeners;
+	};
+
+	/**
+	 * @brief Sort key for FEventBusTopSampler rows.
+	 */
+	enum class EEventBusTopSort : uint8
+	{
+		/** @brief Listener invocations per second. */
+		Invocations,
+		/** @brief Dispatch milliseconds per second. */
+		Cost
+	};
+
+	/**
+	 * @brief Per-channel rates over one sampling window.
+	 */
+	struct FEventBusTopRow final
+	{
+		/** @brief Sample key, usually "<Bus>/<ChannelTag>". */
+		FString Channel;
+		double BroadcastsPerSecond = 0.0;
+		double InvocationsPerSecond = 0.0;
+		double DispatchMsPerSecond = 0.0;
+	};
+
+	/**
+	 * @brief Keeps timestamped counter samples and reduces them to per-channel rates over a sliding window.
+	 *
+	 * Samples are pushed by the caller, so nothing is collected unless a consumer is actively sampling.
+	 * Counter resets between samples are treated as a restart from zero.
+	 */
+	class EVENTBUS_API FEventBusTopSampler final
+	{
+	public:
+		/** @brief Records cumulative counters at TimeSeconds and drops samples older than MaxAgeSeconds. */
+		void AddSample(double TimeSeconds, TMap<FString, FEventChannelStats>&& Counters);
+		/**
+		 * @brief Fills OutRows with at most MaxRows channels, highest first, over the last WindowSeconds.
+		 *
+		 * Returns false until two samples span a non-zero interval. The window start snaps to the newest
+		 * sample at or before (latest - WindowSeconds), or the oldest sample when history is shorter.
+		 */
+		NFL_EVENTBUS_NODISCARD bool GetTop(double WindowSeconds, EEventBusTopSort Sort, int32 MaxRows, TArray<FEventBusTopRow>& OutRows, double& OutWindowSeconds) const;
+		/** @brief Sets how long samples are retained; bounds the largest usable window. */
+		void SetMaxAgeSeconds(double InMaxAgeSeconds);
+		/** @brief Returns retained sample count. */
+		NFL_EVENTBUS_NODISCARD int32 GetSampleCount() const;
+		/** @brief Drops every sample. */
+		void Reset();
+
+	private:
+		struct FSample final
+		{
+			double TimeSeconds = 0.0;
+			TMap<FString, FEventChannelStats> Counters;
+		};
+
+		TArray<FSample> Samples;
+		double MaxAgeSeconds = 60.0;
+	};
+} // namespace Nfrrlib::EventBus
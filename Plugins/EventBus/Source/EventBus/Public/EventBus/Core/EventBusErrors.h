@@ -19,7 +19,14 @@ namespace Nfrrlib::EventBus
 		DelegatePropertyNotFound,
 		ListenerFunctionNotBindable,
 		SignatureMismatch,
-		OwnershipPolicyConflict
+		OwnershipPolicyConflict,
+		ChannelKindConflict,
+		PayloadTypeMismatch,
+		InvalidSpatialQuery,
+		InvalidScopeParent,
+		RecordingInProgress,
+		RecordingFileError,
+		InvalidRecording
 	};
 
 	/**
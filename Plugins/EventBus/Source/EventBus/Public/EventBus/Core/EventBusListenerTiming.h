@@ -0,0 +1,129 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "HAL/PlatformTime.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBusTypes.h"
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Runtime switches for per-listener dispatch timing.
+	 *
+	 * Driven by `EventBus.ListenerTiming.*` console variables. While disabled, every dispatch site
+	 * pays one bool check and takes the untimed path.
+	 */
+	class EVENTBUS_API FEventListenerTiming final
+	{
+	public:
+		/** @brief Returns true when dispatch sites should time each listener callback. */
+		NFL_EVENTBUS_NODISCARD static bool IsEnabled()
+		{
+			return bEnabled;
+		}
+
+		/** @brief Enables or disables timing. `EventBus.ListenerTiming.Enabled` calls this on change. */
+		static void SetEnabled(bool bInEnabled);
+		/** @brief Returns per-invocation budget in milliseconds; slower calls count as over budget. */
+		NFL_EVENTBUS_NODISCARD static double GetBudgetMs();
+		/** @brief Returns minimum seconds between budget warnings for the same listener. */
+		NFL_EVENTBUS_NODISCARD static double GetWarnCooldownSeconds();
+		/** @brief Returns how many listeners one channel tracks before evicting the fastest. */
+		NFL_EVENTBUS_NODISCARD static int32 GetMaxEntriesPerChannel();
+
+	private:
+		static bool bEnabled;
+	};
+
+	/**
+	 * @brief Rolling timing summary for one listener object and function on one channel.
+	 */
+	struct FEventListenerTimingStats final
+	{
+		FName ClassName = NAME_None;
+		FName FunctionName = NAME_None;
+		uint64 CallCount = 0;
+		/** @brief Mean of the last ~32 calls (exact mean until then). */
+		double AverageMs = 0.0;
+		double MaxMs = 0.0;
+		double LastMs = 0.0;
+		/** @brief Calls slower than the configured budget. */
+		uint64 OverBudgetCount = 0;
+	};
+
+	/**
+	 * @brief Per-channel table of listener timings keyed by FListenerKey.
+	 *
+	 * Bounded by FEventListenerTiming::GetMaxEntriesPerChannel; the entry with the lowest maximum is
+	 * evicted first, so the worst offenders survive listener churn.
+	 */
+	class EVENTBUS_API FEventListenerTimingTable final
+	{
+	public:
+		/** @brief Folds one invocation into the listener's entry and warns when it exceeds the budget. */
+		void Record(const FListenerKey& ListenerKey, const UObject* ListenerObj, uint64 Cycles, const FGameplayTag& ChannelTag);
+		/** @brief Replaces OutStats with at most MaxRows entries, slowest maximum first. */
+		void GetWorst(int32 MaxRows, TArray<FEventListenerTimingStats>& OutStats) const;
+		/** @brief Returns tracked listener count. */
+		NFL_EVENTBUS_NODISCARD int32 Num() const;
+		/** @brief Returns heap bytes used by tracked entries. */
+		NFL_EVENTBUS_NODISCARD SIZE_T GetAllocatedSize() const;
+		/** @brief Drops every tracked entry. */
+		void Reset();
+
+	private:
+		struct FEntry final
+		{
+			FEventListenerTimingStats Stats;
+			double LastWarnSeconds = -UE_DOUBLE_BIG_NUMBER;
+		};
+
+		TMap<FListenerKey, FEntry> Entries;
+	};
+
+	/**
+	 * @brief Times one native listener callback into a table when timing is enabled at construction.
+	 */
+	class FScopedListenerTiming final
+	{
+	public:
+		FScopedListenerTiming(FEventListenerTimingTable& InTable, const FListenerKey& InListenerKey, const UObject* InListenerObj, const FGameplayTag& InChannelTag)
+			: Table(FEventListenerTiming::IsEnabled() ? &InTable : nullptr)
+			, ListenerKey(InListenerKey)
+			, ListenerObj(InListenerObj)
+			, ChannelTag(InChannelTag)
+			, StartCycles(Table != nullptr ? FPlatformTime::Cycles64() : 0)
+		{
+		}
+
+		~FScopedListenerTiming()
+		{
+			if (Table != nullptr)
+			{
+				Table->Record(ListenerKey, ListenerObj, FPlatformTime::Cycles64() - StartCycles, ChannelTag);
+			}
+		}
+
+		FScopedListenerTiming(const FScopedListenerTiming&) = delete;
+		FScopedListenerTiming& operator=(const FScopedListenerTiming&) = delete;
+
+	private:
+		FEventListenerTimingTable* Table = nullptr;
+		/** @brief Copied: callbacks may add listeners and reallocate the entry this key came from. */
+		FListenerKey ListenerKey;
+		const UObject* ListenerObj = nullptr;
+		FGameplayTag ChannelTag;
+		uint64 StartCycles = 0;
+	};
+
+	/**
+	 * @brief One bus-tracked delegate listener callback, handed to typed Broadcast for timed dispatch.
+	 */
+	struct FEventTimedListener final
+	{
+		FListenerKey ListenerKey;
+		FScriptDelegate Callback;
+	};
+} // namespace Nfrrlib::EventBus
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+
+/** @brief Low-Level Memory tracker tag covering every EventBus-owned allocation (`-llm`, `stat LLM`). */
+LLM_DECLARE_TAG_API(EventBus, EVENTBUS_API);
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Heap footprint of one channel, as reported by FEventBus::GetChannelMemory.
+	 */
+	struct FEventChannelMemory final
+	{
+		/** @brief Channel object plus every container it owns; PublisherBytes and ListenerBytes are included. */
+		SIZE_T OwnedBytes = 0;
+		/** @brief Publisher entry storage. */
+		SIZE_T PublisherBytes = 0;
+		/** @brief Listener entry storage (map buckets and entries, or native listener arrays). */
+		SIZE_T ListenerBytes = 0;
+		/** @brief Buffered payloads, spatial grid cells and other dispatch-side storage. */
+		SIZE_T DispatchBytes = 0;
+		/**
+		 * @brief Invocation-list storage inside live publisher multicast delegates.
+		 *
+		 * Owned by the publishers, not the bus, so it is excluded from OwnedBytes; it grows with every bind the bus makes.
+		 */
+		SIZE_T PublisherDelegateBytes = 0;
+		int32 PublisherCount = 0;
+		int32 ListenerCount = 0;
+	};
+} // namespace Nfrrlib::EventBus
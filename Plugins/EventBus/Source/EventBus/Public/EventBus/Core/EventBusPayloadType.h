@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+
+#include <type_traits>
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Process-wide identity of one C++ payload type, compared by address.
+	 *
+	 * A per-type static alone is not enough: modular builds give every module its own copy of a
+	 * template static. Ids are therefore interned by the compiler's spelling of the type, which
+	 * includes its namespaces, so every module asking for the same type gets the same key.
+	 */
+	struct FEventPayloadTypeId final
+	{
+		/** @brief Interned key, or nullptr for no type. */
+		const void* Key = nullptr;
+
+		/** @brief Returns true when this id names a payload type. */
+		NFL_EVENTBUS_NODISCARD bool IsValid() const
+		{
+			return Key != nullptr;
+		}
+
+		friend bool operator==(const FEventPayloadTypeId Lhs, const FEventPayloadTypeId Rhs)
+		{
+			return Lhs.Key == Rhs.Key;
+		}
+
+		friend bool operator!=(const FEventPayloadTypeId Lhs, const FEventPayloadTypeId Rhs)
+		{
+			return Lhs.Key != Rhs.Key;
+		}
+	};
+
+	/**
+	 * @brief Process-wide table of payload type ids.
+	 */
+	class EVENTBUS_API FEventPayloadTypeRegistry final
+	{
+	public:
+		/** @brief Returns the id of TypeSignature, creating it on first use. Ids live until process exit. */
+		NFL_EVENTBUS_NODISCARD static FEventPayloadTypeId Intern(const ANSICHAR* TypeSignature);
+	};
+
+	namespace Private
+	{
+		/** @brief Returns the compiler signature of this instantiation; it differs only in the spelling of T. */
+		template <typename T>
+		const ANSICHAR* GetPayloadTypeSignature()
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			return __FUNCSIG__;
+#else
+			return __PRETTY_FUNCTION__;
+#endif
+		}
+	}
+
+	/** @brief Returns the identity of TPayload. Interned once per module, then read from a function-local static. */
+	template <typename TPayload>
+	NFL_EVENTBUS_NODISCARD FEventPayloadTypeId GetPayloadTypeId()
+	{
+		static const FEventPayloadTypeId TypeId = FEventPayloadTypeRegistry::Intern(
+			Private::GetPayloadTypeSignature<std::remove_cv_t<TPayload>>());
+		return TypeId;
+	}
+} // namespace Nfrrlib::EventBus
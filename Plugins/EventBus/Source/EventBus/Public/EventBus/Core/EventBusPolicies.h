@@ -0,0 +1,146 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBusErrors.h"
+#include "EventBus/Core/EventBusValidation.h"
+
+#include <type_traits>
+
+/**
+ * @brief Builds FEventBus over the assert-only policies (1) instead of the checked ones (0).
+ *
+ * Off by default in every configuration. Shipping targets that trust their callers can enable it to turn the
+ * thread, channel tag and binding name checks into `check` asserts, which compile out unless checks are kept
+ * in Shipping. Object validity is always checked, because binding a dead object is not recoverable.
+ */
+#ifndef NFL_EVENTBUS_ASSERT_ONLY_VALIDATION
+#define NFL_EVENTBUS_ASSERT_ONLY_VALIDATION 0
+#endif
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Validation policy that reports bad arguments as EEventBusError; the default.
+	 */
+	struct FEventBusCheckedValidationPolicy final
+	{
+		/** @brief Validates a non-empty channel tag. */
+		NFL_EVENTBUS_NODISCARD FORCEINLINE static bool ValidateChannelTag(const FGameplayTag& ChannelTag, EEventBusError& OutError)
+		{
+			return FEventBusValidation::ValidateChannelTag(ChannelTag, OutError);
+		}
+
+		/** @brief Validates a non-None reflective binding name. */
+		NFL_EVENTBUS_NODISCARD FORCEINLINE static bool ValidateName(const FName Name, EEventBusError& OutError)
+		{
+			return FEventBusValidation::ValidateName(Name, OutError);
+		}
+
+		/** @brief Validates a live binding object. */
+		NFL_EVENTBUS_NODISCARD FORCEINLINE static bool ValidateObject(UObject* Object, EEventBusError& OutError)
+		{
+			return FEventBusValidation::ValidateObject(Object, OutError);
+		}
+	};
+
+	/**
+	 * @brief Validation policy that asserts instead of reporting; calls always proceed.
+	 */
+	struct FEventBusAssertValidationPolicy final
+	{
+		/** @brief Asserts a non-empty channel tag. */
+		NFL_EVENTBUS_NODISCARD FORCEINLINE static bool ValidateChannelTag(const FGameplayTag& ChannelTag, EEventBusError& OutError)
+		{
+			check(ChannelTag.IsValid());
+			OutError = EEventBusError::None;
+			return true;
+		}
+
+		/** @brief Asserts a non-None reflective binding name. */
+		NFL_EVENTBUS_NODISCARD FORCEINLINE static bool ValidateName(const FName Name, EEventBusError& OutError)
+		{
+			check(!Name.IsNone());
+			OutError = EEventBusError::None;
+			return true;
+		}
+
+		/** @brief Still reports a dead object: objects can die between calls, whatever the caller checked. */
+		NFL_EVENTBUS_NODISCARD FORCEINLINE static bool ValidateObject(UObject* Object, EEventBusError& OutError)
+		{
+			return FEventBusValidation::ValidateObject(Object, OutError);
+		}
+	};
+
+	/**
+	 * @brief Threading policy that rejects and logs calls made off the game thread; the default.
+	 */
+	struct FEventBusGameThreadPolicy final
+	{
+		/** @brief Returns false with NotGameThread when called off the game thread. */
+		NFL_EVENTBUS_NODISCARD FORCEINLINE static bool EnsureThread(const TCHAR* Context, EEventBusError& OutError)
+		{
+			return FEventBusValidation::EnsureGameThread(Context, OutError);
+		}
+	};
+
+	/**
+	 * @brief Threading policy that asserts game-thread access; calls always proceed.
+	 */
+	struct FEventBusAssertGameThreadPolicy final
+	{
+		/** @brief Asserts game-thread access. */
+		NFL_EVENTBUS_NODISCARD FORCEINLINE static bool EnsureThread(const TCHAR* Context, EEventBusError& OutError)
+		{
+			checkf(IsInGameThread(), TEXT("EventBus: %s must be called on the Game Thread."), Context);
+			OutError = EEventBusError::None;
+			return true;
+		}
+	};
+
+	/**
+	 * @brief Threading policy of containers that synchronize internally, such as FConcurrentEventBus.
+	 */
+	struct FEventBusAnyThreadPolicy final
+	{
+		/** @brief Accepts every thread. */
+		NFL_EVENTBUS_NODISCARD FORCEINLINE static bool EnsureThread(const TCHAR* Context, EEventBusError& OutError)
+		{
+			OutError = EEventBusError::None;
+			return true;
+		}
+	};
+
+	/**
+	 * @brief Pairs a validation policy with a threading policy and exposes the entry checks FEventBus runs.
+	 *
+	 * Policies are stateless types with static members, so every check inlines into its call site.
+	 */
+	template <typename InValidationPolicy, typename InThreadingPolicy>
+	struct TEventBusPolicies final
+	{
+		using FValidation = InValidationPolicy;
+		using FThreading = InThreadingPolicy;
+
+		/** @brief Entry check of calls that address no channel. */
+		NFL_EVENTBUS_NODISCARD FORCEINLINE static bool EnterCall(const TCHAR* Context, EEventBusError& OutError)
+		{
+			return FThreading::EnsureThread(Context, OutError);
+		}
+
+		/** @brief Entry check of calls addressed by channel tag. */
+		NFL_EVENTBUS_NODISCARD FORCEINLINE static bool EnterChannelCall(const TCHAR* Context, const FGameplayTag& ChannelTag, EEventBusError& OutError)
+		{
+			return FThreading::EnsureThread(Context, OutError) && FValidation::ValidateChannelTag(ChannelTag, OutError);
+		}
+	};
+
+	/** @brief Reports every misuse as an error; the behaviour FEventBus has always had. */
+	using FEventBusCheckedPolicies = TEventBusPolicies<FEventBusCheckedValidationPolicy, FEventBusGameThreadPolicy>;
+	/** @brief Turns thread, tag and name checks into asserts. */
+	using FEventBusAssertPolicies = TEventBusPolicies<FEventBusAssertValidationPolicy, FEventBusAssertGameThreadPolicy>;
+	/** @brief Policies FEventBus and its channel state are built with. */
+	using FEventBusActivePolicies = std::conditional_t<NFL_EVENTBUS_ASSERT_ONLY_VALIDATION != 0, FEventBusAssertPolicies, FEventBusCheckedPolicies>;
+} // namespace Nfrrlib::EventBus
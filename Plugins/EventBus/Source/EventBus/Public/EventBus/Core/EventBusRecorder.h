@@ -0,0 +1,214 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+
+#include <type_traits>
+
+/**
+ * @brief Compiles event-stream recording hooks in (1) or out (0). Defaults to every build except Shipping.
+ */
+#ifndef NFL_EVENTBUS_RECORDING
+#define NFL_EVENTBUS_RECORDING (!UE_BUILD_SHIPPING)
+#endif
+
+namespace Nfrrlib::EventBus
+{
+	class FEventBus;
+
+	/**
+	 * @brief Operation stored by one event-stream record.
+	 */
+	enum class EEventBusRecordOp : uint8
+	{
+		/** @brief Appends one string to the file's name table; never surfaced as an FEventBusRecord. */
+		DefineName,
+		/** @brief Delegate channel registration; Flags holds bOwnsPublisherDelegates. */
+		RegisterChannel,
+		UnregisterChannel,
+		/** @brief Native channel registration; Flags holds EEventNativeChannelKind, MemberName the payload type. */
+		RegisterNativeChannel,
+		/** @brief Native channel unregistration; Flags holds EEventNativeChannelKind. */
+		UnregisterNativeChannel,
+		/** @brief MemberName holds the publisher delegate property. */
+		AddPublisher,
+		RemovePublisher,
+		/** @brief MemberName holds the listener function. */
+		AddListener,
+		RemoveListener,
+		/** @brief Typed delegate broadcast; Payload holds the serialized delegate parameters. */
+		Broadcast,
+		/** @brief Batch or spatial publish; Flags holds EEventNativeChannelKind, Count the payload count. */
+		NativePublish,
+		/** @brief Batch flush; an invalid ChannelTag means every batched channel. */
+		Flush,
+		Count
+	};
+
+	/**
+	 * @brief Returns a readable string for EEventBusRecordOp values.
+	 */
+	NFL_EVENTBUS_NODISCARD EVENTBUS_API const TCHAR* LexToString(EEventBusRecordOp Op);
+
+	/**
+	 * @brief One decoded bus operation from an event-stream file.
+	 */
+	struct FEventBusRecord final
+	{
+		EEventBusRecordOp Op = EEventBusRecordOp::Count;
+		/** @brief Recording-local index of the bus that received the operation, in first-use order. */
+		int32 BusIndex = 0;
+		/** @brief Seconds since recording started. */
+		double TimeSeconds = 0.0;
+		/** @brief Channel tag; invalid when the tag is no longer known to the tag manager. */
+		FGameplayTag ChannelTag;
+		/** @brief Channel tag name as recorded, kept even when ChannelTag failed to resolve. */
+		FName ChannelName = NAME_None;
+		/** @brief Path name of the publisher or listener object. */
+		FString ObjectPath;
+		/** @brief Path name of the publisher or listener class. */
+		FString ClassPath;
+		/** @brief Delegate property, listener function or native payload type, depending on Op. */
+		FName MemberName = NAME_None;
+		uint32 Flags = 0;
+		/** @brief Payload count of a native publish; 1 for every other operation. */
+		int32 Count = 1;
+		/**
+		 * @brief Operation payload.
+		 *
+		 * Broadcast: delegate parameters serialized with object and name references as strings.
+		 * NativePublish: raw payload bytes for trivially copyable payload types (empty otherwise),
+		 * preceded by the FVector location for spatial publishes.
+		 */
+		TArray<uint8> Payload;
+	};
+
+	/**
+	 * @brief Counters for the active or last recording.
+	 */
+	struct FEventBusRecorderStats final
+	{
+		uint64 RecordCount = 0;
+		/** @brief Bytes appended to in-memory blocks, header excluded. */
+		uint64 RecordedBytes = 0;
+		/** @brief Bytes the background flush has written to disk, header included. */
+		uint64 WrittenBytes = 0;
+		/** @brief Filled blocks handed to the background flush. */
+		uint64 FlushedBlocks = 0;
+	};
+
+	/**
+	 * @brief Records bus operations and publishes into a compact append-only binary file.
+	 *
+	 * Records are encoded into fixed-size in-memory blocks on the game thread. Filled blocks move through
+	 * a single-producer lock-free queue to a background task that appends them to the file, so a frame
+	 * never waits on disk. Strings are written once into an inline name table and referenced by index.
+	 *
+	 * Every hook is guarded by IsRecording(), one bool check while idle, and compiles out when
+	 * NFL_EVENTBUS_RECORDING is 0. Recording is game-thread only, like the bus itself.
+	 */
+	class EVENTBUS_API FEventBusRecorder final
+	{
+	public:
+		/** @brief Returns true while a recording is active. */
+		NFL_EVENTBUS_NODISCARD static bool IsRecording()
+		{
+#if NFL_EVENTBUS_RECORDING
+			return bRecording;
+#else
+			return false;
+#endif
+		}
+
+		/** @brief Opens FilePath (or GetDefaultFilePath() when empty) and starts recording. Fails while already recording. */
+		NFL_EVENTBUS_NODISCARD static bool Start(const FString& FilePath);
+		/** @brief Flushes pending blocks, waits for the background writer and closes the file. Returns false when idle. */
+		static bool Stop();
+		/** @brief Returns the active or last recording path. */
+		NFL_EVENTBUS_NODISCARD static FString GetFilePath();
+		/** @brief Returns counters for the active or last recording. */
+		NFL_EVENTBUS_NODISCARD static FEventBusRecorderStats GetStats();
+		/** @brief Returns `<ProjectSaved>/EventBus/Recordings/EventBus-<timestamp>.ebrec`. */
+		NFL_EVENTBUS_NODISCARD static FString GetDefaultFilePath();
+
+		/** @brief Records a delegate or native channel registration change. */
+		static void RecordChannel(const FEventBus& Bus, EEventBusRecordOp Op, const FGameplayTag& ChannelTag, uint32 Flags, FName MemberName);
+		/** @brief Records a publisher or listener add/remove call. */
+		static void RecordBinding(const FEventBus& Bus, EEventBusRecordOp Op, const FGameplayTag& ChannelTag, const UObject* Object, FName MemberName);
+		/** @brief Records a batch flush; pass an invalid tag for a flush of every batched channel. */
+		static void RecordFlush(const FEventBus& Bus, const FGameplayTag& ChannelTag);
+
+		/**
+		 * @brief Records one typed delegate broadcast, converting Args to the delegate's parameter types first.
+		 *
+		 * BroadcastFunc is `&FDelegate::Broadcast`; its parameter list drives conversion, so a literal `1`
+		 * sent to a float delegate is recorded as a float.
+		 */
+		template <typename TDelegate, typename... TParams, typename... TArgs>
+		static void RecordBroadcast(
+			void (TDelegate::*BroadcastFunc)(TParams...) const,
+			const FEventBus& Bus,
+			const FGameplayTag& ChannelTag,
+			const UObject* Publisher,
+			const FName DelegatePropertyName,
+			const TArgs&... Args)
+		{
+			(void)BroadcastFunc;
+			const TTuple<std::remove_cv_t<std::remove_reference_t<TParams>>...> Values(Args...);
+			Values.ApplyAfter([&](const auto&... Params)
+			{
+				const void* const ParamPtrs[] = {static_cast<const void*>(&Params)..., nullptr};
+				RecordBroadcastParams(Bus, ChannelTag, Publisher, DelegatePropertyName, MakeArrayView(ParamPtrs, sizeof...(TParams)));
+			});
+		}
+
+		/** @brief Records Payloads published on a batched channel. */
+		template <typename TPayload>
+		static void RecordBatchPublish(const FEventBus& Bus, const FGameplayTag& ChannelTag, const TConstArrayView<TPayload> Payloads)
+		{
+			if constexpr (std::is_trivially_copyable_v<TPayload>)
+			{
+				RecordNativePublish(Bus, ChannelTag, nullptr, Payloads.GetData(), sizeof(TPayload) * Payloads.Num(), Payloads.Num());
+			}
+			else
+			{
+				RecordNativePublish(Bus, ChannelTag, nullptr, nullptr, 0, Payloads.Num());
+			}
+		}
+
+		/** @brief Records one payload published on a spatial channel at Location. */
+		template <typename TPayload>
+		static void RecordSpatialPublish(const FEventBus& Bus, const FGameplayTag& ChannelTag, const FVector& Location, const TPayload& Payload)
+		{
+			if constexpr (std::is_trivially_copyable_v<TPayload>)
+			{
+				RecordNativePublish(Bus, ChannelTag, &Location, &Payload, sizeof(TPayload), 1);
+			}
+			else
+			{
+				RecordNativePublish(Bus, ChannelTag, &Location, nullptr, 0, 1);
+			}
+		}
+
+	private:
+		/** @brief Serializes delegate parameters, one pointer per signature parameter, in declaration order. */
+		static void RecordBroadcastParams(
+			const FEventBus& Bus,
+			const FGameplayTag& ChannelTag,
+			const UObject* Publisher,
+			FName DelegatePropertyName,
+			TConstArrayView<const void*> ParamPtrs);
+		/** @brief Records a native publish; Location is null for batched channels. */
+		static void RecordNativePublish(
+			const FEventBus& Bus,
+			const FGameplayTag& ChannelTag,
+			const FVector* Location,
+			const void* PayloadData,
+			SIZE_T PayloadBytes,
+			int32 PayloadCount);
+
+		static bool bRecording;
+	};
+} // namespace Nfrrlib::EventBus
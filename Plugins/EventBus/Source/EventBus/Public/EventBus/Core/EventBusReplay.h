@@ -0,0 +1,102 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "Templates/Function.h"
+#include "UObject/StrongObjectPtr.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBusRecorder.h"
+
+namespace Nfrrlib::EventBus
+{
+	class FEventBus;
+
+	/**
+	 * @brief Decoded event-stream file written by FEventBusRecorder.
+	 */
+	struct EVENTBUS_API FEventBusRecording final
+	{
+		/** @brief Every operation in recording order. */
+		TArray<FEventBusRecord> Records;
+		/** @brief Number of distinct buses seen while recording. */
+		int32 BusCount = 0;
+		/** @brief Wall-clock UTC time recording started. */
+		FDateTime StartTime;
+
+		/** @brief Loads and decodes FilePath. Returns false when the file is missing, foreign or truncated. */
+		NFL_EVENTBUS_NODISCARD static bool Load(const FString& FilePath, FEventBusRecording& OutRecording);
+		/** @brief Returns recorded duration in seconds. */
+		NFL_EVENTBUS_NODISCARD double GetDurationSeconds() const;
+	};
+
+	/**
+	 * @brief Options for FEventBusReplayer::Replay.
+	 */
+	struct FEventBusReplayOptions final
+	{
+		/** @brief Replays only records from this recorded bus; INDEX_NONE folds every bus into the target. */
+		int32 BusIndex = INDEX_NONE;
+		/**
+		 * @brief Maps a recorded publisher or listener to a live object. When unset or returning null,
+		 * the replayer creates one transient stand-in per recorded object path from the recorded class.
+		 */
+		TFunction<UObject*(const FEventBusRecord&)> ResolveObject;
+		/**
+		 * @brief Replays native channel registrations and publishes, whose payload types are unknown to the
+		 * replayer; returns false when the record failed. Those records are skipped when unset.
+		 */
+		TFunction<bool(FEventBus&, const FEventBusRecord&)> NativeChannelHandler;
+		/** @brief Called after each replayed record with the cycles it took. */
+		TFunction<void(const FEventBusRecord&, uint64 Cycles)> OnRecordReplayed;
+	};
+
+	/**
+	 * @brief Outcome of one replay.
+	 */
+	struct FEventBusReplayResult final
+	{
+		/** @brief Records executed against the bus. */
+		int32 ReplayedCount = 0;
+		/** @brief Records filtered out or lacking a handler. */
+		int32 SkippedCount = 0;
+		/** @brief Records whose bus call returned false or whose objects could not be resolved. */
+		int32 FailedCount = 0;
+		/** @brief Cycles spent per operation, indexed by EEventBusRecordOp. */
+		TStaticArray<uint64, static_cast<int32>(EEventBusRecordOp::Count)> OpCycles =
+			MakeUniformStaticArray<uint64, static_cast<int32>(EEventBusRecordOp::Count)>(0);
+		/** @brief Wall time of the whole replay. */
+		double TotalSeconds = 0.0;
+	};
+
+	/**
+	 * @brief Replays a recording against a bus as fast as possible, for headless profiling.
+	 *
+	 * Delegate broadcasts are re-fired through the stand-in publisher's delegate property with the recorded
+	 * parameters, so listeners run exactly as they did live. Stand-ins stay alive until the replayer is destroyed.
+	 */
+	class EVENTBUS_API FEventBusReplayer final
+	{
+	public:
+		explicit FEventBusReplayer(const FEventBusRecording& InRecording);
+
+		FEventBusReplayer(const FEventBusReplayer&) = delete;
+		FEventBusReplayer& operator=(const FEventBusReplayer&) = delete;
+
+		/** @brief Executes every selected record against Bus. Returns false when any record failed. */
+		bool Replay(FEventBus& Bus, const FEventBusReplayOptions& Options, FEventBusReplayResult& OutResult);
+		/** @brief Returns the stand-in or resolved object used for ObjectPath, or nullptr when none was needed yet. */
+		NFL_EVENTBUS_NODISCARD UObject* FindResolvedObject(const FString& ObjectPath) const;
+
+	private:
+		/** @brief Returns the live object for Record's object path, creating a stand-in on first use. */
+		UObject* ResolveObject(const FEventBusRecord& Record, const FEventBusReplayOptions& Options);
+		/** @brief Re-fires one recorded delegate broadcast and attributes it to the channel's stats. */
+		bool ReplayBroadcast(FEventBus& Bus, const FEventBusRecord& Record, UObject* Publisher) const;
+		/** @brief Executes one record; returns false when the bus rejected it. */
+		bool ReplayRecord(FEventBus& Bus, const FEventBusRecord& Record, const FEventBusReplayOptions& Options, bool& bOutSkipped);
+
+		const FEventBusRecording& Recording;
+		TMap<FString, TStrongObjectPtr<UObject>> Objects;
+	};
+} // namespace Nfrrlib::EventBus
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Map.h"
+#include "Templates/Function.h"
+#include "Templates/UniquePtr.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBus.h"
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Owns scoped sub-buses keyed by a scope owner object such as a UWorld, ULevel or team actor.
+	 *
+	 * Scopes form a tree under one root bus. A scope created with forwarding uses its parent scope
+	 * (or the root bus) as FEventBus parent, so parent-scope listeners still hear child-scope events
+	 * while each scope keeps its own short fan-out lists. Releasing a scope releases its descendants
+	 * first and drops every binding of the scope in one operation.
+	 *
+	 * Threading:
+	 * - Not thread-safe.
+	 * - All operations must run on the Game Thread.
+	 */
+	class EVENTBUS_API FEventBusScopeRegistry final
+	{
+	public:
+		/** @brief Creates an empty scope tree whose top-level scopes may forward into RootBus. */
+		explicit FEventBusScopeRegistry(FEventBus& InRootBus);
+		~FEventBusScopeRegistry();
+
+		FEventBusScopeRegistry(const FEventBusScopeRegistry&) = delete;
+		FEventBusScopeRegistry& operator=(const FEventBusScopeRegistry&) = delete;
+
+		/**
+		 * @brief Returns the scope bus for ScopeOwner, creating it on first request.
+		 *
+		 * ParentScopeOwner selects the parent scope; nullptr selects the root bus. With
+		 * bForwardToParent false the scope is isolated. Returns nullptr when ScopeOwner is invalid,
+		 * the parent scope does not exist, or an existing scope was created with a different parent.
+		 */
+		NFL_EVENTBUS_NODISCARD FEventBus* CreateScope(
+			const UObject* ScopeOwner,
+			const UObject* ParentScopeOwner = nullptr,
+			bool bForwardToParent = true);
+
+		/** @brief Returns the scope bus owned by ScopeOwner, or nullptr when no such scope exists. */
+		NFL_EVENTBUS_NODISCARD FEventBus* FindScope(const UObject* ScopeOwner) const;
+
+		/**
+		 * @brief Returns the nearest scope bus for ContextObject by walking its outer chain, or the root bus.
+		 *
+		 * An actor resolves to its level scope, then its world scope, before falling back to the root.
+		 */
+		NFL_EVENTBUS_NODISCARD FEventBus& ResolveBus(const UObject* ContextObject) const;
+
+		/** @brief Releases one scope and all of its descendants. Returns false when no scope exists for ScopeOwner. */
+		NFL_EVENTBUS_NODISCARD bool ReleaseScope(const UObject* ScopeOwner);
+
+		/**
+		 * @brief Releases every scope whose owner is OuterObject or lives inside it, plus scopes with destroyed owners.
+		 *
+		 * Returns released scope count including descendants.
+		 */
+		int32 ReleaseScopesWithin(const UObject* OuterObject);
+
+		/** @brief Releases every scope. */
+		void ReleaseAll();
+
+		/** @brief Flushes batched channels on every scope bus and returns total delivered payload count. */
+		int32 FlushBatchChannels();
+
+		/** @brief Sweeps dead bindings on every scope bus and returns total dropped entry count. */
+		int32 SweepStaleBindings();
+
+		/** @brief Drops listener timings on every scope bus. */
+		void ResetListenerTimings();
+
+		/** @brief Returns number of live scopes. */
+		NFL_EVENTBUS_NODISCARD int32 GetNumScopes() const;
+
+		/** @brief Visits every live scope bus with its owner (nullptr when the owner was destroyed). */
+		void ForEachScope(TFunctionRef<void(const UObject* ScopeOwner, const FEventBus& ScopeBus)> Visitor) const;
+
+		/** @brief Returns heap bytes owned by the registry and every scope bus, excluding the root bus. */
+		NFL_EVENTBUS_NODISCARD SIZE_T GetAllocatedSize() const;
+
+	private:
+		/**
+		 * @brief Internal storage for one scope.
+		 */
+		struct FScopeEntry final
+		{
+			/** @brief Scope bus; heap-allocated so child parent pointers stay valid across map growth. */
+			TUniquePtr<FEventBus> Bus;
+			/** @brief Weak owner reference used for outer-chain release and stale-owner detection. */
+			TWeakObjectPtr<const UObject> Owner;
+			/** @brief Parent scope key, or an empty key for top-level scopes. */
+			FObjectKey ParentKey;
+			/** @brief True when Bus forwards into its parent scope or the root bus. */
+			bool bForwardToParent = true;
+		};
+
+		/** @brief Releases the scope at Key after releasing its descendants. Returns released scope count. */
+		int32 ReleaseScopeRecursive(const FObjectKey& Key);
+
+	private:
+		FEventBus& RootBus;
+		TMap<FObjectKey, FScopeEntry> Scopes;
+		/** @brief Buses released from inside FlushBatchChannels or SweepStaleBindings, destroyed once it unwinds. */
+		TArray<TUniquePtr<FEventBus>> RetiredBuses;
+		int32 FlushDepth = 0;
+	};
+} // namespace Nfrrlib::EventBus
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+
+#include <atomic>
+
+namespace Nfrrlib::EventBus
+{
+	template <typename T>
+	class TEventBusSnapshotPool;
+
+	/**
+	 * @brief Epoch-based grace period for immutable snapshots read without locks.
+	 *
+	 * Readers enter an FReadScope before loading a snapshot pointer and leave it when done. Writers
+	 * unpublish a snapshot, then Retire it; it is deleted once every reader that could have loaded it
+	 * has left. The epoch advances only when the readers of the epoch before the current one have
+	 * drained, so an object retired in epoch E is freed from epoch E + 2 on.
+	 *
+	 * Threading:
+	 * - FReadScope may be entered from any thread, and nested.
+	 * - Retire and Reclaim must be serialized by the caller, typically under the lock that guards publishing.
+	 */
+	class EVENTBUS_API FEventBusEpochDomain final
+	{
+	public:
+		FEventBusEpochDomain() = default;
+		/** @brief Deletes everything still retired; no reader may be inside a scope. */
+		~FEventBusEpochDomain();
+
+		FEventBusEpochDomain(const FEventBusEpochDomain&) = delete;
+		FEventBusEpochDomain& operator=(const FEventBusEpochDomain&) = delete;
+
+		/**
+		 * @brief Pins the current epoch so snapshots loaded inside the scope stay alive.
+		 */
+		class EVENTBUS_API FReadScope final
+		{
+		public:
+			explicit FReadScope(const FEventBusEpochDomain& InDomain);
+			~FReadScope();
+
+			FReadScope(const FReadScope&) = delete;
+			FReadScope& operator=(const FReadScope&) = delete;
+
+		private:
+			const FEventBusEpochDomain& Domain;
+			uint32 Parity = 0;
+		};
+
+		/** @brief Defers deletion of an unpublished Object until its grace period ends. Null is ignored. */
+		template <typename T>
+		void Retire(const T* Object)
+		{
+			if (Object)
+			{
+				RetireErased(const_cast<T*>(Object), nullptr, [](void*, void* const Erased)
+				{
+					delete static_cast<T*>(Erased);
+				});
+			}
+		}
+
+		/** @brief Like Retire, but returns Object to Pool instead of deleting it. Pool must outlive this domain. */
+		template <typename T>
+		void Retire(const T* Object, TEventBusSnapshotPool<T>& Pool)
+		{
+			if (Object)
+			{
+				RetireErased(const_cast<T*>(Object), &Pool, [](void* const ErasedPool, void* const Erased)
+				{
+					static_cast<TEventBusSnapshotPool<T>*>(ErasedPool)->Release(static_cast<T*>(Erased));
+				});
+			}
+		}
+
+		/** @brief Advances the epoch where possible and deletes objects whose grace period ended. Returns deleted count. */
+		int32 Reclaim();
+		/** @brief Returns objects waiting for their grace period. */
+		NFL_EVENTBUS_NODISCARD int32 GetRetiredCount() const;
+
+	private:
+		struct FRetired final
+		{
+			void* Object = nullptr;
+			/** @brief Passed to Deleter; the pool for pooled objects, otherwise null. */
+			void* Context = nullptr;
+			void (*Deleter)(void*, void*) = nullptr;
+			uint64 Epoch = 0;
+		};
+
+		void RetireErased(void* Object, void* Context, void (*Deleter)(void*, void*));
+		/** @brief Moves to the next epoch when no reader of the previous one remains. */
+		bool TryAdvance();
+
+		mutable std::atomic<uint64> Epoch{0};
+		/** @brief Active readers by epoch parity. */
+		mutable std::atomic<int32> Readers[2]{};
+		/** @brief Retired objects in retire order, so epochs never decrease along the array. */
+		TArray<FRetired> Retired;
+	};
+
+	/**
+	 * @brief Atomically published pointer to an immutable T, reclaimed through an FEventBusEpochDomain.
+	 */
+	template <typename T>
+	class TEventBusSnapshotCell final
+	{
+	public:
+		TEventBusSnapshotCell() = default;
+		/** @brief Deletes the current value; no reader may remain. */
+		~TEventBusSnapshotCell()
+		{
+			delete Current.load(std::memory_order_relaxed);
+		}
+
+		TEventBusSnapshotCell(const TEventBusSnapshotCell&) = delete;
+		TEventBusSnapshotCell& operator=(const TEventBusSnapshotCell&) = delete;
+
+		/** @brief Returns the current value; readers must hold a read scope of the retiring domain. */
+		NFL_EVENTBUS_NODISCARD const T* Load() const
+		{
+			return Current.load(std::memory_order_acquire);
+		}
+
+		/** @brief Swaps in NewValue and retires the previous value into Domain. */
+		void Publish(const T* NewValue, FEventBusEpochDomain& Domain)
+		{
+			Domain.Retire(Current.exchange(NewValue, std::memory_order_acq_rel));
+		}
+
+		/** @brief Swaps in NewValue and retires the previous value into Pool once its grace period ends. */
+		void Publish(const T* NewValue, FEventBusEpochDomain& Domain, TEventBusSnapshotPool<T>& Pool)
+		{
+			Domain.Retire(Current.exchange(NewValue, std::memory_order_acq_rel), Pool);
+		}
+
+	private:
+		std::atomic<const T*> Current{nullptr};
+	};
+
+	/**
+	 * @brief Free list of snapshot objects whose grace period ended, so steady-state publishing does not allocate.
+	 *
+	 * The pool grows to the number of snapshots retired at once and never shrinks. Writer side only.
+	 */
+	template <typename T>
+	class TEventBusSnapshotPool final
+	{
+	public:
+		TEventBusSnapshotPool() = default;
+		~TEventBusSnapshotPool()
+		{
+			for (T* const Object : Free)
+			{
+				delete Object;
+			}
+		}
+
+		TEventBusSnapshotPool(const TEventBusSnapshotPool&) = delete;
+		TEventBusSnapshotPool& operator=(const TEventBusSnapshotPool&) = delete;
+
+		/** @brief Returns a pooled object assigned from Value, allocating only when the pool is empty. */
+		NFL_EVENTBUS_NODISCARD T* Acquire(const T& Value)
+		{
+			if (Free.IsEmpty())
+			{
+				return new T(Value);
+			}
+
+			T* const Object = Free.Pop(EAllowShrinking::No);
+			*Object = Value;
+			return Object;
+		}
+
+		/** @brief Takes back an object no reader can reach anymore. */
+		void Release(T* const Object)
+		{
+			Free.Add(Object);
+		}
+
+		/** @brief Returns objects waiting for reuse. */
+		NFL_EVENTBUS_NODISCARD int32 Num() const
+		{
+			return Free.Num();
+		}
+
+	private:
+		TArray<T*> Free;
+	};
+} // namespace Nfrrlib::EventBus
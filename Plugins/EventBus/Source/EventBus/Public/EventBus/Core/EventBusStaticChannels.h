@@ -0,0 +1,128 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UObject/SoftObjectPath.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+
+class UClass;
+
+/**
+ * @brief Maximum size of the per-bus slot table addressed by typed channel definitions.
+ *
+ * Tables grow lazily up to the number of slots handed out. Typed channels declared beyond this
+ * capacity keep working through hashed tag lookup.
+ */
+#if !defined(NFL_EVENTBUS_MAX_STATIC_CHANNELS)
+	#define NFL_EVENTBUS_MAX_STATIC_CHANNELS 256
+#endif
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Dense channel address resolved from a typed channel definition.
+	 *
+	 * SlotIndex indexes the static slot table in FEventBus. ChannelTag remains the routing key
+	 * used for validation, diagnostics, and hashed fallback when the slot is not bound yet.
+	 */
+	struct FStaticChannelId final
+	{
+		/** @brief Process-wide slot assigned to the typed channel, or INDEX_NONE when the table is full. */
+		int32 SlotIndex = INDEX_NONE;
+		/** @brief Routing channel key for this typed channel. */
+		FGameplayTag ChannelTag;
+
+		/** @brief Returns true when SlotIndex addresses the static slot table. */
+		NFL_EVENTBUS_NODISCARD bool HasSlot() const
+		{
+			return SlotIndex >= 0 && SlotIndex < NFL_EVENTBUS_MAX_STATIC_CHANNELS;
+		}
+	};
+
+	/**
+	 * @brief Resolved description of one `NFL_DECLARE_EVENTBUS_CHANNEL` declaration for tooling.
+	 *
+	 * Plain data only, so it stays valid after the declaring module is unloaded or hot-reloaded.
+	 * ChannelTag is invalid when every module declaring the channel unloaded before it was resolved.
+	 */
+	struct FStaticChannelDescriptor final
+	{
+		/** @brief Channel definition struct name as written in the declaration. */
+		FString ChannelDefName;
+		/** @brief Declared channel tag. */
+		FGameplayTag ChannelTag;
+		/** @brief Path of the declared publisher class. */
+		FSoftClassPath PublisherClassPath;
+		/** @brief Declared publisher delegate property name. */
+		FName DelegatePropertyName;
+	};
+
+	/**
+	 * @brief Accessors of one declaration as compiled into one module.
+	 *
+	 * Tags and classes are not available during static initialization, so they are read through these
+	 * the first time descriptors are requested. The functions live in the declaring module.
+	 */
+	struct FStaticChannelDeclaration final
+	{
+		const TCHAR* ChannelDefName = nullptr;
+		const FGameplayTag& (*GetChannelTag)() = nullptr;
+		UClass* (*GetPublisherClass)() = nullptr;
+		FName (*GetDelegatePropertyName)() = nullptr;
+	};
+
+	/**
+	 * @brief Static registration of one declaration in one module.
+	 *
+	 * Constructed during the module's static initialization and destroyed when the module is unloaded,
+	 * which withdraws the module's accessors before they can dangle.
+	 */
+	class EVENTBUS_API FStaticChannelDescription final
+	{
+	public:
+		FStaticChannelDescription(const TCHAR* ChannelKey, const FStaticChannelDeclaration& Declaration);
+		~FStaticChannelDescription();
+
+		FStaticChannelDescription(const FStaticChannelDescription&) = delete;
+		FStaticChannelDescription& operator=(const FStaticChannelDescription&) = delete;
+
+		/** @brief Returns the index of this declaration in GetChannelDescriptors output. */
+		NFL_EVENTBUS_NODISCARD int32 GetDescriptorIndex() const
+		{
+			return DescriptorIndex;
+		}
+
+	private:
+		int32 DescriptorIndex = INDEX_NONE;
+	};
+
+	/**
+	 * @brief Process-wide allocator of dense slot indices for typed channel definitions.
+	 *
+	 * Slots and descriptors are keyed by the declaration text, so every module that includes the same
+	 * `NFL_DECLARE_EVENTBUS_CHANNEL` gets the same slot and one descriptor. A slot never changes once
+	 * handed out.
+	 */
+	class EVENTBUS_API FEventBusStaticChannelRegistry final
+	{
+	public:
+		/** @brief Returns the slot of ChannelKey, reserving the next one on first use. INDEX_NONE once capacity is exhausted. */
+		NFL_EVENTBUS_NODISCARD static int32 AllocateSlot(const TCHAR* ChannelKey);
+		/** @brief Returns number of slots reserved so far, clamped to table capacity. */
+		NFL_EVENTBUS_NODISCARD static int32 GetNumAllocatedSlots();
+		/**
+		 * @brief Copies every declaration described so far, in static-initialization order.
+		 * Declarations not resolved yet are resolved first, through accessors of a module that is still loaded.
+		 */
+		static void GetChannelDescriptors(TArray<FStaticChannelDescriptor>& OutDescriptors);
+
+	private:
+		friend class FStaticChannelDescription;
+
+		/** @brief Records Declaration as one module's copy of ChannelKey. Returns the descriptor index. */
+		static int32 DescribeChannel(const TCHAR* ChannelKey, const FStaticChannelDescription& Owner, const FStaticChannelDeclaration& Declaration);
+		/** @brief Drops the accessors Owner recorded; the descriptor keeps whatever was resolved already. */
+		static void WithdrawChannel(int32 DescriptorIndex, const FStaticChannelDescription& Owner);
+	};
+} // namespace Nfrrlib::EventBus
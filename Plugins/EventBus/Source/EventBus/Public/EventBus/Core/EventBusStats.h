@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+
+DECLARE_STATS_GROUP(TEXT("EventBus"), STATGROUP_EventBus, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Bind"), STAT_EventBus_Bind, STATGROUP_EventBus, EVENTBUS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Unbind"), STAT_EventBus_Unbind, STATGROUP_EventBus, EVENTBUS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cleanup"), STAT_EventBus_Cleanup, STATGROUP_EventBus, EVENTBUS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Dispatch"), STAT_EventBus_Dispatch, STATGROUP_EventBus, EVENTBUS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Broadcasts"), STAT_EventBus_Broadcasts, STATGROUP_EventBus, EVENTBUS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Listener Invocations"), STAT_EventBus_ListenerInvocations, STATGROUP_EventBus, EVENTBUS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Binds"), STAT_EventBus_Binds, STATGROUP_EventBus, EVENTBUS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Unbinds"), STAT_EventBus_Unbinds, STATGROUP_EventBus, EVENTBUS_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(EVENTBUS_API, EventBus);
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Cumulative runtime counters for one channel since registration or the last stats reset.
+	 */
+	struct FEventChannelStats final
+	{
+		/** @brief Live publisher entries at query time. */
+		int32 PublisherCount = 0;
+		/** @brief Live listener entries at query time. */
+		int32 ListenerCount = 0;
+		/** @brief Broadcasts observed by the bus (typed Broadcast helper, batched enqueue, spatial publish). */
+		uint64 BroadcastCount = 0;
+		/** @brief Listener callbacks executed by those broadcasts. */
+		uint64 ListenerInvocationCount = 0;
+		/** @brief Listener-to-publisher delegate binds (or native listener adds). */
+		uint64 BindCount = 0;
+		/** @brief Listener-to-publisher delegate unbinds (or native listener removals). */
+		uint64 UnbindCount = 0;
+		/** @brief Time spent in stale publisher/listener cleanup, in CPU cycles. */
+		uint64 CleanupCycles = 0;
+		/** @brief Time spent dispatching broadcasts, in CPU cycles. */
+		uint64 DispatchCycles = 0;
+
+		/** @brief Returns cleanup time in seconds. */
+		NFL_EVENTBUS_NODISCARD double GetCleanupSeconds() const
+		{
+			return FPlatformTime::ToSeconds64(CleanupCycles);
+		}
+
+		/** @brief Returns dispatch time in seconds. */
+		NFL_EVENTBUS_NODISCARD double GetDispatchSeconds() const
+		{
+			return FPlatformTime::ToSeconds64(DispatchCycles);
+		}
+	};
+
+	/**
+	 * @brief Adds elapsed CPU cycles to a channel counter when the scope ends.
+	 */
+	class FScopedChannelCycles final
+	{
+	public:
+		explicit FScopedChannelCycles(uint64& InTargetCycles)
+			: TargetCycles(InTargetCycles)
+			, StartCycles(FPlatformTime::Cycles64())
+		{
+		}
+
+		~FScopedChannelCycles()
+		{
+			TargetCycles += FPlatformTime::Cycles64() - StartCycles;
+		}
+
+		FScopedChannelCycles(const FScopedChannelCycles&) = delete;
+		FScopedChannelCycles& operator=(const FScopedChannelCycles&) = delete;
+
+	private:
+		uint64& TargetCycles;
+		uint64 StartCycles = 0;
+	};
+} // namespace Nfrrlib::EventBus
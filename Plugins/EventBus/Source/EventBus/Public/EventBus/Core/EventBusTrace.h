@@ -0,0 +1,117 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+
+/**
+ * @brief Compiles EventBus Insights instrumentation in or out.
+ *
+ * Defaults to on wherever the engine compiles CPU profiler tracing (including Test builds).
+ * Define to 0 in the target to strip every EventBus trace scope and event.
+ */
+#ifndef NFL_EVENTBUS_TRACE_ENABLED
+	#define NFL_EVENTBUS_TRACE_ENABLED (UE_TRACE_ENABLED && CPUPROFILERTRACE_ENABLED)
+#endif
+
+#if NFL_EVENTBUS_TRACE_ENABLED
+/** @brief Insights trace channel for bus topology changes and listener dispatch; enable with `-trace=cpu,EventBus`. */
+UE_TRACE_CHANNEL_EXTERN(EventBusChannel, EVENTBUS_API);
+#endif
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Entry points for EventBus custom trace events.
+	 */
+	class EVENTBUS_API FEventBusTrace final
+	{
+	public:
+		/** @brief Returns true when instrumentation is compiled in and EventBusChannel is enabled. */
+		NFL_EVENTBUS_NODISCARD static bool IsEnabled();
+
+		/**
+		 * @brief Emits one `EventBus.ListenerInvocation` event with channel tag and listener class.
+		 *
+		 * StartCycle/EndCycle bound the callback; delegate channels report the enclosing broadcast window
+		 * because multicast dispatch does not expose individual invocations.
+		 */
+		static void OutputListenerInvocation(
+			const FGameplayTag& ChannelTag,
+			const UClass* ListenerClass,
+			FName FunctionName,
+			uint64 StartCycle,
+			uint64 EndCycle);
+	};
+
+	/**
+	 * @brief Timeline scope named after a channel tag; does nothing unless EventBusChannel is enabled.
+	 */
+	class EVENTBUS_API FEventBusTraceChannelScope final
+	{
+	public:
+		explicit FEventBusTraceChannelScope(const FGameplayTag& ChannelTag);
+		~FEventBusTraceChannelScope();
+
+		FEventBusTraceChannelScope(const FEventBusTraceChannelScope&) = delete;
+		FEventBusTraceChannelScope& operator=(const FEventBusTraceChannelScope&) = delete;
+
+	private:
+		bool bActive = false;
+	};
+
+	/**
+	 * @brief Times one native listener callback and emits a listener invocation event when the scope ends.
+	 */
+	class FEventBusTraceListenerScope final
+	{
+	public:
+		FEventBusTraceListenerScope(const FGameplayTag& InChannelTag, const UObject* ListenerObj, const FName InFunctionName)
+		{
+			if (FEventBusTrace::IsEnabled())
+			{
+				ChannelTag = &InChannelTag;
+				// Capture class up front: the callback may mark its own listener as garbage.
+				ListenerClass = ListenerObj ? ListenerObj->GetClass() : nullptr;
+				FunctionName = InFunctionName;
+				StartCycle = FPlatformTime::Cycles64();
+			}
+		}
+
+		~FEventBusTraceListenerScope()
+		{
+			if (ChannelTag != nullptr)
+			{
+				FEventBusTrace::OutputListenerInvocation(*ChannelTag, ListenerClass, FunctionName, StartCycle, FPlatformTime::Cycles64());
+			}
+		}
+
+		FEventBusTraceListenerScope(const FEventBusTraceListenerScope&) = delete;
+		FEventBusTraceListenerScope& operator=(const FEventBusTraceListenerScope&) = delete;
+
+	private:
+		const FGameplayTag* ChannelTag = nullptr;
+		const UClass* ListenerClass = nullptr;
+		FName FunctionName = NAME_None;
+		uint64 StartCycle = 0;
+	};
+} // namespace Nfrrlib::EventBus
+
+#if NFL_EVENTBUS_TRACE_ENABLED
+/** @brief CPU timeline scope with a static name on EventBusChannel. */
+	#define NFL_EVENTBUS_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, EventBusChannel)
+/** @brief CPU timeline scope named after a channel tag on EventBusChannel. */
+	#define NFL_EVENTBUS_TRACE_CHANNEL_SCOPE(ChannelTag) \
+		const ::Nfrrlib::EventBus::FEventBusTraceChannelScope PREPROCESSOR_JOIN(EventBusTraceChannelScope, __LINE__)(ChannelTag)
+/** @brief Times one native listener callback and emits a listener invocation event. */
+	#define NFL_EVENTBUS_TRACE_LISTENER_SCOPE(ChannelTag, ListenerObj, FunctionName) \
+		const ::Nfrrlib::EventBus::FEventBusTraceListenerScope PREPROCESSOR_JOIN(EventBusTraceListenerScope, __LINE__)(ChannelTag, ListenerObj, FunctionName)
+#else
+	#define NFL_EVENTBUS_TRACE_SCOPE(Name)
+	#define NFL_EVENTBUS_TRACE_CHANNEL_SCOPE(ChannelTag)
+	#define NFL_EVENTBUS_TRACE_LISTENER_SCOPE(ChannelTag, ListenerObj, FunctionName)
+#endif
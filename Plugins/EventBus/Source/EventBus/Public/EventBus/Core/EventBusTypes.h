@@ -29,6 +29,11 @@ namespace Nfrrlib::EventBus
 	{
 		/** @brief Reflected multicast delegate property name on publisher class. */
 		FName DelegatePropertyName = NAME_None;
+		/**
+		 * @brief Delegate property resolved ahead of time, e.g. when a Blueprint compiled. When set and trusted by
+		 * FEventBusValidation::IsTrustedDelegateProperty, the property lookup is skipped.
+		 */
+		const FMulticastDelegateProperty* ResolvedDelegateProperty = nullptr;
 	};
 
 	/**
@@ -38,6 +43,35 @@ namespace Nfrrlib::EventBus
 	{
 		/** @brief Reflected listener UFUNCTION name on listener class. */
 		FName FunctionName = NAME_None;
+		/**
+		 * @brief Listener function resolved ahead of time, e.g. when a Blueprint compiled. When set and trusted by
+		 * FEventBusValidation::IsTrustedListenerFunction, the function lookup is skipped.
+		 */
+		const UFunction* ResolvedFunction = nullptr;
+		/** @brief Channel signature ResolvedFunction was proven compatible with; a matching channel skips the signature check. */
+		const UFunction* ProvenSignature = nullptr;
+	};
+
+	/**
+	 * @brief One channel/publisher-delegate pair for FEventBus::AddPublishers.
+	 */
+	struct FChannelPublisherBinding final
+	{
+		/** @brief Channel the publisher joins. */
+		FGameplayTag ChannelTag;
+		/** @brief Publisher delegate bound on that channel. */
+		FPublisherBinding Binding;
+	};
+
+	/**
+	 * @brief One channel/listener-function pair for FEventBus::AddListeners and RemoveListeners.
+	 */
+	struct FChannelListenerBinding final
+	{
+		/** @brief Channel the listener joins or leaves. */
+		FGameplayTag ChannelTag;
+		/** @brief Listener function bound on that channel. */
+		FListenerBinding Binding;
 	};
 
 	/**
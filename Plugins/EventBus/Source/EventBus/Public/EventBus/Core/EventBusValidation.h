@@ -8,6 +8,14 @@
 class FMulticastDelegateProperty;
 class UFunction;
 
+/**
+ * @brief Re-resolves pre-resolved bindings by name and compares before trusting them (1), or trusts them after a
+ * class check only (0). Defaults to every build except Shipping.
+ */
+#ifndef NFL_EVENTBUS_CHECK_TRUSTED_BINDINGS
+#define NFL_EVENTBUS_CHECK_TRUSTED_BINDINGS (!UE_BUILD_SHIPPING)
+#endif
+
 namespace Nfrrlib::EventBus
 {
 	/**
@@ -48,6 +56,18 @@ namespace Nfrrlib::EventBus
 			const FMulticastDelegateProperty* DelegateProperty,
 			EEventBusError& OutError);
 
+		/**
+		 * @brief Returns true when Binding's pre-resolved function may be used for ListenerObj without a lookup.
+		 * False means the caller must take the fully validated path. ListenerObj must already be valid.
+		 */
+		NFL_EVENTBUS_NODISCARD static bool IsTrustedListenerFunction(const UObject* ListenerObj, const FListenerBinding& Binding);
+
+		/**
+		 * @brief Returns true when Binding's pre-resolved delegate property may be used for PublisherObj without a lookup.
+		 * False means the caller must take the fully validated path. PublisherObj must already be valid.
+		 */
+		NFL_EVENTBUS_NODISCARD static bool IsTrustedDelegateProperty(const UObject* PublisherObj, const FPublisherBinding& Binding);
+
 		/** @brief Builds an EventBus listener delegate binding and returns resolved function metadata. */
 		NFL_EVENTBUS_NODISCARD
 		static bool BuildListenerBinding(
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Delegates/Delegate.h"
+#include "GameplayTagContainer.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBusSnapshots.h"
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Shape flags of one channel topology snapshot.
+	 */
+	enum class EEventChannelTopologyFlags : uint8
+	{
+		None = 0,
+		/** @brief Delegate channel registered with bOwnsPublisherDelegates. */
+		OwnsPublisherDelegates = 1 << 0,
+		/** @brief Native batched channel. */
+		Batch = 1 << 1,
+		/** @brief Native spatial channel. */
+		Spatial = 1 << 2
+	};
+	ENUM_CLASS_FLAGS(EEventChannelTopologyFlags);
+
+	/**
+	 * @brief Immutable description of one channel's shape as of its last mutation.
+	 */
+	struct FEventChannelTopology final
+	{
+		FGameplayTag ChannelTag;
+		EEventChannelTopologyFlags Flags = EEventChannelTopologyFlags::None;
+		/** @brief Delegate signature function of a delegate channel, or payload type name of a native channel; None until known. */
+		FName SignatureName = NAME_None;
+		/** @brief Live publishers; always 0 for native channels. */
+		int32 PublisherCount = 0;
+		/**
+		 * @brief Live listeners of a delegate channel. Native channels count entries until their next sweep, so
+		 * listeners that died since then are included until FEventBus::SweepStaleBindings runs.
+		 */
+		int32 ListenerCount = 0;
+
+		/** @brief Returns true for batched and spatial channels. */
+		NFL_EVENTBUS_NODISCARD bool IsNative() const
+		{
+			return EnumHasAnyFlags(Flags, EEventChannelTopologyFlags::Batch | EEventChannelTopologyFlags::Spatial);
+		}
+
+		friend bool operator==(const FEventChannelTopology& Lhs, const FEventChannelTopology& Rhs)
+		{
+			return Lhs.ChannelTag == Rhs.ChannelTag &&
+				Lhs.Flags == Rhs.Flags &&
+				Lhs.SignatureName == Rhs.SignatureName &&
+				Lhs.PublisherCount == Rhs.PublisherCount &&
+				Lhs.ListenerCount == Rhs.ListenerCount;
+		}
+	};
+
+	/**
+	 * @brief Called on the writer thread when a channel gains its first listener (true) or loses its last one (false).
+	 */
+	using FOnChannelPresenceChanged = TMulticastDelegate<void(const FGameplayTag& ChannelTag, bool bHasListeners)>;
+
+	/**
+	 * @brief Per-channel topology snapshots of one bus, readable from any thread without locks.
+	 *
+	 * Each channel owns a snapshot cell; the tag-to-cell map is itself a snapshot, replaced only when a
+	 * channel is added or removed. Replaced snapshots and removed cells are reclaimed after their grace period;
+	 * replaced channel snapshots go back to a pool, so listener and publisher churn publishes without allocating.
+	 *
+	 * Presence callbacks fire after the snapshot that moved ListenerCount across zero is published, so they
+	 * may query or mutate the owning bus. Removing a channel that had listeners counts as losing the last one.
+	 *
+	 * Threading:
+	 * - Find may be called from any thread.
+	 * - Publish, Remove, Reset and presence subscription must be serialized by the owner; FEventBus calls them
+	 *   on the game thread.
+	 */
+	class EVENTBUS_API FEventChannelTopologyTable final
+	{
+	public:
+		FEventChannelTopologyTable() = default;
+		/** @brief Deletes every cell; no reader may remain. */
+		~FEventChannelTopologyTable();
+
+		FEventChannelTopologyTable(const FEventChannelTopologyTable&) = delete;
+		FEventChannelTopologyTable& operator=(const FEventChannelTopologyTable&) = delete;
+
+		/** @brief Copies the snapshot of ChannelTag into OutTopology. Returns false when the channel has none. */
+		NFL_EVENTBUS_NODISCARD bool Find(const FGameplayTag& ChannelTag, FEventChannelTopology& OutTopology) const;
+
+		/** @brief Publishes Topology for its channel, adding the channel when new. No-op when nothing changed. */
+		void Publish(const FEventChannelTopology& Topology);
+		/** @brief Removes the snapshot of ChannelTag. */
+		void Remove(const FGameplayTag& ChannelTag);
+		/** @brief Removes every snapshot. */
+		void Reset();
+
+		/** @brief Subscribes Callback to presence changes of ChannelTag, whether or not it has a snapshot yet. */
+		FDelegateHandle AddPresenceCallback(const FGameplayTag& ChannelTag, FOnChannelPresenceChanged::FDelegate&& Callback);
+		/** @brief Unsubscribes one presence callback. Returns false when Handle is not subscribed to ChannelTag. */
+		bool RemovePresenceCallback(const FGameplayTag& ChannelTag, FDelegateHandle Handle);
+
+	private:
+		using FCell = TEventBusSnapshotCell<FEventChannelTopology>;
+
+		/**
+		 * @brief Immutable tag-to-cell map; cells outlive the maps that list them until retired on removal.
+		 */
+		struct FView final
+		{
+			TMap<FGameplayTag, FCell*> Cells;
+		};
+
+		/** @brief Returns the current cell of ChannelTag, or nullptr. Writer side only. */
+		FCell* FindCell(const FGameplayTag& ChannelTag) const;
+		/** @brief Broadcasts ChannelTag's presence callbacks when the listener count crossed zero. */
+		void NotifyPresence(const FGameplayTag& ChannelTag, int32 OldListenerCount, int32 NewListenerCount) const;
+
+		/** @brief Declared before Domain, which releases into it until destroyed. */
+		TEventBusSnapshotPool<FEventChannelTopology> SnapshotPool;
+		FEventBusEpochDomain Domain;
+		TEventBusSnapshotCell<FView> View;
+		/** @brief Presence subscriptions by channel; writer side only. */
+		TMap<FGameplayTag, FOnChannelPresenceChanged> PresenceCallbacks;
+	};
+} // namespace Nfrrlib::EventBus
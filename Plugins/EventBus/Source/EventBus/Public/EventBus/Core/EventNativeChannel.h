@@ -0,0 +1,124 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBusDiagnostics.h"
+#include "EventBus/Core/EventBusErrors.h"
+#include "EventBus/Core/EventBusListenerTiming.h"
+#include "EventBus/Core/EventBusMemory.h"
+#include "EventBus/Core/EventBusPayloadType.h"
+#include "EventBus/Core/EventBusPolicies.h"
+#include "EventBus/Core/EventBusStats.h"
+#include "EventBus/Core/EventBusTrace.h"
+
+namespace Nfrrlib::EventBus
+{
+	class FEventChannelTopologyTable;
+
+	/**
+	 * @brief Dispatch model of a bus-owned native channel.
+	 */
+	enum class EEventNativeChannelKind : uint8
+	{
+		/** @brief Payloads are buffered and delivered as one span per flush. */
+		Batch,
+		/** @brief Payloads carry a world location and reach only listeners whose interest radius covers it. */
+		Spatial
+	};
+
+	/**
+	 * @brief Returns a readable string for EEventNativeChannelKind values.
+	 */
+	NFL_EVENTBUS_NODISCARD EVENTBUS_API const TCHAR* LexToString(EEventNativeChannelKind Kind);
+
+	/**
+	 * @brief Type-erased state for one native channel owned by FEventBus.
+	 *
+	 * Native channels do not route through publisher multicast delegates. The bus owns dispatch
+	 * and invokes native listener delegates directly with strongly typed payloads.
+	 */
+	class EVENTBUS_API FEventNativeChannelBase
+	{
+	public:
+		/** @brief Creates native channel state tagged with its dispatch model, payload type and payload display name. */
+		FEventNativeChannelBase(EEventNativeChannelKind InKind, FEventPayloadTypeId InPayloadTypeId, FName InPayloadTypeName);
+		virtual ~FEventNativeChannelBase() = default;
+
+		FEventNativeChannelBase(const FEventNativeChannelBase&) = delete;
+		FEventNativeChannelBase& operator=(const FEventNativeChannelBase&) = delete;
+
+		/** @brief Returns dispatch model recorded at registration. */
+		NFL_EVENTBUS_NODISCARD EEventNativeChannelKind GetKind() const;
+		/** @brief Returns payload type identity recorded at registration for typed access checks. */
+		NFL_EVENTBUS_NODISCARD FEventPayloadTypeId GetPayloadTypeId() const;
+		/** @brief Returns payload type name recorded at registration for logs, topology and recordings. */
+		NFL_EVENTBUS_NODISCARD FName GetPayloadTypeName() const;
+		/** @brief Returns channel tag assigned by the owning bus at registration. */
+		NFL_EVENTBUS_NODISCARD const FGameplayTag& GetChannelTag() const;
+		/** @brief Records the channel tag used for diagnostics and trace events. */
+		void SetChannelTag(const FGameplayTag& InChannelTag);
+		/** @brief Publishes this channel's topology into InTopology from now on, or stops publishing when null. */
+		void SetTopology(FEventChannelTopologyTable* InTopology);
+
+		/** @brief Delivers buffered payloads and returns delivered payload count. Immediate channels deliver nothing. */
+		virtual int32 Flush();
+		/** @brief Returns number of payloads waiting for the next flush. */
+		NFL_EVENTBUS_NODISCARD virtual int32 GetPendingCount() const;
+		/** @brief Returns number of tracked listener entries. */
+		NFL_EVENTBUS_NODISCARD virtual int32 GetListenerCount() const = 0;
+		/** @brief Drops listeners whose objects died and republishes topology. Returns dropped count. */
+		virtual int32 SweepStaleListeners();
+		/** @brief Drops pending payloads and every listener entry. */
+		virtual void Reset() = 0;
+		/** @brief Fills OutMemory with this channel's heap footprint, including the channel object itself. */
+		virtual void GetMemory(FEventChannelMemory& OutMemory) const = 0;
+		/** @brief Appends one summary row per live listener class and function. */
+		virtual void GetListenerSummaries(TArray<FEventBindingSummary>& OutSummaries) const = 0;
+
+		/** @brief Returns cumulative counters plus current listener count. */
+		NFL_EVENTBUS_NODISCARD FEventChannelStats GetStats() const;
+		/** @brief Clears cumulative counters. */
+		void ResetStats();
+		/** @brief Replaces OutTimings with at most MaxRows listener timings, slowest maximum first. */
+		void GetListenerTimings(int32 MaxRows, TArray<FEventListenerTimingStats>& OutTimings) const;
+		/** @brief Drops recorded listener timings. */
+		void ResetListenerTimings();
+
+	protected:
+		/** @brief Same policies as the owning FEventBus; native listener arguments are validated through them. */
+		using FPolicies = FEventBusActivePolicies;
+
+		/** @brief Emits the shared warning line for rejected native listener operations. */
+		void LogListenerFailure(const TCHAR* Operation, EEventBusError Error, const UObject* ListenerObj, FName FunctionName) const;
+		/** @brief Emits the shared warning line for rejected native channel operations without a listener. */
+		void LogChannelFailure(const TCHAR* Operation, EEventBusError Error) const;
+
+		/** @brief Republishes the topology snapshot when ListenerCount differs from the last published count. */
+		void SyncTopology(const int32 ListenerCount)
+		{
+			if (Topology && ListenerCount != PublishedListenerCount)
+			{
+				PublishTopology(ListenerCount);
+			}
+		}
+
+		/** @brief Cumulative counters updated by typed channel implementations. */
+		FEventChannelStats Stats;
+		/** @brief Per-listener timings, filled by FScopedListenerTiming while timing is enabled. */
+		FEventListenerTimingTable ListenerTimings;
+
+	private:
+		/** @brief Publishes a snapshot with ListenerCount into Topology. */
+		void PublishTopology(int32 ListenerCount);
+
+		EEventNativeChannelKind Kind = EEventNativeChannelKind::Batch;
+		FEventPayloadTypeId PayloadTypeId;
+		FName PayloadTypeName = NAME_None;
+		FGameplayTag ChannelTag;
+		/** @brief Owning bus's topology table while registered; null once unregistered. */
+		FEventChannelTopologyTable* Topology = nullptr;
+		int32 PublishedListenerCount = INDEX_NONE;
+	};
+} // namespace Nfrrlib::EventBus
@@ -0,0 +1,453 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/SparseArray.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+#include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBusErrors.h"
+#include "EventBus/Core/EventBusTypes.h"
+#include "EventBus/Core/EventNativeChannel.h"
+
+namespace Nfrrlib::EventBus
+{
+	/**
+	 * @brief Inclusive range of grid cells covered by one element's interest sphere.
+	 */
+	struct FEventSpatialCellSpan final
+	{
+		/** @brief Lowest covered cell coordinate on each axis. */
+		FIntVector MinCell = FIntVector::ZeroValue;
+		/** @brief Highest covered cell coordinate on each axis. */
+		FIntVector MaxCell = FIntVector::ZeroValue;
+		/** @brief True when the span was too wide for cell buckets and the element lives in the overflow list. */
+		bool bOverflow = false;
+	};
+
+	/**
+	 * @brief Uniform hash grid mapping cells to element ids whose interest sphere overlaps the cell.
+	 *
+	 * Elements are inserted into every cell their bounding box touches, so a point query only reads
+	 * the single cell containing the point. Elements wider than MaxCellsPerElement cells are kept in
+	 * an overflow list that every query visits instead of flooding the cell map.
+	 */
+	class EVENTBUS_API FEventSpatialGrid final
+	{
+	public:
+		/** @brief Upper bound of cell buckets one element may occupy before it falls back to the overflow list. */
+		static constexpr int64 MaxCellsPerElement = 512;
+
+		explicit FEventSpatialGrid(double InCellSize);
+
+		/** @brief Returns true when CellSize is finite and strictly positive. */
+		NFL_EVENTBUS_NODISCARD static bool IsValidCellSize(double CellSize);
+
+		/** @brief Returns grid cell edge length in world units. */
+		NFL_EVENTBUS_NODISCARD double GetCellSize() const;
+		/** @brief Returns the cell containing Location. */
+		NFL_EVENTBUS_NODISCARD FIntVector GetCell(const FVector& Location) const;
+		/** @brief Returns number of non-empty cell buckets. */
+		NFL_EVENTBUS_NODISCARD int32 GetNumCells() const;
+
+		/** @brief Inserts ElementId into every cell overlapped by the sphere and returns the covered span. */
+		FEventSpatialCellSpan Insert(int32 ElementId, const FVector& Center, double Radius);
+		/** @brief Removes ElementId from every cell of a span previously returned by Insert. */
+		void Remove(int32 ElementId, const FEventSpatialCellSpan& Span);
+		/** @brief Replaces OutElementIds with every element whose cells contain Location. Callers still run exact distance checks. */
+		void Gather(const FVector& Location, TArray<int32>& OutElementIds) const;
+		/** @brief Drops every cell bucket and overflow entry. */
+		void Reset();
+		/** @brief Returns heap bytes held by cell buckets and the overflow list. */
+		NFL_EVENTBUS_NODISCARD SIZE_T GetAllocatedSize() const;
+
+	private:
+		double CellSize = 1.0;
+		double InvCellSize = 1.0;
+		TMap<FIntVector, TArray<int32>> Cells;
+		TArray<int32> Overflow;
+	};
+
+	/**
+	 * @brief Spatial channel storage for one payload type.
+	 *
+	 * Listeners register an interest sphere. Publish takes a world location and invokes only
+	 * listeners whose sphere contains it, visiting one grid cell instead of every listener.
+	 * Listener removal and callback replacement during publish are deferred until delivery completes, so
+	 * gathered ids stay valid and a callback never destroys the delegate that is running it.
+	 *
+	 * Listeners whose objects were destroyed are dropped when a publish gathers them, and by a sweep
+	 * that runs once the number of adds since the last sweep reaches the live listener count.
+	 */
+	template <typename TPayload>
+	class TEventSpatialChannel final : public FEventNativeChannelBase
+	{
+	public:
+		/** @brief Native listener callback receiving one located payload. */
+		using FSpatialDelegate = TDelegate<void(const TPayload&)>;
+
+		TEventSpatialChannel(const FName InPayloadTypeName, const double InCellSize)
+			: FEventNativeChannelBase(EEventNativeChannelKind::Spatial, GetPayloadTypeId<TPayload>(), InPayloadTypeName)
+			, Grid(InCellSize)
+		{
+		}
+
+		/** @brief Returns grid cell edge length in world units. */
+		NFL_EVENTBUS_NODISCARD double GetCellSize() const
+		{
+			return Grid.GetCellSize();
+		}
+
+		/** @brief Adds or replaces one listener callback with an interest sphere centered at Location. */
+		NFL_EVENTBUS_NODISCARD bool AddListener(
+			UObject* ListenerObj,
+			const FName FunctionName,
+			const FVector& Location,
+			const double Radius,
+			FSpatialDelegate&& Callback)
+		{
+			EEventBusError Error = EEventBusError::None;
+			if (!FPolicies::FValidation::ValidateObject(ListenerObj, Error) ||
+				!FPolicies::FValidation::ValidateName(FunctionName, Error))
+			{
+				LogListenerFailure(TEXT("AddSpatialListener"), Error, ListenerObj, FunctionName);
+				return false;
+			}
+
+			if (!Callback.IsBound())
+			{
+				LogListenerFailure(TEXT("AddSpatialListener"), EEventBusError::ListenerFunctionNotBindable, ListenerObj, FunctionName);
+				return false;
+			}
+
+			if (!IsValidInterest(Location, Radius))
+			{
+				LogListenerFailure(TEXT("AddSpatialListener"), EEventBusError::InvalidSpatialQuery, ListenerObj, FunctionName);
+				return false;
+			}
+
+			LLM_SCOPE_BYTAG(EventBus);
+			const FListenerKey ListenerKey = MakeListenerKey(ListenerObj, FunctionName);
+			if (const int32* ExistingIndex = ListenerIndices.Find(ListenerKey))
+			{
+				FSpatialListenerEntry& Existing = Listeners[*ExistingIndex];
+				Existing.Listener = ListenerObj;
+				if (PublishDepth > 0)
+				{
+					// The entry's callback may be the one executing; swap it in once the outermost publish ends.
+					Existing.StagedCallback = MoveTemp(Callback);
+					PendingReplacements.Add(*ExistingIndex);
+				}
+				else
+				{
+					Existing.Callback = MoveTemp(Callback);
+				}
+				Relocate(*ExistingIndex, Location, Radius);
+				return true;
+			}
+
+			if (++AddsSinceSweep >= FMath::Max(ListenerIndices.Num(), MinAddsBetweenSweeps))
+			{
+				SweepStaleListeners();
+			}
+
+			const int32 NewIndex = Listeners.Emplace();
+			FSpatialListenerEntry& NewEntry = Listeners[NewIndex];
+			NewEntry.ListenerKey = ListenerKey;
+			NewEntry.Listener = ListenerObj;
+			NewEntry.Callback = MoveTemp(Callback);
+			NewEntry.Location = Location;
+			NewEntry.RadiusSquared = FMath::Square(Radius);
+			NewEntry.Span = Grid.Insert(NewIndex, Location, Radius);
+			ListenerIndices.Add(ListenerKey, NewIndex);
+			++Stats.BindCount;
+			INC_DWORD_STAT(STAT_EventBus_Binds);
+			SyncTopology(ListenerIndices.Num());
+			return true;
+		}
+
+		/** @brief Moves or resizes the interest sphere of one tracked listener. */
+		NFL_EVENTBUS_NODISCARD bool UpdateListener(UObject* ListenerObj, const FName FunctionName, const FVector& Location, const double Radius)
+		{
+			if (!IsValidInterest(Location, Radius))
+			{
+				LogListenerFailure(TEXT("UpdateSpatialListener"), EEventBusError::InvalidSpatialQuery, ListenerObj, FunctionName);
+				return false;
+			}
+
+			const int32* ExistingIndex = ListenerIndices.Find(MakeListenerKey(ListenerObj, FunctionName));
+			if (!ExistingIndex)
+			{
+				return false;
+			}
+
+			LLM_SCOPE_BYTAG(EventBus);
+			Relocate(*ExistingIndex, Location, Radius);
+			return true;
+		}
+
+		/** @brief Removes one listener callback keyed by object identity and function name. */
+		NFL_EVENTBUS_NODISCARD bool RemoveListener(UObject* ListenerObj, const FName FunctionName)
+		{
+			EEventBusError Error = EEventBusError::None;
+			if (!FPolicies::FValidation::ValidateObject(ListenerObj, Error) ||
+				!FPolicies::FValidation::ValidateName(FunctionName, Error))
+			{
+				LogListenerFailure(TEXT("RemoveSpatialListener"), Error, ListenerObj, FunctionName);
+				return false;
+			}
+
+			int32 ExistingIndex = INDEX_NONE;
+			if (!ListenerIndices.RemoveAndCopyValue(MakeListenerKey(ListenerObj, FunctionName), ExistingIndex))
+			{
+				return false;
+			}
+
+			ReleaseListener(ExistingIndex);
+			++Stats.UnbindCount;
+			INC_DWORD_STAT(STAT_EventBus_Unbinds);
+			SyncTopology(ListenerIndices.Num());
+			return true;
+		}
+
+		/**
+		 * @brief Drops listeners whose objects were destroyed, including ones no publish gathers. Returns dropped count.
+		 * Runs automatically from AddListener at an amortized constant cost per add.
+		 */
+		virtual int32 SweepStaleListeners() override
+		{
+			AddsSinceSweep = 0;
+			TArray<int32, TInlineAllocator<16>> StaleIndices;
+			for (auto It = Listeners.CreateConstIterator(); It; ++It)
+			{
+				if (!It->bReleased && !It->Listener.IsValid())
+				{
+					StaleIndices.Add(It.GetIndex());
+				}
+			}
+
+			for (const int32 Index : StaleIndices)
+			{
+				ListenerIndices.Remove(Listeners[Index].ListenerKey);
+				ReleaseListener(Index);
+			}
+
+			if (!StaleIndices.IsEmpty())
+			{
+				SyncTopology(ListenerIndices.Num());
+			}
+			return StaleIndices.Num();
+		}
+
+		/** @brief Invokes every live listener whose interest sphere contains Location and returns invoked count. */
+		int32 Publish(const FVector& Location, const TPayload& Payload)
+		{
+			if (Location.ContainsNaN())
+			{
+				LogChannelFailure(TEXT("PublishSpatial"), EEventBusError::InvalidSpatialQuery);
+				return 0;
+			}
+
+			SCOPE_CYCLE_COUNTER(STAT_EventBus_Dispatch);
+			CSV_SCOPED_TIMING_STAT(EventBus, Dispatch);
+			NFL_EVENTBUS_TRACE_CHANNEL_SCOPE(GetChannelTag());
+			const FScopedChannelCycles DispatchTimer(Stats.DispatchCycles);
+			++Stats.BroadcastCount;
+			INC_DWORD_STAT(STAT_EventBus_Broadcasts);
+
+			// Local candidate buffer keeps nested publishes from callbacks independent of this one.
+			TArray<int32> Candidates;
+			Grid.Gather(Location, Candidates);
+			if (Candidates.IsEmpty())
+			{
+				return 0;
+			}
+
+			++PublishDepth;
+			int32 InvokedCount = 0;
+			for (const int32 Index : Candidates)
+			{
+				// Fetch Entry afresh for each candidate: callbacks may add listeners and reallocate storage, so Entry
+				// is not used once its callback has run.
+				FSpatialListenerEntry& Entry = Listeners[Index];
+				if (Entry.bReleased)
+				{
+					continue;
+				}
+
+				if (!Entry.Listener.IsValid())
+				{
+					ListenerIndices.Remove(Entry.ListenerKey);
+					ReleaseListener(Index);
+					continue;
+				}
+
+				if (FVector::DistSquared(Location, Entry.Location) > Entry.RadiusSquared)
+				{
+					continue;
+				}
+
+				NFL_EVENTBUS_TRACE_LISTENER_SCOPE(GetChannelTag(), Entry.Listener.Get(), Entry.ListenerKey.FunctionName);
+				const FScopedListenerTiming ListenerTimer(ListenerTimings, Entry.ListenerKey, Entry.Listener.Get(), GetChannelTag());
+				Entry.Callback.Execute(Payload);
+				++InvokedCount;
+			}
+			--PublishDepth;
+
+			if (PublishDepth == 0)
+			{
+				ApplyDeferredChanges();
+			}
+
+			SyncTopology(ListenerIndices.Num());
+			Stats.ListenerInvocationCount += InvokedCount;
+			INC_DWORD_STAT_BY(STAT_EventBus_ListenerInvocations, InvokedCount);
+			return InvokedCount;
+		}
+
+		virtual int32 GetListenerCount() const override
+		{
+			return ListenerIndices.Num();
+		}
+
+		virtual void Reset() override
+		{
+			Grid.Reset();
+			ListenerIndices.Reset();
+			SyncTopology(0);
+			if (PublishDepth > 0)
+			{
+				// Gathered ids of in-flight publishes still index Listeners; mark now and free slots afterwards.
+				for (auto It = Listeners.CreateIterator(); It; ++It)
+				{
+					if (!It->bReleased)
+					{
+						It->bReleased = true;
+						PendingRemovals.Add(It.GetIndex());
+					}
+				}
+				return;
+			}
+
+			Listeners.Reset();
+			PendingRemovals.Reset();
+			PendingReplacements.Reset();
+			AddsSinceSweep = 0;
+		}
+
+		virtual void GetMemory(FEventChannelMemory& OutMemory) const override
+		{
+			OutMemory = FEventChannelMemory();
+			OutMemory.ListenerBytes = Listeners.GetAllocatedSize() + ListenerIndices.GetAllocatedSize();
+			OutMemory.DispatchBytes = Grid.GetAllocatedSize() + PendingRemovals.GetAllocatedSize() + PendingReplacements.GetAllocatedSize();
+			OutMemory.OwnedBytes = sizeof(*this) + OutMemory.ListenerBytes + OutMemory.DispatchBytes + ListenerTimings.GetAllocatedSize();
+			OutMemory.ListenerCount = ListenerIndices.Num();
+		}
+
+		virtual void GetListenerSummaries(TArray<FEventBindingSummary>& OutSummaries) const override
+		{
+			for (const TPair<FListenerKey, int32>& Pair : ListenerIndices)
+			{
+				AppendBindingSummary(OutSummaries, Listeners[Pair.Value].Listener.Get(), Pair.Key.FunctionName);
+			}
+		}
+
+	private:
+		/**
+		 * @brief Internal listener storage for one spatial channel.
+		 */
+		struct FSpatialListenerEntry final
+		{
+			/** @brief Stable key used for deduplication and remove operations. */
+			FListenerKey ListenerKey;
+			/** @brief Weak listener reference for stale-object cleanup safety. */
+			TWeakObjectPtr<UObject> Listener;
+			/** @brief Native callback invoked with each payload published inside the interest sphere. */
+			FSpatialDelegate Callback;
+			/** @brief Replacement callback registered during a publish; applied when the outermost publish ends. */
+			FSpatialDelegate StagedCallback;
+			/** @brief Set once the listener left the grid; the slot is freed when no publish is in flight. */
+			bool bReleased = false;
+			/** @brief Interest sphere center in world space. */
+			FVector Location = FVector::ZeroVector;
+			/** @brief Squared interest radius used for the exact distance check. */
+			double RadiusSquared = 0.0;
+			/** @brief Grid cells currently holding this listener id. */
+			FEventSpatialCellSpan Span;
+		};
+
+		/** @brief Builds the dedup key shared with delegate and batched channels. */
+		static FListenerKey MakeListenerKey(const UObject* ListenerObj, const FName FunctionName)
+		{
+			FListenerKey ListenerKey;
+			ListenerKey.ListenerObjectKey = FObjectKey(ListenerObj);
+			ListenerKey.FunctionName = FunctionName;
+			return ListenerKey;
+		}
+
+		/** @brief Returns true when the interest sphere can be placed in the grid. */
+		static bool IsValidInterest(const FVector& Location, const double Radius)
+		{
+			return !Location.ContainsNaN() && FMath::IsFinite(Radius) && Radius >= 0.0;
+		}
+
+		/** @brief Moves one tracked listener to new grid cells. */
+		void Relocate(const int32 Index, const FVector& Location, const double Radius)
+		{
+			FSpatialListenerEntry& Entry = Listeners[Index];
+			Grid.Remove(Index, Entry.Span);
+			Entry.Location = Location;
+			Entry.RadiusSquared = FMath::Square(Radius);
+			Entry.Span = Grid.Insert(Index, Location, Radius);
+		}
+
+		/** @brief Detaches one listener from the grid and frees its slot, deferring the free while publishing. */
+		void ReleaseListener(const int32 Index)
+		{
+			FSpatialListenerEntry& Entry = Listeners[Index];
+			Grid.Remove(Index, Entry.Span);
+			if (PublishDepth > 0)
+			{
+				// The callback may be executing further up the stack; it is destroyed with the slot.
+				Entry.bReleased = true;
+				PendingRemovals.Add(Index);
+				return;
+			}
+
+			Listeners.RemoveAt(Index);
+		}
+
+		/** @brief Applies callbacks staged and frees slots released while publishes were in flight. */
+		void ApplyDeferredChanges()
+		{
+			for (const int32 Index : PendingReplacements)
+			{
+				FSpatialListenerEntry& Entry = Listeners[Index];
+				if (!Entry.bReleased && Entry.StagedCallback.IsBound())
+				{
+					Entry.Callback = MoveTemp(Entry.StagedCallback);
+					Entry.StagedCallback.Unbind();
+				}
+			}
+			PendingReplacements.Reset();
+
+			for (const int32 Index : PendingRemovals)
+			{
+				Listeners.RemoveAt(Index);
+			}
+			PendingRemovals.Reset();
+		}
+
+		/** @brief Lower bound of adds between automatic stale sweeps, so small channels do not sweep on every add. */
+		static constexpr int32 MinAddsBetweenSweeps = 64;
+
+	private:
+		FEventSpatialGrid Grid;
+		TSparseArray<FSpatialListenerEntry> Listeners;
+		TMap<FListenerKey, int32> ListenerIndices;
+		TArray<int32> PendingRemovals;
+		TArray<int32> PendingReplacements;
+		int32 PublishDepth = 0;
+		int32 AddsSinceSweep = 0;
+	};
+} // namespace Nfrrlib::EventBus
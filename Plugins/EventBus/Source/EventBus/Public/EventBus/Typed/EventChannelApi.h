@@ -96,13 +96,61 @@ namespace Nfrrlib::EventBus
 		{
 			FPublisherBinding Binding;
 			Binding.DelegatePropertyName = TChannelDef::GetDelegatePropertyName();
-			return Bus.AddPublisher(TChannelDef::GetChannelTag(), PublisherObj, Binding);
+			return Bus.AddPublisher(TChannelDef::GetChannelId(), PublisherObj, Binding);
 		}
 
 		/** @brief Removes a publisher instance from this typed channel. */
 		NFL_EVENTBUS_NODISCARD static bool RemovePublisher(FEventBus& Bus, typename TChannelDef::PublisherType* PublisherObj)
 		{
-			return Bus.RemovePublisher(TChannelDef::GetChannelTag(), PublisherObj);
+			return Bus.RemovePublisher(TChannelDef::GetChannelId(), PublisherObj);
+		}
+
+		/**
+		 * @brief Broadcasts the publisher's channel delegate and records broadcast, invocation and dispatch-time stats.
+		 *
+		 * Also opens an Insights scope named after the channel tag when EventBusChannel tracing is enabled, and appends
+		 * the broadcast with its parameters to the event stream while FEventBusRecorder is recording.
+		 * While listener timing is enabled, bus-tracked listeners are invoked and timed one by one, followed by
+		 * any bindings made outside the bus.
+		 * Direct `Delegate.Broadcast(...)` calls still work; they are simply invisible to channel stats and traces.
+		 */
+		template <typename... TArgs>
+		static void Broadcast(FEventBus& Bus, typename TChannelDef::PublisherType* PublisherObj, TArgs&&... Args)
+		{
+			if (!::IsValid(PublisherObj))
+			{
+				return;
+			}
+
+			SCOPE_CYCLE_COUNTER(STAT_EventBus_Dispatch);
+			CSV_SCOPED_TIMING_STAT(EventBus, Dispatch);
+			NFL_EVENTBUS_TRACE_CHANNEL_SCOPE(TChannelDef::GetChannelTag());
+			if (FEventBusRecorder::IsRecording())
+			{
+				FEventBusRecorder::RecordBroadcast(
+					&TChannelDef::FDelegate::Broadcast,
+					Bus,
+					TChannelDef::GetChannelTag(),
+					PublisherObj,
+					TChannelDef::GetDelegatePropertyName(),
+					Args...);
+			}
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			if (FEventListenerTiming::IsEnabled())
+			{
+				BroadcastTimed(Bus, PublisherObj->*TChannelDef::DelegateMember, Args...);
+			}
+			else
+			{
+				(PublisherObj->*TChannelDef::DelegateMember).Broadcast(Forward<TArgs>(Args)...);
+			}
+			Bus.RecordDispatch(TChannelDef::GetChannelId(), StartCycles, FPlatformTime::Cycles64());
+		}
+
+		/** @brief Returns true when this typed channel is registered, resolved through its static slot. */
+		NFL_EVENTBUS_NODISCARD static bool IsRegistered(const FEventBus& Bus)
+		{
+			return Bus.IsChannelRegistered(TChannelDef::GetChannelId());
 		}
 
 		template <typename TListener, typename TFunc>
@@ -111,7 +159,7 @@ namespace Nfrrlib::EventBus
 		{
 			FListenerBinding Binding;
 			Binding.FunctionName = Detail::ValidateListenerFunc<decltype(ListenerObj), TFunc>(Method.FunctionName);
-			return Bus.AddListener(TChannelDef::GetChannelTag(), ListenerObj, Binding);
+			return Bus.AddListener(TChannelDef::GetChannelId(), ListenerObj, Binding);
 		}
 
 		template <typename TListener, typename TFunc>
@@ -120,7 +168,370 @@ namespace Nfrrlib::EventBus
 		{
 			FListenerBinding Binding;
 			Binding.FunctionName = Detail::ValidateListenerFunc<decltype(ListenerObj), TFunc>(Method.FunctionName);
-			return Bus.RemoveListener(TChannelDef::GetChannelTag(), ListenerObj, Binding);
+			return Bus.RemoveListener(TChannelDef::GetChannelId(), ListenerObj, Binding);
+		}
+
+		/** @brief Returns true when this typed channel has at least one listener. Callable from any thread. */
+		NFL_EVENTBUS_NODISCARD static bool HasListeners(const FEventBus& Bus)
+		{
+			return Bus.HasListeners(TChannelDef::GetChannelId());
+		}
+
+		/** @brief Subscribes Callback to this channel gaining its first or losing its last listener. */
+		static FDelegateHandle AddPresenceCallback(FEventBus& Bus, FOnChannelPresenceChanged::FDelegate&& Callback)
+		{
+			return Bus.AddPresenceCallback(TChannelDef::GetChannelTag(), MoveTemp(Callback));
+		}
+
+		/** @brief Unsubscribes one presence callback of this channel. */
+		static bool RemovePresenceCallback(FEventBus& Bus, const FDelegateHandle Handle)
+		{
+			return Bus.RemovePresenceCallback(TChannelDef::GetChannelTag(), Handle);
+		}
+
+	private:
+		/**
+		 * @brief Invokes each bus-tracked listener through a single-entry copy of the delegate and times it.
+		 *
+		 * Single-entry copies reuse the generated Broadcast marshalling; Args are passed as lvalues because
+		 * every copy reads them. Bindings not owned by the bus are broadcast last, untimed.
+		 */
+		template <typename... TArgs>
+		static void BroadcastTimed(FEventBus& Bus, typename TChannelDef::FDelegate& Delegate, TArgs&... Args)
+		{
+			TArray<FEventTimedListener> TimedListeners;
+			Bus.CollectTimedListeners(TChannelDef::GetChannelId(), TimedListeners);
+
+			typename TChannelDef::FDelegate Untracked = Delegate;
+			for (const FEventTimedListener& TimedListener : TimedListeners)
+			{
+				if (!Delegate.Contains(TimedListener.Callback))
+				{
+					continue;
+				}
+
+				Untracked.Remove(TimedListener.Callback);
+				typename TChannelDef::FDelegate Single;
+				Single.Add(TimedListener.Callback);
+				NFL_EVENTBUS_TRACE_LISTENER_SCOPE(TChannelDef::GetChannelTag(), TimedListener.Callback.GetUObject(), TimedListener.Callback.GetFunctionName());
+				const uint64 ListenerStartCycles = FPlatformTime::Cycles64();
+				Single.Broadcast(Args...);
+				Bus.RecordListenerTiming(TChannelDef::GetChannelId(), TimedListener.ListenerKey, FPlatformTime::Cycles64() - ListenerStartCycles);
+			}
+
+			if (Untracked.IsBound())
+			{
+				Untracked.Broadcast(Args...);
+			}
+		}
+	};
+
+	/**
+	 * @brief Registers several typed channels in one bulk call, for example at module or subsystem startup.
+	 */
+	template <CEventChannelDef... TChannelDefs>
+	NFL_EVENTBUS_NODISCARD bool RegisterEventChannels(FEventBus& Bus, const bool bOwnsPublisherDelegates = false)
+	{
+		const FChannelRegistration Registrations[] = {
+			FChannelRegistration{TChannelDefs::GetChannelTag(), bOwnsPublisherDelegates}...
+		};
+		return Bus.RegisterChannels(Registrations);
+	}
+
+	/**
+	 * @brief Static typed API for one batched channel definition.
+	 */
+	template <CEventBatchChannelDef TChannelDef>
+	class TEventBatchChannelApi final
+	{
+	public:
+		using FPayload = typename TChannelDef::FPayload;
+		using FChannel = TEventBatchChannel<FPayload>;
+
+		/** @brief Registers this typed batched channel in the runtime bus. */
+		NFL_EVENTBUS_NODISCARD static bool Register(FEventBus& Bus)
+		{
+			return Bus.RegisterBatchChannel<FPayload>(TChannelDef::GetChannelTag(), TChannelDef::GetPayloadTypeName());
+		}
+
+		/**
+		 * @brief Appends one payload to the pending batch of Bus and of every ancestor bus registering this channel.
+		 * Returns false when the channel is not registered on Bus.
+		 */
+		NFL_EVENTBUS_NODISCARD static bool Publish(FEventBus& Bus, const FPayload& Payload)
+		{
+			FChannel* const Channel = FindChannel(Bus);
+			if (!Channel)
+			{
+				return false;
+			}
+
+			if (FEventBusRecorder::IsRecording())
+			{
+				FEventBusRecorder::RecordBatchPublish(Bus, TChannelDef::GetChannelTag(), MakeArrayView(&Payload, 1));
+			}
+			Channel->Enqueue(Payload);
+			ForEachAncestorChannel(Bus, [&Payload](FChannel& AncestorChannel)
+			{
+				AncestorChannel.Enqueue(Payload);
+			});
+			return true;
+		}
+
+		/**
+		 * @brief Appends a contiguous payload range to Bus and every ancestor bus registering this channel.
+		 * Returns false when the channel is not registered on Bus.
+		 */
+		NFL_EVENTBUS_NODISCARD static bool PublishRange(FEventBus& Bus, const TConstArrayView<FPayload> Payloads)
+		{
+			FChannel* const Channel = FindChannel(Bus);
+			if (!Channel)
+			{
+				return false;
+			}
+
+			if (FEventBusRecorder::IsRecording())
+			{
+				FEventBusRecorder::RecordBatchPublish(Bus, TChannelDef::GetChannelTag(), Payloads);
+			}
+			Channel->EnqueueRange(Payloads);
+			ForEachAncestorChannel(Bus, [Payloads](FChannel& AncestorChannel)
+			{
+				AncestorChannel.EnqueueRange(Payloads);
+			});
+			return true;
+		}
+
+		/** @brief Delivers pending payloads for this channel immediately and returns delivered payload count. */
+		static int32 Flush(FEventBus& Bus)
+		{
+			return Bus.FlushBatchChannel(TChannelDef::GetChannelTag());
+		}
+
+		template <typename TListener, typename TFunc>
+		/** @brief Adds a native batch listener receiving `TConstArrayView<FPayload>` once per flush. */
+		NFL_EVENTBUS_NODISCARD static bool AddListener(FEventBus& Bus, TListener* ListenerObj, const TEventListenerMethod<TFunc>& Method)
+		{
+			const FName FunctionName = Detail::ValidateListenerFunc<decltype(ListenerObj), TFunc>(Method.FunctionName);
+			FChannel* const Channel = FindChannel(Bus);
+			if (!Channel)
+			{
+				return false;
+			}
+
+			typename FChannel::FBatchDelegate Callback;
+			if (::IsValid(ListenerObj))
+			{
+				Callback.BindUObject(ListenerObj, Method.FunctionPtr);
+			}
+			return Channel->AddListener(ListenerObj, FunctionName, MoveTemp(Callback));
+		}
+
+		template <typename TListener, typename TFunc>
+		/** @brief Removes a native batch listener from this typed channel. */
+		NFL_EVENTBUS_NODISCARD static bool RemoveListener(FEventBus& Bus, TListener* ListenerObj, const TEventListenerMethod<TFunc>& Method)
+		{
+			const FName FunctionName = Detail::ValidateListenerFunc<decltype(ListenerObj), TFunc>(Method.FunctionName);
+			FChannel* const Channel = FindChannel(Bus);
+			return Channel != nullptr && Channel->RemoveListener(ListenerObj, FunctionName);
+		}
+
+		/** @brief Returns true when this channel has at least one listener. Callable from any thread. */
+		NFL_EVENTBUS_NODISCARD static bool HasListeners(const FEventBus& Bus)
+		{
+			return Bus.HasListeners(TChannelDef::GetChannelTag());
+		}
+
+		/** @brief Subscribes Callback to this channel gaining its first or losing its last listener. */
+		static FDelegateHandle AddPresenceCallback(FEventBus& Bus, FOnChannelPresenceChanged::FDelegate&& Callback)
+		{
+			return Bus.AddPresenceCallback(TChannelDef::GetChannelTag(), MoveTemp(Callback));
+		}
+
+		/** @brief Unsubscribes one presence callback of this channel. */
+		static bool RemovePresenceCallback(FEventBus& Bus, const FDelegateHandle Handle)
+		{
+			return Bus.RemovePresenceCallback(TChannelDef::GetChannelTag(), Handle);
+		}
+
+	private:
+		/** @brief Resolves typed channel state and reports unregistered channels. */
+		static FChannel* FindChannel(FEventBus& Bus)
+		{
+			FChannel* const Channel = Bus.FindBatchChannel<FPayload>(TChannelDef::GetChannelTag());
+			if (!Channel)
+			{
+				UE_LOG(LogNFLEventBus, Verbose, TEXT("Batch channel access failed. Error=%s Channel=%s"),
+					LexToString(EEventBusError::ChannelNotRegistered),
+					*TChannelDef::GetChannelTag().ToString());
+			}
+			return Channel;
+		}
+
+		/** @brief Invokes Visitor for this channel on every ancestor bus that registers it. */
+		template <typename TVisitor>
+		static void ForEachAncestorChannel(const FEventBus& Bus, TVisitor&& Visitor)
+		{
+			for (FEventBus* Ancestor = Bus.GetParent(); Ancestor; Ancestor = Ancestor->GetParent())
+			{
+				if (FChannel* const AncestorChannel = Ancestor->FindBatchChannel<FPayload>(TChannelDef::GetChannelTag()))
+				{
+					Visitor(*AncestorChannel);
+				}
+			}
+		}
+	};
+
+	/**
+	 * @brief Static typed API for one spatial channel definition.
+	 */
+	template <CEventSpatialChannelDef TChannelDef>
+	class TEventSpatialChannelApi final
+	{
+	public:
+		using FPayload = typename TChannelDef::FPayload;
+		using FChannel = TEventSpatialChannel<FPayload>;
+
+		/** @brief Registers this typed spatial channel in the runtime bus. */
+		NFL_EVENTBUS_NODISCARD static bool Register(FEventBus& Bus)
+		{
+			return Bus.RegisterSpatialChannel<FPayload>(
+				TChannelDef::GetChannelTag(),
+				TChannelDef::GetPayloadTypeName(),
+				TChannelDef::GetCellSize());
+		}
+
+		/**
+		 * @brief Delivers one payload to listeners whose interest sphere contains Location, on Bus and every
+		 * ancestor bus registering this channel. Returns total invoked count.
+		 *
+		 * Callbacks may unregister the channel, reset a bus or release a scope. Each channel is pinned for its
+		 * own publish, and the next ancestor is resolved only after that publish returns and only while the bus
+		 * it is read from still exists.
+		 */
+		static int32 Publish(FEventBus& Bus, const FVector& Location, const FPayload& Payload)
+		{
+			const TSharedPtr<FChannel> Channel = PinChannel(Bus);
+			if (!Channel)
+			{
+				return 0;
+			}
+
+			if (FEventBusRecorder::IsRecording())
+			{
+				FEventBusRecorder::RecordSpatialPublish(Bus, TChannelDef::GetChannelTag(), Location, Payload);
+			}
+
+			FEventBus* Current = &Bus;
+			TWeakPtr<uint8> CurrentLifetime = Bus.GetLifetimeToken();
+			int32 InvokedCount = Channel->Publish(Location, Payload);
+			while (CurrentLifetime.IsValid())
+			{
+				Current = Current->GetParent();
+				if (!Current)
+				{
+					break;
+				}
+
+				CurrentLifetime = Current->GetLifetimeToken();
+				if (const TSharedPtr<FChannel> AncestorChannel = Current->PinSpatialChannel<FPayload>(TChannelDef::GetChannelTag()))
+				{
+					InvokedCount += AncestorChannel->Publish(Location, Payload);
+				}
+			}
+			return InvokedCount;
+		}
+
+		template <typename TListener, typename TFunc>
+		/** @brief Adds a native spatial listener receiving `const FPayload&` for events within Radius of Location. */
+		NFL_EVENTBUS_NODISCARD static bool AddListener(
+			FEventBus& Bus,
+			TListener* ListenerObj,
+			const TEventListenerMethod<TFunc>& Method,
+			const FVector& Location,
+			const double Radius)
+		{
+			const FName FunctionName = Detail::ValidateListenerFunc<decltype(ListenerObj), TFunc>(Method.FunctionName);
+			FChannel* const Channel = FindChannel(Bus);
+			if (!Channel)
+			{
+				return false;
+			}
+
+			typename FChannel::FSpatialDelegate Callback;
+			if (::IsValid(ListenerObj))
+			{
+				Callback.BindUObject(ListenerObj, Method.FunctionPtr);
+			}
+			return Channel->AddListener(ListenerObj, FunctionName, Location, Radius, MoveTemp(Callback));
+		}
+
+		template <typename TListener, typename TFunc>
+		/** @brief Moves or resizes the interest sphere of a tracked spatial listener. */
+		NFL_EVENTBUS_NODISCARD static bool UpdateListener(
+			FEventBus& Bus,
+			TListener* ListenerObj,
+			const TEventListenerMethod<TFunc>& Method,
+			const FVector& Location,
+			const double Radius)
+		{
+			const FName FunctionName = Detail::ValidateListenerFunc<decltype(ListenerObj), TFunc>(Method.FunctionName);
+			FChannel* const Channel = FindChannel(Bus);
+			return Channel != nullptr && Channel->UpdateListener(ListenerObj, FunctionName, Location, Radius);
+		}
+
+		template <typename TListener, typename TFunc>
+		/** @brief Removes a native spatial listener from this typed channel. */
+		NFL_EVENTBUS_NODISCARD static bool RemoveListener(FEventBus& Bus, TListener* ListenerObj, const TEventListenerMethod<TFunc>& Method)
+		{
+			const FName FunctionName = Detail::ValidateListenerFunc<decltype(ListenerObj), TFunc>(Method.FunctionName);
+			FChannel* const Channel = FindChannel(Bus);
+			return Channel != nullptr && Channel->RemoveListener(ListenerObj, FunctionName);
+		}
+
+		/** @brief Returns true when this channel has at least one listener. Callable from any thread. */
+		NFL_EVENTBUS_NODISCARD static bool HasListeners(const FEventBus& Bus)
+		{
+			return Bus.HasListeners(TChannelDef::GetChannelTag());
+		}
+
+		/** @brief Subscribes Callback to this channel gaining its first or losing its last listener. */
+		static FDelegateHandle AddPresenceCallback(FEventBus& Bus, FOnChannelPresenceChanged::FDelegate&& Callback)
+		{
+			return Bus.AddPresenceCallback(TChannelDef::GetChannelTag(), MoveTemp(Callback));
+		}
+
+		/** @brief Unsubscribes one presence callback of this channel. */
+		static bool RemovePresenceCallback(FEventBus& Bus, const FDelegateHandle Handle)
+		{
+			return Bus.RemovePresenceCallback(TChannelDef::GetChannelTag(), Handle);
+		}
+
+	private:
+		/** @brief Resolves typed channel state and reports unregistered channels. */
+		static FChannel* FindChannel(FEventBus& Bus)
+		{
+			FChannel* const Channel = Bus.FindSpatialChannel<FPayload>(TChannelDef::GetChannelTag());
+			if (!Channel)
+			{
+				UE_LOG(LogNFLEventBus, Verbose, TEXT("Spatial channel access failed. Error=%s Channel=%s"),
+					LexToString(EEventBusError::ChannelNotRegistered),
+					*TChannelDef::GetChannelTag().ToString());
+			}
+			return Channel;
+		}
+
+		/** @brief FindChannel returning shared ownership, for publishes whose callbacks may unregister the channel. */
+		static TSharedPtr<FChannel> PinChannel(FEventBus& Bus)
+		{
+			TSharedPtr<FChannel> Channel = Bus.PinSpatialChannel<FPayload>(TChannelDef::GetChannelTag());
+			if (!Channel)
+			{
+				UE_LOG(LogNFLEventBus, Verbose, TEXT("Spatial channel access failed. Error=%s Channel=%s"),
+					LexToString(EEventBusError::ChannelNotRegistered),
+					*TChannelDef::GetChannelTag().ToString());
+			}
+			return Channel;
 		}
 	};
 } // namespace Nfrrlib::EventBus
@@ -142,3 +553,33 @@ namespace Nfrrlib::EventBus
  */
 #define NFL_EVENTBUS_REMOVE_LISTENER(Bus, ChannelDef, ListenerObj, ClassType, FunctionName) \
 	::Nfrrlib::EventBus::TEventChannelApi<ChannelDef>::RemoveListener((Bus), (ListenerObj), NFL_EVENTBUS_METHOD(ClassType, FunctionName))
+
+/**
+ * @brief Adds a native batch listener on a typed batched channel using pointer syntax.
+ */
+#define NFL_EVENTBUS_ADD_BATCH_LISTENER(Bus, ChannelDef, ListenerObj, ClassType, FunctionName) \
+	::Nfrrlib::EventBus::TEventBatchChannelApi<ChannelDef>::AddListener((Bus), (ListenerObj), NFL_EVENTBUS_METHOD(ClassType, FunctionName))
+
+/**
+ * @brief Removes a native batch listener on a typed batched channel using pointer syntax.
+ */
+#define NFL_EVENTBUS_REMOVE_BATCH_LISTENER(Bus, ChannelDef, ListenerObj, ClassType, FunctionName) \
+	::Nfrrlib::EventBus::TEventBatchChannelApi<ChannelDef>::RemoveListener((Bus), (ListenerObj), NFL_EVENTBUS_METHOD(ClassType, FunctionName))
+
+/**
+ * @brief Adds a native spatial listener on a typed spatial channel using pointer syntax.
+ */
+#define NFL_EVENTBUS_ADD_SPATIAL_LISTENER(Bus, ChannelDef, ListenerObj, ClassType, FunctionName, Location, Radius) \
+	::Nfrrlib::EventBus::TEventSpatialChannelApi<ChannelDef>::AddListener((Bus), (ListenerObj), NFL_EVENTBUS_METHOD(ClassType, FunctionName), (Location), (Radius))
+
+/**
+ * @brief Moves a native spatial listener on a typed spatial channel using pointer syntax.
+ */
+#define NFL_EVENTBUS_UPDATE_SPATIAL_LISTENER(Bus, ChannelDef, ListenerObj, ClassType, FunctionName, Location, Radius) \
+	::Nfrrlib::EventBus::TEventSpatialChannelApi<ChannelDef>::UpdateListener((Bus), (ListenerObj), NFL_EVENTBUS_METHOD(ClassType, FunctionName), (Location), (Radius))
+
+/**
+ * @brief Removes a native spatial listener on a typed spatial channel using pointer syntax.
+ */
+#define NFL_EVENTBUS_REMOVE_SPATIAL_LISTENER(Bus, ChannelDef, ListenerObj, ClassType, FunctionName) \
+	::Nfrrlib::EventBus::TEventSpatialChannelApi<ChannelDef>::RemoveListener((Bus), (ListenerObj), NFL_EVENTBUS_METHOD(ClassType, FunctionName))
@@ -4,6 +4,7 @@
 #include "GameplayTagContainer.h"
 
 #include "EventBus/Core/EventBusAttributes.h"
+#include "EventBus/Core/EventBusStaticChannels.h"
 
 #include <concepts>
 
@@ -18,13 +19,42 @@ namespace Nfrrlib::EventBus
 		typename TChannelDef::PublisherType;
 		typename TChannelDef::FDelegate;
 		{ TChannelDef::GetChannelTag() } -> std::convertible_to<FGameplayTag>;
+		{ TChannelDef::GetChannelId() } -> std::convertible_to<FStaticChannelId>;
 		{ TChannelDef::GetDelegatePropertyName() } -> std::convertible_to<FName>;
 		{ PublisherPtr->*TChannelDef::DelegateMember } -> std::same_as<typename TChannelDef::FDelegate&>;
 	};
+
+	/**
+	 * @brief Compile-time contract for typed batched channel definitions.
+	 *
+	 * FPayload decides payload type checks; GetPayloadTypeName only labels logs, topology and recordings.
+	 */
+	template <typename TChannelDef>
+	concept CEventBatchChannelDef = requires
+	{
+		typename TChannelDef::FPayload;
+		{ TChannelDef::GetChannelTag() } -> std::convertible_to<FGameplayTag>;
+		{ TChannelDef::GetPayloadTypeName() } -> std::convertible_to<FName>;
+	};
+
+	/**
+	 * @brief Compile-time contract for typed spatial channel definitions.
+	 */
+	template <typename TChannelDef>
+	concept CEventSpatialChannelDef = CEventBatchChannelDef<TChannelDef> && requires
+	{
+		{ TChannelDef::GetCellSize() } -> std::convertible_to<double>;
+	};
 } // namespace Nfrrlib::EventBus
 
 /**
  * @brief Declares a typed channel for C++ static API helpers.
+ *
+ * Each declaration reserves one dense slot index on first typed access. Typed API calls address the bus
+ * slot table through that index instead of hashing the channel tag. Slots and descriptors are keyed by the
+ * declaration text, so a header included by several modules still maps to one slot. The declaration is
+ * also described to FEventBusStaticChannelRegistry during static initialization so editor tooling can
+ * list native publishers.
  */
 #define NFL_DECLARE_EVENTBUS_CHANNEL(ChannelDefName, DelegateType, PublisherClass, ChannelTagExpr, DelegateMemberName) \
 	struct ChannelDefName final                                                                                         \
@@ -36,9 +66,73 @@ namespace Nfrrlib::EventBus
 			static const FGameplayTag Tag = (ChannelTagExpr);                                                            \
 			return Tag;                                                                                                   \
 		}                                                                                                                \
+		NFL_EVENTBUS_NODISCARD static const TCHAR* GetChannelKey()                                                     \
+		{                                                                                                                \
+			return TEXT(#ChannelDefName) TEXT("|") TEXT(#ChannelTagExpr);                                               \
+		}                                                                                                                \
+		NFL_EVENTBUS_NODISCARD static int32 GetStaticSlotIndex()                                                       \
+		{                                                                                                                \
+			static const int32 SlotIndex = ::Nfrrlib::EventBus::FEventBusStaticChannelRegistry::AllocateSlot(GetChannelKey()); \
+			return SlotIndex;                                                                                             \
+		}                                                                                                                \
+		NFL_EVENTBUS_NODISCARD static ::Nfrrlib::EventBus::FStaticChannelId GetChannelId()                             \
+		{                                                                                                                \
+			return ::Nfrrlib::EventBus::FStaticChannelId{GetStaticSlotIndex(), GetChannelTag()};                         \
+		}                                                                                                                \
 		NFL_EVENTBUS_NODISCARD static FName GetDelegatePropertyName()                                                   \
 		{                                                                                                                \
 			return GET_MEMBER_NAME_CHECKED(PublisherType, DelegateMemberName);                                           \
 		}                                                                                                                \
 		static constexpr FDelegate PublisherType::* DelegateMember = &PublisherType::DelegateMemberName;                \
+		static inline const ::Nfrrlib::EventBus::FStaticChannelDescription Description{                                 \
+			GetChannelKey(),                                                                                             \
+			{TEXT(#ChannelDefName), &GetChannelTag, &PublisherType::StaticClass, &GetDelegatePropertyName}};             \
+		static inline const int32 DescriptorIndex = Description.GetDescriptorIndex();                                   \
+	}
+
+/**
+ * @brief Declares a typed batched channel whose listeners receive contiguous payload spans.
+ *
+ * PayloadType as written becomes the display name; channels are matched by the type itself.
+ */
+#define NFL_DECLARE_EVENTBUS_BATCH_CHANNEL(ChannelDefName, PayloadType, ChannelTagExpr)                               \
+	struct ChannelDefName final                                                                                         \
+	{                                                                                                                    \
+		using FPayload = PayloadType;                                                                                    \
+		NFL_EVENTBUS_NODISCARD static const FGameplayTag& GetChannelTag()                                              \
+		{                                                                                                                \
+			static const FGameplayTag Tag = (ChannelTagExpr);                                                            \
+			return Tag;                                                                                                   \
+		}                                                                                                                \
+		NFL_EVENTBUS_NODISCARD static FName GetPayloadTypeName()                                                        \
+		{                                                                                                                \
+			static const FName PayloadTypeName(TEXT(#PayloadType));                                                      \
+			return PayloadTypeName;                                                                                       \
+		}                                                                                                                \
+	}
+
+/**
+ * @brief Declares a typed spatial channel whose listeners receive payloads published inside their interest radius.
+ *
+ * CellSizeExpr sets the uniform grid edge length in world units; pick it close to the typical listener radius.
+ * PayloadType as written becomes the display name; channels are matched by the type itself.
+ */
+#define NFL_DECLARE_EVENTBUS_SPATIAL_CHANNEL(ChannelDefName, PayloadType, ChannelTagExpr, CellSizeExpr)               \
+	struct ChannelDefName final                                                                                         \
+	{                                                                                                                    \
+		using FPayload = PayloadType;                                                                                    \
+		NFL_EVENTBUS_NODISCARD static const FGameplayTag& GetChannelTag()                                              \
+		{                                                                                                                \
+			static const FGameplayTag Tag = (ChannelTagExpr);                                                            \
+			return Tag;                                                                                                   \
+		}                                                                                                                \
+		NFL_EVENTBUS_NODISCARD static FName GetPayloadTypeName()                                                        \
+		{                                                                                                                \
+			static const FName PayloadTypeName(TEXT(#PayloadType));                                                      \
+			return PayloadTypeName;                                                                                       \
+		}                                                                                                                \
+		NFL_EVENTBUS_NODISCARD static constexpr double GetCellSize()                                                    \
+		{                                                                                                                \
+			return (CellSizeExpr);                                                                                        \
+		}                                                                                                                \
 	}
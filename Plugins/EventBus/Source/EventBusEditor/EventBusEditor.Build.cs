@@ -18,6 +18,8 @@ public class EventBusEditor : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"AssetRegistry",
+				"DeveloperToolSettings",
 				"Slate",
 				"SlateCore",
 				"UnrealEd",
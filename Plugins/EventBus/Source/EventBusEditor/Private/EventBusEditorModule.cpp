@@ -3,15 +3,20 @@
 #include "EdGraphUtilities.h"
 #include "Modules/ModuleManager.h"
 
+#include "Index/EventBusTopologyIndex.h"
+#include "K2Nodes/EventBusPickerCache.h"
 #include "Pins/EventBusGraphPinFactory.h"
 
 /**
- * @brief Registers EventBus custom graph pin factory for filtered picker widgets.
+ * @brief Registers EventBus custom graph pin factory for filtered picker widgets, hooks picker cache invalidation
+ * and starts the topology index.
  */
 void FEventBusEditorModule::StartupModule()
 {
 	PinFactory = MakeShared<FEventBusGraphPinFactory>();
 	FEdGraphUtilities::RegisterVisualPinFactory(PinFactory);
+	EventBusPickerCache::Startup();
+	EventBusTopology::FIndex::Get().Startup();
 }
 
 /**
@@ -19,6 +24,9 @@ void FEventBusEditorModule::StartupModule()
  */
 void FEventBusEditorModule::ShutdownModule()
 {
+	EventBusTopology::FIndex::Get().Shutdown();
+	EventBusPickerCache::Shutdown();
+
 	if (PinFactory.IsValid() && FModuleManager::Get().IsModuleLoaded(TEXT("UnrealEd")))
 	{
 		FEdGraphUtilities::UnregisterVisualPinFactory(PinFactory);
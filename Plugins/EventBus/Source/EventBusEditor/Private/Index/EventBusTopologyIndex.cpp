@@ -0,0 +1,554 @@
+#include "Index/EventBusTopologyIndex.h"
+
+#include "Async/Async.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "UObject/AssetRegistryTagsContext.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+
+#include "EventBus/Core/EventBusStaticChannels.h"
+#include "K2Nodes/EventBusK2NodeUtils.h"
+
+namespace EventBusTopology
+{
+	namespace
+	{
+		/** @brief Hidden Blueprint tag: version, then `L|Channel|ClassPath|Member` or `P|...` records separated by ';'. */
+		const FName BindingsTagName(TEXT("EventBusBindings"));
+		const TCHAR* const BindingsTagVersion = TEXT("1");
+		constexpr int32 MaxBatchSize = 256;
+
+		FString EncodeBinds(const TArray<EventBusK2NodeUtils::FLiteralBind>& Binds)
+		{
+			FString Encoded = BindingsTagVersion;
+			for (const EventBusK2NodeUtils::FLiteralBind& Bind : Binds)
+			{
+				Encoded += FString::Printf(TEXT(";%s|%s|%s|%s"),
+					Bind.bListener ? TEXT("L") : TEXT("P"),
+					*Bind.ChannelTag.ToString(),
+					*Bind.ObjectClass->GetClassPathName().ToString(),
+					*Bind.MemberName.ToString());
+			}
+			return Encoded;
+		}
+
+		/**
+		 * @brief Writes the bindings tag for every saved Blueprint, including ones with no binds, so "no binds" and
+		 * "saved before the tag existed" stay distinguishable.
+		 */
+		void WriteBindingsTag(FAssetRegistryTagsContext Context)
+		{
+			const UBlueprint* const Blueprint = Cast<UBlueprint>(Context.GetObject());
+			if (!Blueprint)
+			{
+				return;
+			}
+
+			TArray<EventBusK2NodeUtils::FLiteralBind> Binds;
+			EventBusK2NodeUtils::CollectLiteralBinds(*Blueprint, Binds);
+			Context.AddTag(UObject::FAssetRegistryTag(BindingsTagName, EncodeBinds(Binds), UObject::FAssetRegistryTag::TT_Hidden));
+		}
+
+		FEntry MakeBlueprintEntry(const FGameplayTag& ChannelTag, const bool bListener, const FName PackageName, const FTopLevelAssetPath& ClassPath, const FName MemberName)
+		{
+			FEntry Entry;
+			Entry.ChannelTag = ChannelTag;
+			Entry.bListener = bListener;
+			Entry.Source = EEntrySource::Blueprint;
+			Entry.SourceName = PackageName;
+			Entry.ObjectClassPath = ClassPath;
+			Entry.MemberName = MemberName;
+			return Entry;
+		}
+
+		IAssetRegistry& GetAssetRegistry()
+		{
+			return FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		}
+
+		/** @brief `EventBus.Topology.Report [Filter]`: prints indexed publishers and listeners per channel. */
+		FAutoConsoleCommandWithArgsAndOutputDevice GEventBusTopologyReportCommand(
+			TEXT("EventBus.Topology.Report"),
+			TEXT("Prints every indexed EventBus channel with its Blueprint and native publishers and listeners. Optional argument filters channels by substring."),
+			FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic([](const TArray<FString>& Args, FOutputDevice& Ar)
+			{
+				FIndex::Get().WriteReport(Args.Num() > 0 ? Args[0] : FString(), Ar);
+			}));
+
+		/** @brief `EventBus.Topology.Rescan [load]`: rebuilds the index, optionally loading untagged Blueprints. */
+		FAutoConsoleCommandWithArgsAndOutputDevice GEventBusTopologyRescanCommand(
+			TEXT("EventBus.Topology.Rescan"),
+			TEXT("Re-reads native declarations and re-queues every Blueprint. 'load' also loads and scans Blueprints saved before the index tag existed."),
+			FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic([](const TArray<FString>& Args, FOutputDevice& Ar)
+			{
+				const bool bLoadUntagged = Args.ContainsByPredicate([](const FString& Arg)
+				{
+					return Arg.Equals(TEXT("load"), ESearchCase::IgnoreCase);
+				});
+				FIndex::Get().RequestFullRescan(bLoadUntagged);
+				Ar.Logf(TEXT("EventBus.Topology.Rescan queued. Pending=%d"), FIndex::Get().GetNumPendingAssets());
+			}));
+	}
+
+	/**
+	 * @brief Runs on the thread pool, so it only creates names and paths.
+	 */
+	void FIndex::DecodeBinds(const FString& Encoded, TArray<FParsedBind>& OutBinds)
+	{
+		TArray<FString> Records;
+		Encoded.ParseIntoArray(Records, TEXT(";"), true);
+		if (Records.Num() == 0 || Records[0] != BindingsTagVersion)
+		{
+			return;
+		}
+
+		TArray<FString> Fields;
+		for (int32 Index = 1; Index < Records.Num(); ++Index)
+		{
+			Records[Index].ParseIntoArray(Fields, TEXT("|"), false);
+			if (Fields.Num() != 4)
+			{
+				continue;
+			}
+
+			const FTopLevelAssetPath ClassPath(Fields[2]);
+			if (ClassPath.IsValid())
+			{
+				OutBinds.Add({Fields[0] == TEXT("L"), FName(*Fields[1]), ClassPath, FName(*Fields[3])});
+			}
+		}
+	}
+
+	FIndex& FIndex::Get()
+	{
+		static FIndex Index;
+		return Index;
+	}
+
+	void FIndex::Startup()
+	{
+		if (bStarted)
+		{
+			return;
+		}
+		bStarted = true;
+
+		ExtraTagsHandle = UObject::FAssetRegistryTag::OnGetExtraObjectTagsWithContext.AddStatic(&WriteBindingsTag);
+		PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FIndex::HandlePackageSaved);
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FIndex::Tick));
+
+		IAssetRegistry& AssetRegistry = GetAssetRegistry();
+		AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FIndex::HandleAssetAddedOrUpdated);
+		AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FIndex::HandleAssetAddedOrUpdated);
+		AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FIndex::HandleAssetRemoved);
+		AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FIndex::HandleAssetRenamed);
+
+		IndexNativeDeclarations();
+		if (AssetRegistry.IsLoadingAssets())
+		{
+			FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FIndex::HandleFilesLoaded);
+		}
+		else
+		{
+			QueueAllBlueprints();
+		}
+	}
+
+	void FIndex::Shutdown()
+	{
+		if (!bStarted)
+		{
+			return;
+		}
+		bStarted = false;
+
+		UObject::FAssetRegistryTag::OnGetExtraObjectTagsWithContext.Remove(ExtraTagsHandle);
+		UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+
+		if (FAssetRegistryModule* const AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+		{
+			IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+			AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+			AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+			AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+			AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+			AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+		}
+
+		if (InFlightBatch.IsValid())
+		{
+			InFlightBatch.Wait();
+			InFlightBatch.Reset();
+		}
+
+		EntriesBySource.Reset();
+		EntriesByChannel.Reset();
+		SourceStamps.Reset();
+		UntaggedBlueprints.Reset();
+		NativeSources.Reset();
+		PendingAssets.Reset();
+		InFlightCount = 0;
+	}
+
+	void FIndex::RequestFullRescan(const bool bLoadUntagged)
+	{
+		IndexNativeDeclarations();
+		QueueAllBlueprints();
+		if (!bLoadUntagged)
+		{
+			return;
+		}
+
+		TArray<TPair<FName, FSoftObjectPath>> Untagged = UntaggedBlueprints.Array();
+		for (const TPair<FName, FSoftObjectPath>& Pair : Untagged)
+		{
+			if (const UBlueprint* const Blueprint = Cast<UBlueprint>(Pair.Value.TryLoad()))
+			{
+				IndexLoadedBlueprint(*Blueprint);
+			}
+		}
+	}
+
+	void FIndex::GetChannelEntries(const FGameplayTag& ChannelTag, TArray<FEntry>& OutEntries) const
+	{
+		if (const TArray<FEntry>* const Entries = EntriesByChannel.Find(ChannelTag))
+		{
+			OutEntries.Append(*Entries);
+		}
+	}
+
+	/**
+	 * @brief Lists channels by tag name; a channel with publishers but no listeners (or the reverse) is flagged,
+	 * since that is usually a typo in one of the literal tags.
+	 */
+	void FIndex::WriteReport(const FString& Filter, FOutputDevice& Ar) const
+	{
+		TArray<FGameplayTag> Channels;
+		EntriesByChannel.GenerateKeyArray(Channels);
+		Channels.Sort([](const FGameplayTag& A, const FGameplayTag& B)
+		{
+			return A.GetTagName().LexicalLess(B.GetTagName());
+		});
+
+		int32 ReportedCount = 0;
+		for (const FGameplayTag& ChannelTag : Channels)
+		{
+			const FString ChannelName = ChannelTag.ToString();
+			if (!Filter.IsEmpty() && !ChannelName.Contains(Filter))
+			{
+				continue;
+			}
+
+			const TArray<FEntry>& Entries = EntriesByChannel.FindChecked(ChannelTag);
+			const bool bHasPublisher = Entries.ContainsByPredicate([](const FEntry& Entry) { return !Entry.bListener; });
+			const bool bHasListener = Entries.ContainsByPredicate([](const FEntry& Entry) { return Entry.bListener; });
+			Ar.Logf(TEXT("%s%s"),
+				*ChannelName,
+				!bHasPublisher ? TEXT(" [no publishers]") : !bHasListener ? TEXT(" [no listeners]") : TEXT(""));
+
+			for (const FEntry& Entry : Entries)
+			{
+				Ar.Logf(TEXT("    %s %s::%s (%s %s)"),
+					Entry.bListener ? TEXT("Listener ") : TEXT("Publisher"),
+					*Entry.ObjectClassPath.GetAssetName().ToString(),
+					*Entry.MemberName.ToString(),
+					Entry.Source == EEntrySource::Blueprint ? TEXT("Blueprint") : TEXT("Native"),
+					*Entry.SourceName.ToString());
+			}
+			++ReportedCount;
+		}
+
+		Ar.Logf(TEXT("EventBus topology: Channels=%d Sources=%d Untagged=%d Pending=%d"),
+			ReportedCount,
+			EntriesBySource.Num(),
+			UntaggedBlueprints.Num(),
+			GetNumPendingAssets());
+		if (UntaggedBlueprints.Num() > 0)
+		{
+			Ar.Logf(TEXT("Untagged Blueprints are missing until re-saved; run 'EventBus.Topology.Rescan load' to index them now."));
+		}
+	}
+
+	int32 FIndex::GetNumPendingAssets() const
+	{
+		return PendingAssets.Num() + InFlightCount;
+	}
+
+	void FIndex::HandleFilesLoaded()
+	{
+		GetAssetRegistry().OnFilesLoaded().Remove(FilesLoadedHandle);
+		FilesLoadedHandle.Reset();
+		QueueAllBlueprints();
+	}
+
+	/**
+	 * @brief Events fired by the initial discovery are skipped; HandleFilesLoaded queues everything at once.
+	 */
+	void FIndex::HandleAssetAddedOrUpdated(const FAssetData& AssetData)
+	{
+		if (!FilesLoadedHandle.IsValid() && AssetData.IsInstanceOf(UBlueprint::StaticClass()))
+		{
+			QueueAsset(AssetData);
+		}
+	}
+
+	void FIndex::HandleAssetRemoved(const FAssetData& AssetData)
+	{
+		if (AssetData.IsInstanceOf(UBlueprint::StaticClass()))
+		{
+			BumpStamp(AssetData.PackageName);
+			RemoveSource(AssetData.PackageName);
+			UntaggedBlueprints.Remove(AssetData.PackageName);
+		}
+	}
+
+	void FIndex::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+	{
+		if (AssetData.IsInstanceOf(UBlueprint::StaticClass()))
+		{
+			const FName OldPackageName(*FSoftObjectPath(OldObjectPath).GetLongPackageName());
+			BumpStamp(OldPackageName);
+			RemoveSource(OldPackageName);
+			UntaggedBlueprints.Remove(OldPackageName);
+			QueueAsset(AssetData);
+		}
+	}
+
+	/**
+	 * @brief The saved Blueprint is already loaded, so its graphs are read directly instead of waiting for the
+	 * registry to pick up the new tag.
+	 */
+	void FIndex::HandlePackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext SaveContext)
+	{
+		if (!Package || SaveContext.IsProceduralSave())
+		{
+			return;
+		}
+
+		ForEachObjectWithPackage(Package, [this](UObject* Object)
+		{
+			if (const UBlueprint* const Blueprint = Cast<UBlueprint>(Object))
+			{
+				IndexLoadedBlueprint(*Blueprint);
+			}
+			return true;
+		}, false);
+	}
+
+	/**
+	 * @brief Merges the finished batch and starts the next one; only one batch is in flight at a time.
+	 */
+	bool FIndex::Tick(float DeltaTime)
+	{
+		if (InFlightBatch.IsValid())
+		{
+			if (!InFlightBatch.IsReady())
+			{
+				return true;
+			}
+
+			ApplyBatch(InFlightBatch.Consume());
+			InFlightCount = 0;
+		}
+
+		if (PendingAssets.Num() == 0)
+		{
+			return true;
+		}
+
+		const int32 BatchSize = FMath::Min(PendingAssets.Num(), MaxBatchSize);
+		TArray<FAssetData> BatchAssets(PendingAssets.GetData(), BatchSize);
+		PendingAssets.RemoveAt(0, BatchSize, EAllowShrinking::No);
+
+		TArray<uint32> Stamps;
+		Stamps.Reserve(BatchSize);
+		for (const FAssetData& AssetData : BatchAssets)
+		{
+			Stamps.Add(SourceStamps.FindRef(AssetData.PackageName));
+		}
+
+		InFlightCount = BatchSize;
+		InFlightBatch = Async(EAsyncExecution::ThreadPool, [BatchAssets = MoveTemp(BatchAssets), Stamps = MoveTemp(Stamps)]()
+		{
+			TArray<FParsedSource> Parsed;
+			Parsed.Reserve(BatchAssets.Num());
+			for (int32 Index = 0; Index < BatchAssets.Num(); ++Index)
+			{
+				const FAssetData& AssetData = BatchAssets[Index];
+				FParsedSource& Source = Parsed.AddDefaulted_GetRef();
+				Source.PackageName = AssetData.PackageName;
+				Source.AssetPath = AssetData.GetSoftObjectPath();
+				Source.Stamp = Stamps[Index];
+
+				FString Encoded;
+				Source.bHasTag = AssetData.GetTagValue(BindingsTagName, Encoded);
+				if (Source.bHasTag)
+				{
+					DecodeBinds(Encoded, Source.Binds);
+				}
+			}
+			return Parsed;
+		});
+		return true;
+	}
+
+	void FIndex::QueueAllBlueprints()
+	{
+		TArray<FAssetData> BlueprintAssets;
+		GetAssetRegistry().GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), BlueprintAssets, true);
+		for (const FAssetData& AssetData : BlueprintAssets)
+		{
+			QueueAsset(AssetData);
+		}
+	}
+
+	void FIndex::QueueAsset(const FAssetData& AssetData)
+	{
+		BumpStamp(AssetData.PackageName);
+		PendingAssets.Add(AssetData);
+	}
+
+	/**
+	 * @brief Native declarations are keyed by definition name; all of them are replaced together.
+	 */
+	void FIndex::IndexNativeDeclarations()
+	{
+		for (const FName SourceName : NativeSources)
+		{
+			RemoveSource(SourceName);
+		}
+		NativeSources.Reset();
+
+		TArray<Nfrrlib::EventBus::FStaticChannelDescriptor> Descriptors;
+		Nfrrlib::EventBus::FEventBusStaticChannelRegistry::GetChannelDescriptors(Descriptors);
+
+		TMap<FName, TArray<FEntry>> EntriesByDefinition;
+		for (const Nfrrlib::EventBus::FStaticChannelDescriptor& Descriptor : Descriptors)
+		{
+			if (Descriptor.PublisherClassPath.IsNull() || !Descriptor.ChannelTag.IsValid())
+			{
+				continue;
+			}
+
+			FEntry Entry;
+			Entry.ChannelTag = Descriptor.ChannelTag;
+			Entry.bListener = false;
+			Entry.Source = EEntrySource::NativeDeclaration;
+			Entry.SourceName = FName(*Descriptor.ChannelDefName);
+			Entry.ObjectClassPath = Descriptor.PublisherClassPath.GetAssetPath();
+			Entry.MemberName = Descriptor.DelegatePropertyName;
+			EntriesByDefinition.FindOrAdd(Entry.SourceName).Add(MoveTemp(Entry));
+		}
+
+		for (TPair<FName, TArray<FEntry>>& Pair : EntriesByDefinition)
+		{
+			NativeSources.Add(Pair.Key);
+			ReplaceSource(Pair.Key, MoveTemp(Pair.Value));
+		}
+	}
+
+	void FIndex::IndexLoadedBlueprint(const UBlueprint& Blueprint)
+	{
+		const FName PackageName = Blueprint.GetPackage()->GetFName();
+		BumpStamp(PackageName);
+		UntaggedBlueprints.Remove(PackageName);
+
+		TArray<EventBusK2NodeUtils::FLiteralBind> Binds;
+		EventBusK2NodeUtils::CollectLiteralBinds(Blueprint, Binds);
+
+		TArray<FEntry> Entries;
+		Entries.Reserve(Binds.Num());
+		for (const EventBusK2NodeUtils::FLiteralBind& Bind : Binds)
+		{
+			Entries.Add(MakeBlueprintEntry(Bind.ChannelTag, Bind.bListener, PackageName, Bind.ObjectClass->GetClassPathName(), Bind.MemberName));
+		}
+		ReplaceSource(PackageName, MoveTemp(Entries));
+	}
+
+	/**
+	 * @brief Drops sources whose package changed after the batch was read; tags are resolved here because
+	 * the gameplay tag manager is game-thread only.
+	 */
+	void FIndex::ApplyBatch(TArray<FParsedSource>&& Batch)
+	{
+		for (FParsedSource& Source : Batch)
+		{
+			if (SourceStamps.FindRef(Source.PackageName) != Source.Stamp)
+			{
+				continue;
+			}
+
+			if (!Source.bHasTag)
+			{
+				RemoveSource(Source.PackageName);
+				UntaggedBlueprints.Add(Source.PackageName, Source.AssetPath);
+				continue;
+			}
+
+			UntaggedBlueprints.Remove(Source.PackageName);
+			TArray<FEntry> Entries;
+			Entries.Reserve(Source.Binds.Num());
+			for (const FParsedBind& Bind : Source.Binds)
+			{
+				const FGameplayTag ChannelTag = FGameplayTag::RequestGameplayTag(Bind.ChannelName, false);
+				if (ChannelTag.IsValid())
+				{
+					Entries.Add(MakeBlueprintEntry(ChannelTag, Bind.bListener, Source.PackageName, Bind.ObjectClassPath, Bind.MemberName));
+				}
+			}
+			ReplaceSource(Source.PackageName, MoveTemp(Entries));
+		}
+	}
+
+	uint32 FIndex::BumpStamp(const FName PackageName)
+	{
+		return SourceStamps.FindOrAdd(PackageName) = ++NextStamp;
+	}
+
+	void FIndex::RemoveSource(const FName SourceName)
+	{
+		TArray<FEntry> Removed;
+		if (!EntriesBySource.RemoveAndCopyValue(SourceName, Removed))
+		{
+			return;
+		}
+
+		for (const FEntry& Entry : Removed)
+		{
+			TArray<FEntry>* const ChannelEntries = EntriesByChannel.Find(Entry.ChannelTag);
+			if (!ChannelEntries)
+			{
+				continue;
+			}
+
+			ChannelEntries->RemoveAll([SourceName](const FEntry& Candidate)
+			{
+				return Candidate.SourceName == SourceName;
+			});
+			if (ChannelEntries->Num() == 0)
+			{
+				EntriesByChannel.Remove(Entry.ChannelTag);
+			}
+		}
+	}
+
+	void FIndex::ReplaceSource(const FName SourceName, TArray<FEntry>&& Entries)
+	{
+		RemoveSource(SourceName);
+		if (Entries.Num() == 0)
+		{
+			return;
+		}
+
+		for (const FEntry& Entry : Entries)
+		{
+			EntriesByChannel.FindOrAdd(Entry.ChannelTag).Add(Entry);
+		}
+		EntriesBySource.Add(SourceName, MoveTemp(Entries));
+	}
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "AssetRegistry/AssetData.h"
+#include "Containers/Ticker.h"
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/TopLevelAssetPath.h"
+
+class FOutputDevice;
+class UBlueprint;
+class UPackage;
+
+namespace EventBusTopology
+{
+	/**
+	 * @brief Where an index entry was found.
+	 */
+	enum class EEntrySource : uint8
+	{
+		/** A bind node in a Blueprint graph. */
+		Blueprint,
+		/** An `NFL_DECLARE_EVENTBUS_CHANNEL` declaration compiled into a loaded module. */
+		NativeDeclaration
+	};
+
+	/**
+	 * @brief One publisher or listener of one channel.
+	 */
+	struct FEntry final
+	{
+		FGameplayTag ChannelTag;
+		bool bListener = false;
+		EEntrySource Source = EEntrySource::Blueprint;
+		/** @brief Blueprint package name, or channel definition name for native declarations. */
+		FName SourceName = NAME_None;
+		/** @brief Publisher or listener class; may name a class that is not loaded. */
+		FTopLevelAssetPath ObjectClassPath;
+		/** @brief Delegate property name for publishers, function name for listeners. */
+		FName MemberName = NAME_None;
+	};
+
+	/**
+	 * @brief Editor-wide index of EventBus publishers and listeners across every Blueprint and native channel declaration.
+	 *
+	 * Blueprints carry their literal binds in a hidden asset registry tag written on save, so indexing never loads
+	 * assets. Tag parsing runs on the thread pool one batch at a time and results are merged on the game thread by a
+	 * core ticker. Asset add, update, rename and remove events, plus Blueprint saves, keep the index current.
+	 * Blueprints saved before the tag existed stay untagged until re-saved or indexed by `EventBus.Topology.Rescan load`.
+	 * C++ listeners bind at runtime and are not visible here; the runtime registry history covers them.
+	 */
+	class FIndex final
+	{
+	public:
+		/** @brief Returns the editor-wide instance. */
+		static FIndex& Get();
+
+		/** @brief Installs the save-time tag writer and asset registry hooks, then queues every Blueprint. */
+		void Startup();
+		/** @brief Removes every hook, waits for the batch in flight and drops the index. */
+		void Shutdown();
+
+		/** @brief Re-reads native declarations and queues every Blueprint; with bLoadUntagged, also loads and scans untagged ones now. */
+		void RequestFullRescan(bool bLoadUntagged);
+
+		/** @brief Appends every entry for ChannelTag. */
+		void GetChannelEntries(const FGameplayTag& ChannelTag, TArray<FEntry>& OutEntries) const;
+
+		/** @brief Prints channels whose tag contains Filter (all when empty) with their publishers and listeners. */
+		void WriteReport(const FString& Filter, FOutputDevice& Ar) const;
+
+		/** @brief Number of Blueprints waiting to be parsed, including the batch in flight. */
+		int32 GetNumPendingAssets() const;
+
+	private:
+		/** @brief One bind decoded off the game thread; the channel is still a name. */
+		struct FParsedBind final
+		{
+			bool bListener = false;
+			FName ChannelName = NAME_None;
+			FTopLevelAssetPath ObjectClassPath;
+			FName MemberName = NAME_None;
+		};
+
+		/** @brief Decoded tag of one Blueprint package, stamped with the package generation it was read at. */
+		struct FParsedSource final
+		{
+			FName PackageName = NAME_None;
+			FSoftObjectPath AssetPath;
+			uint32 Stamp = 0;
+			bool bHasTag = false;
+			TArray<FParsedBind> Binds;
+		};
+
+		/** @brief Decodes one bindings tag value written by the save-time tag writer. */
+		static void DecodeBinds(const FString& Encoded, TArray<FParsedBind>& OutBinds);
+
+		void HandleFilesLoaded();
+		void HandleAssetAddedOrUpdated(const FAssetData& AssetData);
+		void HandleAssetRemoved(const FAssetData& AssetData);
+		void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+		void HandlePackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext SaveContext);
+		bool Tick(float DeltaTime);
+
+		void QueueAllBlueprints();
+		void QueueAsset(const FAssetData& AssetData);
+		void IndexNativeDeclarations();
+		void IndexLoadedBlueprint(const UBlueprint& Blueprint);
+		void ApplyBatch(TArray<FParsedSource>&& Batch);
+
+		/** @brief Bumps the package generation so batches read before this point are dropped when they land. */
+		uint32 BumpStamp(FName PackageName);
+		void RemoveSource(FName SourceName);
+		void ReplaceSource(FName SourceName, TArray<FEntry>&& Entries);
+
+		TMap<FName, TArray<FEntry>> EntriesBySource;
+		TMap<FGameplayTag, TArray<FEntry>> EntriesByChannel;
+		TMap<FName, uint32> SourceStamps;
+		TMap<FName, FSoftObjectPath> UntaggedBlueprints;
+		TSet<FName> NativeSources;
+		TArray<FAssetData> PendingAssets;
+		TFuture<TArray<FParsedSource>> InFlightBatch;
+		int32 InFlightCount = 0;
+		uint32 NextStamp = 0;
+		bool bStarted = false;
+
+		FTSTicker::FDelegateHandle TickerHandle;
+		FDelegateHandle ExtraTagsHandle;
+		FDelegateHandle PackageSavedHandle;
+		FDelegateHandle FilesLoadedHandle;
+		FDelegateHandle AssetAddedHandle;
+		FDelegateHandle AssetUpdatedHandle;
+		FDelegateHandle AssetRemovedHandle;
+		FDelegateHandle AssetRenamedHandle;
+	};
+}
@@ -0,0 +1,147 @@
+#include "K2Nodes/EventBusBindingProof.h"
+
+#include "EdGraph/EdGraphPin.h"
+#include "Engine/Blueprint.h"
+#include "K2Node.h"
+#include "UObject/UnrealType.h"
+
+#include "K2Nodes/EventBusK2NodeUtils.h"
+#include "K2Nodes/EventBusPickerCache.h"
+
+#define LOCTEXT_NAMESPACE "EventBusBindingProof"
+
+namespace EventBusBindingProof
+{
+	namespace
+	{
+		/**
+		 * @brief Returns true when Class's members are stable enough to reference from compiled bytecode.
+		 *
+		 * The Blueprint being compiled regenerates its own functions during the compile, so bindings to itself are
+		 * validated but never tokenized. Other classes are referenced by path and re-resolved on load.
+		 */
+		bool CanTokenizeClass(const UClass* Class, const UK2Node& Node)
+		{
+			return !Class->HasAnyClassFlags(CLASS_NewerVersionExists) &&
+				UBlueprint::GetBlueprintFromClass(Class) != Node.GetBlueprint();
+		}
+
+		/**
+		 * @brief Class and channel signature shared by both proofs; false when the inputs cannot be proven.
+		 */
+		bool ResolveProofInputs(
+			const UK2Node& Node,
+			const FName ObjectPinName,
+			const FName MemberPinName,
+			UClass*& OutClass,
+			FName& OutMemberName,
+			const UFunction*& OutChannelSignature)
+		{
+			OutClass = EventBusK2NodeUtils::ResolveObjectClassFromPin(Node.FindPin(ObjectPinName));
+			OutMemberName = EventBusK2NodeUtils::ReadLiteralName(Node.FindPin(MemberPinName));
+			if (!::IsValid(OutClass) || OutClass == UObject::StaticClass() || OutMemberName.IsNone())
+			{
+				return false;
+			}
+
+			const FGameplayTag ChannelTag =
+				EventBusK2NodeUtils::ReadLiteralChannelTag(Node.FindPin(EventBusK2NodeUtils::ChannelTagPinName));
+			OutChannelSignature = EventBusPickerCache::FindChannelSignature(ChannelTag);
+			return true;
+		}
+
+		/**
+		 * @brief Same two-way check the runtime applies.
+		 */
+		bool IsSignatureCompatible(const UFunction* Function, const UFunction* ChannelSignature)
+		{
+			return ChannelSignature == nullptr ||
+				(Function->IsSignatureCompatibleWith(ChannelSignature) && ChannelSignature->IsSignatureCompatibleWith(Function));
+		}
+	}
+
+	FProof ProveListenerBinding(const UK2Node& Node, const FName ObjectPinName, const FName FunctionPinName)
+	{
+		FProof Proof;
+		UClass* ListenerClass = nullptr;
+		FName FunctionName = NAME_None;
+		const UFunction* ChannelSignature = nullptr;
+		if (!ResolveProofInputs(Node, ObjectPinName, FunctionPinName, ListenerClass, FunctionName, ChannelSignature))
+		{
+			return Proof;
+		}
+
+		UFunction* const Function = ListenerClass->FindFunctionByName(FunctionName);
+		if (!Function)
+		{
+			Proof.Result = EProofResult::Invalid;
+			Proof.Message = FText::Format(
+				LOCTEXT("ListenerFunctionMissing", "@@: '{0}' is not a function on {1}; the bind will fail at runtime."),
+				FText::FromName(FunctionName),
+				FText::FromString(ListenerClass->GetName()));
+			return Proof;
+		}
+
+		if (!IsSignatureCompatible(Function, ChannelSignature))
+		{
+			Proof.Result = EProofResult::Invalid;
+			Proof.Message = FText::Format(
+				LOCTEXT("ListenerSignatureMismatch", "@@: '{0}' does not match the channel's delegate signature {1}."),
+				FText::FromName(FunctionName),
+				FText::FromString(ChannelSignature->GetName()));
+			return Proof;
+		}
+
+		if (CanTokenizeClass(ListenerClass, Node))
+		{
+			Proof.Result = EProofResult::Proven;
+			Proof.Token.ObjectClass = ListenerClass;
+			Proof.Token.ListenerFunction = Function;
+			Proof.Token.ProvenSignature = const_cast<UFunction*>(ChannelSignature);
+		}
+		return Proof;
+	}
+
+	FProof ProvePublisherBinding(const UK2Node& Node, const FName ObjectPinName, const FName DelegatePinName)
+	{
+		FProof Proof;
+		UClass* PublisherClass = nullptr;
+		FName DelegatePropertyName = NAME_None;
+		const UFunction* ChannelSignature = nullptr;
+		if (!ResolveProofInputs(Node, ObjectPinName, DelegatePinName, PublisherClass, DelegatePropertyName, ChannelSignature))
+		{
+			return Proof;
+		}
+
+		FMulticastDelegateProperty* const DelegateProperty = FindFProperty<FMulticastDelegateProperty>(PublisherClass, DelegatePropertyName);
+		if (!DelegateProperty || !DelegateProperty->SignatureFunction)
+		{
+			Proof.Result = EProofResult::Invalid;
+			Proof.Message = FText::Format(
+				LOCTEXT("PublisherDelegateMissing", "@@: '{0}' is not a multicast delegate on {1}; the bind will fail at runtime."),
+				FText::FromName(DelegatePropertyName),
+				FText::FromString(PublisherClass->GetName()));
+			return Proof;
+		}
+
+		if (!IsSignatureCompatible(DelegateProperty->SignatureFunction, ChannelSignature))
+		{
+			Proof.Result = EProofResult::Invalid;
+			Proof.Message = FText::Format(
+				LOCTEXT("PublisherSignatureMismatch", "@@: '{0}' does not match the channel's delegate signature {1}."),
+				FText::FromName(DelegatePropertyName),
+				FText::FromString(ChannelSignature->GetName()));
+			return Proof;
+		}
+
+		if (CanTokenizeClass(PublisherClass, Node))
+		{
+			Proof.Result = EProofResult::Proven;
+			Proof.Token.ObjectClass = PublisherClass;
+			Proof.Token.DelegateProperty = DelegateProperty;
+		}
+		return Proof;
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "EventBus/BP/EventBusBlueprintLibrary.h"
+
+class UK2Node;
+
+namespace EventBusBindingProof
+{
+	/**
+	 * @brief What compiling a filtered node could establish about its bind.
+	 */
+	enum class EProofResult : uint8
+	{
+		/** Inputs are not literal or the class is not known precisely enough; the runtime validates as before. */
+		Unprovable,
+		/** Member and signature check out; Token is filled for the trusted entry point. */
+		Proven,
+		/** Member is missing or incompatible with the channel; Message explains why. */
+		Invalid
+	};
+
+	/**
+	 * @brief Outcome of one proof attempt.
+	 */
+	struct FProof final
+	{
+		EProofResult Result = EProofResult::Unprovable;
+		FEventBusBindingToken Token;
+		FText Message;
+	};
+
+	/** @brief Checks a listener node's literal class, function and channel inputs. */
+	FProof ProveListenerBinding(const UK2Node& Node, FName ObjectPinName, FName FunctionPinName);
+
+	/** @brief Checks a publisher node's literal class, delegate and channel inputs. */
+	FProof ProvePublisherBinding(const UK2Node& Node, FName ObjectPinName, FName DelegatePinName);
+}
@@ -2,12 +2,18 @@
 
 #include "EdGraph/EdGraphPin.h"
 #include "EdGraphSchema_K2.h"
+#include "EdGraph/EdGraph.h"
 #include "Engine/Blueprint.h"
 #include "K2Node.h"
+#include "K2Node_CallFunction.h"
 #include "UObject/Class.h"
 
+#include "EventBus/BP/EventBusBlueprintLibrary.h"
+
 namespace EventBusK2NodeUtils
 {
+	const FName ChannelTagPinName(TEXT("ChannelTag"));
+
 	namespace
 	{
 		/**
@@ -55,6 +61,26 @@ namespace EventBusK2NodeUtils
 
 			return Blueprint->SkeletonGeneratedClass;
 		}
+
+		/**
+		 * @brief Returns true for library functions that add a listener through ListenerObj/FunctionName pins.
+		 */
+		bool IsListenerBindFunction(const FName FunctionName)
+		{
+			return FunctionName == GET_FUNCTION_NAME_CHECKED(UEventBusBlueprintLibrary, AddListener) ||
+				FunctionName == GET_FUNCTION_NAME_CHECKED(UEventBusBlueprintLibrary, AddListenerValidated) ||
+				FunctionName == GET_FUNCTION_NAME_CHECKED(UEventBusBlueprintLibrary, AddListenerWithHandle);
+		}
+
+		/**
+		 * @brief Returns true for library functions that add a publisher through PublisherObj/DelegatePropertyName pins.
+		 */
+		bool IsPublisherBindFunction(const FName FunctionName)
+		{
+			return FunctionName == GET_FUNCTION_NAME_CHECKED(UEventBusBlueprintLibrary, AddPublisher) ||
+				FunctionName == GET_FUNCTION_NAME_CHECKED(UEventBusBlueprintLibrary, AddPublisherValidated) ||
+				FunctionName == GET_FUNCTION_NAME_CHECKED(UEventBusBlueprintLibrary, AddPublisherWithHandle);
+		}
 	}
 
 	/**
@@ -117,4 +143,71 @@ namespace EventBusK2NodeUtils
 
 		return FallbackClass;
 	}
+
+	/**
+	 * @brief Linked pins carry runtime values, so only unlinked defaults are parsed.
+	 */
+	FGameplayTag ReadLiteralChannelTag(const UEdGraphPin* ChannelPin)
+	{
+		FGameplayTag ChannelTag;
+		if (ChannelPin && ChannelPin->LinkedTo.IsEmpty())
+		{
+			ChannelTag.FromExportString(ChannelPin->GetDefaultAsString());
+		}
+		return ChannelTag;
+	}
+
+	/**
+	 * @brief Linked pins carry runtime values, so only unlinked defaults are read.
+	 */
+	FName ReadLiteralName(const UEdGraphPin* NamePin)
+	{
+		if (!NamePin || !NamePin->LinkedTo.IsEmpty())
+		{
+			return NAME_None;
+		}
+		return FName(*NamePin->GetDefaultAsString());
+	}
+
+	/**
+	 * @brief Bulk and handle-less remove functions are skipped; their inputs are arrays or unrelated to topology.
+	 */
+	bool ReadLiteralBind(const UK2Node_CallFunction& Node, FLiteralBind& OutBind)
+	{
+		const UFunction* const Function = Node.GetTargetFunction();
+		if (!Function || Function->GetOwnerClass() != UEventBusBlueprintLibrary::StaticClass())
+		{
+			return false;
+		}
+
+		const bool bListener = IsListenerBindFunction(Function->GetFName());
+		if (!bListener && !IsPublisherBindFunction(Function->GetFName()))
+		{
+			return false;
+		}
+
+		OutBind.bListener = bListener;
+		OutBind.ChannelTag = ReadLiteralChannelTag(Node.FindPin(ChannelTagPinName));
+		OutBind.ObjectClass = ResolveObjectClassFromPin(Node.FindPin(bListener ? TEXT("ListenerObj") : TEXT("PublisherObj")));
+		OutBind.MemberName = ReadLiteralName(Node.FindPin(bListener ? TEXT("FunctionName") : TEXT("DelegatePropertyName")));
+		return OutBind.ChannelTag.IsValid() && OutBind.ObjectClass != nullptr && !OutBind.MemberName.IsNone();
+	}
+
+	void CollectLiteralBinds(const UBlueprint& Blueprint, TArray<FLiteralBind>& OutBinds)
+	{
+		TArray<UEdGraph*> Graphs;
+		Blueprint.GetAllGraphs(Graphs);
+		for (const UEdGraph* const Graph : Graphs)
+		{
+			for (const UEdGraphNode* const Node : Graph->Nodes)
+			{
+				const UK2Node_CallFunction* const CallNode = Cast<UK2Node_CallFunction>(Node);
+				FLiteralBind Bind;
+				if (CallNode && ReadLiteralBind(*CallNode, Bind))
+				{
+					OutBinds.Add(Bind);
+				}
+			}
+		}
+	}
 }
@@ -1,9 +1,12 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
 
+class UBlueprint;
 class UClass;
 class UEdGraphPin;
+class UK2Node_CallFunction;
 
 namespace EventBusK2NodeUtils
 {
@@ -11,5 +14,39 @@ namespace EventBusK2NodeUtils
 	 * @brief Resolves best-known UObject class from a pin default or connected pin types.
 	 */
 	UClass* ResolveObjectClassFromPin(const UEdGraphPin* ObjectPin);
+
+	/**
+	 * @brief Returns the literal channel tag typed into a pin, or an empty tag when the pin is missing or linked.
+	 */
+	FGameplayTag ReadLiteralChannelTag(const UEdGraphPin* ChannelPin);
+
+	/**
+	 * @brief Returns the literal name typed into a pin, or None when the pin is missing or linked.
+	 */
+	FName ReadLiteralName(const UEdGraphPin* NamePin);
+
+	/** @brief Name of the channel tag pin shared by every EventBus bind function. */
+	extern const FName ChannelTagPinName;
+
+	/**
+	 * @brief One EventBus bind node whose channel, object class and member are all known at edit time.
+	 */
+	struct FLiteralBind final
+	{
+		FGameplayTag ChannelTag;
+		UClass* ObjectClass = nullptr;
+		FName MemberName = NAME_None;
+		bool bListener = false;
+	};
+
+	/**
+	 * @brief Reads Node when it calls a single-channel EventBus add function with literal inputs.
+	 */
+	bool ReadLiteralBind(const UK2Node_CallFunction& Node, FLiteralBind& OutBind);
+
+	/**
+	 * @brief Appends every literal bind found in Blueprint's graphs.
+	 */
+	void CollectLiteralBinds(const UBlueprint& Blueprint, TArray<FLiteralBind>& OutBinds);
 }
 
@@ -0,0 +1,285 @@
+#include "K2Nodes/EventBusPickerCache.h"
+
+#include "Editor.h"
+#include "UObject/Class.h"
+#include "UObject/FieldIterator.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectIterator.h"
+
+#include "EventBus/BP/EventBusRegistryAsset.h"
+#include "Index/EventBusTopologyIndex.h"
+
+namespace EventBusPickerCache
+{
+	namespace
+	{
+		enum class EPickerKind : uint8
+		{
+			ListenerFunctions,
+			PublisherDelegates
+		};
+
+		/**
+		 * @brief Identifies one option list; a null signature key stands for "channel signature unknown".
+		 */
+		struct FPickerKey final
+		{
+			FObjectKey Class;
+			FObjectKey Signature;
+			EPickerKind Kind = EPickerKind::ListenerFunctions;
+
+			bool operator==(const FPickerKey& Other) const
+			{
+				return Class == Other.Class && Signature == Other.Signature && Kind == Other.Kind;
+			}
+
+			friend uint32 GetTypeHash(const FPickerKey& Key)
+			{
+				return HashCombine(HashCombine(GetTypeHash(Key.Class), GetTypeHash(Key.Signature)), static_cast<uint32>(Key.Kind));
+			}
+		};
+
+		struct FPickerCacheState final
+		{
+			TMap<FPickerKey, TArray<TSharedPtr<FName>>> Options;
+			TMap<FGameplayTag, TWeakObjectPtr<const UFunction>> ChannelSignatures;
+			FDelegateHandle BlueprintCompiledHandle;
+			FDelegateHandle ReloadCompleteHandle;
+		};
+
+		FPickerCacheState& GetState()
+		{
+			static FPickerCacheState State;
+			return State;
+		}
+
+		/**
+		 * @brief Mirrors the runtime bind check: both signatures must accept each other.
+		 */
+		bool IsSignatureCompatible(const UFunction* Function, const UFunction* ChannelSignature)
+		{
+			return ChannelSignature == nullptr ||
+				(Function->IsSignatureCompatibleWith(ChannelSignature) && ChannelSignature->IsSignatureCompatibleWith(Function));
+		}
+
+		/**
+		 * @brief Sorts names lexically and wraps them for SGraphPinNameList.
+		 */
+		void FinalizeOptions(TArray<FName>& Names, TArray<TSharedPtr<FName>>& OutOptions)
+		{
+			Names.Sort([](const FName& A, const FName& B)
+			{
+				return A.Compare(B) < 0;
+			});
+
+			OutOptions.Reserve(Names.Num());
+			for (const FName Name : Names)
+			{
+				OutOptions.Add(MakeShared<FName>(Name));
+			}
+		}
+
+		void BuildListenerFunctionOptions(UClass* ListenerClass, const UFunction* ChannelSignature, TArray<TSharedPtr<FName>>& OutOptions)
+		{
+			TArray<FName> Names;
+			for (TFieldIterator<UFunction> It(ListenerClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+			{
+				const UFunction* const Function = *It;
+				if (!Function ||
+					!Function->HasAnyFunctionFlags(FUNC_BlueprintCallable | FUNC_BlueprintEvent) ||
+					Function->HasAnyFunctionFlags(FUNC_Delegate))
+				{
+					continue;
+				}
+
+				const FName FunctionName = Function->GetFName();
+				if (FunctionName.IsNone() || FunctionName.ToString().StartsWith(TEXT("ExecuteUbergraph_")))
+				{
+					continue;
+				}
+
+				if (IsSignatureCompatible(Function, ChannelSignature))
+				{
+					Names.AddUnique(FunctionName);
+				}
+			}
+
+			FinalizeOptions(Names, OutOptions);
+		}
+
+		void BuildPublisherDelegateOptions(UClass* PublisherClass, const UFunction* ChannelSignature, TArray<TSharedPtr<FName>>& OutOptions)
+		{
+			TArray<FName> Names;
+			for (TFieldIterator<FMulticastDelegateProperty> It(PublisherClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+			{
+				const FMulticastDelegateProperty* const DelegateProperty = *It;
+				if (!DelegateProperty || DelegateProperty->GetFName().IsNone() || !DelegateProperty->SignatureFunction)
+				{
+					continue;
+				}
+
+				if (IsSignatureCompatible(DelegateProperty->SignatureFunction, ChannelSignature))
+				{
+					Names.AddUnique(DelegateProperty->GetFName());
+				}
+			}
+
+			FinalizeOptions(Names, OutOptions);
+		}
+
+		/**
+		 * @brief Returns the cached list for Key, building it on first request.
+		 */
+		template <typename BuildFn>
+		const TArray<TSharedPtr<FName>>& FindOrBuild(const FPickerKey& Key, BuildFn&& Build)
+		{
+			TMap<FPickerKey, TArray<TSharedPtr<FName>>>& Options = GetState().Options;
+			if (const TArray<TSharedPtr<FName>>* const Cached = Options.Find(Key))
+			{
+				return *Cached;
+			}
+
+			TArray<TSharedPtr<FName>>& Built = Options.Add(Key);
+			Build(Built);
+			return Built;
+		}
+
+		const TArray<TSharedPtr<FName>>& GetEmptyOptions()
+		{
+			static const TArray<TSharedPtr<FName>> Empty;
+			return Empty;
+		}
+	}
+
+	const TArray<TSharedPtr<FName>>& GetListenerFunctionOptions(UClass* ListenerClass, const UFunction* ChannelSignature)
+	{
+		if (!::IsValid(ListenerClass))
+		{
+			return GetEmptyOptions();
+		}
+
+		return FindOrBuild({ListenerClass, ChannelSignature, EPickerKind::ListenerFunctions}, [ListenerClass, ChannelSignature](TArray<TSharedPtr<FName>>& OutOptions)
+		{
+			BuildListenerFunctionOptions(ListenerClass, ChannelSignature, OutOptions);
+		});
+	}
+
+	const TArray<TSharedPtr<FName>>& GetPublisherDelegateOptions(UClass* PublisherClass, const UFunction* ChannelSignature)
+	{
+		if (!::IsValid(PublisherClass))
+		{
+			return GetEmptyOptions();
+		}
+
+		return FindOrBuild({PublisherClass, ChannelSignature, EPickerKind::PublisherDelegates}, [PublisherClass, ChannelSignature](TArray<TSharedPtr<FName>>& OutOptions)
+		{
+			BuildPublisherDelegateOptions(PublisherClass, ChannelSignature, OutOptions);
+		});
+	}
+
+	/**
+	 * @brief Scans publisher history of every loaded registry (runtime, PIE and baked) for the channel's delegate,
+	 * resolving baked class paths only when the class is already loaded. Then falls back to topology index publishers
+	 * whose class is loaded. Only hits are cached, so a channel first published during PIE or indexed later is picked
+	 * up on the next pin rebuild.
+	 */
+	const UFunction* FindChannelSignature(const FGameplayTag& ChannelTag)
+	{
+		if (!ChannelTag.IsValid())
+		{
+			return nullptr;
+		}
+
+		TMap<FGameplayTag, TWeakObjectPtr<const UFunction>>& Signatures = GetState().ChannelSignatures;
+		if (const TWeakObjectPtr<const UFunction>* const Cached = Signatures.Find(ChannelTag))
+		{
+			if (const UFunction* const Signature = Cached->Get())
+			{
+				return Signature;
+			}
+		}
+
+		for (TObjectIterator<UEventBusRegistryAsset> It; It; ++It)
+		{
+			for (const FEventBusPublisherHistoryEntry& Entry : It->PublisherHistory)
+			{
+				if (Entry.ChannelTag != ChannelTag || !Entry.PublisherClass)
+				{
+					continue;
+				}
+
+				const FMulticastDelegateProperty* const DelegateProperty =
+					FindFProperty<FMulticastDelegateProperty>(Entry.PublisherClass.Get(), Entry.DelegatePropertyName);
+				if (DelegateProperty && DelegateProperty->SignatureFunction)
+				{
+					Signatures.Add(ChannelTag, DelegateProperty->SignatureFunction);
+					return DelegateProperty->SignatureFunction;
+				}
+			}
+
+			for (const FEventBusBakedPublisherEntry& Entry : It->BakedPublishers)
+			{
+				const UClass* const PublisherClass = Entry.ChannelTag == ChannelTag ? Entry.PublisherClassPath.ResolveClass() : nullptr;
+				const FMulticastDelegateProperty* const DelegateProperty =
+					PublisherClass ? FindFProperty<FMulticastDelegateProperty>(PublisherClass, Entry.DelegatePropertyName) : nullptr;
+				if (DelegateProperty && DelegateProperty->SignatureFunction)
+				{
+					Signatures.Add(ChannelTag, DelegateProperty->SignatureFunction);
+					return DelegateProperty->SignatureFunction;
+				}
+			}
+		}
+
+		TArray<EventBusTopology::FEntry> IndexEntries;
+		EventBusTopology::FIndex::Get().GetChannelEntries(ChannelTag, IndexEntries);
+		for (const EventBusTopology::FEntry& Entry : IndexEntries)
+		{
+			const UClass* const PublisherClass = Entry.bListener ? nullptr : FindObject<UClass>(Entry.ObjectClassPath);
+			const FMulticastDelegateProperty* const DelegateProperty =
+				PublisherClass ? FindFProperty<FMulticastDelegateProperty>(PublisherClass, Entry.MemberName) : nullptr;
+			if (DelegateProperty && DelegateProperty->SignatureFunction)
+			{
+				Signatures.Add(ChannelTag, DelegateProperty->SignatureFunction);
+				return DelegateProperty->SignatureFunction;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void Invalidate()
+	{
+		FPickerCacheState& State = GetState();
+		State.Options.Reset();
+		State.ChannelSignatures.Reset();
+	}
+
+	/**
+	 * @brief Any compile can change a class's functions or a delegate's signature, so the whole cache is dropped.
+	 */
+	void Startup()
+	{
+		FPickerCacheState& State = GetState();
+		if (GEditor)
+		{
+			State.BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddStatic(&Invalidate);
+		}
+		State.ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason)
+		{
+			Invalidate();
+		});
+	}
+
+	void Shutdown()
+	{
+		FPickerCacheState& State = GetState();
+		if (GEditor)
+		{
+			GEditor->OnBlueprintCompiled().Remove(State.BlueprintCompiledHandle);
+		}
+		FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(State.ReloadCompleteHandle);
+		State.BlueprintCompiledHandle.Reset();
+		State.ReloadCompleteHandle.Reset();
+		Invalidate();
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+class UClass;
+class UFunction;
+
+namespace EventBusPickerCache
+{
+	/**
+	 * @brief Returns sorted listener function options on ListenerClass, filtered to ChannelSignature when known.
+	 * Without a signature every Blueprint-callable function is listed.
+	 */
+	const TArray<TSharedPtr<FName>>& GetListenerFunctionOptions(UClass* ListenerClass, const UFunction* ChannelSignature);
+
+	/**
+	 * @brief Returns sorted multicast delegate options on PublisherClass, filtered to ChannelSignature when known.
+	 */
+	const TArray<TSharedPtr<FName>>& GetPublisherDelegateOptions(UClass* PublisherClass, const UFunction* ChannelSignature);
+
+	/**
+	 * @brief Returns the delegate signature recorded for ChannelTag by any loaded registry, or nullptr when unknown.
+	 */
+	const UFunction* FindChannelSignature(const FGameplayTag& ChannelTag);
+
+	/** @brief Drops every cached option list and channel signature. */
+	void Invalidate();
+
+	/** @brief Hooks Invalidate to Blueprint compiles and reloads. */
+	void Startup();
+
+	/** @brief Removes the hooks installed by Startup. */
+	void Shutdown();
+}
@@ -4,8 +4,11 @@
 #include "BlueprintNodeSpawner.h"
 #include "EdGraph/EdGraphPin.h"
 #include "EventBus/BP/EventBusBlueprintLibrary.h"
+#include "EdGraphSchema_K2.h"
+#include "KismetCompiler.h"
+#include "K2Nodes/EventBusBindingProof.h"
 #include "K2Nodes/EventBusK2NodeUtils.h"
-#include "UObject/FieldIterator.h"
+#include "K2Nodes/EventBusPickerCache.h"
 
 #define LOCTEXT_NAMESPACE "EventBusK2NodeAddListenerValidated"
 
@@ -61,7 +64,7 @@ void UK2Node_EventBusAddListenerValidated::GetMenuActions(FBlueprintActionDataba
 }
 
 /**
- * @brief Builds list picker entries from Blueprint-callable functions declared on selected listener class.
+ * @brief Returns cached picker entries for the listener class, narrowed to the channel's signature when one is known.
  */
 void UK2Node_EventBusAddListenerValidated::BuildFunctionOptions(
 	const UEdGraphPin* FunctionNamePin,
@@ -87,44 +90,55 @@ void UK2Node_EventBusAddListenerValidated::BuildFunctionOptions(
 		return;
 	}
 
-	TSet<FName> UniqueNames;
-	for (TFieldIterator<UFunction> It(ListenerClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	const FGameplayTag ChannelTag = EventBusK2NodeUtils::ReadLiteralChannelTag(OwningNode->FindPin(EventBusK2NodeUtils::ChannelTagPinName));
+	OutOptions = EventBusPickerCache::GetListenerFunctionOptions(ListenerClass, EventBusPickerCache::FindChannelSignature(ChannelTag));
+}
+
+/**
+ * @brief Surfaces provably failing binds at compile time; unprovable inputs are left to the runtime checks.
+ */
+void UK2Node_EventBusAddListenerValidated::ValidateNodeDuringCompilation(FCompilerResultsLog& MessageLog) const
+{
+	Super::ValidateNodeDuringCompilation(MessageLog);
+
+	const EventBusBindingProof::FProof Proof = EventBusBindingProof::ProveListenerBinding(*this, ListenerObjPinName, FunctionNamePinName);
+	if (Proof.Result == EventBusBindingProof::EProofResult::Invalid)
 	{
-		const UFunction* const Function = *It;
-		if (!Function)
-		{
-			continue;
-		}
+		MessageLog.Warning(*Proof.Message.ToString(), this);
+	}
+}
 
-		if (!Function->HasAnyFunctionFlags(FUNC_BlueprintCallable | FUNC_BlueprintEvent))
-		{
-			continue;
-		}
+/**
+ * @brief Swaps the validated call for the trusted entry point when the bind was proven, moving every pin across.
+ */
+void UK2Node_EventBusAddListenerValidated::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	const EventBusBindingProof::FProof Proof = EventBusBindingProof::ProveListenerBinding(*this, ListenerObjPinName, FunctionNamePinName);
+	UFunction* const TrustedFunction = UEventBusBlueprintLibrary::StaticClass()->FindFunctionByName(
+		GET_FUNCTION_NAME_CHECKED(UEventBusBlueprintLibrary, AddListenerTrusted));
+	if (Proof.Result != EventBusBindingProof::EProofResult::Proven || !TrustedFunction)
+	{
+		Super::ExpandNode(CompilerContext, SourceGraph);
+		return;
+	}
 
-		if (Function->HasAnyFunctionFlags(FUNC_Delegate))
-		{
-			continue;
-		}
+	UK2Node_CallFunction* const TrustedCall = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+	TrustedCall->SetFromFunction(TrustedFunction);
+	TrustedCall->AllocateDefaultPins();
 
-		const FName FunctionName = Function->GetFName();
-		if (FunctionName.IsNone() || FunctionName.ToString().StartsWith(TEXT("ExecuteUbergraph_")))
+	for (UEdGraphPin* const Pin : Pins)
+	{
+		if (UEdGraphPin* const TrustedPin = TrustedCall->FindPin(Pin->PinName, Pin->Direction))
 		{
-			continue;
+			CompilerContext.MovePinLinksToIntermediate(*Pin, *TrustedPin);
 		}
-
-		UniqueNames.Add(FunctionName);
 	}
 
-	TArray<FName> SortedNames = UniqueNames.Array();
-	SortedNames.Sort([](const FName& A, const FName& B)
-	{
-		return A.Compare(B) < 0;
-	});
+	FString TokenText;
+	FEventBusBindingToken::StaticStruct()->ExportText(TokenText, &Proof.Token, nullptr, nullptr, PPF_None, nullptr);
+	GetDefault<UEdGraphSchema_K2>()->TrySetDefaultValue(*TrustedCall->FindPinChecked(TEXT("Token")), TokenText);
 
-	for (const FName Name : SortedNames)
-	{
-		OutOptions.Add(MakeShared<FName>(Name));
-	}
+	BreakAllNodeLinks();
 }
 
 #undef LOCTEXT_NAMESPACE
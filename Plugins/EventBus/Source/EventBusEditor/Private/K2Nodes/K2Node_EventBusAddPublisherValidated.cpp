@@ -4,9 +4,11 @@
 #include "BlueprintNodeSpawner.h"
 #include "EdGraph/EdGraphPin.h"
 #include "EventBus/BP/EventBusBlueprintLibrary.h"
+#include "EdGraphSchema_K2.h"
+#include "KismetCompiler.h"
+#include "K2Nodes/EventBusBindingProof.h"
 #include "K2Nodes/EventBusK2NodeUtils.h"
-#include "UObject/FieldIterator.h"
-#include "UObject/UnrealType.h"
+#include "K2Nodes/EventBusPickerCache.h"
 
 #define LOCTEXT_NAMESPACE "EventBusK2NodeAddPublisherValidated"
 
@@ -62,7 +64,7 @@ void UK2Node_EventBusAddPublisherValidated::GetMenuActions(FBlueprintActionDatab
 }
 
 /**
- * @brief Builds list picker entries from delegate properties declared on selected publisher class.
+ * @brief Returns cached picker entries for the publisher class, narrowed to the channel's signature when one is known.
  */
 void UK2Node_EventBusAddPublisherValidated::BuildDelegateOptions(
 	const UEdGraphPin* DelegatePin,
@@ -88,32 +90,55 @@ void UK2Node_EventBusAddPublisherValidated::BuildDelegateOptions(
 		return;
 	}
 
-	TSet<FName> UniqueNames;
-	for (TFieldIterator<FMulticastDelegateProperty> It(PublisherClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
-	{
-		const FMulticastDelegateProperty* const DelegateProperty = *It;
-		if (!DelegateProperty)
-		{
-			continue;
-		}
+	const FGameplayTag ChannelTag = EventBusK2NodeUtils::ReadLiteralChannelTag(OwningNode->FindPin(EventBusK2NodeUtils::ChannelTagPinName));
+	OutOptions = EventBusPickerCache::GetPublisherDelegateOptions(PublisherClass, EventBusPickerCache::FindChannelSignature(ChannelTag));
+}
 
-		const FName PropertyName = DelegateProperty->GetFName();
-		if (!PropertyName.IsNone())
-		{
-			UniqueNames.Add(PropertyName);
-		}
+/**
+ * @brief Surfaces provably failing binds at compile time; unprovable inputs are left to the runtime checks.
+ */
+void UK2Node_EventBusAddPublisherValidated::ValidateNodeDuringCompilation(FCompilerResultsLog& MessageLog) const
+{
+	Super::ValidateNodeDuringCompilation(MessageLog);
+
+	const EventBusBindingProof::FProof Proof = EventBusBindingProof::ProvePublisherBinding(*this, PublisherObjPinName, DelegatePropertyPinName);
+	if (Proof.Result == EventBusBindingProof::EProofResult::Invalid)
+	{
+		MessageLog.Warning(*Proof.Message.ToString(), this);
 	}
+}
 
-	TArray<FName> SortedNames = UniqueNames.Array();
-	SortedNames.Sort([](const FName& A, const FName& B)
+/**
+ * @brief Swaps the validated call for the trusted entry point when the bind was proven, moving every pin across.
+ */
+void UK2Node_EventBusAddPublisherValidated::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	const EventBusBindingProof::FProof Proof = EventBusBindingProof::ProvePublisherBinding(*this, PublisherObjPinName, DelegatePropertyPinName);
+	UFunction* const TrustedFunction = UEventBusBlueprintLibrary::StaticClass()->FindFunctionByName(
+		GET_FUNCTION_NAME_CHECKED(UEventBusBlueprintLibrary, AddPublisherTrusted));
+	if (Proof.Result != EventBusBindingProof::EProofResult::Proven || !TrustedFunction)
 	{
-		return A.Compare(B) < 0;
-	});
+		Super::ExpandNode(CompilerContext, SourceGraph);
+		return;
+	}
 
-	for (const FName Name : SortedNames)
+	UK2Node_CallFunction* const TrustedCall = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+	TrustedCall->SetFromFunction(TrustedFunction);
+	TrustedCall->AllocateDefaultPins();
+
+	for (UEdGraphPin* const Pin : Pins)
 	{
-		OutOptions.Add(MakeShared<FName>(Name));
+		if (UEdGraphPin* const TrustedPin = TrustedCall->FindPin(Pin->PinName, Pin->Direction))
+		{
+			CompilerContext.MovePinLinksToIntermediate(*Pin, *TrustedPin);
+		}
 	}
+
+	FString TokenText;
+	FEventBusBindingToken::StaticStruct()->ExportText(TokenText, &Proof.Token, nullptr, nullptr, PPF_None, nullptr);
+	GetDefault<UEdGraphSchema_K2>()->TrySetDefaultValue(*TrustedCall->FindPinChecked(TEXT("Token")), TokenText);
+
+	BreakAllNodeLinks();
 }
 
 #undef LOCTEXT_NAMESPACE
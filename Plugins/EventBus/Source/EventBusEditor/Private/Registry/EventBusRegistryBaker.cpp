@@ -0,0 +1,190 @@
+#include "Registry/EventBusRegistryBaker.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/PackageName.h"
+#include "Settings/ProjectPackagingSettings.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "UObject/UObjectIterator.h"
+
+#include "EventBus/BP/EventBusRegistryAsset.h"
+#include "EventBus/BP/EventBusSettings.h"
+#include "K2Nodes/EventBusK2NodeUtils.h"
+
+namespace EventBusRegistryBaker
+{
+	namespace
+	{
+		const TCHAR* const DefaultBakedRegistryPath = TEXT("/Game/EventBus/EventBusBakedRegistry");
+
+		/** @brief `EventBus.Registry.Bake [PackagePath] [live]`: writes the baked registry asset. */
+		FAutoConsoleCommandWithArgsAndOutputDevice GEventBusRegistryBakeCommand(
+			TEXT("EventBus.Registry.Bake"),
+			TEXT("Scans Blueprints for EventBus binds and saves them as the baked registry (default /Game/EventBus/EventBusBakedRegistry). 'live' also merges running PIE history."),
+			FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic([](const TArray<FString>& Args, FOutputDevice& Ar)
+			{
+				FString PackagePath = DefaultBakedRegistryPath;
+				bool bIncludeLiveHistory = false;
+				for (const FString& Arg : Args)
+				{
+					if (Arg.Equals(TEXT("live"), ESearchCase::IgnoreCase))
+					{
+						bIncludeLiveHistory = true;
+					}
+					else
+					{
+						PackagePath = Arg;
+					}
+				}
+
+				Bake(PackagePath, bIncludeLiveHistory, Ar);
+			}));
+	}
+
+	/**
+	 * @brief Loads every Blueprint asset and walks its graphs; loading is what makes this an explicit editor step.
+	 */
+	int32 ScanBlueprints(UEventBusRegistryAsset& Registry)
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		AssetRegistry.SearchAllAssets(true);
+
+		TArray<FAssetData> BlueprintAssets;
+		AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), BlueprintAssets, true);
+
+		TArray<EventBusK2NodeUtils::FLiteralBind> Binds;
+		for (const FAssetData& AssetData : BlueprintAssets)
+		{
+			if (const UBlueprint* const Blueprint = Cast<UBlueprint>(AssetData.GetAsset()))
+			{
+				EventBusK2NodeUtils::CollectLiteralBinds(*Blueprint, Binds);
+			}
+		}
+
+		for (const EventBusK2NodeUtils::FLiteralBind& Bind : Binds)
+		{
+			if (Bind.bListener)
+			{
+				Registry.RecordListenerBinding(Bind.ChannelTag, Bind.ObjectClass, Bind.MemberName);
+			}
+			else
+			{
+				Registry.RecordPublisherBinding(Bind.ChannelTag, Bind.ObjectClass, Bind.MemberName);
+			}
+		}
+		return Binds.Num();
+	}
+
+	/**
+	 * @brief Merges transient runtime registries; saved registry assets are skipped so bakes never feed on themselves.
+	 */
+	int32 MergeLiveHistory(UEventBusRegistryAsset& Registry)
+	{
+		int32 MergedCount = 0;
+		for (TObjectIterator<UEventBusRegistryAsset> It; It; ++It)
+		{
+			const UEventBusRegistryAsset* const LiveRegistry = *It;
+			if (LiveRegistry == &Registry ||
+				LiveRegistry->HasAnyFlags(RF_ClassDefaultObject) ||
+				!LiveRegistry->HasAnyFlags(RF_Transient))
+			{
+				continue;
+			}
+
+			for (const FEventBusPublisherHistoryEntry& Entry : LiveRegistry->PublisherHistory)
+			{
+				Registry.RecordPublisherBinding(Entry.ChannelTag, Entry.PublisherClass.Get(), Entry.DelegatePropertyName);
+				++MergedCount;
+			}
+
+			for (const FEventBusListenerHistoryEntry& Entry : LiveRegistry->ListenerHistory)
+			{
+				for (const FName FunctionName : Entry.KnownFunctions)
+				{
+					Registry.RecordListenerBinding(Entry.ChannelTag, Entry.ListenerClass.Get(), FunctionName);
+					++MergedCount;
+				}
+			}
+		}
+		return MergedCount;
+	}
+
+	/**
+	 * @brief Settings hold the baked registry as a soft reference, which the cooker does not follow.
+	 */
+	bool AddAlwaysCookDirectory(const FString& PackagePath)
+	{
+		const FString Directory = FPackageName::GetLongPackagePath(PackagePath);
+		UProjectPackagingSettings* const PackagingSettings = GetMutableDefault<UProjectPackagingSettings>();
+		const bool bAlreadyCooked = PackagingSettings->DirectoriesToAlwaysCook.ContainsByPredicate([&Directory](const FDirectoryPath& Entry)
+		{
+			return Entry.Path.Equals(Directory, ESearchCase::IgnoreCase);
+		});
+		if (bAlreadyCooked)
+		{
+			return false;
+		}
+
+		FDirectoryPath& NewEntry = PackagingSettings->DirectoriesToAlwaysCook.AddDefaulted_GetRef();
+		NewEntry.Path = Directory;
+		PackagingSettings->TryUpdateDefaultConfigFile();
+		return true;
+	}
+
+	/**
+	 * @brief Builds the history in a scratch registry, then copies it into the asset so a failed scan never leaves
+	 * a half-written asset in memory.
+	 */
+	bool Bake(const FString& PackagePath, const bool bIncludeLiveHistory, FOutputDevice& Ar)
+	{
+		if (!FPackageName::IsValidLongPackageName(PackagePath))
+		{
+			Ar.Logf(TEXT("EventBus.Registry.Bake failed: '%s' is not a valid long package name."), *PackagePath);
+			return false;
+		}
+
+		UEventBusRegistryAsset* const Scratch = NewObject<UEventBusRegistryAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+		const int32 ScannedCount = ScanBlueprints(*Scratch);
+		const int32 MergedCount = bIncludeLiveHistory ? MergeLiveHistory(*Scratch) : 0;
+
+		UPackage* const Package = CreatePackage(*PackagePath);
+		Package->FullyLoad();
+		const FString AssetName = FPackageName::GetLongPackageAssetName(PackagePath);
+		UEventBusRegistryAsset* Asset = FindObject<UEventBusRegistryAsset>(Package, *AssetName);
+		if (!Asset)
+		{
+			Asset = NewObject<UEventBusRegistryAsset>(Package, FName(*AssetName), RF_Public | RF_Standalone);
+			FAssetRegistryModule::AssetCreated(Asset);
+		}
+
+		Asset->BakeFrom(*Scratch);
+		Package->MarkPackageDirty();
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		SaveArgs.SaveFlags = SAVE_NoError;
+		const FString Filename = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
+		if (!UPackage::SavePackage(Package, Asset, *Filename, SaveArgs))
+		{
+			Ar.Logf(TEXT("EventBus.Registry.Bake failed: could not save '%s'."), *Filename);
+			return false;
+		}
+
+		UEventBusSettings* const Settings = GetMutableDefault<UEventBusSettings>();
+		Settings->BakedRegistry = Asset;
+		Settings->TryUpdateDefaultConfigFile();
+		const bool bAddedCookDirectory = AddAlwaysCookDirectory(PackagePath);
+
+		Ar.Logf(TEXT("EventBus.Registry.Bake wrote %s. ScannedBinds=%d LiveEntries=%d Publishers=%d Listeners=%d AddedAlwaysCookDirectory=%d"),
+			*PackagePath,
+			ScannedCount,
+			MergedCount,
+			Asset->BakedPublishers.Num(),
+			Asset->BakedListeners.Num(),
+			bAddedCookDirectory ? 1 : 0);
+		return true;
+	}
+}
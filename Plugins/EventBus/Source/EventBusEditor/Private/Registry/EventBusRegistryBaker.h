@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FOutputDevice;
+class UEventBusRegistryAsset;
+
+namespace EventBusRegistryBaker
+{
+	/**
+	 * @brief Records every EventBus bind node with literal channel and member pins found in project Blueprints.
+	 * Returns the number of binds recorded.
+	 */
+	int32 ScanBlueprints(UEventBusRegistryAsset& Registry);
+
+	/**
+	 * @brief Merges every live runtime registry, such as a running PIE session's, into Registry.
+	 * Returns the number of entries merged.
+	 */
+	int32 MergeLiveHistory(UEventBusRegistryAsset& Registry);
+
+	/**
+	 * @brief Adds the directory of PackagePath to the project's DirectoriesToAlwaysCook so packaged builds ship it.
+	 * Returns false when the directory was already listed.
+	 */
+	bool AddAlwaysCookDirectory(const FString& PackagePath);
+
+	/**
+	 * @brief Scans Blueprints (and live history when requested), saves the result as class paths in a registry
+	 * asset at PackagePath, points UEventBusSettings::BakedRegistry at it and makes sure it is cooked.
+	 */
+	bool Bake(const FString& PackagePath, bool bIncludeLiveHistory, FOutputDevice& Ar);
+}
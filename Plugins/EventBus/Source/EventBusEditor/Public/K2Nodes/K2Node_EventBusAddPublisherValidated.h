@@ -21,6 +21,10 @@ public:
 	virtual FText GetTooltipText() const override;
 	virtual FText GetMenuCategory() const override;
 	virtual void GetMenuActions(class FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
+	/** @brief Warns when literal inputs name a missing delegate or one incompatible with the channel signature. */
+	virtual void ValidateNodeDuringCompilation(class FCompilerResultsLog& MessageLog) const override;
+	/** @brief Compiles to `AddPublisherTrusted` with a pre-resolved token when the literal inputs were proven. */
+	virtual void ExpandNode(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
 
 	/**
 	 * @brief Builds dropdown options for DelegatePropertyName pin from selected publisher class.
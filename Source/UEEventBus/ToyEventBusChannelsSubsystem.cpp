@@ -35,10 +35,12 @@ void UToyEventBusChannelsSubsystem::Initialize(FSubsystemCollectionBase& Collect
 	}
 
 	Nfrrlib::EventBus::FEventBus& Bus = EventBusSubsystem->GetEventBus();
-	const bool bHealthRegistered = Nfrrlib::EventBus::TEventChannelApi<FToyHealthChangedChannel>::Register(Bus, false);
-	const bool bStaminaRegistered = Nfrrlib::EventBus::TEventChannelApi<FToyStaminaChangedChannel>::Register(Bus, false);
+	const bool bChannelsRegistered =
+		Nfrrlib::EventBus::RegisterEventChannels<FToyHealthChangedChannel, FToyStaminaChangedChannel>(Bus, false);
+	const bool bHealthRegistered = Nfrrlib::EventBus::TEventChannelApi<FToyHealthChangedChannel>::IsRegistered(Bus);
+	const bool bStaminaRegistered = Nfrrlib::EventBus::TEventChannelApi<FToyStaminaChangedChannel>::IsRegistered(Bus);
 
-	if (!bHealthRegistered || !bStaminaRegistered)
+	if (!bChannelsRegistered)
 	{
 		UE_LOG(LogNFLEventBus, Warning,
 			TEXT("ToyEventBusChannelsSubsystem::Initialize incomplete. HealthReg=%d StaminaReg=%d"),